@@ -102,6 +102,51 @@ internal sealed class ConsoleBenchmarkSink : IBenchmarkSink
         Console.WriteLine($"\r│  Trial {trialNumber}: {FormatThroughput(result.BytesPerSecond)} " +
                          $"({FormatIops(result.Iops)}) - Lat: p50={result.Latency.P50Us:F1}µs, " +
                          $"p99={result.Latency.P99Us:F1}µs                    ");
+
+        if (result.Placement != null && trialNumber == 1)
+        {
+            Console.WriteLine($"│    Placement: {result.Placement}");
+            foreach (var note in result.Placement.Notes)
+            {
+                Console.WriteLine($"│      {note}");
+            }
+        }
+
+        var errors = result.Errors;
+        if (errors != null && (errors.Errors > 0 || errors.InjectedFaults > 0 || errors.ShortTransfers > 0))
+        {
+            Console.WriteLine($"│    Errors: {errors.Errors} ({errors.Retries} retries, {errors.Recovered} recovered, " +
+                             $"{errors.Failed} failed), short transfers: {errors.ShortTransfers}, injected: {errors.InjectedFaults}");
+            if (errors.RetryLatency != null)
+            {
+                Console.WriteLine($"│    Retried IO latency: p50={errors.RetryLatency.P50Us / 1000:F2}ms, " +
+                                 $"max={errors.RetryLatency.MaxUs / 1000:F2}ms");
+            }
+        }
+
+        var slowIos = result.SlowIos;
+        if (slowIos == null)
+        {
+            return;
+        }
+
+        if (slowIos.Slowest.Count > 0)
+        {
+            var worst = slowIos.Slowest[0];
+            Console.WriteLine($"│    Slowest IO: {worst.LatencyUs / 1000:F2}ms {(worst.IsWrite ? "write" : "read")} " +
+                             $"at offset {worst.Offset} (slot {worst.Slot})");
+        }
+
+        if (slowIos.OverThresholdCount > 0)
+        {
+            Console.WriteLine($"│    {slowIos.OverThresholdCount} IO(s) over the slow threshold");
+        }
+
+        foreach (var stuck in slowIos.Stuck)
+        {
+            OnWarning($"IO stuck for {stuck.LatencyUs / 1000:F0}ms: {(stuck.IsWrite ? "write" : "read")} " +
+                      $"{stuck.Size} bytes at offset {stuck.Offset}");
+        }
     }
 
     public void OnWorkloadComplete(WorkloadSpec workload, WorkloadResult result)
@@ -122,6 +167,37 @@ internal sealed class ConsoleBenchmarkSink : IBenchmarkSink
                              $"{FormatThroughput(result.ThroughputCI.Value.Upper)}]");
         }
 
+        if (result.LatencyCI != null)
+        {
+            // Bootstrap bounds; percentiles resting on too few tail samples are marked
+            var shown = result.LatencyCI.Where(ci => ci.Percentile is 50 or 99 or 99.9)
+                .Select(ci => $"p{ci.Percentile}=[{ci.LowerUs:F1}, {ci.UpperUs:F1}]µs{(ci.InsufficientSamples ? "*" : "")}");
+            Console.WriteLine($"│  Lat. CI:    {string.Join(", ", shown)}");
+        }
+
+        if (result.Energy != null)
+        {
+            Console.WriteLine($"│  Energy:     {result.Energy.AverageWatts:F1} W, " +
+                             $"{result.Energy.IopsPerWatt:F0} IOPS/W, " +
+                             $"{result.Energy.JoulesPerGigabyte:F1} J/GB");
+        }
+
+        if (result.WriteBack is { Count: > 0 } writeBack)
+        {
+            var stalls = writeBack.Sum(w => w.Stalls.Count);
+            Console.WriteLine($"│  Write-back: app {FormatThroughput(writeBack.Average(w => w.ApplicationBytesPerSecond))}, " +
+                             $"device {FormatThroughput(writeBack.Average(w => w.DeviceBytesPerSecond))}, " +
+                             $"peak dirty {FormatSize(writeBack.Max(w => w.PeakDirtyBytes))}");
+            Console.WriteLine($"│  Stalls:     {stalls}{(writeBack.Any(w => w.StallsTruncated) ? "+" : "")} " +
+                             $"(longest {writeBack.Max(w => w.LongestStallUs) / 1000:F0} ms, " +
+                             $"{writeBack.Average(w => w.StallFraction) * 100:F1}% of time stalled)");
+        }
+
+        foreach (var slo in result.Objectives ?? [])
+        {
+            PrintObjective(slo);
+        }
+
         Console.WriteLine($"└─────────────────────────────────────────────────────────────────");
         Console.WriteLine();
     }
@@ -150,6 +226,50 @@ internal sealed class ConsoleBenchmarkSink : IBenchmarkSink
         Console.WriteLine($"System: {result.SystemInfo?.OsVersion}");
         Console.WriteLine($"Processors: {result.SystemInfo?.LogicalProcessors}");
         Console.WriteLine($"Memory: {FormatSize(result.SystemInfo?.TotalMemoryBytes ?? 0)}");
+
+        if (result.ObjectivesPassed.HasValue)
+        {
+            Console.ForegroundColor = result.ObjectivesPassed.Value ? ConsoleColor.Green : ConsoleColor.Red;
+            Console.WriteLine($"Objectives: {(result.ObjectivesPassed.Value ? "all passed" : "FAILED")}");
+            Console.ResetColor();
+        }
+    }
+
+    private static void PrintObjective(SloResult slo)
+    {
+        var objective = slo.Objective;
+        string Format(double value) => objective.Metric switch
+        {
+            SloMetric.Latency => $"{value:F0}µs",
+            SloMetric.Iops => $"{FormatIops(value)} IOPS",
+            _ => FormatThroughput(value)
+        };
+
+        Console.ForegroundColor = slo.Passed ? ConsoleColor.Green : ConsoleColor.Red;
+        Console.WriteLine($"│  SLO {(slo.Passed ? "PASS" : "FAIL")}:   {objective}");
+        Console.ResetColor();
+
+        var detail = $"│    worst trial {Format(slo.WorstTrialValue)}, {slo.TrialsFailed} trial(s) failed";
+        if (slo.IntervalsEvaluated > 0)
+        {
+            detail += $", {slo.IntervalsViolated}/{slo.IntervalsEvaluated} intervals violated";
+        }
+        if (slo.ErrorBudgetConsumed.HasValue)
+        {
+            detail += $", {slo.ErrorBudgetConsumed.Value:P0} of error budget";
+        }
+        Console.WriteLine(detail);
+
+        const int maxWindows = 5;
+        foreach (var window in slo.Violations.Take(maxWindows))
+        {
+            Console.WriteLine($"│    trial {window.TrialNumber} {window.StartSecond}s-{window.StartSecond + window.Seconds}s: " +
+                             $"worst {Format(window.WorstValue)}");
+        }
+        if (slo.Violations.Count > maxWindows)
+        {
+            Console.WriteLine($"│    ... {slo.Violations.Count - maxWindows} more violation window(s)");
+        }
     }
 
     public void OnError(string message, Exception? exception = null)
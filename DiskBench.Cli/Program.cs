@@ -1,7 +1,10 @@
+using System.Diagnostics;
 using System.Globalization;
+using System.Text;
 using System.Text.Json;
 using System.Text.Json.Serialization;
 using DiskBench.Core;
+using DiskBench.Metrics;
 using DiskBench.Win32;
 
 namespace DiskBench.Cli;
@@ -11,6 +14,12 @@ namespace DiskBench.Cli;
 /// </summary>
 internal static class Program
 {
+    /// <summary>
+    /// Exit code when the command ran but a check failed: a service level objective,
+    /// or anomalous regions in a surface scan.
+    /// </summary>
+    private const int CheckFailedExitCode = 2;
+
     /// <summary>
     /// Entry point.
     /// </summary>
@@ -27,7 +36,18 @@ internal static class Program
         {
             "run" => await RunCommandAsync(args[1..]).ConfigureAwait(false),
             "quick" => await QuickCommandAsync(args[1..]).ConfigureAwait(false),
+            "probe" => await ProbeCommandAsync(args[1..]).ConfigureAwait(false),
             "profile" => await ProfileCommandAsync(args[1..]).ConfigureAwait(false),
+            "predict" => await PredictCommandAsync(args[1..]).ConfigureAwait(false),
+            "compare" => await CompareCommandAsync(args[1..]).ConfigureAwait(false),
+            "pressure" => await PressureCommandAsync(args[1..]).ConfigureAwait(false),
+            "interfere" => await InterfereCommandAsync(args[1..]).ConfigureAwait(false),
+            "copy" => await CopyCommandAsync(args[1..]).ConfigureAwait(false),
+            "files" => await FilesCommandAsync(args[1..]).ConfigureAwait(false),
+            "shape" => await ShapeCommandAsync(args[1..]).ConfigureAwait(false),
+            "scan" => await ScanCommandAsync(args[1..]).ConfigureAwait(false),
+            "cache" => await CacheCommandAsync(args[1..]).ConfigureAwait(false),
+            "trace" => TraceCommand(args[1..]),
             "profiles" => ListProfiles(),
             "info" => InfoCommand(args[1..]),
             "-h" or "--help" or "help" => PrintUsage(),
@@ -45,8 +65,19 @@ internal static class Program
             Commands:
               run       Run a benchmark with specified options
               quick     Run a quick benchmark with common workloads
+              probe     Estimate drive performance in ~2 seconds (fleet screening)
               profile   Run a usage profile benchmark (real-world patterns)
               profiles  List all available usage profiles
+              predict   Predict every profile from a short basis run (fleet screening)
+              compare   Run the same benchmark in several directories and compare them
+              pressure  Run buffered workloads with the page cache squeezed to several sizes
+              interfere Run workloads next to CPU and memory stressors (noisy neighbours)
+              copy      Compare file copy strategies (buffered, unbuffered, system copy, clone)
+              files     Spread the benchmark over growing sets of open files
+              shape     Search block size, queue depth and threads for the cheapest fast IO shape
+              scan      Read the whole target and map throughput and latency per region
+              cache     Simulate page caches on a workload's offset stream (miss ratio curves)
+              trace     Query a per-IO trace recorded with run --trace
               info      Display disk information
 
             Profile Command (simplest):
@@ -63,6 +94,7 @@ internal static class Program
                 -t, --trials <n>       Number of trials per workload (default: 3)
                 -d, --duration <sec>   Measured duration in seconds (default: 30)
                 -o, --output <file>    Output JSON file for results
+                --slo <objective>      Service level objective for every workload (repeatable)
 
             Run Command (advanced):
               diskbench run [options]
@@ -74,16 +106,177 @@ internal static class Program
                 -d, --duration <sec>   Measured duration in seconds (default: 30)
                 -w, --warmup <sec>     Warmup duration in seconds (default: 5)
                 -o, --output <file>    Output JSON file for results
+                -p, --plan <file>      Run a JSON plan (workloads, trials, durations) instead of the
+                                       built-in workloads, e.g. with custom IO generators
                 --buffered             Use buffered IO
+                --slow-ms <ms>         Log every IO slower than this (top 10 slowest always kept)
+                --writeback            Buffered write stall analysis: sample dirty/writeback pages
+                                       and compare app vs device throughput (implies --buffered)
+                --continue-on-error    Count failed IOs and retry them instead of aborting
+                --retries <n>          Retries per failed IO with --continue-on-error (default: 3)
+                --inject-errors <rate> Fail this fraction of IOs (e.g., 0.001) to test resilience
+                --inject-spikes <rate> Delay this fraction of IOs by 50 ms
+                --placement <auto|n>   Pin the IO thread: auto (from CPU/device topology) or CPU n
+                --slo <objective>      Service level objective for every workload (repeatable),
+                                       e.g. "p99<500us@99%", "iops>100k@99%", "mbps>500"
+                --trace <dir>          Record every measured IO to a columnar trace per trial
+                --content <mode>       Write test files with generated content: incompressible,
+                                       2:1 or text (default: zeros), for compressing storage
+                --unique <ratio>       Fraction of unique 4K blocks with --content (default: 1)
 
             Available Profiles:
               gaming, streaming, compiling, browsing, database,
               vm, fileserver, media, os, backup
 
+            Probe Command (screening):
+              diskbench probe [drive|path] [options]
+
+              Options:
+                -s, --size <size>      Probe file size (default: 128M)
+                -b, --budget <sec>     Total time budget in seconds (default: 2)
+                -o, --output <file>    Output JSON file for results
+
+            Compare Command (filesystems, mount options):
+              diskbench compare <dir> <dir> [dir...] [options]
+
+              Options:
+                -p, --profile <name>   Compare on a usage profile (default: run command workloads)
+                -s, --size <size>      Test file size (default: 1G, or profile-specific)
+                -t, --trials <n>       Number of trials per workload (default: 3)
+                -d, --duration <sec>   Measured duration in seconds (default: 30)
+                -o, --output <file>    Output JSON file for results
+
+            Pressure Command (page cache under memory pressure):
+              diskbench pressure [options]
+
+              Options:
+                -f, --file <path>      Target file path (default: diskbench_test.dat)
+                -s, --size <size>      Test file size (default: 1G)
+                -t, --trials <n>       Number of trials per workload (default: 3)
+                -d, --duration <sec>   Measured duration in seconds (default: 30)
+                --levels <list>        Cache budgets as fractions of the file size (default: 1,0.5,0.25)
+                -o, --output <file>    Output JSON file for results
+
+            Interfere Command (CPU and memory-bandwidth neighbours):
+              diskbench interfere [options]
+
+              Options:
+                -f, --file <path>      Target file path (default: diskbench_test.dat)
+                -s, --size <size>      Test file size (default: 1G)
+                -t, --trials <n>       Number of trials per workload (default: 3)
+                -d, --duration <sec>   Measured duration in seconds (default: 30)
+                --stress <kind>        int, avx, mem or cache (repeatable; default: all four)
+                --threads <n>          Threads per stressor (default: processor count - 1)
+                --levels <list>        Stressor intensities as busy fractions (default: 0.5,1)
+                --cpus <list>          Pin stressor threads to these processors (default: unpinned)
+                -o, --output <file>    Output JSON file for results
+
+            Copy Command (copy strategies):
+              diskbench copy [options]
+
+              Options:
+                -f, --file <path>      Source file, created if missing (default: diskbench_copy.dat)
+                --dest <path>          Destination file (default: source + .copy)
+                -s, --size <size>      Source file size (default: 1G)
+                -t, --trials <n>       Copies per strategy (default: 3)
+                -b, --block <size>     Buffer size for buffered and unbuffered copies (default: 1M)
+                -o, --output <file>    Output JSON file for results
+
+            Predict Command (profile scores from a short basis run):
+              diskbench predict --training <file|dir> [options]
+              diskbench predict --calibrate -o <file> [options]
+
+              Options:
+                --training <path>      Calibration results to learn from (JSON files or directories; repeatable)
+                --calibrate            Run the basis and every profile, and save the result as training data
+                --fit-only             Report the model's cross-validated error without running anything
+                -f, --file <path>      Target file path (default: diskbench_test.dat)
+                -s, --size <size>      Test file size (default: 1G)
+                -t, --trials <n>       Number of trials per workload (default: 1, calibrate: 3)
+                -d, --duration <sec>   Measured duration per workload (default: 5, calibrate: 30)
+                -o, --output <file>    Output JSON file for results
+
+            Files Command (open-handle scaling, file servers):
+              diskbench files [options]
+
+              Options:
+                -f, --file <path>      Base path of the files (default: diskbench_test.dat)
+                -s, --size <size>      Total data size, split over the files (default: 1G)
+                -t, --trials <n>       Number of trials per workload (default: 3)
+                -d, --duration <sec>   Measured duration in seconds (default: 30)
+                --counts <list>        File counts to run (default: 1,64,1024,16384)
+                --distribution <name>  How IO is spread over files: uniform or zipf (default: uniform)
+                -o, --output <file>    Output JSON file for results
+
+            Shape Command (optimal transfer size and queue depth):
+              diskbench shape [drive|path] [options]
+
+              Options:
+                -s, --size <size>      Test file size (default: 1G)
+                --random               Random instead of sequential IO
+                --write-percent <n>    Percentage of writes (default: 0)
+                --blocks <list>        Block sizes to search (default: 4K,16K,64K,256K,1M)
+                --qd <list>            Queue depths per thread (default: 1,2,4,8,16,32,64,128)
+                --threads <list>       Thread counts (default: 1,2,4)
+                -d, --duration <sec>   First-round measured duration per shape (default: 0.5)
+                --eta <n>              Keep 1/n of the shapes per round, measured n times longer (default: 3)
+                --rounds <n>           Maximum rounds (default: 4)
+                --target <fraction>    Fraction of peak throughput the cheapest shape must reach (default: 0.95)
+                -o, --output <file>    Output JSON file for results
+
+            Scan Command (surface map, degrading drives):
+              diskbench scan <file|drive|path> [options]
+
+              Options:
+                -s, --size <size>      Size to create if the file does not exist (default: existing size)
+                -r, --region <size>    Region size per map cell (default: 1G)
+                -b, --block <size>     IO size (default: 1M)
+                -q, --queue-depth <n>  Outstanding IOs (default: 32)
+                --write                Write every region before reading it (destroys the file's contents)
+                -o, --output <file>    Output JSON file for results
+
+            Cache Command (miss ratio curves, no IO is performed):
+              diskbench cache [options]
+
+              Options:
+                -p, --profile <name>   Analyse a usage profile's workloads (default: run command workloads)
+                -s, --size <size>      Test file size (default: 1G, or profile-specific)
+                -n, --references <n>   Cache block references per workload (default: 10000000)
+                -b, --block <size>     Cache block size (default: 4K)
+                --sampling <rate>      Fraction of blocks sampled (default: 0.01)
+                -o, --output <file>    Output JSON file for results
+
+            Trace Command (post-mortem queries over run --trace files):
+              diskbench trace <file.iotrace> [options]
+
+              Options:
+                --from <sec>           Only IOs submitted at or after this time into the measured window
+                --to <sec>             Only IOs submitted before this time
+                --min-offset <size>    Only IOs at or above this file offset
+                --max-offset <size>    Only IOs below this file offset
+                --min-latency <us>     Only IOs at or above this latency
+                --reads | --writes     Only reads or only writes
+                -n, --list <n>         Also print the first n matching IOs
+
+            Exit codes: 0 = success, 1 = error,
+                        2 = a service level objective failed or a scan found anomalous regions
+
             Examples:
               diskbench profile gaming
               diskbench profile database D:\test.dat -s 8G
               diskbench quick
+              diskbench probe D:\
+              diskbench predict --calibrate -f D:\test.dat -o calibration\drive42.json
+              diskbench predict --training calibration -f D:\test.dat
+              diskbench compare /mnt/ext4 /mnt/xfs /mnt/btrfs -p database
+              diskbench pressure -s 4G --levels 1,0.5,0.1
+              diskbench interfere --stress mem --stress avx --cpus 2,3
+              diskbench copy -f D:\src.dat --dest E:\dst.dat -s 8G
+              diskbench files -f D:\files\bench.dat -s 64G --counts 1,1000,50000 --distribution zipf
+              diskbench shape D:\ -s 8G --blocks 64K,128K,256K,1M --threads 1,2
+              diskbench scan D:\archive.dat -r 4G
+              diskbench cache -p database -s 64G
+              diskbench trace traces/workload1-trial1.iotrace --from 10 --to 12 --min-latency 5000
               diskbench info C:\
             """);
         return 0;
@@ -106,6 +299,18 @@ internal static class Program
         int warmup = 5;
         string? output = null;
         bool buffered = false;
+        bool writeBack = false;
+        double? slowMs = null;
+        bool continueOnError = false;
+        int retries = 3;
+        double errorRate = 0;
+        double spikeRate = 0;
+        var engineOptions = new WindowsIoEngineOptions();
+        var objectives = new List<ServiceLevelObjective>();
+        string? planFile = null;
+        string? traceDirectory = null;
+        PreparedContent? content = null;
+        double uniqueRatio = 1.0;
 
         for (int i = 0; i < args.Length; i++)
         {
@@ -129,15 +334,73 @@ internal static class Program
                 case "-o" or "--output":
                     output = args[++i];
                     break;
+                case "-p" or "--plan":
+                    planFile = args[++i];
+                    break;
                 case "--buffered":
                     buffered = true;
                     break;
+                case "--writeback":
+                    writeBack = true;
+                    buffered = true;
+                    break;
+                case "--slow-ms":
+                    slowMs = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "--continue-on-error":
+                    continueOnError = true;
+                    break;
+                case "--retries":
+                    retries = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "--inject-errors":
+                    errorRate = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "--inject-spikes":
+                    spikeRate = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "--placement":
+                    var placement = args[++i];
+                    engineOptions = placement.Equals("auto", StringComparison.OrdinalIgnoreCase)
+                        ? new WindowsIoEngineOptions { AutoPlacement = true }
+                        : new WindowsIoEngineOptions { PinToCore = int.Parse(placement, CultureInfo.InvariantCulture) };
+                    break;
+                case "--slo":
+                    objectives.Add(ServiceLevelObjective.Parse(args[++i]));
+                    break;
+                case "--trace":
+                    traceDirectory = args[++i];
+                    break;
+                case "--content":
+                    content = new PreparedContent { Mode = ParseContentMode(args[++i]) };
+                    break;
+                case "--unique":
+                    uniqueRatio = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
             }
         }
 
-        return await RunBenchmarkAsync(file, size, trials, duration, warmup, output, buffered).ConfigureAwait(false);
+        if (uniqueRatio != 1.0)
+        {
+            content = (content ?? new PreparedContent()) with { UniqueBlockRatio = uniqueRatio };
+        }
+
+        var errorPolicy = continueOnError ? new IoErrorPolicy { ContinueOnError = true, MaxRetries = retries } : null;
+        var faults = errorRate > 0 || spikeRate > 0
+            ? new FaultInjectionOptions { ErrorRate = errorRate, LatencySpikeRate = spikeRate }
+            : null;
+
+        return await RunBenchmarkAsync(file, size, trials, duration, warmup, output, buffered, writeBack, slowMs, errorPolicy, faults, engineOptions, objectives, planFile, traceDirectory, content).ConfigureAwait(false);
     }
 
+    private static ContentMode ParseContentMode(string mode) => mode.ToUpperInvariant() switch
+    {
+        "INCOMPRESSIBLE" or "RANDOM" => ContentMode.Incompressible,
+        "2:1" or "COMPRESSIBLE" => ContentMode.Compressible,
+        "TEXT" => ContentMode.Text,
+        _ => throw new FormatException($"Unknown content mode '{mode}' (use incompressible, 2:1 or text)")
+    };
+
     private static async Task<int> QuickCommandAsync(string[] args)
     {
         string? file = null;
@@ -168,6 +431,169 @@ internal static class Program
         return await RunQuickBenchmarkAsync(file, size).ConfigureAwait(false);
     }
 
+    private static async Task<int> ProbeCommandAsync(string[] args)
+    {
+        string? file = null;
+        string size = "128M";
+        double budget = 2;
+        string? output = null;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            var arg = args[i];
+            if (arg.StartsWith('-'))
+            {
+                switch (arg)
+                {
+                    case "-f" or "--file":
+                        file = args[++i];
+                        break;
+                    case "-s" or "--size":
+                        size = args[++i];
+                        break;
+                    case "-b" or "--budget":
+                        budget = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "-o" or "--output":
+                        output = args[++i];
+                        break;
+                }
+            }
+            else if (file == null)
+            {
+                file = arg;
+            }
+        }
+
+        file = GenerateTestFilePath(file, "probe");
+        return await RunProbeAsync(file, size, budget, output).ConfigureAwait(false);
+    }
+
+    private static async Task<int> ScanCommandAsync(string[] args)
+    {
+        string? file = null;
+        string? size = null;
+        string region = "1G";
+        string block = "1M";
+        int queueDepth = 32;
+        bool write = false;
+        string? output = null;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            var arg = args[i];
+            if (arg.StartsWith('-'))
+            {
+                switch (arg)
+                {
+                    case "-s" or "--size":
+                        size = args[++i];
+                        break;
+                    case "-r" or "--region":
+                        region = args[++i];
+                        break;
+                    case "-b" or "--block":
+                        block = args[++i];
+                        break;
+                    case "-q" or "--queue-depth":
+                        queueDepth = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "--write":
+                        write = true;
+                        break;
+                    case "-o" or "--output":
+                        output = args[++i];
+                        break;
+                }
+            }
+            else if (file == null)
+            {
+                file = arg;
+            }
+        }
+
+        if (file == null)
+        {
+            Console.Error.WriteLine("Error: A file, drive or directory to scan is required.");
+            Console.Error.WriteLine("Usage: diskbench scan <file|drive|path> [options]");
+            return 1;
+        }
+
+        var spec = new SurfaceScanSpec
+        {
+            FilePath = GenerateTestFilePath(file, "scan"),
+            FileSize = size != null ? ParseSize(size) : 0,
+            RegionSize = ParseSize(region),
+            BlockSize = (int)ParseSize(block),
+            QueueDepth = queueDepth,
+            Write = write
+        };
+
+        return await RunScanAsync(spec, output).ConfigureAwait(false);
+    }
+
+    private static async Task<int> CacheCommandAsync(string[] args)
+    {
+        string? profileName = null;
+        string? size = null;
+        long references = 10_000_000;
+        string block = "4K";
+        double sampling = 0.01;
+        string? output = null;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "-p" or "--profile":
+                    profileName = args[++i];
+                    break;
+                case "-s" or "--size":
+                    size = args[++i];
+                    break;
+                case "-n" or "--references":
+                    references = long.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-b" or "--block":
+                    block = args[++i];
+                    break;
+                case "--sampling":
+                    sampling = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-o" or "--output":
+                    output = args[++i];
+                    break;
+            }
+        }
+
+        BenchmarkPlan plan;
+        if (profileName != null)
+        {
+            var profile = ResolveProfile(profileName);
+            if (profile == null)
+            {
+                Console.Error.WriteLine($"Error: Unknown profile '{profileName}'");
+                Console.Error.WriteLine("Use 'diskbench profiles' to see available profiles.");
+                return 1;
+            }
+
+            plan = UsageProfiles.CreatePlan(
+                profile,
+                $"diskbench_{GetProfileShortName(profile.Type)}.dat",
+                size != null ? ParseSize(size) : null,
+                1,
+                TimeSpan.Zero,
+                TimeSpan.Zero);
+        }
+        else
+        {
+            plan = CreateDefaultPlan("diskbench_test.dat", ParseSize(size ?? "1G"), 1, 0, 0, true, null, null);
+        }
+
+        var options = new MissRatioCurveOptions { BlockSize = (int)ParseSize(block), SamplingRate = sampling };
+        return await RunCacheAnalysisAsync(plan, options, references, output).ConfigureAwait(false);
+    }
+
     private static async Task<int> ProfileCommandAsync(string[] args)
     {
         string? profileName = null;
@@ -176,6 +602,7 @@ internal static class Program
         int trials = 3;
         int duration = 30;
         string? output = null;
+        var objectives = new List<ServiceLevelObjective>();
 
         for (int i = 0; i < args.Length; i++)
         {
@@ -204,48 +631,1044 @@ internal static class Program
                     case "-o" or "--output":
                         output = args[++i];
                         break;
+                    case "--slo":
+                        objectives.Add(ServiceLevelObjective.Parse(args[++i]));
+                        break;
                 }
             }
             else if (profileName == null)
             {
-                // First positional argument is the profile name
-                profileName = arg;
+                // First positional argument is the profile name
+                profileName = arg;
+            }
+            else if (file == null)
+            {
+                // Second positional argument is the file path
+                file = arg;
+            }
+        }
+
+        if (string.IsNullOrEmpty(profileName))
+        {
+            Console.Error.WriteLine("Error: Profile name is required.");
+            Console.Error.WriteLine();
+            Console.Error.WriteLine("Usage: diskbench profile <name> [file] [options]");
+            Console.Error.WriteLine();
+            Console.Error.WriteLine("Examples:");
+            Console.Error.WriteLine("  diskbench profile gaming");
+            Console.Error.WriteLine("  diskbench profile gaming D:\\");
+            Console.Error.WriteLine("  diskbench profile gaming -s 4G -d 60");
+            Console.Error.WriteLine();
+            Console.Error.WriteLine("Use 'diskbench profiles' to see available profiles.");
+            return 1;
+        }
+
+        var profile = ResolveProfile(profileName);
+        if (profile == null)
+        {
+            Console.Error.WriteLine($"Error: Unknown profile '{profileName}'");
+            Console.Error.WriteLine("Use 'diskbench profiles' to see available profiles.");
+            return 1;
+        }
+
+        // Generate file path
+        file = GenerateTestFilePath(file, profileName);
+
+        long? fileSize = sizeOverride != null ? ParseSize(sizeOverride) : null;
+        return await RunProfileBenchmarkAsync(profile, file, fileSize, trials, duration, output, objectives).ConfigureAwait(false);
+    }
+
+    private static async Task<int> PredictCommandAsync(string[] args)
+    {
+        string file = "diskbench_test.dat";
+        string size = "1G";
+        int? trials = null;
+        int? duration = null;
+        string? output = null;
+        bool calibrate = false;
+        bool fitOnly = false;
+        var training = new List<string>();
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "-f" or "--file":
+                    file = args[++i];
+                    break;
+                case "-s" or "--size":
+                    size = args[++i];
+                    break;
+                case "-t" or "--trials":
+                    trials = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-d" or "--duration":
+                    duration = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-o" or "--output":
+                    output = args[++i];
+                    break;
+                case "--training":
+                    training.Add(args[++i]);
+                    break;
+                case "--calibrate":
+                    calibrate = true;
+                    break;
+                case "--fit-only":
+                    fitOnly = true;
+                    break;
+            }
+        }
+
+        if (calibrate ? output == null : training.Count == 0)
+        {
+            Console.Error.WriteLine(calibrate
+                ? "Error: --calibrate needs -o <file> to save the training result to."
+                : "Error: At least one --training file or directory is required.");
+            Console.Error.WriteLine("Usage: diskbench predict --training <file|dir> [options]");
+            Console.Error.WriteLine("       diskbench predict --calibrate -o <file> [options]");
+            return 1;
+        }
+
+        try
+        {
+            await using var engine = new WindowsIoEngine();
+            var runner = new BenchmarkRunner(engine, new ConsoleBenchmarkSink());
+
+            if (calibrate)
+            {
+                var calibration = ProfilePredictor.CreateCalibrationPlan(
+                    file,
+                    ParseSize(size),
+                    trials ?? 3,
+                    TimeSpan.FromSeconds(5),
+                    TimeSpan.FromSeconds(duration ?? 30));
+                var calibrationResult = await runner.RunAsync(calibration).ConfigureAwait(false);
+                await File.WriteAllTextAsync(output!, JsonSerializer.Serialize(calibrationResult, JsonOptions)).ConfigureAwait(false);
+                Console.WriteLine($"\nTraining result written to: {output}");
+                return 0;
+            }
+
+            var predictor = ProfilePredictor.Fit(LoadTrainingScores(training));
+            PrintPredictorFit(predictor);
+            if (fitOnly)
+            {
+                return 0;
+            }
+
+            var plan = ProfilePredictor.CreateBasisPlan(file, ParseSize(size), trials ?? 1, measuredDuration: TimeSpan.FromSeconds(duration ?? 5));
+
+            Console.WriteLine();
+            Console.WriteLine("======================================================================");
+            Console.WriteLine("                  DiskBench Profile Prediction                        ");
+            Console.WriteLine("======================================================================");
+            Console.WriteLine();
+
+            var basisResult = await runner.RunAsync(plan).ConfigureAwait(false);
+            var result = predictor.Predict(ProfilePredictor.GetScores(basisResult));
+            PrintPrediction(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nBenchmark cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    /// <summary>
+    /// Reads the workload scores of saved benchmark results (files, or every .json file of a directory).
+    /// Only names, mean IOPS and p99 latency are read, so results from older versions load too.
+    /// </summary>
+    private static List<IReadOnlyDictionary<string, WorkloadScore>> LoadTrainingScores(IEnumerable<string> paths)
+    {
+        var samples = new List<IReadOnlyDictionary<string, WorkloadScore>>();
+        var files = paths.SelectMany(p => Directory.Exists(p) ? Directory.GetFiles(p, "*.json") : [p]);
+        foreach (var path in files)
+        {
+            try
+            {
+                using var document = JsonDocument.Parse(File.ReadAllText(path));
+                var scores = new Dictionary<string, WorkloadScore>(StringComparer.Ordinal);
+                if (document.RootElement.TryGetProperty("workloads", out var workloads) && workloads.ValueKind == JsonValueKind.Array)
+                {
+                    foreach (var workload in workloads.EnumerateArray())
+                    {
+                        if (workload.TryGetProperty("workload", out var spec) &&
+                            spec.TryGetProperty("name", out var name) &&
+                            workload.TryGetProperty("meanIops", out var iops) &&
+                            workload.TryGetProperty("meanLatency", out var latency) &&
+                            latency.TryGetProperty("p99Us", out var p99))
+                        {
+                            scores[name.GetString()!] = new WorkloadScore(iops.GetDouble(), p99.GetDouble());
+                        }
+                    }
+                }
+
+                samples.Add(scores);
+            }
+            catch (JsonException ex)
+            {
+                Console.Error.WriteLine($"Skipping {path}: {ex.Message}");
+            }
+        }
+
+        return samples;
+    }
+
+    private static void PrintPredictorFit(ProfilePredictor predictor)
+    {
+        Console.WriteLine();
+        Console.WriteLine("Model (nested leave-one-out error on drives not trained on):");
+        Console.WriteLine($"  {"Workload",-44} {"Drives",6} {"IOPS err",10} {"p99 err",10}");
+        foreach (var fit in predictor.Fits)
+        {
+            Console.WriteLine($"  {fit.Name,-44} {fit.Samples,6} {"±" + (fit.IopsError * 100).ToString("F0", CultureInfo.InvariantCulture) + "%",10} {"±" + (fit.P99LatencyError * 100).ToString("F0", CultureInfo.InvariantCulture) + "%",10}");
+        }
+    }
+
+    private static void PrintPrediction(ProfilePredictionResult result)
+    {
+        Console.WriteLine();
+        Console.WriteLine("======================================================================");
+        Console.WriteLine("                    Predicted Profile Results                         ");
+        Console.WriteLine("======================================================================");
+        foreach (var profile in result.Profiles)
+        {
+            Console.WriteLine();
+            Console.WriteLine($"  {profile.Name}");
+            foreach (var w in profile.Workloads)
+            {
+                var name = w.Name[(profile.Name.Length + 2)..];
+                Console.WriteLine(
+                    $"    {name,-28} {w.Iops,10:N0} IOPS ({w.IopsBand.Lower:N0}-{w.IopsBand.Upper:N0})  " +
+                    $"{w.BytesPerSecond / (1024 * 1024),8:F1} MB/s  p99 {w.P99LatencyUs,9:F1} us ({w.P99LatencyBand.Lower:F0}-{w.P99LatencyBand.Upper:F0})");
+            }
+        }
+
+        Console.WriteLine();
+        Console.WriteLine("  Ranges are 95% prediction bands (nested cross-validated error, Student's t).");
+    }
+
+    private static async Task<int> CompareCommandAsync(string[] args)
+    {
+        var directories = new List<string>();
+        string? profileName = null;
+        string? size = null;
+        int trials = 3;
+        int duration = 30;
+        string? output = null;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            var arg = args[i];
+            if (arg.StartsWith('-'))
+            {
+                switch (arg)
+                {
+                    case "-p" or "--profile":
+                        profileName = args[++i];
+                        break;
+                    case "-s" or "--size":
+                        size = args[++i];
+                        break;
+                    case "-t" or "--trials":
+                        trials = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "-d" or "--duration":
+                        duration = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "-o" or "--output":
+                        output = args[++i];
+                        break;
+                }
+            }
+            else
+            {
+                directories.Add(arg);
+            }
+        }
+
+        if (directories.Count < 2)
+        {
+            Console.Error.WriteLine("Error: At least two directories are required.");
+            Console.Error.WriteLine("Usage: diskbench compare <dir> <dir> [dir...] [options]");
+            return 1;
+        }
+
+        BenchmarkPlan plan;
+        if (profileName != null)
+        {
+            var profile = ResolveProfile(profileName);
+            if (profile == null)
+            {
+                Console.Error.WriteLine($"Error: Unknown profile '{profileName}'");
+                Console.Error.WriteLine("Use 'diskbench profiles' to see available profiles.");
+                return 1;
+            }
+
+            plan = UsageProfiles.CreatePlan(
+                profile,
+                $"diskbench_{GetProfileShortName(profile.Type)}.dat",
+                size != null ? ParseSize(size) : null,
+                trials,
+                TimeSpan.FromSeconds(5),
+                TimeSpan.FromSeconds(duration));
+        }
+        else
+        {
+            plan = CreateDefaultPlan("diskbench_test.dat", ParseSize(size ?? "1G"), trials, duration, 5, true, null, null);
+        }
+
+        var targets = directories.Select(d => new ComparisonTarget { Directory = d }).ToList();
+        await using var engine = new WindowsIoEngine();
+        var runner = new FilesystemComparisonRunner(engine, new ConsoleBenchmarkSink());
+
+        try
+        {
+            Console.WriteLine();
+            Console.WriteLine("======================================================================");
+            Console.WriteLine("                  DiskBench Filesystem Comparison                     ");
+            Console.WriteLine("======================================================================");
+            Console.WriteLine();
+
+            var result = await runner.RunAsync(plan, targets).ConfigureAwait(false);
+            PrintComparison(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nBenchmark cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static async Task<int> PressureCommandAsync(string[] args)
+    {
+        string file = "diskbench_test.dat";
+        string size = "1G";
+        int trials = 3;
+        int duration = 30;
+        string? output = null;
+        var levels = new List<double> { 1, 0.5, 0.25 };
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "-f" or "--file":
+                    file = args[++i];
+                    break;
+                case "-s" or "--size":
+                    size = args[++i];
+                    break;
+                case "-t" or "--trials":
+                    trials = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-d" or "--duration":
+                    duration = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-o" or "--output":
+                    output = args[++i];
+                    break;
+                case "--levels":
+                    levels = [.. args[++i].Split(',').Select(l => double.Parse(l, CultureInfo.InvariantCulture))];
+                    break;
+            }
+        }
+
+        IMemoryPressure pressure = OperatingSystem.IsWindows() ? new MemoryBalloon(PhysicalMemory.GetAvailableBytes) : new MemoryBalloon();
+        if (!pressure.IsAvailable)
+        {
+            Console.Error.WriteLine($"Error: Memory pressure unavailable: {pressure.Description}");
+            return 1;
+        }
+
+        var plan = CreateDefaultPlan(file, ParseSize(size), trials, duration, 5, false, null, null);
+        await using var engine = new WindowsIoEngine();
+        var runner = new MemoryPressureRunner(engine, pressure, new ConsoleBenchmarkSink());
+
+        try
+        {
+            Console.WriteLine();
+            Console.WriteLine("======================================================================");
+            Console.WriteLine("                  DiskBench Memory Pressure Scenario                  ");
+            Console.WriteLine("======================================================================");
+            Console.WriteLine();
+
+            var result = await runner.RunAsync(plan, levels).ConfigureAwait(false);
+            PrintPressure(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nBenchmark cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static async Task<int> InterfereCommandAsync(string[] args)
+    {
+        string file = "diskbench_test.dat";
+        string size = "1G";
+        int trials = 3;
+        int duration = 30;
+        string? output = null;
+        int threads = Math.Max(1, Environment.ProcessorCount - 1);
+        var kinds = new List<StressorKind>();
+        var intensities = new List<double> { 0.5, 1 };
+        List<int>? cpus = null;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "-f" or "--file":
+                    file = args[++i];
+                    break;
+                case "-s" or "--size":
+                    size = args[++i];
+                    break;
+                case "-t" or "--trials":
+                    trials = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-d" or "--duration":
+                    duration = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-o" or "--output":
+                    output = args[++i];
+                    break;
+                case "--threads":
+                    threads = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "--levels":
+                    intensities = [.. args[++i].Split(',').Select(l => double.Parse(l, CultureInfo.InvariantCulture))];
+                    break;
+                case "--cpus":
+                    cpus = [.. args[++i].Split(',').Select(c => int.Parse(c, CultureInfo.InvariantCulture))];
+                    break;
+                case "--stress":
+                    var kind = ParseStressorKind(args[++i]);
+                    if (kind == null)
+                    {
+                        Console.Error.WriteLine($"Error: Unknown stressor '{args[i]}' (expected int, avx, mem or cache)");
+                        return 1;
+                    }
+
+                    kinds.Add(kind.Value);
+                    break;
+            }
+        }
+
+        if (kinds.Count == 0)
+        {
+            kinds.AddRange(Enum.GetValues<StressorKind>());
+        }
+
+        var levels = kinds
+            .SelectMany(kind => intensities.Select(intensity => new StressorLevel
+            {
+                Stressors = [new StressorSpec { Kind = kind, Threads = threads, Intensity = intensity, Cpus = cpus }]
+            }))
+            .ToList();
+
+        var plan = CreateDefaultPlan(file, ParseSize(size), trials, duration, 5, true, null, null);
+        await using var engine = new WindowsIoEngine();
+        var runner = new InterferenceRunner(engine, new ConsoleBenchmarkSink(), ThreadAffinity.PinCurrentThread, HighResolutionWaiter.TryCreate);
+
+        try
+        {
+            Console.WriteLine();
+            Console.WriteLine("======================================================================");
+            Console.WriteLine("                  DiskBench Interference Scenario                     ");
+            Console.WriteLine("======================================================================");
+            Console.WriteLine();
+
+            var result = await runner.RunAsync(plan, levels).ConfigureAwait(false);
+            PrintInterference(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nBenchmark cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static StressorKind? ParseStressorKind(string value) => value.ToLowerInvariant() switch
+    {
+        "int" or "integer" => StressorKind.IntegerBurn,
+        "avx" or "vector" => StressorKind.VectorBurn,
+        "mem" or "memory" => StressorKind.MemoryStream,
+        "cache" => StressorKind.CacheThrash,
+        _ => null
+    };
+
+    private static void PrintInterference(InterferenceResult result)
+    {
+        Console.WriteLine();
+        Console.WriteLine("======================================================================");
+        Console.WriteLine("                    Interference Summary                              ");
+        Console.WriteLine("======================================================================");
+
+        for (int l = 0; l < result.Levels.Count; l++)
+        {
+            var level = result.Levels[l];
+            var work = string.Join(", ", level.StressorThroughput.Select(s => $"{FormatRate(s.PerSecond)} {s.Unit}/s, {s.BusyFraction * 100:F0}% busy"));
+            Console.WriteLine($"  [{l + 1}] {level.Name}" + (work.Length > 0 ? $"  ({work})" : ""));
+        }
+
+        Console.WriteLine();
+        Console.WriteLine("  Latency sensitivity (p50 / p99 / p99.9 and IOPS relative to idle):");
+        for (int w = 0; w < result.Levels[0].Sensitivity.Count; w++)
+        {
+            Console.WriteLine();
+            Console.WriteLine($"  {result.Levels[0].Sensitivity[w].WorkloadName}");
+            for (int l = 1; l < result.Levels.Count; l++)
+            {
+                var s = result.Levels[l].Sensitivity[w];
+                Console.WriteLine($"    [{l + 1}] x{s.P50Ratio,5:F2} / x{s.P99Ratio,5:F2} / x{s.P999Ratio,5:F2}   IOPS {s.IopsRatio,6:P0}");
+            }
+        }
+    }
+
+    private static string FormatRate(double value) => value switch
+    {
+        >= 1e9 => $"{value / 1e9:F1}G",
+        >= 1e6 => $"{value / 1e6:F1}M",
+        >= 1e3 => $"{value / 1e3:F1}K",
+        _ => $"{value:F0}"
+    };
+
+    /// <summary>
+    /// Reads a plan from JSON. Relative generator assembly paths are resolved against the plan's directory.
+    /// </summary>
+    private static BenchmarkPlan LoadPlan(string path)
+    {
+        var plan = JsonSerializer.Deserialize<BenchmarkPlan>(File.ReadAllText(path), JsonOptions)
+            ?? throw new FormatException($"Plan file is empty: {path}");
+        var directory = Path.GetDirectoryName(Path.GetFullPath(path))!;
+
+        return plan with
+        {
+            Workloads =
+            [
+                .. plan.Workloads.Select(w => w.Generator is { AssemblyPath: { } assembly } && !Path.IsPathRooted(assembly)
+                    ? w with { Generator = w.Generator with { AssemblyPath = Path.Combine(directory, assembly) } }
+                    : w)
+            ]
+        };
+    }
+
+    private static async Task<int> CopyCommandAsync(string[] args)
+    {
+        string file = "diskbench_copy.dat";
+        string? destination = null;
+        string size = "1G";
+        int trials = 3;
+        string block = "1M";
+        string? output = null;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "-f" or "--file":
+                    file = args[++i];
+                    break;
+                case "--dest":
+                    destination = args[++i];
+                    break;
+                case "-s" or "--size":
+                    size = args[++i];
+                    break;
+                case "-t" or "--trials":
+                    trials = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-b" or "--block":
+                    block = args[++i];
+                    break;
+                case "-o" or "--output":
+                    output = args[++i];
+                    break;
+            }
+        }
+
+        int blockSize = (int)ParseSize(block);
+        var plan = new FileCopyPlan
+        {
+            SourcePath = file,
+            DestinationPath = destination,
+            FileSize = ParseSize(size),
+            Trials = trials,
+            Cases =
+            [
+                new CopyCase { Strategy = CopyStrategy.Buffered, BlockSize = 64 * 1024 },
+                new CopyCase { Strategy = CopyStrategy.Buffered, BlockSize = blockSize },
+                new CopyCase { Strategy = CopyStrategy.Unbuffered, BlockSize = blockSize, QueueDepth = 2 },
+                new CopyCase { Strategy = CopyStrategy.Unbuffered, BlockSize = blockSize, QueueDepth = 8 },
+                new CopyCase { Strategy = CopyStrategy.SystemCopy },
+                new CopyCase { Strategy = CopyStrategy.Clone }
+            ]
+        };
+
+        await using var engine = new WindowsIoEngine();
+        var runner = new FileCopyRunner(engine, new ConsoleBenchmarkSink(), PhysicalMemory.GetSystemCacheBytes);
+
+        try
+        {
+            Console.WriteLine();
+            Console.WriteLine("======================================================================");
+            Console.WriteLine("                  DiskBench Copy Strategies                           ");
+            Console.WriteLine("======================================================================");
+            Console.WriteLine();
+            Console.WriteLine($"  Source: {Path.GetFullPath(file)} ({FormatBytes(plan.FileSize)})");
+
+            var result = await runner.RunAsync(plan).ConfigureAwait(false);
+            PrintCopy(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nBenchmark cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static void PrintCopy(FileCopyResult result)
+    {
+        Console.WriteLine();
+        Console.WriteLine($"  {"Strategy",-22} {"MB/s",10} {"CPU s/GB",10} {"Cache growth",14}");
+        foreach (var copyCase in result.Cases)
+        {
+            if (copyCase.SkipReason != null)
+            {
+                Console.WriteLine($"  {copyCase.Name,-22} skipped: {copyCase.SkipReason}");
+                continue;
+            }
+
+            var growth = copyCase.MeanPageCacheGrowthBytes is { } g ? $"{g / (1024 * 1024),11:F0} MB" : "n/a";
+            Console.WriteLine(
+                $"  {copyCase.Name,-22} {copyCase.MeanBytesPerSecond / (1024 * 1024),10:F1} {copyCase.MeanCpuSecondsPerGB,10:F3} {growth,14}");
+        }
+    }
+
+    private static async Task<int> FilesCommandAsync(string[] args)
+    {
+        string file = "diskbench_test.dat";
+        string size = "1G";
+        int trials = 3;
+        int duration = 30;
+        string? output = null;
+        List<int> counts = [1, 64, 1024, 16384];
+        var distribution = FileDistribution.Uniform;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "-f" or "--file":
+                    file = args[++i];
+                    break;
+                case "-s" or "--size":
+                    size = args[++i];
+                    break;
+                case "-t" or "--trials":
+                    trials = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-d" or "--duration":
+                    duration = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                case "-o" or "--output":
+                    output = args[++i];
+                    break;
+                case "--counts":
+                    counts = [.. args[++i].Split(',').Select(c => int.Parse(c, CultureInfo.InvariantCulture))];
+                    break;
+                case "--distribution":
+                    distribution = Enum.Parse<FileDistribution>(args[++i], ignoreCase: true);
+                    break;
+            }
+        }
+
+        var plan = CreateDefaultPlan(file, ParseSize(size), trials, duration, 5, true, null, null);
+        await using var engine = new WindowsIoEngine();
+        var runner = new FileSetScalingRunner(engine, new ConsoleBenchmarkSink());
+
+        try
+        {
+            Console.WriteLine();
+            Console.WriteLine("======================================================================");
+            Console.WriteLine("                  DiskBench File Set Scaling                          ");
+            Console.WriteLine("======================================================================");
+            Console.WriteLine();
+
+            var result = await runner.RunAsync(plan, counts, distribution).ConfigureAwait(false);
+            PrintFileSetScaling(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nBenchmark cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static async Task<int> ShapeCommandAsync(string[] args)
+    {
+        string? file = null;
+        string size = "1G";
+        string? output = null;
+        var pattern = AccessPattern.Sequential;
+        int writePercent = 0;
+        List<int> blocks = [4096, 16384, 65536, 262144, 1048576];
+        List<int> queueDepths = [1, 2, 4, 8, 16, 32, 64, 128];
+        List<int> threads = [1, 2, 4];
+        double duration = 0.5;
+        int reduction = 3;
+        int rounds = 4;
+        double target = 0.95;
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            var arg = args[i];
+            if (arg.StartsWith('-'))
+            {
+                switch (arg)
+                {
+                    case "-s" or "--size":
+                        size = args[++i];
+                        break;
+                    case "--random":
+                        pattern = AccessPattern.Random;
+                        break;
+                    case "--write-percent":
+                        writePercent = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "--blocks":
+                        blocks = [.. args[++i].Split(',').Select(b => (int)ParseSize(b))];
+                        break;
+                    case "--qd":
+                        queueDepths = [.. args[++i].Split(',').Select(q => int.Parse(q, CultureInfo.InvariantCulture))];
+                        break;
+                    case "--threads":
+                        threads = [.. args[++i].Split(',').Select(t => int.Parse(t, CultureInfo.InvariantCulture))];
+                        break;
+                    case "-d" or "--duration":
+                        duration = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "--eta":
+                        reduction = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "--rounds":
+                        rounds = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "--target":
+                        target = double.Parse(args[++i], CultureInfo.InvariantCulture);
+                        break;
+                    case "-o" or "--output":
+                        output = args[++i];
+                        break;
+                }
+            }
+            else if (file == null)
+            {
+                file = arg;
+            }
+        }
+
+        var spec = new ShapeSearchSpec
+        {
+            Workload = new WorkloadSpec
+            {
+                FilePath = GenerateTestFilePath(file, "shape"),
+                FileSize = ParseSize(size),
+                BlockSize = blocks.Count > 0 ? blocks[0] : 0,
+                Pattern = pattern,
+                WritePercent = writePercent
+            },
+            BlockSizes = blocks,
+            QueueDepths = queueDepths,
+            ThreadCounts = threads,
+            InitialDuration = TimeSpan.FromSeconds(duration),
+            Reduction = reduction,
+            MaxRounds = rounds,
+            TargetFraction = target
+        };
+
+        await using var engine = new WindowsIoEngine();
+        var runner = new ShapeSearchRunner(engine);
+
+        try
+        {
+            Console.WriteLine();
+            Console.WriteLine("======================================================================");
+            Console.WriteLine("                    DiskBench IO Shape Search                         ");
+            Console.WriteLine("======================================================================");
+            Console.WriteLine();
+
+            int shapes = blocks.Count * queueDepths.Count * threads.Count;
+            Console.WriteLine($"  Searching {shapes} shapes ({pattern}, {writePercent}% writes)...");
+
+            var result = await runner.RunAsync(spec).ConfigureAwait(false);
+            PrintShapeSearch(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nSearch cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static void PrintShapeSearch(ShapeSearchResult result)
+    {
+        Console.WriteLine();
+        Console.WriteLine("======================================================================");
+        Console.WriteLine("                    IO Shape Search Summary                           ");
+        Console.WriteLine("======================================================================");
+
+        foreach (var round in result.Rounds)
+        {
+            Console.WriteLine($"  Round {round.Round}: {round.Evaluated,4} shapes x {round.MeasuredDuration.TotalSeconds:F2} s, kept {round.Kept}");
+        }
+
+        Console.WriteLine($"  Measured {result.MeasuredTime.TotalMinutes:F1} min (exhaustive grid: {result.ExhaustiveTime.TotalMinutes:F1} min)");
+
+        Console.WriteLine();
+        Console.WriteLine($"  Pareto frontier of the {result.Finalists.Count} finalists (throughput, p99, CPU per IO):");
+        foreach (var point in result.Frontier)
+        {
+            PrintShapePoint(point, result.PeakBytesPerSecond);
+        }
+
+        Console.WriteLine();
+        Console.WriteLine($"  Cheapest shape reaching {result.Spec.TargetFraction:P0} of peak ({result.PeakBytesPerSecond / (1024 * 1024):F1} MB/s):");
+        PrintShapePoint(result.Cheapest, result.PeakBytesPerSecond);
+    }
+
+    private static void PrintShapePoint(ShapePoint point, double peak)
+    {
+        Console.WriteLine(
+            $"    {point.Name,-22} {point.BytesPerSecond / (1024 * 1024),10:F1} MB/s {point.BytesPerSecond / peak,6:P0} " +
+            $"{point.Iops,12:N0} IOPS   p99 {point.P99LatencyUs,10:F1} us  {point.CpuUsPerIo,7:F2} us CPU/IO  " +
+            $"{FormatBytes(point.OutstandingBytes),10} in flight");
+    }
+
+    private static void PrintFileSetScaling(FileSetScalingResult result)
+    {
+        Console.WriteLine();
+        Console.WriteLine("======================================================================");
+        Console.WriteLine("                    File Set Scaling Summary                          ");
+        Console.WriteLine("======================================================================");
+        Console.WriteLine($"  Distribution: {result.Distribution}");
+
+        for (int l = 0; l < result.Levels.Count; l++)
+        {
+            Console.WriteLine($"  [{l + 1}] {result.Levels[l].Name}");
+        }
+
+        foreach (var workload in result.Workloads)
+        {
+            Console.WriteLine();
+            Console.WriteLine($"  {workload.WorkloadName} (fastest: {workload.FastestTarget})");
+            for (int l = 0; l < workload.Scores.Count; l++)
+            {
+                var score = workload.Scores[l];
+                Console.WriteLine(
+                    $"    [{l + 1}] {score.MeanIops,12:N0} IOPS {score.RelativeIops,6:P0}   " +
+                    $"p99 {score.P99LatencyUs,10:F1} us  x{score.RelativeP99Latency:F2}");
+            }
+        }
+    }
+
+    private static void PrintPressure(MemoryPressureResult result)
+    {
+        Console.WriteLine();
+        Console.WriteLine("======================================================================");
+        Console.WriteLine("                    Memory Pressure Summary                           ");
+        Console.WriteLine("======================================================================");
+        Console.WriteLine($"  Method: {result.Method}, working set {FormatBytes(result.WorkingSetBytes)}");
+
+        for (int l = 0; l < result.Levels.Count; l++)
+        {
+            var level = result.Levels[l];
+            var budget = level.CacheBytes.HasValue ? $" ({FormatBytes(level.CacheBytes.Value)})" : "";
+            var evictions = level.ReclaimedPages.HasValue
+                ? $"  {level.ReclaimedPages,12:N0} reclaimed  {level.RefaultedPages,12:N0} refaulted"
+                : "";
+            Console.WriteLine($"  [{l + 1}] {level.Name}{budget}{evictions}");
+        }
+
+        foreach (var workload in result.Workloads)
+        {
+            Console.WriteLine();
+            Console.WriteLine($"  {workload.WorkloadName}");
+            for (int l = 0; l < workload.Scores.Count; l++)
+            {
+                var score = workload.Scores[l];
+                Console.WriteLine(
+                    $"    [{l + 1}] {score.MeanBytesPerSecond / (1024 * 1024),10:F1} MB/s {score.RelativeIops,6:P0}   " +
+                    $"p99 {score.P99LatencyUs,10:F1} us  x{score.RelativeP99Latency:F2}");
             }
-            else if (file == null)
+        }
+    }
+
+    private static void PrintComparison(FilesystemComparisonResult result)
+    {
+        Console.WriteLine();
+        Console.WriteLine("======================================================================");
+        Console.WriteLine("                        Comparison Summary                            ");
+        Console.WriteLine("======================================================================");
+
+        for (int t = 0; t < result.Targets.Count; t++)
+        {
+            var target = result.Targets[t];
+            Console.WriteLine($"  [{t + 1}] {target.Name}");
+            if (target.MountOptions != null)
             {
-                // Second positional argument is the file path
-                file = arg;
+                Console.WriteLine($"      {target.Device} ({target.MountOptions})");
             }
         }
 
-        if (string.IsNullOrEmpty(profileName))
+        foreach (var workload in result.Workloads)
         {
-            Console.Error.WriteLine("Error: Profile name is required.");
-            Console.Error.WriteLine();
-            Console.Error.WriteLine("Usage: diskbench profile <name> [file] [options]");
-            Console.Error.WriteLine();
-            Console.Error.WriteLine("Examples:");
-            Console.Error.WriteLine("  diskbench profile gaming");
-            Console.Error.WriteLine("  diskbench profile gaming D:\\");
-            Console.Error.WriteLine("  diskbench profile gaming -s 4G -d 60");
-            Console.Error.WriteLine();
-            Console.Error.WriteLine("Use 'diskbench profiles' to see available profiles.");
-            return 1;
+            Console.WriteLine();
+            Console.WriteLine($"  {workload.WorkloadName}");
+            for (int t = 0; t < workload.Scores.Count; t++)
+            {
+                var score = workload.Scores[t];
+                Console.WriteLine(
+                    $"    [{t + 1}] {score.MeanIops,12:N0} IOPS  {score.RelativeIops,6:P0}   " +
+                    $"p99 {score.P99LatencyUs,10:F1} us  x{score.RelativeP99Latency:F2}");
+            }
         }
 
-        var profile = ResolveProfile(profileName);
-        if (profile == null)
+        Console.WriteLine();
+        Console.WriteLine("  Score (geometric mean of relative IOPS):");
+        for (int t = 0; t < result.Targets.Count; t++)
         {
-            Console.Error.WriteLine($"Error: Unknown profile '{profileName}'");
-            Console.Error.WriteLine("Use 'diskbench profiles' to see available profiles.");
-            return 1;
+            Console.WriteLine($"    [{t + 1}] {result.Targets[t].Score,6:P0}  {result.Targets[t].Name}");
         }
-
-        // Generate file path
-        file = GenerateTestFilePath(file, profileName);
-
-        long? fileSize = sizeOverride != null ? ParseSize(sizeOverride) : null;
-        return await RunProfileBenchmarkAsync(profile, file, fileSize, trials, duration, output).ConfigureAwait(false);
     }
 
     /// <summary>
@@ -345,15 +1768,18 @@ internal static class Program
         long? fileSize,
         int trials,
         int duration,
-        string? output)
+        string? output,
+        IReadOnlyList<ServiceLevelObjective> objectives)
     {
-        var plan = UsageProfiles.CreatePlan(
-            profile,
-            file,
-            fileSize,
-            trials,
-            TimeSpan.FromSeconds(5),
-            TimeSpan.FromSeconds(duration));
+        var plan = WithObjectives(
+            UsageProfiles.CreatePlan(
+                profile,
+                file,
+                fileSize,
+                trials,
+                TimeSpan.FromSeconds(5),
+                TimeSpan.FromSeconds(duration)),
+            objectives);
 
         var sink = new ConsoleBenchmarkSink();
         await using var engine = new WindowsIoEngine();
@@ -385,7 +1811,7 @@ internal static class Program
                 Console.WriteLine($"\nResults written to: {output}");
             }
 
-            return 0;
+            return result.ObjectivesPassed == false ? CheckFailedExitCode : 0;
         }
         catch (OperationCanceledException)
         {
@@ -440,6 +1866,92 @@ internal static class Program
         return 0;
     }
 
+    private static int TraceCommand(string[] args)
+    {
+        string? path = null;
+        int list = 0;
+        var filter = new IoTraceFilter();
+
+        for (int i = 0; i < args.Length; i++)
+        {
+            switch (args[i])
+            {
+                case "--from":
+                    filter = filter with { From = TimeSpan.FromSeconds(double.Parse(args[++i], CultureInfo.InvariantCulture)) };
+                    break;
+                case "--to":
+                    filter = filter with { To = TimeSpan.FromSeconds(double.Parse(args[++i], CultureInfo.InvariantCulture)) };
+                    break;
+                case "--min-offset":
+                    filter = filter with { MinOffset = ParseSize(args[++i]) };
+                    break;
+                case "--max-offset":
+                    filter = filter with { MaxOffset = ParseSize(args[++i]) };
+                    break;
+                case "--min-latency":
+                    filter = filter with { MinLatency = TimeSpan.FromMicroseconds(double.Parse(args[++i], CultureInfo.InvariantCulture)) };
+                    break;
+                case "--reads":
+                    filter = filter with { IsWrite = false };
+                    break;
+                case "--writes":
+                    filter = filter with { IsWrite = true };
+                    break;
+                case "-n" or "--list":
+                    list = int.Parse(args[++i], CultureInfo.InvariantCulture);
+                    break;
+                default:
+                    path ??= args[i];
+                    break;
+            }
+        }
+
+        if (path == null)
+        {
+            Console.Error.WriteLine("Usage: diskbench trace <file.iotrace> [options]");
+            return 1;
+        }
+
+        try
+        {
+            using var reader = new IoTraceReader(path);
+            var stopwatch = Stopwatch.StartNew();
+            var aggregate = reader.Aggregate(filter);
+            stopwatch.Stop();
+
+            var ticksPerUs = LatencyHistogram.TicksPerMicrosecond;
+            var latency = aggregate.Latency;
+            Console.WriteLine($"Trace: {path}");
+            Console.WriteLine($"  {reader.Count:N0} IOs in {reader.Blocks.Count} blocks; {aggregate.BlocksScanned} scanned, {aggregate.BlocksSkipped} skipped by the index ({stopwatch.Elapsed.TotalMilliseconds:F0} ms)");
+            Console.WriteLine($"  Matching IOs: {aggregate.Count:N0}");
+            if (aggregate.Count > 0)
+            {
+                Console.WriteLine(
+                    $"  Latency (us): mean {latency.MeanTicks / ticksPerUs:F1}  p50 {latency.GetPercentileTicks(0.5) / ticksPerUs:F1}  " +
+                    $"p99 {latency.GetPercentileTicks(0.99) / ticksPerUs:F1}  p99.9 {latency.GetPercentileTicks(0.999) / ticksPerUs:F1}  " +
+                    $"max {latency.MaxTicks / ticksPerUs:F1}");
+            }
+
+            foreach (var io in reader.Read(filter).Take(list))
+            {
+                Console.WriteLine(
+                    $"  {reader.ToTimeSpan(io.SubmitTicks).TotalMilliseconds,12:F3} ms  {(io.IsWrite ? "W" : "R")} " +
+                    $"{io.Offset,16:N0} +{io.Size,-8} {reader.ToTimeSpan(io.LatencyTicks).TotalMicroseconds,10:F1} us  thread {io.Thread}");
+            }
+
+            return 0;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
     private static async Task<int> RunBenchmarkAsync(
         string file,
         string size,
@@ -447,14 +1959,38 @@ internal static class Program
         int duration,
         int warmup,
         string? output,
-        bool buffered)
+        bool buffered,
+        bool writeBack,
+        double? slowMs,
+        IoErrorPolicy? errorPolicy,
+        FaultInjectionOptions? faults,
+        WindowsIoEngineOptions engineOptions,
+        IReadOnlyList<ServiceLevelObjective> objectives,
+        string? planFile = null,
+        string? traceDirectory = null,
+        PreparedContent? content = null)
     {
-        var fileSizeBytes = ParseSize(size);
-        var plan = CreateDefaultPlan(file, fileSizeBytes, trials, duration, warmup, !buffered);
+        var plan = planFile != null
+            ? LoadPlan(planFile)
+            : CreateDefaultPlan(file, ParseSize(size), trials, duration, warmup, !buffered, slowMs, errorPolicy);
+        plan = WithObjectives(plan, objectives);
+        if (traceDirectory != null)
+        {
+            plan = plan with { TraceDirectory = traceDirectory };
+        }
+
+        if (content != null)
+        {
+            plan = plan with { Content = content };
+        }
 
         var sink = new ConsoleBenchmarkSink();
-        await using var engine = new WindowsIoEngine();
-        var runner = new BenchmarkRunner(engine, sink);
+        await using IBenchmarkEngine engine = faults != null
+            ? new FaultInjectingEngine(new WindowsIoEngine(engineOptions), faults)
+            : new WindowsIoEngine(engineOptions);
+        using var cacheManager = writeBack && OperatingSystem.IsWindows() ? new CacheManagerWriteBackMonitor() : null;
+        var writeBackMonitor = writeBack ? cacheManager ?? (IWriteBackMonitor)new ProcMeminfoWriteBackMonitor() : null;
+        var runner = new BenchmarkRunner(engine, sink, writeBackMonitor: writeBackMonitor);
 
         try
         {
@@ -473,7 +2009,7 @@ internal static class Program
                 Console.WriteLine($"\nResults written to: {output}");
             }
 
-            return 0;
+            return result.ObjectivesPassed == false ? CheckFailedExitCode : 0;
         }
         catch (OperationCanceledException)
         {
@@ -602,6 +2138,246 @@ internal static class Program
         }
     }
 
+    private static async Task<int> RunProbeAsync(string file, string size, double budgetSeconds, string? output)
+    {
+        var spec = new ProbeSpec
+        {
+            FilePath = file,
+            FileSize = ParseSize(size),
+            TimeBudget = TimeSpan.FromSeconds(budgetSeconds)
+        };
+
+        var sink = new ConsoleBenchmarkSink();
+        await using var engine = new WindowsIoEngine();
+        var runner = new BenchmarkRunner(engine, sink);
+
+        try
+        {
+            var result = await runner.ProbeAsync(spec).ConfigureAwait(false);
+
+            Console.WriteLine();
+            Console.WriteLine($"DiskBench Probe: {Path.GetFullPath(file)}");
+            Console.WriteLine($"  {"Workload",-18} {"Throughput",12} {"IOPS",12}   {"95% band",-14} {"Slices",6}");
+            foreach (var m in result.Measurements)
+            {
+                var band = $"±{m.RelativeError * 100:F1}%";
+                var mark = m.Converged ? string.Empty : " (budget)";
+                Console.WriteLine($"  {m.Workload.Name,-18} {m.MeanBytesPerSecond / (1024 * 1024),8:F1} MB/s {m.MeanIops,12:F0}   {band + mark,-14} {m.Slices,6}");
+            }
+            Console.WriteLine($"  Prepare: {result.PrepareDuration.TotalSeconds:F2}s, total: {result.Duration.TotalSeconds:F2}s");
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nProbe cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static async Task<int> RunScanAsync(SurfaceScanSpec spec, string? output)
+    {
+        var sink = new ConsoleBenchmarkSink();
+        await using var engine = new WindowsIoEngine();
+        var runner = new BenchmarkRunner(engine, sink);
+
+        Console.WriteLine($"DiskBench Surface Scan: {Path.GetFullPath(spec.FilePath)}");
+        Console.WriteLine($"  {FormatBytes(spec.RegionSize)} regions, {FormatBytes(spec.BlockSize)} blocks at QD{spec.QueueDepth}" +
+                          (spec.Write ? ", write then read" : ", read only"));
+
+        var progress = new Progress<SurfacePass>(pass =>
+            Console.Write($"\r  {(pass.IsWrite ? "Write" : "Read ")} {FormatBytes(pass.Offset + pass.Length),10}: " +
+                          $"{pass.BytesPerSecond / (1024 * 1024),8:F1} MB/s, p99 {pass.Latency.P99Us,8:F0}µs   "));
+
+        try
+        {
+            var result = await runner.ScanAsync(spec, progress).ConfigureAwait(false);
+
+            Console.WriteLine();
+            PrintSurfaceMap(result);
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(result, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return result.AnomalousRegions.Count > 0 ? CheckFailedExitCode : 0;
+        }
+        catch (OperationCanceledException)
+        {
+            Console.Error.WriteLine("\nScan cancelled.");
+            return 1;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static async Task<int> RunCacheAnalysisAsync(BenchmarkPlan plan, MissRatioCurveOptions options, long references, string? output)
+    {
+        Console.WriteLine($"DiskBench Cache Simulation: {plan.Name}");
+        Console.WriteLine($"  {references:N0} block references per workload, {FormatBytes(options.BlockSize)} cache blocks, {options.SamplingRate:P1} of blocks sampled");
+
+        try
+        {
+            var results = new List<object>();
+            for (int w = 0; w < plan.Workloads.Count; w++)
+            {
+                var workload = plan.Workloads[w];
+                var builder = new MissRatioCurveBuilder(options);
+                var stream = new IoStreamGenerator(workload, plan.Seed + w * 1000);
+
+                // Large IOs touch many blocks, so the stream length is set in block references rather than IOs
+                long ios = Math.Max(1, references / Math.Max(1, workload.BlockSize / options.BlockSize));
+                for (long n = 0; n < ios; n++)
+                {
+                    var io = stream.NextIo();
+                    builder.Access(io.Offset, io.Size);
+                }
+
+                var analysis = builder.Build();
+                results.Add(new { Workload = workload.GetDisplayName(), Analysis = analysis });
+                PrintMissRatioCurves(workload.GetDisplayName(), analysis);
+            }
+
+            if (output != null)
+            {
+                var json = JsonSerializer.Serialize(results, JsonOptions);
+                await File.WriteAllTextAsync(output, json).ConfigureAwait(false);
+                Console.WriteLine($"\nResults written to: {output}");
+            }
+
+            return 0;
+        }
+#pragma warning disable CA1031 // Catch general exception for CLI error handling
+        catch (Exception ex)
+#pragma warning restore CA1031
+        {
+            Console.ForegroundColor = ConsoleColor.Red;
+            Console.Error.WriteLine($"\nError: {ex.Message}");
+            Console.ResetColor();
+            return 1;
+        }
+    }
+
+    private static void PrintMissRatioCurves(string name, MissRatioAnalysis analysis)
+    {
+        var curves = analysis.Curves;
+
+        Console.WriteLine();
+        Console.WriteLine($"  {name}: footprint ~{FormatBytes(analysis.EstimatedFootprintBytes)}, " +
+                          $"{analysis.References:N0} block references ({analysis.SampledReferences:N0} sampled at {analysis.SamplingRate:P2})");
+        Console.WriteLine($"  {"Cache",10}" + string.Concat(curves.Select(c => $"{c.Policy,10}")) + "   (hit ratio)");
+
+        // Sizes well beyond the footprint all hit, so stop once every policy has levelled off
+        for (int i = 0; i < curves[0].Points.Count; i++)
+        {
+            long cacheBytes = curves[0].Points[i].CacheBytes;
+            Console.WriteLine($"  {FormatBytes(cacheBytes),10}" + string.Concat(curves.Select(c => $"{c.Points[i].HitRatio,10:P1}")));
+
+            if (cacheBytes > 2 * analysis.EstimatedFootprintBytes)
+            {
+                break;
+            }
+        }
+
+        double[] targets = [0.9, 0.95, 0.99];
+        foreach (double target in targets)
+        {
+            Console.WriteLine($"  {$"{target:P0} hit",10}" + string.Concat(curves.Select(c =>
+                $"{(c.CacheSizeForHitRatio(target) is long bytes ? FormatBytes(bytes) : "-"),10}")));
+        }
+    }
+
+    private static void PrintSurfaceMap(SurfaceScanResult result)
+    {
+        const int cellsPerLine = 64;
+        const int maxListed = 50;
+        var regions = result.Regions;
+        double median = result.MedianReadBytesPerSecond;
+
+        Console.WriteLine();
+        Console.WriteLine($"  Read throughput per {FormatBytes(result.Spec.RegionSize)} region vs median {median / (1024 * 1024):F1} MB/s");
+        Console.WriteLine("  (█ ≥90%, ▓ ≥70%, ▒ ≥50%, ░ <50%, R retries, X errors, ? incomplete)");
+
+        for (int start = 0; start < regions.Count; start += cellsPerLine)
+        {
+            var line = new StringBuilder();
+            foreach (var region in regions.Skip(start).Take(cellsPerLine))
+            {
+                double relative = median > 0 ? region.Read.BytesPerSecond / median : 0;
+                line.Append(region.Anomalies switch
+                {
+                    var a when a.HasFlag(SurfaceAnomaly.Errors) => 'X',
+                    var a when a.HasFlag(SurfaceAnomaly.Incomplete) => '?',
+                    var a when a.HasFlag(SurfaceAnomaly.Retries) => 'R',
+                    _ => relative >= 0.9 ? '█' : relative >= 0.7 ? '▓' : relative >= 0.5 ? '▒' : '░'
+                });
+            }
+
+            Console.WriteLine($"  {FormatBytes(regions[start].Offset),10} {line}");
+        }
+
+        if (result.MedianWriteBytesPerSecond.HasValue)
+        {
+            Console.WriteLine($"  Median write throughput: {result.MedianWriteBytesPerSecond.Value / (1024 * 1024):F1} MB/s");
+        }
+
+        if (result.HasZoneDropOff)
+        {
+            Console.WriteLine($"  Read throughput falls {result.ZoneDropOff:P0} from the first to the last region " +
+                              "(expected on HDDs: inner tracks are slower)");
+        }
+
+        var anomalous = result.AnomalousRegions;
+        if (anomalous.Count == 0)
+        {
+            Console.WriteLine($"  No anomalous regions ({regions.Count} scanned in {result.Duration.TotalSeconds:F0}s)");
+            return;
+        }
+
+        Console.ForegroundColor = ConsoleColor.Yellow;
+        Console.WriteLine($"  {anomalous.Count} anomalous region(s) of {regions.Count}:");
+        Console.ResetColor();
+        Console.WriteLine($"  {"Offset",10} {"Read MB/s",10} {"p99 µs",10} {"Retries",8} {"Failed",7}  Anomalies");
+        foreach (var region in anomalous.Take(maxListed))
+        {
+            long retries = (region.Read.Errors?.Retries ?? 0) + (region.Write?.Errors?.Retries ?? 0);
+            long failed = (region.Read.Errors?.Failed ?? 0) + (region.Write?.Errors?.Failed ?? 0);
+            Console.WriteLine($"  {FormatBytes(region.Offset),10} {region.Read.BytesPerSecond / (1024 * 1024),10:F1} " +
+                              $"{region.Read.Latency.P99Us,10:F0} {retries,8} {failed,7}  {region.Anomalies}");
+        }
+
+        if (anomalous.Count > maxListed)
+        {
+            Console.WriteLine($"  ... {anomalous.Count - maxListed} more (see --output)");
+        }
+    }
+
     private static void DisplayDiskInfo(string path)
     {
         var fullPath = Path.GetFullPath(path);
@@ -688,7 +2464,25 @@ internal static class Program
         Console.WriteLine("╚══════════════════════════════════════════════════════════════════════════════╝");
     }
 
-    private static BenchmarkPlan CreateDefaultPlan(string file, long fileSize, int trials, int duration, int warmup, bool noBuffering)
+    private static BenchmarkPlan WithObjectives(BenchmarkPlan plan, IReadOnlyList<ServiceLevelObjective> objectives)
+    {
+        if (objectives.Count == 0)
+        {
+            return plan;
+        }
+
+        return plan with { Workloads = [.. plan.Workloads.Select(w => w with { Objectives = objectives })] };
+    }
+
+    private static BenchmarkPlan CreateDefaultPlan(
+        string file,
+        long fileSize,
+        int trials,
+        int duration,
+        int warmup,
+        bool noBuffering,
+        double? slowMs,
+        IoErrorPolicy? errorPolicy)
     {
         return new BenchmarkPlan
         {
@@ -743,7 +2537,9 @@ internal static class Program
             Trials = trials,
             WarmupDuration = TimeSpan.FromSeconds(warmup),
             MeasuredDuration = TimeSpan.FromSeconds(duration),
-            CollectTimeSeries = true
+            CollectTimeSeries = true,
+            SlowIoThreshold = slowMs.HasValue ? TimeSpan.FromMilliseconds(slowMs.Value) : null,
+            ErrorPolicy = errorPolicy
         };
     }
 
@@ -0,0 +1,82 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Base class for engines that wrap another engine (fault injection, instrumentation, etc.).
+/// Every member forwards to the inner engine; override only what the decorator changes.
+/// </summary>
+public abstract class BenchmarkEngineDecorator : IBenchmarkEngine
+{
+    private bool _disposed;
+
+    /// <summary>
+    /// Creates a decorator over an inner engine.
+    /// </summary>
+    /// <param name="inner">The engine to wrap.</param>
+    /// <param name="ownsInner">Whether disposing the decorator disposes the inner engine.</param>
+    protected BenchmarkEngineDecorator(IBenchmarkEngine inner, bool ownsInner = true)
+    {
+        Inner = inner ?? throw new ArgumentNullException(nameof(inner));
+        OwnsInner = ownsInner;
+    }
+
+    /// <summary>
+    /// The wrapped engine.
+    /// </summary>
+    protected IBenchmarkEngine Inner { get; }
+
+    /// <summary>
+    /// Whether disposing the decorator disposes the inner engine.
+    /// </summary>
+    protected bool OwnsInner { get; }
+
+    /// <inheritdoc />
+    public virtual Task<PrepareResult> PrepareAsync(
+        PrepareSpec spec,
+        IProgress<double>? progress = null,
+        CancellationToken cancellationToken = default)
+    {
+        return Inner.PrepareAsync(spec, progress, cancellationToken);
+    }
+
+    /// <inheritdoc />
+    public virtual Task<TrialResult> RunTrialAsync(
+        TrialSpec spec,
+        IProgress<TrialProgress>? progress = null,
+        CancellationToken cancellationToken = default)
+    {
+        return Inner.RunTrialAsync(spec, progress, cancellationToken);
+    }
+
+    /// <inheritdoc />
+    public virtual int GetSectorSize(string filePath) => Inner.GetSectorSize(filePath);
+
+    /// <inheritdoc />
+    public virtual DriveDetails? GetDriveDetails(string drivePath) => Inner.GetDriveDetails(drivePath);
+
+    /// <inheritdoc />
+    public virtual IReadOnlyList<DriveDetails> GetAllDriveDetails() => Inner.GetAllDriveDetails();
+
+    /// <inheritdoc />
+    public async ValueTask DisposeAsync()
+    {
+        if (_disposed)
+        {
+            return;
+        }
+
+        _disposed = true;
+        await DisposeAsyncCore().ConfigureAwait(false);
+        GC.SuppressFinalize(this);
+    }
+
+    /// <summary>
+    /// Releases the decorator's resources. The default disposes the inner engine if owned.
+    /// </summary>
+    protected virtual async ValueTask DisposeAsyncCore()
+    {
+        if (OwnsInner)
+        {
+            await Inner.DisposeAsync().ConfigureAwait(false);
+        }
+    }
+}
@@ -1,3 +1,7 @@
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using DiskBench.Metrics;
+
 namespace DiskBench.Core;
 
 /// <summary>
@@ -5,18 +9,34 @@ namespace DiskBench.Core;
 /// </summary>
 public sealed class BenchmarkRunner
 {
+    private const int ProbeSequentialBlockSize = 1024 * 1024;
+
+    private static readonly TimeSpan WriteBackSampleInterval = TimeSpan.FromMilliseconds(100);
+
     private readonly IBenchmarkEngine _engine;
     private readonly IBenchmarkSink _sink;
+    private readonly IEnergyMeter? _energyMeter;
+    private readonly IWriteBackMonitor? _writeBackMonitor;
+    private bool _energyFailed;
+    private bool _writeBackFailed;
 
     /// <summary>
     /// Creates a new benchmark runner.
     /// </summary>
     /// <param name="engine">The IO engine to use.</param>
     /// <param name="sink">Sink for benchmark events.</param>
-    public BenchmarkRunner(IBenchmarkEngine engine, IBenchmarkSink? sink = null)
+    /// <param name="energyMeter">Optional energy counters sampled around each trial.</param>
+    /// <param name="writeBackMonitor">Optional page cache counters sampled during buffered write trials.</param>
+    public BenchmarkRunner(
+        IBenchmarkEngine engine,
+        IBenchmarkSink? sink = null,
+        IEnergyMeter? energyMeter = null,
+        IWriteBackMonitor? writeBackMonitor = null)
     {
         _engine = engine ?? throw new ArgumentNullException(nameof(engine));
         _sink = sink ?? NullBenchmarkSink.Instance;
+        _energyMeter = energyMeter;
+        _writeBackMonitor = writeBackMonitor;
     }
 
     /// <summary>
@@ -34,6 +54,23 @@ public sealed class BenchmarkRunner
 
         ValidatePlan(plan);
 
+        if (plan.TraceDirectory != null)
+        {
+            Directory.CreateDirectory(plan.TraceDirectory);
+        }
+
+        _energyFailed = false;
+        _writeBackFailed = false;
+        if (_energyMeter != null && !_energyMeter.IsAvailable)
+        {
+            _sink.OnWarning($"Energy counters unavailable, efficiency will not be reported: {_energyMeter.Description}");
+        }
+
+        if (_writeBackMonitor != null && !_writeBackMonitor.IsAvailable)
+        {
+            _sink.OnWarning($"Write-back counters unavailable, stalls will not be analysed: {_writeBackMonitor.Description}");
+        }
+
         Dictionary<string, FileStream>? deleteOnCloseHandles = null;
         HashSet<string>? deleteOnCloseDirectories = null;
         if (plan.DeleteOnComplete)
@@ -96,7 +133,7 @@ public sealed class BenchmarkRunner
             Workloads = workloadResults,
             StartTime = startTime,
             EndTime = endTime,
-            SystemInfo = CollectSystemInfo()
+            SystemInfo = CollectSystemInfo(plan)
         };
 
         _sink.OnBenchmarkComplete(benchmarkResult);
@@ -104,6 +141,401 @@ public sealed class BenchmarkRunner
         return benchmarkResult;
     }
 
+    /// <summary>
+    /// Runs a quick screening probe: sequential read/write throughput and 4K QD1/QD32 random read IOPS.
+    /// Each workload runs short slices until its 95% confidence band reaches the target or its share
+    /// of the time budget is used up, so a whole probe completes in about the configured budget.
+    /// </summary>
+    /// <param name="spec">The probe specification.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    /// <returns>Probe estimates with confidence bands.</returns>
+    public async Task<ProbeResult> ProbeAsync(ProbeSpec spec, CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(spec);
+
+        ValidateProbe(spec);
+
+        var startTime = DateTimeOffset.UtcNow;
+        var workloads = CreateProbeWorkloads(spec);
+
+        var prepareStart = Stopwatch.GetTimestamp();
+        var prepareResult = await PrepareFileAsync(
+                spec.FilePath,
+                spec.FileSize,
+                spec.ReuseExistingFile,
+                cancellationToken)
+            .ConfigureAwait(false);
+        var prepareDuration = Stopwatch.GetElapsedTime(prepareStart);
+
+        var measurements = new List<ProbeMeasurement>();
+#pragma warning disable CA5394 // Random.Shared is appropriate for seed generation, not security
+        var seed = spec.Seed != 0 ? spec.Seed : Random.Shared.Next();
+#pragma warning restore CA5394
+        var workloadBudget = spec.TimeBudget / workloads.Count;
+
+        try
+        {
+            for (int i = 0; i < workloads.Count; i++)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+
+                ValidateAlignment(workloads[i], prepareResult.LogicalSectorSize);
+                var measurement = await ProbeWorkloadAsync(
+                        spec,
+                        workloads[i],
+                        seed + i * 1000,
+                        workloadBudget,
+                        prepareResult.LogicalSectorSize,
+                        cancellationToken)
+                    .ConfigureAwait(false);
+                measurements.Add(measurement);
+            }
+        }
+        finally
+        {
+            if (spec.DeleteOnComplete)
+            {
+                CleanupTestFiles([spec.FilePath]);
+            }
+        }
+
+        return new ProbeResult
+        {
+            Spec = spec,
+            Measurements = measurements,
+            PrepareDuration = prepareDuration,
+            StartTime = startTime,
+            EndTime = DateTimeOffset.UtcNow
+        };
+    }
+
+    private static void ValidateProbe(ProbeSpec spec)
+    {
+        if (string.IsNullOrWhiteSpace(spec.FilePath))
+        {
+            throw new ArgumentException("Probe file path cannot be empty.", nameof(spec));
+        }
+
+        if (spec.FileSize < ProbeSequentialBlockSize)
+        {
+            throw new ArgumentException($"Probe file size must be at least {ProbeSequentialBlockSize} bytes: {spec.FileSize}", nameof(spec));
+        }
+
+        if (spec.TimeBudget <= TimeSpan.Zero || spec.SliceDuration <= TimeSpan.Zero)
+        {
+            throw new ArgumentException("Probe time budget and slice duration must be positive.", nameof(spec));
+        }
+
+        if (spec.MinSlices < 2)
+        {
+            throw new ArgumentException($"Probe needs at least 2 slices for a confidence band: {spec.MinSlices}", nameof(spec));
+        }
+
+        if (spec.TargetRelativeError <= 0)
+        {
+            throw new ArgumentException($"Target relative error must be positive: {spec.TargetRelativeError}", nameof(spec));
+        }
+    }
+
+    private static List<WorkloadSpec> CreateProbeWorkloads(ProbeSpec spec)
+    {
+        return
+        [
+            new WorkloadSpec
+            {
+                Name = "Seq Read 1M Q8",
+                FilePath = spec.FilePath,
+                FileSize = spec.FileSize,
+                BlockSize = ProbeSequentialBlockSize,
+                Pattern = AccessPattern.Sequential,
+                WritePercent = 0,
+                QueueDepth = 8
+            },
+            new WorkloadSpec
+            {
+                Name = "Seq Write 1M Q8",
+                FilePath = spec.FilePath,
+                FileSize = spec.FileSize,
+                BlockSize = ProbeSequentialBlockSize,
+                Pattern = AccessPattern.Sequential,
+                WritePercent = 100,
+                QueueDepth = 8
+            },
+            new WorkloadSpec
+            {
+                Name = "Rand Read 4K Q1",
+                FilePath = spec.FilePath,
+                FileSize = spec.FileSize,
+                BlockSize = 4096,
+                Pattern = AccessPattern.Random,
+                WritePercent = 0,
+                QueueDepth = 1
+            },
+            new WorkloadSpec
+            {
+                Name = "Rand Read 4K Q32",
+                FilePath = spec.FilePath,
+                FileSize = spec.FileSize,
+                BlockSize = 4096,
+                Pattern = AccessPattern.Random,
+                WritePercent = 0,
+                QueueDepth = 32
+            }
+        ];
+    }
+
+    private async Task<ProbeMeasurement> ProbeWorkloadAsync(
+        ProbeSpec spec,
+        WorkloadSpec workload,
+        int seed,
+        TimeSpan budget,
+        int sectorSize,
+        CancellationToken cancellationToken)
+    {
+        var start = Stopwatch.GetTimestamp();
+        var slices = new List<TrialResult>();
+        var iops = new List<double>();
+        double relativeError = double.PositiveInfinity;
+        bool converged = false;
+
+        while (true)
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            var trialSpec = new TrialSpec
+            {
+                Workload = workload,
+                WarmupDuration = slices.Count == 0 ? spec.WarmupDuration : TimeSpan.Zero,
+                MeasuredDuration = spec.SliceDuration,
+                Seed = seed + slices.Count,
+                TrialNumber = slices.Count + 1,
+                CollectTimeSeries = false,
+                SectorSize = sectorSize
+            };
+
+            var result = await _engine.RunTrialAsync(trialSpec, null, cancellationToken).ConfigureAwait(false);
+            slices.Add(result);
+            iops.Add(result.Iops);
+
+            if (iops.Count >= 2)
+            {
+                var (lower, upper) = StatisticalAggregation.StudentTConfidenceInterval(CollectionsMarshal.AsSpan(iops));
+                var mean = (lower + upper) / 2;
+                relativeError = mean > 0 ? (upper - lower) / 2 / mean : double.PositiveInfinity;
+            }
+
+            if (slices.Count >= spec.MinSlices && relativeError <= spec.TargetRelativeError)
+            {
+                converged = true;
+                break;
+            }
+
+            // Stop when another slice would overrun this workload's share of the budget
+            if (slices.Count >= 2 && Stopwatch.GetElapsedTime(start) + spec.SliceDuration > budget)
+            {
+                break;
+            }
+        }
+
+        var bytesPerSecond = slices.Select(s => s.BytesPerSecond).ToArray();
+        var iopsValues = iops.ToArray();
+
+        return new ProbeMeasurement
+        {
+            Workload = workload,
+            Slices = slices.Count,
+            Converged = converged,
+            MeanBytesPerSecond = bytesPerSecond.Average(),
+            MeanIops = iopsValues.Average(),
+            BytesPerSecondBand = StatisticalAggregation.StudentTConfidenceInterval(bytesPerSecond),
+            IopsBand = StatisticalAggregation.StudentTConfidenceInterval(iopsValues),
+            RelativeError = relativeError,
+            MeanLatency = AverageLatency(slices),
+            Elapsed = Stopwatch.GetElapsedTime(start)
+        };
+    }
+
+    /// <summary>
+    /// Scans the whole file once in large sequential blocks at high queue depth (optionally writing
+    /// each region before reading it back) and maps throughput, latency and errors per region.
+    /// Each pass over a region is one engine trial limited to the region's blocks, so the scan runs
+    /// on the same aligned slot table and completion loop as any benchmark.
+    /// </summary>
+    /// <param name="spec">The scan specification.</param>
+    /// <param name="progress">Optional progress reporter, called after every pass.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    /// <returns>The per-region map with anomalies flagged.</returns>
+    public async Task<SurfaceScanResult> ScanAsync(
+        SurfaceScanSpec spec,
+        IProgress<SurfacePass>? progress = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(spec);
+
+        ValidateScan(spec);
+
+        var startTime = DateTimeOffset.UtcNow;
+        long fileSize = spec.FileSize > 0 ? spec.FileSize : GetExistingFileSize(spec.FilePath);
+
+        var prepareStart = Stopwatch.GetTimestamp();
+        var prepareResult = await PrepareFileAsync(spec.FilePath, fileSize, spec.ReuseExistingFile, cancellationToken)
+            .ConfigureAwait(false);
+        var prepareDuration = Stopwatch.GetElapsedTime(prepareStart);
+
+        // A tail shorter than one block is not scanned
+        long scanLength = fileSize / spec.BlockSize * spec.BlockSize;
+        var reads = new List<SurfacePass>();
+        var writes = new List<SurfacePass>();
+
+        try
+        {
+            for (long offset = 0; offset < scanLength; offset += spec.RegionSize)
+            {
+                long length = Math.Min(spec.RegionSize, scanLength - offset);
+                var region = new FileRegion(offset, length);
+
+                if (spec.Write)
+                {
+                    var write = await ScanPassAsync(spec, fileSize, region, true, reads.Count, prepareResult.LogicalSectorSize, cancellationToken)
+                        .ConfigureAwait(false);
+                    writes.Add(write);
+                    progress?.Report(write);
+                }
+
+                var read = await ScanPassAsync(spec, fileSize, region, false, reads.Count, prepareResult.LogicalSectorSize, cancellationToken)
+                    .ConfigureAwait(false);
+                reads.Add(read);
+                progress?.Report(read);
+            }
+        }
+        finally
+        {
+            if (spec.DeleteOnComplete)
+            {
+                CleanupTestFiles([spec.FilePath]);
+            }
+        }
+
+        var readAnomalies = SurfaceScanAnalysis.FindAnomalies(reads, spec);
+        var writeAnomalies = spec.Write ? SurfaceScanAnalysis.FindAnomalies(writes, spec) : null;
+
+        return new SurfaceScanResult
+        {
+            Spec = spec,
+            FileSize = fileSize,
+            Regions = reads.Select((read, i) => new SurfaceRegion
+            {
+                Index = i,
+                Read = read,
+                Write = spec.Write ? writes[i] : null,
+                Anomalies = readAnomalies[i] | (writeAnomalies?[i] ?? SurfaceAnomaly.None)
+            }).ToList(),
+            MedianReadBytesPerSecond = StatisticalAggregation.Median(reads.Select(r => r.BytesPerSecond).ToArray()),
+            MedianWriteBytesPerSecond = spec.Write ? StatisticalAggregation.Median(writes.Select(w => w.BytesPerSecond).ToArray()) : null,
+            ZoneDropOff = SurfaceScanAnalysis.ZoneDropOff(reads),
+            PrepareDuration = prepareDuration,
+            StartTime = startTime,
+            EndTime = DateTimeOffset.UtcNow
+        };
+    }
+
+    private static void ValidateScan(SurfaceScanSpec spec)
+    {
+        if (string.IsNullOrWhiteSpace(spec.FilePath))
+        {
+            throw new ArgumentException("Scan file path cannot be empty.", nameof(spec));
+        }
+
+        if (spec.FileSize < 0)
+        {
+            throw new ArgumentException($"Invalid file size: {spec.FileSize}", nameof(spec));
+        }
+
+        if (spec.BlockSize <= 0 || spec.QueueDepth <= 0)
+        {
+            throw new ArgumentException($"Invalid block size or queue depth: {spec.BlockSize}, {spec.QueueDepth}", nameof(spec));
+        }
+
+        if (spec.RegionSize < spec.BlockSize || spec.RegionSize % spec.BlockSize != 0)
+        {
+            throw new ArgumentException($"Region size must be a multiple of the block size ({spec.BlockSize}): {spec.RegionSize}", nameof(spec));
+        }
+
+        if (spec.RegionTimeout <= TimeSpan.Zero)
+        {
+            throw new ArgumentException("Region timeout must be positive.", nameof(spec));
+        }
+
+        if (spec.NeighbourRegions < 1 || spec.SlowRegionFactor is <= 0 or >= 1 || spec.HighLatencyFactor <= 1)
+        {
+            throw new ArgumentException("Anomaly thresholds need at least one neighbour, a slow factor in (0, 1) and a latency factor above 1.", nameof(spec));
+        }
+    }
+
+    private static long GetExistingFileSize(string filePath)
+    {
+        var file = new FileInfo(filePath);
+        if (!file.Exists)
+        {
+            throw new ArgumentException($"File does not exist and no scan size was given: {filePath}");
+        }
+
+        return file.Length;
+    }
+
+    private async Task<SurfacePass> ScanPassAsync(
+        SurfaceScanSpec spec,
+        long fileSize,
+        FileRegion region,
+        bool isWrite,
+        int regionIndex,
+        int sectorSize,
+        CancellationToken cancellationToken)
+    {
+        cancellationToken.ThrowIfCancellationRequested();
+
+        var workload = new WorkloadSpec
+        {
+            Name = $"Scan {(isWrite ? "Write" : "Read")} @{region.Offset}",
+            FilePath = spec.FilePath,
+            FileSize = fileSize,
+            BlockSize = spec.BlockSize,
+            Pattern = AccessPattern.Sequential,
+            WritePercent = isWrite ? 100 : 0,
+            QueueDepth = spec.QueueDepth,
+            Region = region
+        };
+        ValidateAlignment(workload, sectorSize);
+
+        long blocks = region.Length / spec.BlockSize;
+        var trialSpec = new TrialSpec
+        {
+            Workload = workload,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = spec.RegionTimeout,
+            IoLimit = blocks,
+            Seed = regionIndex + 1,
+            TrialNumber = regionIndex + 1,
+            SectorSize = sectorSize,
+            ErrorPolicy = spec.ErrorPolicy
+        };
+
+        var result = await _engine.RunTrialAsync(trialSpec, null, cancellationToken).ConfigureAwait(false);
+        long failed = result.Errors?.Failed ?? 0;
+
+        return new SurfacePass
+        {
+            Offset = region.Offset,
+            Length = region.Length,
+            IsWrite = isWrite,
+            BytesTransferred = result.TotalBytes,
+            Duration = result.Duration,
+            Latency = result.Latency,
+            Errors = result.Errors,
+            Complete = result.TotalOperations + failed >= blocks
+        };
+    }
+
     private void ValidatePlan(BenchmarkPlan plan)
     {
         if (plan.Workloads.Count == 0)
@@ -111,6 +543,39 @@ public sealed class BenchmarkRunner
             throw new ArgumentException("Plan must contain at least one workload.", nameof(plan));
         }
 
+        if (plan.ErrorPolicy is { MaxRetries: < 0 })
+        {
+            throw new ArgumentException($"Max retries cannot be negative: {plan.ErrorPolicy.MaxRetries}", nameof(plan));
+        }
+
+        if (plan.SlowIoTopK < 0)
+        {
+            throw new ArgumentException($"Slow IO top-K cannot be negative: {plan.SlowIoTopK}", nameof(plan));
+        }
+
+        if (plan.MinTailSamples < 0)
+        {
+            throw new ArgumentException($"Minimum tail samples cannot be negative: {plan.MinTailSamples}", nameof(plan));
+        }
+
+        if (plan.WriteStallThreshold <= TimeSpan.Zero)
+        {
+            throw new ArgumentException($"Write stall threshold must be positive: {plan.WriteStallThreshold}", nameof(plan));
+        }
+
+        if (plan.Content is { } content)
+        {
+            if (content.BlockSize <= 0 || content.BlockSize % 512 != 0)
+            {
+                throw new ArgumentException($"Content block size must be a positive multiple of 512: {content.BlockSize}", nameof(plan));
+            }
+
+            if (!(content.UniqueBlockRatio > 0 && content.UniqueBlockRatio <= 1))
+            {
+                throw new ArgumentException($"Unique block ratio must be in (0, 1]: {content.UniqueBlockRatio}", nameof(plan));
+            }
+        }
+
         foreach (var workload in plan.Workloads)
         {
             ValidateWorkload(workload);
@@ -149,13 +614,48 @@ public sealed class BenchmarkRunner
             throw new ArgumentException($"Write percent must be 0-100: {workload.WritePercent}");
         }
 
+        if (workload.FileSet is { FileCount: <= 0 })
+        {
+            throw new ArgumentException($"File set must contain at least one file: {workload.FileSet.FileCount}");
+        }
+
+        if (workload.FileSet is { Distribution: FileDistribution.Zipf, ZipfExponent: <= 0 or double.NaN })
+        {
+            throw new ArgumentException($"Zipf exponent must be positive: {workload.FileSet.ZipfExponent}");
+        }
+
+        // Load custom generators now, so a bad plan fails before any file is prepared
+        if (workload.Generator != null)
+        {
+            IoGeneratorLoader.Load(workload.Generator);
+        }
+
+        foreach (var objective in workload.Objectives ?? [])
+        {
+            if (objective.Threshold <= 0)
+            {
+                throw new ArgumentException($"Objective threshold must be positive: {objective}");
+            }
+
+            if (objective.Metric == SloMetric.Latency && !LatencyPercentiles.IsRecordedPercentile(objective.Percentile))
+            {
+                throw new ArgumentException($"Objective percentile must be 0, 50, 90, 95, 99, 99.9 or 100: {objective.Percentile}");
+            }
+
+            if (objective.IntervalCompliance is <= 0 or > 1)
+            {
+                throw new ArgumentException($"Interval compliance must be in (0, 1]: {objective.IntervalCompliance}");
+            }
+        }
+
         // Warn about potential issues (only for buffered IO where caching matters)
         if (!workload.NoBuffering)
         {
             var ramBytes = GC.GetGCMemoryInfo().TotalAvailableMemoryBytes;
-            if (workload.FileSize < ramBytes)
+            var dataSize = workload.FileSize * (workload.FileSet?.FileCount ?? 1);
+            if (dataSize < ramBytes)
             {
-                _sink.OnWarning($"Test file ({FormatBytes(workload.FileSize)}) fits in RAM ({FormatBytes(ramBytes)}). " +
+                _sink.OnWarning($"Test file ({FormatBytes(dataSize)}) fits in RAM ({FormatBytes(ramBytes)}). " +
                     "Buffered reads may be served from memory cache instead of disk. " +
                     "Use a larger file or enable NO_BUFFERING for accurate disk performance.");
             }
@@ -170,10 +670,15 @@ public sealed class BenchmarkRunner
     {
         // Get unique file paths from all workloads
         var filePaths = plan.Workloads
-            .Select(w => w.FilePath)
+            .SelectMany(w => w.GetFilePaths())
             .Distinct(StringComparer.OrdinalIgnoreCase)
             .ToList();
 
+        CleanupTestFiles(filePaths);
+    }
+
+    private void CleanupTestFiles(IEnumerable<string> filePaths)
+    {
         foreach (var filePath in filePaths)
         {
             try
@@ -183,6 +688,8 @@ public sealed class BenchmarkRunner
                     File.Delete(filePath);
                 }
 
+                PrepareManifest.Delete(filePath);
+
                 var directory = Path.GetDirectoryName(filePath);
                 if (!string.IsNullOrEmpty(directory) &&
                     Directory.Exists(directory) &&
@@ -211,57 +718,59 @@ public sealed class BenchmarkRunner
         HashSet<string>? deleteOnCloseDirectories,
         CancellationToken cancellationToken)
     {
-        // Prepare the file
-        var prepareSpec = new PrepareSpec
-        {
-            FilePath = workload.FilePath,
-            FileSize = workload.FileSize,
-            ReuseIfExists = plan.ReuseExistingFiles
-        };
-
-        var prepareResult = await _engine.PrepareAsync(prepareSpec, null, cancellationToken).ConfigureAwait(false);
-
-        if (prepareResult.Warnings != null)
+        // Prepare the file, or every file of a file set
+        var filePaths = workload.GetFilePaths();
+        var prepareResult = await PrepareFileAsync(
+                filePaths[0],
+                workload.FileSize,
+                plan.ReuseExistingFiles,
+                cancellationToken,
+                plan.Content)
+            .ConfigureAwait(false);
+
+        // Files of a set get their own seeds so they share no blocks
+        for (int f = 1; f < filePaths.Count; f++)
         {
-            foreach (var warning in prepareResult.Warnings)
-            {
-                _sink.OnWarning(warning);
-            }
+            var content = plan.Content != null ? plan.Content with { Seed = plan.Content.Seed + f } : null;
+            await PrepareFileAsync(filePaths[f], workload.FileSize, plan.ReuseExistingFiles, cancellationToken, content).ConfigureAwait(false);
         }
 
         if (deleteOnCloseHandles != null)
         {
-            EnsureDeleteOnCloseHandle(prepareResult.FilePath, deleteOnCloseHandles, deleteOnCloseDirectories);
-        }
-
-        // Validate alignment for NO_BUFFERING
-        if (workload.NoBuffering)
-        {
-            var sectorSize = prepareResult.LogicalSectorSize;
-            if (workload.BlockSize % sectorSize != 0)
+            foreach (var filePath in filePaths)
             {
-                throw new InvalidOperationException(
-                    $"Block size ({workload.BlockSize}) must be a multiple of sector size ({sectorSize}) for unbuffered IO.");
-            }
-
-            if (workload.Region.Offset % sectorSize != 0)
-            {
-                throw new InvalidOperationException(
-                    $"Region offset ({workload.Region.Offset}) must be aligned to sector size ({sectorSize}) for unbuffered IO.");
+                EnsureDeleteOnCloseHandle(filePath, deleteOnCloseHandles, deleteOnCloseDirectories);
             }
         }
 
+        ValidateAlignment(workload, prepareResult.LogicalSectorSize);
+
         // Run trials
         var trialResults = new List<TrialResult>();
+        var energyMeter = _energyMeter?.IsAvailable == true && !_energyFailed ? _energyMeter : null;
+        var energyIntervals = new List<(EnergySample Start, EnergySample End)>();
+
+        // Write-back analysis needs per-second throughput and every stalled write logged
+        var writeBackMonitor = _writeBackMonitor?.IsAvailable == true && !_writeBackFailed && workload.WritePercent > 0 && !workload.NoBuffering
+            ? _writeBackMonitor
+            : null;
+        var writeBack = writeBackMonitor != null ? new List<WriteBackResult>() : null;
+        var slowIoThreshold = plan.SlowIoThreshold;
+        if (writeBackMonitor != null && (slowIoThreshold == null || slowIoThreshold > plan.WriteStallThreshold))
+        {
+            slowIoThreshold = plan.WriteStallThreshold;
+        }
 #pragma warning disable CA5394 // Random.Shared is appropriate for seed generation, not security
         var seed = plan.Seed != 0 ? plan.Seed : Random.Shared.Next();
 #pragma warning restore CA5394
 
+        var workloadName = workload.GetDisplayName();
         for (int trial = 1; trial <= plan.Trials; trial++)
         {
             cancellationToken.ThrowIfCancellationRequested();
 
             _sink.OnTrialStart(workload, trial, plan.Trials);
+            DiskBenchEventSource.Log.TrialStart(workloadName, trial, plan.Trials);
 
             var trialSpec = new TrialSpec
             {
@@ -270,20 +779,253 @@ public sealed class BenchmarkRunner
                 MeasuredDuration = plan.MeasuredDuration,
                 Seed = seed + workloadIndex * 1000 + trial,
                 TrialNumber = trial,
-                CollectTimeSeries = plan.CollectTimeSeries,
+                CollectTimeSeries = plan.CollectTimeSeries || workload.Objectives is { Count: > 0 } || writeBackMonitor != null,
+                CollectIntervalLatency = workload.Objectives?.Any(o => o.Metric == SloMetric.Latency) == true || writeBackMonitor != null,
                 TrackAllocations = plan.TrackAllocations,
-                SectorSize = prepareResult.LogicalSectorSize
+                SectorSize = prepareResult.LogicalSectorSize,
+                SlowIoTopK = plan.SlowIoTopK,
+                SlowIoThreshold = slowIoThreshold,
+                StuckIoTimeout = plan.StuckIoTimeout,
+                ErrorPolicy = plan.ErrorPolicy,
+                TracePath = plan.TraceDirectory != null
+                    ? Path.Combine(plan.TraceDirectory, $"workload{workloadIndex + 1}-trial{trial}.iotrace")
+                    : null
             };
 
-            var progress = new Progress<TrialProgress>(p => _sink.OnTrialProgress(workload, trial, p));
-            var result = await _engine.RunTrialAsync(trialSpec, progress, cancellationToken).ConfigureAwait(false);
+            int trialNumber = trial;
+            var progress = new Progress<TrialProgress>(p =>
+            {
+                _sink.OnTrialProgress(workload, trialNumber, p);
+                DiskBenchEventSource.Log.ReportProgress(workloadName, trialNumber, p);
+            });
+            var energyStart = energyMeter != null ? TryReadEnergy(energyMeter) : null;
+            TrialResult result;
+            if (writeBackMonitor != null && !_writeBackFailed)
+            {
+                var samples = new List<WriteBackSample>();
+                using var samplingCts = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+                var sampling = SampleWriteBackAsync(writeBackMonitor, samples, samplingCts.Token);
+                try
+                {
+                    result = await _engine.RunTrialAsync(trialSpec, progress, cancellationToken).ConfigureAwait(false);
+                }
+                finally
+                {
+                    await samplingCts.CancelAsync().ConfigureAwait(false);
+                    await sampling.ConfigureAwait(false);
+                }
+
+                if (TryReadWriteBack(writeBackMonitor) is { } last)
+                {
+                    samples.Add(last);
+
+                    // Fall back to the end of the trial less its duration for engines that don't report the window start
+                    var measuredStart = result.MeasuredStartTimestamp != 0
+                        ? result.MeasuredStartTimestamp
+                        : samples[^1].Timestamp - (long)(result.Duration.TotalSeconds * Stopwatch.Frequency);
+                    writeBack!.Add(WriteBackAnalysis.Analyze(result, samples, measuredStart, writeBackMonitor.Description, plan.WriteStallThreshold));
+                }
+            }
+            else
+            {
+                result = await _engine.RunTrialAsync(trialSpec, progress, cancellationToken).ConfigureAwait(false);
+            }
+
+            if (energyMeter != null && energyStart.HasValue && TryReadEnergy(energyMeter) is { } energyEnd)
+            {
+                energyIntervals.Add((energyStart.Value, energyEnd));
+            }
 
             trialResults.Add(result);
             _sink.OnTrialComplete(workload, trial, result);
+            DiskBenchEventSource.Log.ReportTrialComplete(workloadName, trial, result);
         }
 
         // Aggregate results
-        return AggregateTrials(workload, trialResults, plan.ComputeConfidenceIntervals, plan.BootstrapIterations);
+        var aggregate = AggregateTrials(workload, trialResults, plan.ComputeConfidenceIntervals, plan.BootstrapIterations, plan.MinTailSamples);
+        var noisy = aggregate.LatencyCI?.Where(ci => ci.InsufficientSamples).ToList();
+        if (noisy is { Count: > 0 })
+        {
+            _sink.OnWarning($"{workloadName}: " +
+                string.Join(", ", noisy.Select(ci => $"p{ci.Percentile} rests on {ci.TailSamples} samples above it")) +
+                $" (fewer than {plan.MinTailSamples}); treat changes in these percentiles as noise or run longer.");
+        }
+        if (energyMeter != null && !_energyFailed && energyIntervals.Count > 0)
+        {
+            aggregate = aggregate with { Energy = ComputeEnergy(energyMeter.Description, aggregate, energyIntervals) };
+        }
+
+        if (workload.Objectives is { Count: > 0 })
+        {
+            aggregate = aggregate with { Objectives = SloEvaluator.Evaluate(workload.Objectives, trialResults) };
+        }
+
+        if (writeBack is { Count: > 0 } && !_writeBackFailed)
+        {
+            aggregate = aggregate with { WriteBack = writeBack };
+        }
+
+        return aggregate;
+    }
+
+    /// <summary>
+    /// Samples the write-back counters until cancelled or a read fails, starting immediately.
+    /// </summary>
+    private async Task SampleWriteBackAsync(IWriteBackMonitor monitor, List<WriteBackSample> samples, CancellationToken cancellationToken)
+    {
+        using var timer = new PeriodicTimer(WriteBackSampleInterval);
+        try
+        {
+            do
+            {
+                if (TryReadWriteBack(monitor) is not { } sample)
+                {
+                    return;
+                }
+
+                samples.Add(sample);
+            }
+            while (await timer.WaitForNextTickAsync(cancellationToken).ConfigureAwait(false));
+        }
+        catch (OperationCanceledException)
+        {
+        }
+    }
+
+    private static EnergyResult ComputeEnergy(
+        string source,
+        WorkloadResult result,
+        List<(EnergySample Start, EnergySample End)> intervals)
+    {
+        double packageJoules = 0;
+        double? dramJoules = null;
+        var sampled = TimeSpan.Zero;
+
+        foreach (var (start, end) in intervals)
+        {
+            packageJoules += end.PackageJoules - start.PackageJoules;
+            if (start.DramJoules.HasValue && end.DramJoules.HasValue)
+            {
+                dramJoules = (dramJoules ?? 0) + end.DramJoules.Value - start.DramJoules.Value;
+            }
+
+            sampled += Stopwatch.GetElapsedTime(start.Timestamp, end.Timestamp);
+        }
+
+        var seconds = sampled.TotalSeconds;
+        var packageWatts = seconds > 0 ? packageJoules / seconds : 0;
+        double? dramWatts = dramJoules.HasValue && seconds > 0 ? dramJoules.Value / seconds : null;
+        var watts = packageWatts + (dramWatts ?? 0);
+        var gigabytesPerSecond = result.MeanBytesPerSecond / 1e9;
+
+        return new EnergyResult
+        {
+            Source = source,
+            Joules = packageJoules + (dramJoules ?? 0),
+            SampledDuration = sampled,
+            PackageWatts = packageWatts,
+            DramWatts = dramWatts,
+            IopsPerWatt = watts > 0 ? result.MeanIops / watts : 0,
+            JoulesPerGigabyte = gigabytesPerSecond > 0 ? watts / gigabytesPerSecond : 0
+        };
+    }
+
+    /// <summary>
+    /// Reads the energy counters. A failed read drops energy from the rest of the run with one warning
+    /// instead of aborting the benchmark.
+    /// </summary>
+    private EnergySample? TryReadEnergy(IEnergyMeter meter)
+    {
+        if (_energyFailed)
+        {
+            return null;
+        }
+
+        try
+        {
+            return meter.Read();
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException or FormatException or OverflowException)
+        {
+            _energyFailed = true;
+            _sink.OnWarning($"Energy counters could not be read, efficiency will not be reported: {ex.Message}");
+            return null;
+        }
+    }
+
+    /// <summary>
+    /// Reads the write-back counters. A failed read drops write-back analysis from the rest of the run
+    /// with one warning instead of aborting the trial.
+    /// </summary>
+    private WriteBackSample? TryReadWriteBack(IWriteBackMonitor monitor)
+    {
+        if (_writeBackFailed)
+        {
+            return null;
+        }
+
+        try
+        {
+            return monitor.Read();
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException or FormatException or OverflowException or InvalidOperationException)
+        {
+            _writeBackFailed = true;
+            _sink.OnWarning($"Write-back counters could not be read, stalls will not be analysed: {ex.Message}");
+            return null;
+        }
+    }
+
+    private async Task<PrepareResult> PrepareFileAsync(
+        string filePath,
+        long fileSize,
+        bool reuseIfExists,
+        CancellationToken cancellationToken,
+        PreparedContent? content = null)
+    {
+        var prepareSpec = new PrepareSpec
+        {
+            FilePath = filePath,
+            FileSize = fileSize,
+            ReuseIfExists = reuseIfExists,
+            Content = content
+        };
+
+        var progress = DiskBenchEventSource.Log.IsEnabled()
+            ? new Progress<double>(fraction => DiskBenchEventSource.Log.PrepareProgress(filePath, fraction))
+            : null;
+        var prepareResult = await _engine.PrepareAsync(prepareSpec, progress, cancellationToken).ConfigureAwait(false);
+
+        if (prepareResult.Warnings != null)
+        {
+            foreach (var warning in prepareResult.Warnings)
+            {
+                _sink.OnWarning(warning);
+            }
+        }
+
+        return prepareResult;
+    }
+
+    private static void ValidateAlignment(WorkloadSpec workload, int sectorSize)
+    {
+        // Validate alignment for NO_BUFFERING
+        if (!workload.NoBuffering)
+        {
+            return;
+        }
+
+        if (workload.BlockSize % sectorSize != 0)
+        {
+            throw new InvalidOperationException(
+                $"Block size ({workload.BlockSize}) must be a multiple of sector size ({sectorSize}) for unbuffered IO.");
+        }
+
+        if (workload.Region.Offset % sectorSize != 0)
+        {
+            throw new InvalidOperationException(
+                $"Region offset ({workload.Region.Offset}) must be aligned to sector size ({sectorSize}) for unbuffered IO.");
+        }
     }
 
     private static void EnsureDeleteOnCloseHandle(
@@ -349,7 +1091,8 @@ public sealed class BenchmarkRunner
         WorkloadSpec workload,
         List<TrialResult> trials,
         bool computeCI,
-        int bootstrapIterations)
+        int bootstrapIterations,
+        int minTailSamples)
     {
         var throughputs = trials.Select(t => t.BytesPerSecond).ToArray();
         var iops = trials.Select(t => t.Iops).ToArray();
@@ -360,17 +1103,7 @@ public sealed class BenchmarkRunner
         var stdDevIops = ComputeStdDev(iops);
 
         // Aggregate latencies (mean of percentiles across trials)
-        var meanLatency = new LatencyPercentiles
-        {
-            MinUs = trials.Average(t => t.Latency.MinUs),
-            P50Us = trials.Average(t => t.Latency.P50Us),
-            P90Us = trials.Average(t => t.Latency.P90Us),
-            P95Us = trials.Average(t => t.Latency.P95Us),
-            P99Us = trials.Average(t => t.Latency.P99Us),
-            P999Us = trials.Average(t => t.Latency.P999Us),
-            MaxUs = trials.Max(t => t.Latency.MaxUs),
-            MeanUs = trials.Average(t => t.Latency.MeanUs)
-        };
+        var meanLatency = AverageLatency(trials);
 
         var result = new WorkloadResult
         {
@@ -392,9 +1125,66 @@ public sealed class BenchmarkRunner
             };
         }
 
+        if (computeCI && trials.All(t => t.Histogram is { Count: > 0 }))
+        {
+            result = result with { LatencyCI = ComputeLatencyCI(trials, meanLatency, bootstrapIterations, minTailSamples) };
+        }
+
         return result;
     }
 
+    private static List<LatencyPercentileInterval> ComputeLatencyCI(
+        List<TrialResult> trials,
+        LatencyPercentiles meanLatency,
+        int bootstrapIterations,
+        int minTailSamples)
+    {
+        double[] percentiles = [50, 90, 95, 99, 99.9];
+        var histograms = trials.Select(t => t.Histogram!).ToList();
+        var ticksPerMicrosecond = LatencyHistogram.TicksPerMicrosecond;
+
+        var pooled = HistogramSnapshot.Combine(histograms);
+        var bootstrap = PercentileConfidence.BucketBootstrapIntervals(
+            histograms,
+            percentiles.Select(p => p / 100).ToList(),
+            bootstrapIterations);
+
+        var intervals = new List<LatencyPercentileInterval>(percentiles.Length);
+        for (int i = 0; i < percentiles.Length; i++)
+        {
+            var (lower, upper) = PercentileConfidence.OrderStatisticInterval(pooled, percentiles[i] / 100);
+            var tailSamples = histograms.Min(h => PercentileConfidence.TailSamples(h.Count, percentiles[i] / 100));
+            intervals.Add(new LatencyPercentileInterval
+            {
+                Percentile = percentiles[i],
+                EstimateUs = meanLatency.GetPercentile(percentiles[i]),
+                LowerUs = bootstrap[i].Lower / ticksPerMicrosecond,
+                UpperUs = bootstrap[i].Upper / ticksPerMicrosecond,
+                OrderStatisticLowerUs = lower / ticksPerMicrosecond,
+                OrderStatisticUpperUs = upper / ticksPerMicrosecond,
+                TailSamples = tailSamples,
+                InsufficientSamples = tailSamples < minTailSamples
+            });
+        }
+
+        return intervals;
+    }
+
+    private static LatencyPercentiles AverageLatency(List<TrialResult> trials)
+    {
+        return new LatencyPercentiles
+        {
+            MinUs = trials.Average(t => t.Latency.MinUs),
+            P50Us = trials.Average(t => t.Latency.P50Us),
+            P90Us = trials.Average(t => t.Latency.P90Us),
+            P95Us = trials.Average(t => t.Latency.P95Us),
+            P99Us = trials.Average(t => t.Latency.P99Us),
+            P999Us = trials.Average(t => t.Latency.P999Us),
+            MaxUs = trials.Max(t => t.Latency.MaxUs),
+            MeanUs = trials.Average(t => t.Latency.MeanUs)
+        };
+    }
+
     private static double ComputeStdDev(double[] values)
     {
         if (values.Length < 2) return 0;
@@ -434,14 +1224,24 @@ public sealed class BenchmarkRunner
         return (bootstrapMeans[lowerIndex], bootstrapMeans[upperIndex]);
     }
 
-    private static SystemInfo CollectSystemInfo()
+    private static SystemInfo CollectSystemInfo(BenchmarkPlan plan)
     {
+        List<BlockQueueState>? queues = null;
+        if (OperatingSystem.IsLinux())
+        {
+            queues = [.. plan.Workloads
+                .Select(w => BlockQueueSettings.Read(w.FilePath))
+                .OfType<BlockQueueState>()
+                .DistinctBy(q => q.Device, StringComparer.Ordinal)];
+        }
+
         return new SystemInfo
         {
             OsVersion = Environment.OSVersion.ToString(),
             LogicalProcessors = Environment.ProcessorCount,
             TotalMemoryBytes = GC.GetGCMemoryInfo().TotalAvailableMemoryBytes,
-            RuntimeVersion = Environment.Version.ToString()
+            RuntimeVersion = Environment.Version.ToString(),
+            BlockQueues = queues
         };
     }
 
@@ -0,0 +1,224 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Runs a plan under several Linux block-layer queue configurations (IO scheduler, nr_requests,
+/// rq_affinity) of the devices holding its test files, after a run with the current settings,
+/// and restores the original settings afterwards. Configurations that cannot be applied are
+/// reported as skipped rather than failing the matrix.
+/// </summary>
+/// <remarks>
+/// Needs a Linux engine and root. The CLI only ships the Windows IOCP engine, so it does not expose
+/// this runner; on other platforms <see cref="RunAsync"/> throws because no device has queue settings.
+/// </remarks>
+public sealed class BlockQueueMatrixRunner
+{
+    private const string CurrentName = "current";
+
+    private readonly IBenchmarkEngine _engine;
+    private readonly IBenchmarkSink _sink;
+    private readonly string _sysfsRoot;
+    private readonly string _mountsPath;
+
+    /// <summary>
+    /// Creates a new queue matrix runner.
+    /// </summary>
+    /// <param name="engine">The IO engine to use.</param>
+    /// <param name="sink">Optional sink for progress events (receives every configuration's run).</param>
+    /// <param name="sysfsRoot">sysfs root (for tests).</param>
+    /// <param name="mountsPath">Mount table (for tests).</param>
+    public BlockQueueMatrixRunner(
+        IBenchmarkEngine engine,
+        IBenchmarkSink? sink = null,
+        string sysfsRoot = SysfsTopology.DefaultSysfsRoot,
+        string mountsPath = MountTable.DefaultMountsPath)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _sink = sink ?? NullBenchmarkSink.Instance;
+        _sysfsRoot = sysfsRoot ?? throw new ArgumentNullException(nameof(sysfsRoot));
+        _mountsPath = mountsPath ?? throw new ArgumentNullException(nameof(mountsPath));
+    }
+
+    /// <summary>
+    /// Builds the cross product of scheduler, nr_requests and rq_affinity values.
+    /// Null or empty lists leave that setting unchanged.
+    /// </summary>
+    /// <param name="schedulers">Schedulers to try.</param>
+    /// <param name="nrRequests">nr_requests values to try.</param>
+    /// <param name="rqAffinity">rq_affinity values to try.</param>
+    public static IReadOnlyList<BlockQueueConfig> CreateMatrix(
+        IReadOnlyList<string>? schedulers,
+        IReadOnlyList<int>? nrRequests = null,
+        IReadOnlyList<int>? rqAffinity = null)
+    {
+        IReadOnlyList<string?> schedulerValues = schedulers is { Count: > 0 } ? [.. schedulers] : [null];
+        IReadOnlyList<int?> nrValues = nrRequests is { Count: > 0 } ? [.. nrRequests.Select(n => (int?)n)] : [null];
+        IReadOnlyList<int?> affinityValues = rqAffinity is { Count: > 0 } ? [.. rqAffinity.Select(a => (int?)a)] : [null];
+
+        return
+        [
+            .. from scheduler in schedulerValues
+               from nr in nrValues
+               from affinity in affinityValues
+               select new BlockQueueConfig { Scheduler = scheduler, NrRequests = nr, RqAffinity = affinity }
+        ];
+    }
+
+    /// <summary>
+    /// Runs the plan with the current settings, then once per configuration.
+    /// </summary>
+    /// <param name="plan">The plan to run under every configuration.</param>
+    /// <param name="configurations">Queue configurations to apply to every device the plan uses.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    /// <exception cref="InvalidOperationException">A workload's file is not on a block device with a queue (or not on Linux).</exception>
+    public async Task<BlockQueueMatrixResult> RunAsync(
+        BenchmarkPlan plan,
+        IReadOnlyList<BlockQueueConfig> configurations,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(plan);
+        ArgumentNullException.ThrowIfNull(configurations);
+        ValidateConfigurations(configurations);
+
+        var original = new List<BlockQueueState>();
+        foreach (var workload in plan.Workloads)
+        {
+            var state = BlockQueueSettings.Read(workload.FilePath, _sysfsRoot, _mountsPath)
+                ?? throw new InvalidOperationException($"'{workload.FilePath}' is not on a block device with queue settings (Linux only).");
+            if (!original.Any(o => o.Device == state.Device))
+            {
+                original.Add(state);
+            }
+        }
+
+        var startTime = DateTimeOffset.UtcNow;
+        var runner = new BenchmarkRunner(_engine, _sink);
+        var results = new List<BlockQueueConfigResult>();
+        var name = plan.Name ?? "Benchmark";
+
+        foreach (var config in configurations.Select(c => (BlockQueueConfig?)c).Prepend(null))
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            var configName = config?.GetDisplayName() ?? CurrentName;
+            var skipReason = config != null ? GetUnavailableReason(config, original) : null;
+            bool written = config != null && skipReason == null;
+            try
+            {
+                if (written)
+                {
+                    skipReason = Apply(config!, original);
+                }
+
+                if (skipReason == null)
+                {
+                    var applied = original.Select(o => BlockQueueSettings.ReadDevice(o.Device, _sysfsRoot)!).ToList();
+                    var result = await runner.RunAsync(plan with { Name = $"{name} [{configName}]" }, cancellationToken).ConfigureAwait(false);
+                    results.Add(new BlockQueueConfigResult { Name = configName, Config = config, Applied = applied, Result = result });
+                    continue;
+                }
+            }
+            finally
+            {
+                if (written)
+                {
+                    Restore(original);
+                }
+            }
+
+            _sink.OnWarning($"Skipping {configName}: {skipReason}");
+            results.Add(new BlockQueueConfigResult { Name = configName, Config = config, SkipReason = skipReason });
+        }
+
+        return new BlockQueueMatrixResult
+        {
+            Original = original,
+            Configurations = results,
+            Workloads = FilesystemComparisonRunner.Compare(
+                results.Where(r => r.Result != null).Select(r => (r.Name, r.Result!)).ToList()),
+            StartTime = startTime,
+            Duration = DateTimeOffset.UtcNow - startTime
+        };
+    }
+
+    private static string? GetUnavailableReason(BlockQueueConfig config, IReadOnlyList<BlockQueueState> devices)
+    {
+        foreach (var device in devices)
+        {
+            if (config.Scheduler != null && !device.AvailableSchedulers.Contains(config.Scheduler, StringComparer.Ordinal))
+            {
+                return $"scheduler {config.Scheduler} not available on {device.Device} (offered: {string.Join(", ", device.AvailableSchedulers)})";
+            }
+
+            if ((config.NrRequests.HasValue && device.NrRequests == null) || (config.RqAffinity.HasValue && device.RqAffinity == null))
+            {
+                return $"{device.Device} does not expose the queue setting";
+            }
+        }
+
+        return null;
+    }
+
+    /// <summary>
+    /// Writes the configuration to every device. Returns why it could not be applied, or null.
+    /// </summary>
+    private string? Apply(BlockQueueConfig config, IReadOnlyList<BlockQueueState> devices)
+    {
+        foreach (var device in devices)
+        {
+            try
+            {
+                BlockQueueSettings.Write(device.Device, config, _sysfsRoot);
+            }
+            catch (UnauthorizedAccessException)
+            {
+                return $"permission denied writing {device.Device} queue settings (needs root)";
+            }
+            catch (IOException ex)
+            {
+                return $"{device.Device} rejected the settings: {ex.Message}";
+            }
+        }
+
+        return null;
+    }
+
+    private void Restore(IReadOnlyList<BlockQueueState> original)
+    {
+        foreach (var device in original)
+        {
+            try
+            {
+                BlockQueueSettings.Write(device.Device, device.ToConfig(), _sysfsRoot);
+            }
+            catch (UnauthorizedAccessException ex)
+            {
+                _sink.OnWarning($"Failed to restore {device.Device} queue settings ({device.ToConfig().GetDisplayName()}): {ex.Message}");
+            }
+            catch (IOException ex)
+            {
+                _sink.OnWarning($"Failed to restore {device.Device} queue settings ({device.ToConfig().GetDisplayName()}): {ex.Message}");
+            }
+        }
+    }
+
+    private static void ValidateConfigurations(IReadOnlyList<BlockQueueConfig> configurations)
+    {
+        if (configurations.Count == 0)
+        {
+            throw new ArgumentException("At least one queue configuration is required.", nameof(configurations));
+        }
+
+        foreach (var config in configurations)
+        {
+            if (config.NrRequests is <= 0)
+            {
+                throw new ArgumentException($"nr_requests must be positive: {config.NrRequests}", nameof(configurations));
+            }
+
+            if (config.RqAffinity is < 0 or > 2)
+            {
+                throw new ArgumentException($"rq_affinity must be 0, 1 or 2: {config.RqAffinity}", nameof(configurations));
+            }
+        }
+    }
+}
@@ -0,0 +1,129 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Reads and writes Linux block-layer queue settings (scheduler, nr_requests, rq_affinity) in sysfs.
+/// </summary>
+public static class BlockQueueSettings
+{
+    /// <summary>
+    /// Reads the queue settings of the disk holding <paramref name="path"/>.
+    /// Returns null when the path is not on a block device or on platforms other than Linux.
+    /// </summary>
+    /// <param name="path">File or directory on the device (need not exist yet).</param>
+    /// <param name="sysfsRoot">sysfs root (for tests).</param>
+    /// <param name="mountsPath">Mount table (for tests).</param>
+    public static BlockQueueState? Read(
+        string path,
+        string sysfsRoot = SysfsTopology.DefaultSysfsRoot,
+        string mountsPath = MountTable.DefaultMountsPath)
+    {
+        var diskDir = SysfsTopology.FindDiskDirectory(Path.GetFullPath(path), sysfsRoot, mountsPath);
+        return diskDir != null ? ReadDevice(Path.GetFileName(diskDir), sysfsRoot) : null;
+    }
+
+    /// <summary>
+    /// Reads a device's queue settings by kernel name. Returns null if the device has no queue directory.
+    /// </summary>
+    /// <param name="device">Kernel device name (e.g., "nvme0n1").</param>
+    /// <param name="sysfsRoot">sysfs root (for tests).</param>
+    public static BlockQueueState? ReadDevice(string device, string sysfsRoot = SysfsTopology.DefaultSysfsRoot)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(device);
+
+        var queueDir = GetQueueDirectory(device, sysfsRoot);
+        if (!Directory.Exists(queueDir))
+        {
+            return null;
+        }
+
+        var (scheduler, available) = ParseScheduler(TryReadText(Path.Combine(queueDir, "scheduler")) ?? string.Empty);
+        return new BlockQueueState
+        {
+            Device = device,
+            Scheduler = scheduler,
+            AvailableSchedulers = available,
+            NrRequests = TryReadInt(Path.Combine(queueDir, "nr_requests")),
+            RqAffinity = TryReadInt(Path.Combine(queueDir, "rq_affinity"))
+        };
+    }
+
+    /// <summary>
+    /// Applies a configuration to a device. The scheduler is written first, since switching
+    /// schedulers resets nr_requests to the new scheduler's default.
+    /// </summary>
+    /// <param name="device">Kernel device name.</param>
+    /// <param name="config">Settings to write; null settings are left unchanged.</param>
+    /// <param name="sysfsRoot">sysfs root (for tests).</param>
+    /// <exception cref="UnauthorizedAccessException">Not permitted (writing queue settings needs root).</exception>
+    /// <exception cref="IOException">The kernel rejected a value.</exception>
+    public static void Write(string device, BlockQueueConfig config, string sysfsRoot = SysfsTopology.DefaultSysfsRoot)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(device);
+        ArgumentNullException.ThrowIfNull(config);
+
+        var queueDir = GetQueueDirectory(device, sysfsRoot);
+        if (config.Scheduler != null)
+        {
+            File.WriteAllText(Path.Combine(queueDir, "scheduler"), config.Scheduler);
+        }
+
+        if (config.NrRequests.HasValue)
+        {
+            File.WriteAllText(Path.Combine(queueDir, "nr_requests"), config.NrRequests.Value.ToString(CultureInfo.InvariantCulture));
+        }
+
+        if (config.RqAffinity.HasValue)
+        {
+            File.WriteAllText(Path.Combine(queueDir, "rq_affinity"), config.RqAffinity.Value.ToString(CultureInfo.InvariantCulture));
+        }
+    }
+
+    /// <summary>
+    /// Parses queue/scheduler, e.g. "mq-deadline kyber [bfq] none", into the active and available schedulers.
+    /// </summary>
+    /// <param name="text">Contents of the scheduler file.</param>
+    public static (string? Active, IReadOnlyList<string> Available) ParseScheduler(string text)
+    {
+        ArgumentNullException.ThrowIfNull(text);
+
+        string? active = null;
+        var available = new List<string>();
+        foreach (var token in text.Split(' ', StringSplitOptions.RemoveEmptyEntries | StringSplitOptions.TrimEntries))
+        {
+            bool selected = token.StartsWith('[') && token.EndsWith(']');
+            var name = selected ? token[1..^1] : token;
+            available.Add(name);
+            if (selected)
+            {
+                active = name;
+            }
+        }
+
+        // Devices without a choice list only their fixed scheduler, unbracketed
+        return (active ?? (available.Count == 1 ? available[0] : null), available);
+    }
+
+    private static string GetQueueDirectory(string device, string sysfsRoot) =>
+        Path.Combine(sysfsRoot, "class", "block", device, "queue");
+
+    private static int? TryReadInt(string path) =>
+        int.TryParse(TryReadText(path), NumberStyles.Integer, CultureInfo.InvariantCulture, out int value) ? value : null;
+
+    private static string? TryReadText(string path)
+    {
+        try
+        {
+            return File.Exists(path) ? File.ReadAllText(path).Trim() : null;
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return null;
+        }
+    }
+}
@@ -0,0 +1,233 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Limits the page cache by lowering memory.max of the benchmark's own cgroup (Linux cgroup v2).
+/// Cached file pages are charged to the cgroup that read or wrote them, so the kernel evicts the
+/// test file's pages to keep the cgroup under its limit. The limit includes the process's own
+/// anonymous memory, which is added on top of the cache budget.
+/// </summary>
+/// <remarks>
+/// The cgroup must have the memory controller enabled and memory.max must be writable: run as root,
+/// or in a delegated cgroup (e.g., <c>systemd-run --user --scope diskbench ...</c>). Pages already
+/// cached by other cgroups are not charged to this one, so caches are dropped (best effort, root only)
+/// before the limit is applied.
+/// </remarks>
+public sealed class CgroupMemoryLimit : IMemoryPressure
+{
+    /// <summary>
+    /// Default cgroup v2 mount point.
+    /// </summary>
+    public const string DefaultCgroupRoot = "/sys/fs/cgroup";
+
+    /// <summary>
+    /// Default file listing the process's cgroup membership.
+    /// </summary>
+    public const string DefaultSelfCgroupPath = "/proc/self/cgroup";
+
+    /// <summary>
+    /// Default file for dropping clean caches.
+    /// </summary>
+    public const string DefaultDropCachesPath = "/proc/sys/vm/drop_caches";
+
+    /// <summary>
+    /// Margin above cache budget and anonymous memory, for kernel memory and allocations during the run.
+    /// </summary>
+    public const long HeadroomBytes = 32 * 1024 * 1024;
+
+    private readonly string? _dropCachesPath;
+    private readonly bool _available;
+
+    /// <summary>
+    /// Uses the cgroup the current process belongs to.
+    /// Unavailable on platforms other than Linux.
+    /// </summary>
+    public CgroupMemoryLimit()
+    {
+        if (!OperatingSystem.IsLinux())
+        {
+            Description = "cgroup memory limits require Linux";
+            return;
+        }
+
+        try
+        {
+            CgroupDirectory = FindCgroupDirectory(File.ReadAllText(DefaultSelfCgroupPath), DefaultCgroupRoot);
+        }
+        catch (IOException)
+        {
+            Description = $"{DefaultSelfCgroupPath} is not readable";
+            return;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            Description = $"{DefaultSelfCgroupPath} is not readable";
+            return;
+        }
+
+        if (CgroupDirectory == null)
+        {
+            Description = "process is not in a cgroup v2 hierarchy";
+            return;
+        }
+
+        _dropCachesPath = DefaultDropCachesPath;
+        (_available, Description) = Discover(CgroupDirectory);
+    }
+
+    /// <summary>
+    /// Uses a specific cgroup directory.
+    /// </summary>
+    /// <param name="cgroupDirectory">Cgroup v2 directory containing memory.max and memory.stat.</param>
+    /// <param name="dropCachesPath">Optional drop_caches file written before each limit is applied.</param>
+    public CgroupMemoryLimit(string cgroupDirectory, string? dropCachesPath = null)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(cgroupDirectory);
+        CgroupDirectory = cgroupDirectory;
+        _dropCachesPath = dropCachesPath;
+        (_available, Description) = Discover(cgroupDirectory);
+    }
+
+    /// <summary>
+    /// Cgroup directory being limited, if one was found.
+    /// </summary>
+    public string? CgroupDirectory { get; }
+
+    /// <inheritdoc />
+    public bool IsAvailable => _available;
+
+    /// <inheritdoc />
+    public string Description { get; }
+
+    /// <summary>
+    /// Finds the cgroup v2 directory in /proc/self/cgroup contents (the "0::/path" line).
+    /// </summary>
+    /// <param name="selfCgroup">Contents of /proc/self/cgroup.</param>
+    /// <param name="cgroupRoot">Cgroup v2 mount point.</param>
+    /// <returns>The directory, or null if the process is not in a cgroup v2 hierarchy.</returns>
+    public static string? FindCgroupDirectory(string selfCgroup, string cgroupRoot)
+    {
+        ArgumentNullException.ThrowIfNull(selfCgroup);
+        ArgumentNullException.ThrowIfNull(cgroupRoot);
+
+        foreach (var line in selfCgroup.Split('\n'))
+        {
+            if (line.StartsWith("0::/", StringComparison.Ordinal))
+            {
+                return Path.Combine(cgroupRoot, line[4..].TrimEnd());
+            }
+        }
+
+        return null;
+    }
+
+    /// <summary>
+    /// Sets memory.max to the cache budget plus current anonymous memory and headroom,
+    /// restoring the previous limit when the returned handle is disposed.
+    /// </summary>
+    /// <param name="cacheBytes">Memory to leave for cached file pages.</param>
+    public IDisposable Apply(long cacheBytes)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(cacheBytes);
+        if (!_available)
+        {
+            throw new InvalidOperationException($"Cgroup memory limit unavailable: {Description}");
+        }
+
+        var maxPath = Path.Combine(CgroupDirectory!, "memory.max");
+        var previous = File.ReadAllText(maxPath).Trim();
+        long anon = PageCacheStats.GetValue(File.ReadAllText(Path.Combine(CgroupDirectory!, "memory.stat")), "anon") ?? 0;
+
+        DropCaches();
+
+        // Lowering memory.max makes the kernel reclaim the cgroup down to the new limit before returning
+        File.WriteAllText(maxPath, (cacheBytes + anon + HeadroomBytes).ToString(CultureInfo.InvariantCulture));
+        return new Limit(maxPath, previous);
+    }
+
+    /// <inheritdoc />
+    public PageCacheCounters? ReadCounters()
+    {
+        if (!_available)
+        {
+            return null;
+        }
+
+        try
+        {
+            return PageCacheStats.ParseCounters(File.ReadAllText(Path.Combine(CgroupDirectory!, "memory.stat")));
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return null;
+        }
+    }
+
+    private static (bool Available, string Description) Discover(string directory)
+    {
+        var maxPath = Path.Combine(directory, "memory.max");
+        try
+        {
+            if (!File.Exists(maxPath) || !File.Exists(Path.Combine(directory, "memory.stat")))
+            {
+                return (false, $"memory controller not enabled for {directory}");
+            }
+
+            // Writing the current value back checks permission without changing anything
+            File.WriteAllText(maxPath, File.ReadAllText(maxPath).Trim());
+            return (true, $"cgroup {directory}");
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return (false, $"{maxPath} is not writable (run as root or in a delegated cgroup)");
+        }
+        catch (IOException)
+        {
+            return (false, $"{maxPath} is not writable");
+        }
+    }
+
+    private void DropCaches()
+    {
+        if (_dropCachesPath == null)
+        {
+            return;
+        }
+
+        try
+        {
+            File.WriteAllText(_dropCachesPath, "1");
+        }
+        catch (IOException)
+        {
+            // Without root the limit only constrains pages this cgroup caches from now on
+        }
+        catch (UnauthorizedAccessException)
+        {
+        }
+    }
+
+    /// <summary>
+    /// Applied limit, restored on dispose.
+    /// </summary>
+    private sealed class Limit(string maxPath, string previous) : IDisposable
+    {
+        private bool _disposed;
+
+        public void Dispose()
+        {
+            if (_disposed)
+            {
+                return;
+            }
+
+            _disposed = true;
+            File.WriteAllText(maxPath, previous);
+        }
+    }
+}
@@ -0,0 +1,170 @@
+using System.Buffers;
+using System.Numerics;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Generates the content of a prepared file with a target compressibility and share of unique blocks.
+/// </summary>
+/// <remarks>
+/// Content is a function of the file offset alone, so a file can be written in any order. Each block
+/// is generated from its content ID, the block index modulo the number of unique blocks, so blocks
+/// sharing an ID are byte-identical and everything else differs. Random bytes come from xorshift
+/// generators running in every lane of a <see cref="Vector{T}"/>, several GB/s per core, so
+/// generation keeps ahead of the device being written.
+/// </remarks>
+public sealed class ContentGenerator
+{
+    /// <summary>
+    /// Length of the alternating random and zero runs of compressible content: long enough that
+    /// LZ-style compressors encode each zero run in a few bytes, short enough to compress in any chunk.
+    /// </summary>
+    private const int RunLength = 256;
+
+    /// <summary>
+    /// 64 common English words, so one random byte picks a word without bias.
+    /// </summary>
+    private static readonly byte[][] Vocabulary = [..
+        ("the of and to in is that for it as was with be by on not he this are or his from at which but have an " +
+         "they you were her she there been one all we their has would when if so no what can more will other up " +
+         "into out time only about then them some could like just over also my")
+        .Split(' ')
+        .Select(w => Encoding.ASCII.GetBytes(w + " "))];
+
+    private readonly PreparedContent _content;
+
+    /// <summary>
+    /// Creates a generator for a file of the given size.
+    /// </summary>
+    /// <param name="content">Content to generate.</param>
+    /// <param name="fileSize">Size of the file in bytes, which sets the number of unique blocks.</param>
+    /// <exception cref="ArgumentException">Invalid block size, unique block ratio or file size.</exception>
+    public ContentGenerator(PreparedContent content, long fileSize)
+    {
+        ArgumentNullException.ThrowIfNull(content);
+
+        if (content.BlockSize <= 0 || content.BlockSize % 512 != 0)
+        {
+            throw new ArgumentException($"Content block size must be a positive multiple of 512: {content.BlockSize}", nameof(content));
+        }
+
+        if (!(content.UniqueBlockRatio > 0 && content.UniqueBlockRatio <= 1))
+        {
+            throw new ArgumentException($"Unique block ratio must be in (0, 1]: {content.UniqueBlockRatio}", nameof(content));
+        }
+
+        if (fileSize <= 0)
+        {
+            throw new ArgumentException($"Invalid file size: {fileSize}", nameof(fileSize));
+        }
+
+        _content = content;
+        long blocks = (fileSize + content.BlockSize - 1) / content.BlockSize;
+        UniqueBlocks = Math.Max(1, (long)Math.Ceiling(blocks * content.UniqueBlockRatio));
+    }
+
+    /// <summary>
+    /// Gets the number of distinct blocks in the file.
+    /// </summary>
+    public long UniqueBlocks { get; }
+
+    /// <summary>
+    /// Fills a buffer with the file's content starting at an offset.
+    /// </summary>
+    /// <param name="buffer">Buffer to fill.</param>
+    /// <param name="offset">File offset of the buffer's first byte (a multiple of the block size).</param>
+    public void Fill(Span<byte> buffer, long offset)
+    {
+        int blockSize = _content.BlockSize;
+        if (offset < 0 || offset % blockSize != 0)
+        {
+            throw new ArgumentException($"Offset must be a multiple of the content block size ({blockSize}): {offset}", nameof(offset));
+        }
+
+        long block = offset / blockSize;
+        while (buffer.Length >= blockSize)
+        {
+            FillBlock(buffer[..blockSize], block % UniqueBlocks);
+            buffer = buffer[blockSize..];
+            block++;
+        }
+
+        // A trailing partial block is the prefix of its full block
+        if (!buffer.IsEmpty)
+        {
+            var scratch = ArrayPool<byte>.Shared.Rent(blockSize);
+            FillBlock(scratch.AsSpan(0, blockSize), block % UniqueBlocks);
+            scratch.AsSpan(0, buffer.Length).CopyTo(buffer);
+            ArrayPool<byte>.Shared.Return(scratch);
+        }
+    }
+
+    private void FillBlock(Span<byte> block, long contentId)
+    {
+        switch (_content.Mode)
+        {
+            case ContentMode.Compressible:
+                FillRandom(block, contentId);
+                for (int i = RunLength; i < block.Length; i += 2 * RunLength)
+                {
+                    block.Slice(i, Math.Min(RunLength, block.Length - i)).Clear();
+                }
+
+                break;
+
+            case ContentMode.Text:
+                FillText(block, contentId);
+                break;
+
+            default:
+                FillRandom(block, contentId);
+                break;
+        }
+    }
+
+    private void FillRandom(Span<byte> block, long contentId)
+    {
+        // Seed each lane with SplitMix64 of (seed, content ID) so blocks and lanes are independent
+        Span<ulong> seeds = stackalloc ulong[Vector<ulong>.Count];
+        ulong mix = ((ulong)(uint)_content.Seed << 40) ^ (ulong)contentId;
+        for (int lane = 0; lane < seeds.Length; lane++)
+        {
+            mix += 0x9E3779B97F4A7C15UL;
+            ulong z = mix;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9UL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBUL;
+            seeds[lane] = (z ^ (z >> 31)) | 1;
+        }
+
+        // The block size is a multiple of 512, so it is a whole number of vectors
+        var state = new Vector<ulong>(seeds);
+        var output = MemoryMarshal.Cast<byte, Vector<ulong>>(block);
+        for (int i = 0; i < output.Length; i++)
+        {
+            state ^= Vector.ShiftLeft(state, 13);
+            state ^= Vector.ShiftRightLogical(state, 7);
+            state ^= Vector.ShiftLeft(state, 17);
+            output[i] = state;
+        }
+    }
+
+    private void FillText(Span<byte> block, long contentId)
+    {
+        // Every word takes at least two bytes, so a block of random bytes picks more words than fit
+        var random = ArrayPool<byte>.Shared.Rent(block.Length);
+        FillRandom(random.AsSpan(0, block.Length), contentId);
+
+        int position = 0;
+        for (int r = 0; position < block.Length; r++)
+        {
+            var word = Vocabulary[random[r] & 63];
+            int length = Math.Min(word.Length, block.Length - position);
+            word.AsSpan(0, length).CopyTo(block[position..]);
+            position += length;
+        }
+
+        ArrayPool<byte>.Shared.Return(random);
+    }
+}
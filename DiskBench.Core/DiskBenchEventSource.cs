@@ -0,0 +1,285 @@
+using System.Diagnostics.Tracing;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Counters and events for observing runs with standard .NET tooling, without code changes:
+/// <c>dotnet-counters monitor -n diskbench --counters DiskBench</c> and
+/// <c>dotnet-trace collect -n diskbench --providers DiskBench</c>.
+/// </summary>
+/// <remarks>
+/// Everything is fed from the progress snapshots and results the runner already receives, never from the
+/// IO thread: engines take a snapshot a few times a second, and the runner forwards it here from the
+/// thread pool. Counters are polled by the runtime only while a listener is attached, and events are
+/// skipped when the source is disabled.
+/// </remarks>
+[EventSource(Name = "DiskBench")]
+public sealed class DiskBenchEventSource : EventSource
+{
+    /// <summary>
+    /// The single instance.
+    /// </summary>
+    public static readonly DiskBenchEventSource Log = new();
+
+    private readonly object _lock = new();
+    private long _baseOperations;
+    private long _baseBytes;
+    private long _trialOperations;
+    private long _trialBytes;
+    private int _inFlightIos;
+    private double _intervalP99Us;
+    private string? _phase;
+
+    private IncrementingPollingCounter? _iopsCounter;
+    private IncrementingPollingCounter? _throughputCounter;
+    private PollingCounter? _inFlightCounter;
+    private PollingCounter? _p99Counter;
+    private IncrementingPollingCounter? _gcPauseCounter;
+
+    private DiskBenchEventSource()
+    {
+    }
+
+    /// <summary>
+    /// Event keywords.
+    /// </summary>
+#pragma warning disable CA1034 // EventSource discovers keyword names through a nested class named Keywords
+    public static class Keywords
+    {
+        /// <summary>
+        /// Trial start, end and phase transitions.
+        /// </summary>
+        public const EventKeywords Trial = (EventKeywords)1;
+
+        /// <summary>
+        /// Test file preparation progress.
+        /// </summary>
+        public const EventKeywords Prepare = (EventKeywords)2;
+
+        /// <summary>
+        /// IOs captured by the slow IO tracker.
+        /// </summary>
+        public const EventKeywords SlowIo = (EventKeywords)4;
+    }
+#pragma warning restore CA1034
+
+    /// <summary>
+    /// A trial started.
+    /// </summary>
+    /// <param name="workload">Workload name.</param>
+    /// <param name="trial">Trial number (1-based).</param>
+    /// <param name="trials">Number of trials of the workload.</param>
+    [Event(1, Level = EventLevel.Informational, Keywords = Keywords.Trial, Opcode = EventOpcode.Start)]
+    public void TrialStart(string workload, int trial, int trials)
+    {
+        lock (_lock)
+        {
+            FoldTrialCounts();
+            _phase = null;
+        }
+
+        WriteEvent(1, workload, trial, trials);
+    }
+
+    /// <summary>
+    /// A trial finished.
+    /// </summary>
+    /// <param name="workload">Workload name.</param>
+    /// <param name="trial">Trial number (1-based).</param>
+    /// <param name="iops">Measured IOPS.</param>
+    /// <param name="bytesPerSecond">Measured throughput in bytes per second.</param>
+    /// <param name="p99Us">99th percentile latency in microseconds.</param>
+    [Event(2, Level = EventLevel.Informational, Keywords = Keywords.Trial, Opcode = EventOpcode.Stop)]
+    public void TrialStop(string workload, int trial, double iops, double bytesPerSecond, double p99Us)
+    {
+        WriteEvent(2, workload, trial, iops, bytesPerSecond, p99Us);
+    }
+
+    /// <summary>
+    /// A trial moved to another phase (Warmup, Measured or Finalizing).
+    /// </summary>
+    /// <param name="workload">Workload name.</param>
+    /// <param name="trial">Trial number (1-based).</param>
+    /// <param name="phase">New phase.</param>
+    [Event(3, Level = EventLevel.Informational, Keywords = Keywords.Trial)]
+    public void PhaseTransition(string workload, int trial, string phase)
+    {
+        WriteEvent(3, workload, trial, phase);
+    }
+
+    /// <summary>
+    /// Test file preparation progressed.
+    /// </summary>
+    /// <param name="filePath">File being prepared.</param>
+    /// <param name="fraction">Fraction written (0-1).</param>
+    [Event(4, Level = EventLevel.Verbose, Keywords = Keywords.Prepare)]
+    public void PrepareProgress(string filePath, double fraction)
+    {
+        WriteEvent(4, filePath, fraction);
+    }
+
+    /// <summary>
+    /// An IO was slower than the slow IO threshold, or stuck.
+    /// </summary>
+    /// <param name="workload">Workload name.</param>
+    /// <param name="trial">Trial number (1-based).</param>
+    /// <param name="offset">File offset of the IO.</param>
+    /// <param name="size">IO size in bytes.</param>
+    /// <param name="isWrite">Whether the IO was a write.</param>
+    /// <param name="latencyUs">Latency in microseconds (age when observed, for stuck IOs).</param>
+    /// <param name="stuck">Whether the IO was still in flight when observed.</param>
+    [Event(5, Level = EventLevel.Warning, Keywords = Keywords.SlowIo)]
+    public void SlowIo(string workload, int trial, long offset, int size, bool isWrite, double latencyUs, bool stuck)
+    {
+        WriteEvent(5, workload, trial, offset, size, isWrite, latencyUs, stuck);
+    }
+
+    /// <summary>
+    /// Updates the counters from a progress snapshot and raises an event when the phase changes.
+    /// </summary>
+    /// <param name="workload">Workload name.</param>
+    /// <param name="trial">Trial number (1-based).</param>
+    /// <param name="progress">Progress snapshot.</param>
+    [NonEvent]
+    public void ReportProgress(string workload, int trial, TrialProgress progress)
+    {
+        ArgumentNullException.ThrowIfNull(progress);
+
+        string phase = progress.IsFinalizing ? "Finalizing" : progress.IsWarmup ? "Warmup" : "Measured";
+        bool phaseChanged;
+
+        lock (_lock)
+        {
+            // Snapshots are delivered on the thread pool and may arrive out of order; totals only
+            // go down legitimately when the measured phase starts and the engine resets its metrics
+            if (progress.TotalOperations < _trialOperations || (progress.IsWarmup && _phase is not (null or "Warmup")))
+            {
+                if (progress.IsWarmup || _phase != "Warmup")
+                {
+                    return;
+                }
+
+                FoldTrialCounts();
+            }
+
+            _trialOperations = progress.TotalOperations;
+            _trialBytes = progress.TotalBytes;
+            _inFlightIos = progress.InFlightIos;
+            _intervalP99Us = progress.IntervalP99Us;
+
+            phaseChanged = phase != _phase;
+            _phase = phase;
+        }
+
+        if (phaseChanged && IsEnabled(EventLevel.Informational, Keywords.Trial))
+        {
+            PhaseTransition(workload, trial, phase);
+        }
+    }
+
+    /// <summary>
+    /// Raises the trial end event and one event per slow or stuck IO of the result.
+    /// </summary>
+    /// <param name="workload">Workload name.</param>
+    /// <param name="trial">Trial number (1-based).</param>
+    /// <param name="result">Trial result.</param>
+    [NonEvent]
+    public void ReportTrialComplete(string workload, int trial, TrialResult result)
+    {
+        ArgumentNullException.ThrowIfNull(result);
+
+        lock (_lock)
+        {
+            _inFlightIos = 0;
+        }
+
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        TrialStop(workload, trial, result.Iops, result.BytesPerSecond, result.Latency.P99Us);
+
+        if (result.SlowIos != null && IsEnabled(EventLevel.Warning, Keywords.SlowIo))
+        {
+            foreach (var io in result.SlowIos.OverThreshold)
+            {
+                SlowIo(workload, trial, io.Offset, io.Size, io.IsWrite, io.LatencyUs, false);
+            }
+
+            foreach (var io in result.SlowIos.Stuck)
+            {
+                SlowIo(workload, trial, io.Offset, io.Size, io.IsWrite, io.LatencyUs, true);
+            }
+        }
+    }
+
+    /// <inheritdoc />
+    protected override void OnEventCommand(EventCommandEventArgs command)
+    {
+        ArgumentNullException.ThrowIfNull(command);
+
+        if (command.Command != EventCommand.Enable || _iopsCounter != null)
+        {
+            return;
+        }
+
+        _iopsCounter = new IncrementingPollingCounter("iops", this, () => Read(() => _baseOperations + _trialOperations))
+        {
+            DisplayName = "IOPS",
+            DisplayRateTimeScale = TimeSpan.FromSeconds(1)
+        };
+        _throughputCounter = new IncrementingPollingCounter("throughput", this, () => Read(() => (_baseBytes + _trialBytes) / (1024.0 * 1024)))
+        {
+            DisplayName = "Throughput",
+            DisplayUnits = "MB",
+            DisplayRateTimeScale = TimeSpan.FromSeconds(1)
+        };
+        _inFlightCounter = new PollingCounter("in-flight-ios", this, () => Read(() => _inFlightIos))
+        {
+            DisplayName = "IOs in flight"
+        };
+        _p99Counter = new PollingCounter("latency-p99", this, () => Read(() => _intervalP99Us))
+        {
+            DisplayName = "p99 latency (last interval)",
+            DisplayUnits = "us"
+        };
+        _gcPauseCounter = new IncrementingPollingCounter("gc-pause-time", this, () => GC.GetTotalPauseDuration().TotalMilliseconds)
+        {
+            DisplayName = "GC pause time",
+            DisplayUnits = "ms",
+            DisplayRateTimeScale = TimeSpan.FromSeconds(1)
+        };
+    }
+
+    /// <inheritdoc />
+    protected override void Dispose(bool disposing)
+    {
+        if (disposing)
+        {
+            _iopsCounter?.Dispose();
+            _throughputCounter?.Dispose();
+            _inFlightCounter?.Dispose();
+            _p99Counter?.Dispose();
+            _gcPauseCounter?.Dispose();
+        }
+
+        base.Dispose(disposing);
+    }
+
+    private void FoldTrialCounts()
+    {
+        _baseOperations += _trialOperations;
+        _baseBytes += _trialBytes;
+        _trialOperations = 0;
+        _trialBytes = 0;
+    }
+
+    private double Read(Func<double> value)
+    {
+        lock (_lock)
+        {
+            return value();
+        }
+    }
+}
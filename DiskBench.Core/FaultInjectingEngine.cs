@@ -0,0 +1,108 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Engine decorator that injects IO errors, latency spikes, stalls and short transfers
+/// into the wrapped engine's trials. Engines apply the faults per IO via
+/// <see cref="TrialSpec.FaultInjector"/>, so tail latency and retry behavior can be
+/// measured on healthy hardware (or the fake engine).
+/// </summary>
+public sealed class FaultInjectingEngine : BenchmarkEngineDecorator
+{
+    private readonly FaultInjectionOptions _options;
+
+    /// <summary>
+    /// Creates a fault-injecting engine.
+    /// </summary>
+    /// <param name="inner">The engine to inject faults into.</param>
+    /// <param name="options">Fault rates.</param>
+    /// <param name="ownsInner">Whether disposing this engine disposes the inner engine.</param>
+    public FaultInjectingEngine(IBenchmarkEngine inner, FaultInjectionOptions options, bool ownsInner = true)
+        : base(inner, ownsInner)
+    {
+        _options = options ?? throw new ArgumentNullException(nameof(options));
+        (double Rate, string Name)[] rates =
+        [
+            (options.ErrorRate, nameof(options.ErrorRate)),
+            (options.LatencySpikeRate, nameof(options.LatencySpikeRate)),
+            (options.StallRate, nameof(options.StallRate)),
+            (options.ShortTransferRate, nameof(options.ShortTransferRate))
+        ];
+
+        foreach (var (rate, name) in rates)
+        {
+            if (rate < 0 || rate > 1 || double.IsNaN(rate))
+            {
+                throw new ArgumentException($"{name} must be between 0 and 1: {rate}", nameof(options));
+            }
+        }
+
+        if (options.ErrorRate + options.LatencySpikeRate + options.StallRate + options.ShortTransferRate > 1)
+        {
+            throw new ArgumentException("Fault rates must add up to at most 1.", nameof(options));
+        }
+    }
+
+    /// <inheritdoc />
+    public override Task<TrialResult> RunTrialAsync(
+        TrialSpec spec,
+        IProgress<TrialProgress>? progress = null,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(spec);
+
+        var injector = new RandomFaultInjector(_options, spec.Seed);
+        return Inner.RunTrialAsync(spec with { FaultInjector = injector }, progress, cancellationToken);
+    }
+}
+
+/// <summary>
+/// Fault injector that draws faults independently per IO at fixed rates.
+/// </summary>
+public sealed class RandomFaultInjector : IIoFaultInjector
+{
+    private readonly FaultInjectionOptions _options;
+    private readonly Random _random;
+
+    /// <summary>
+    /// Creates an injector for one trial.
+    /// </summary>
+    /// <param name="options">Fault rates.</param>
+    /// <param name="trialSeed">Trial seed, combined with the options seed.</param>
+    public RandomFaultInjector(FaultInjectionOptions options, int trialSeed)
+    {
+        _options = options ?? throw new ArgumentNullException(nameof(options));
+#pragma warning disable CA5394 // Random is appropriate for fault simulation, not security
+        _random = new Random(HashCode.Combine(options.Seed, trialSeed));
+#pragma warning restore CA5394
+    }
+
+    /// <inheritdoc />
+    public IoFault NextFault(long offset, int size, bool isWrite)
+    {
+#pragma warning disable CA5394 // Random is appropriate for fault simulation, not security
+        var roll = _random.NextDouble();
+#pragma warning restore CA5394
+
+        if ((roll -= _options.ErrorRate) < 0)
+        {
+            return new IoFault(IoFaultKind.Error);
+        }
+
+        if ((roll -= _options.LatencySpikeRate) < 0)
+        {
+            return new IoFault(IoFaultKind.LatencySpike, _options.LatencySpike);
+        }
+
+        if ((roll -= _options.StallRate) < 0)
+        {
+            return new IoFault(IoFaultKind.Stall, _options.StallDuration);
+        }
+
+        if ((roll -= _options.ShortTransferRate) < 0 && size > 1)
+        {
+            return new IoFault(IoFaultKind.ShortTransfer, BytesTransferred: size / 2);
+        }
+
+        return IoFault.None;
+    }
+}
@@ -0,0 +1,291 @@
+using System.ComponentModel;
+using System.Diagnostics;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Copies a prepared source file with each strategy of a <see cref="FileCopyPlan"/> and reports
+/// throughput, CPU per GB and page cache growth. Buffered and system copies are portable; unbuffered
+/// copies and clones come from the engine when it implements <see cref="IFileCopyEngine"/>.
+/// The source is evicted from the page cache before every copy, so every strategy reads it from the device.
+/// </summary>
+public sealed class FileCopyRunner
+{
+    private const int FillPatternSeed = 1;
+
+    private readonly IBenchmarkEngine _engine;
+    private readonly IBenchmarkSink _sink;
+    private readonly Func<long>? _cachedBytes;
+    private bool _sourceEvicted;
+
+    /// <summary>
+    /// Creates a new copy runner.
+    /// </summary>
+    /// <param name="engine">The IO engine, used to prepare the source and for engine-specific strategies.</param>
+    /// <param name="sink">Optional sink for warnings.</param>
+    /// <param name="cachedBytes">
+    /// Returns the system page cache size; defaults to Cached in /proc/meminfo on Linux.
+    /// Page cache growth is not reported when null and no default exists.
+    /// </param>
+    public FileCopyRunner(IBenchmarkEngine engine, IBenchmarkSink? sink = null, Func<long>? cachedBytes = null)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _sink = sink ?? NullBenchmarkSink.Instance;
+        _cachedBytes = cachedBytes ?? (OperatingSystem.IsLinux() && File.Exists("/proc/meminfo") ? ReadMeminfoCached : null);
+    }
+
+    /// <summary>
+    /// Prepares the source and runs every case.
+    /// </summary>
+    /// <param name="plan">Copy plan.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    public async Task<FileCopyResult> RunAsync(FileCopyPlan plan, CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(plan);
+        ValidatePlan(plan);
+
+        var startTime = DateTimeOffset.UtcNow;
+        var destination = plan.DestinationPath ?? plan.SourcePath + ".copy";
+
+        // Random-looking content, so compressing or deduplicating filesystems copy real data
+        var pattern = new byte[4096];
+#pragma warning disable CA5394 // Random is appropriate for test data, not security
+        new Random(FillPatternSeed).NextBytes(pattern);
+#pragma warning restore CA5394
+        await _engine.PrepareAsync(
+            new PrepareSpec { FilePath = plan.SourcePath, FileSize = plan.FileSize, FillPattern = pattern },
+            cancellationToken: cancellationToken).ConfigureAwait(false);
+
+        _sourceEvicted = _engine is IFileCopyEngine;
+        if (!_sourceEvicted)
+        {
+            _sink.OnWarning("The engine cannot evict the source from the page cache; buffered and system copies may read a cached source.");
+        }
+
+        var cases = new List<CopyCaseResult>();
+        try
+        {
+            foreach (var copyCase in plan.Cases)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+                cases.Add(await RunCaseAsync(plan, copyCase, destination, cancellationToken).ConfigureAwait(false));
+            }
+        }
+        finally
+        {
+            TryDelete(destination);
+            if (plan.DeleteOnComplete)
+            {
+                TryDelete(plan.SourcePath);
+            }
+        }
+
+        return new FileCopyResult
+        {
+            SourcePath = plan.SourcePath,
+            FileSize = plan.FileSize,
+            Cases = cases,
+            SourceCacheEvicted = _sourceEvicted,
+            StartTime = startTime,
+            Duration = DateTimeOffset.UtcNow - startTime
+        };
+    }
+
+    private async Task<CopyCaseResult> RunCaseAsync(FileCopyPlan plan, CopyCase copyCase, string destination, CancellationToken cancellationToken)
+    {
+        var name = copyCase.GetDisplayName();
+        var copyEngine = _engine as IFileCopyEngine;
+        if ((copyCase.Strategy is CopyStrategy.Unbuffered or CopyStrategy.Clone) && copyEngine == null)
+        {
+            return Skipped(copyCase, name, $"{copyCase.Strategy} copies need engine support");
+        }
+
+        using var process = Process.GetCurrentProcess();
+        var trials = new List<CopyTrialResult>();
+        for (int t = 1; t <= plan.Trials; t++)
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+            TryDelete(destination);
+            await EvictSourceAsync(plan.SourcePath, cancellationToken).ConfigureAwait(false);
+
+            process.Refresh();
+            var cpuBefore = process.TotalProcessorTime;
+            long? cacheBefore = _cachedBytes?.Invoke();
+            long start = Stopwatch.GetTimestamp();
+
+            long bytes;
+            try
+            {
+                bytes = copyCase.Strategy switch
+                {
+                    CopyStrategy.Buffered => await Task.Run(() => BufferedCopy(plan.SourcePath, destination, copyCase.BlockSize), cancellationToken).ConfigureAwait(false),
+                    CopyStrategy.SystemCopy => await Task.Run(() => SystemCopy(plan.SourcePath, destination), cancellationToken).ConfigureAwait(false),
+                    _ => await copyEngine!.CopyFileAsync(copyCase, plan.SourcePath, destination, cancellationToken).ConfigureAwait(false)
+                };
+
+                if (plan.FlushDestination)
+                {
+                    await Task.Run(() => FlushToDevice(destination), cancellationToken).ConfigureAwait(false);
+                }
+            }
+            catch (NotSupportedException ex)
+            {
+                _sink.OnWarning($"{name} skipped: {ex.Message}");
+                return Skipped(copyCase, name, ex.Message);
+            }
+
+            var elapsed = Stopwatch.GetElapsedTime(start);
+            process.Refresh();
+            long? cacheAfter = _cachedBytes?.Invoke();
+
+            trials.Add(new CopyTrialResult
+            {
+                TrialNumber = t,
+                Bytes = bytes,
+                Duration = elapsed,
+                CpuTime = process.TotalProcessorTime - cpuBefore,
+                PageCacheGrowthBytes = cacheAfter - cacheBefore
+            });
+        }
+
+        var growth = trials.Where(t => t.PageCacheGrowthBytes.HasValue).Select(t => (double)t.PageCacheGrowthBytes!.Value).ToList();
+        return new CopyCaseResult
+        {
+            Case = copyCase,
+            Name = name,
+            Trials = trials,
+            MeanBytesPerSecond = trials.Average(t => t.BytesPerSecond),
+            MeanCpuSecondsPerGB = trials.Average(t => t.CpuSecondsPerGB),
+            MeanPageCacheGrowthBytes = growth.Count > 0 ? growth.Average() : null
+        };
+    }
+
+    /// <summary>
+    /// Drops the source's cached pages before a copy, outside the timed window. A failure is reported
+    /// once and leaves the result marked as read from a possibly cached source.
+    /// </summary>
+    private async Task EvictSourceAsync(string sourcePath, CancellationToken cancellationToken)
+    {
+        if (!_sourceEvicted)
+        {
+            return;
+        }
+
+        try
+        {
+            await ((IFileCopyEngine)_engine).EvictFromCacheAsync(sourcePath, cancellationToken).ConfigureAwait(false);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException or NotSupportedException or Win32Exception)
+        {
+            _sourceEvicted = false;
+            _sink.OnWarning($"Failed to evict '{sourcePath}' from the page cache: {ex.Message}. Buffered and system copies may read a cached source.");
+        }
+    }
+
+    private static CopyCaseResult Skipped(CopyCase copyCase, string name, string reason) => new()
+    {
+        Case = copyCase,
+        Name = name,
+        SkipReason = reason,
+        Trials = []
+    };
+
+    private static long BufferedCopy(string source, string destination, int blockSize)
+    {
+        using var input = new FileStream(source, new FileStreamOptions
+        {
+            Mode = FileMode.Open,
+            Access = FileAccess.Read,
+            Share = FileShare.Read,
+            BufferSize = 0,
+            Options = FileOptions.SequentialScan
+        });
+        using var output = new FileStream(destination, new FileStreamOptions
+        {
+            Mode = FileMode.Create,
+            Access = FileAccess.Write,
+            BufferSize = 0,
+            PreallocationSize = input.Length
+        });
+
+        var buffer = GC.AllocateUninitializedArray<byte>(blockSize);
+        long total = 0;
+        int read;
+        while ((read = input.Read(buffer, 0, buffer.Length)) > 0)
+        {
+            output.Write(buffer, 0, read);
+            total += read;
+        }
+
+        return total;
+    }
+
+    private static long SystemCopy(string source, string destination)
+    {
+        File.Copy(source, destination, overwrite: true);
+        return new FileInfo(destination).Length;
+    }
+
+    private static void FlushToDevice(string path)
+    {
+        using var stream = new FileStream(path, FileMode.Open, FileAccess.ReadWrite, FileShare.ReadWrite);
+        stream.Flush(flushToDisk: true);
+    }
+
+    private static long ReadMeminfoCached()
+    {
+        return (PageCacheStats.GetMeminfoKilobytes(File.ReadAllText("/proc/meminfo"), "Cached") ?? 0) * 1024;
+    }
+
+    private void TryDelete(string path)
+    {
+        try
+        {
+            File.Delete(path);
+        }
+        catch (IOException ex)
+        {
+            _sink.OnWarning($"Failed to delete '{path}': {ex.Message}");
+        }
+        catch (UnauthorizedAccessException ex)
+        {
+            _sink.OnWarning($"Failed to delete '{path}': {ex.Message}");
+        }
+    }
+
+    private static void ValidatePlan(FileCopyPlan plan)
+    {
+        if (string.IsNullOrWhiteSpace(plan.SourcePath))
+        {
+            throw new ArgumentException("Source path cannot be empty.", nameof(plan));
+        }
+
+        if (plan.FileSize <= 0)
+        {
+            throw new ArgumentException("File size must be positive.", nameof(plan));
+        }
+
+        if (plan.Trials <= 0)
+        {
+            throw new ArgumentException("Trials must be positive.", nameof(plan));
+        }
+
+        if (plan.Cases.Count == 0)
+        {
+            throw new ArgumentException("At least one copy case is required.", nameof(plan));
+        }
+
+        foreach (var copyCase in plan.Cases)
+        {
+            if (copyCase.BlockSize <= 0 || copyCase.QueueDepth <= 0)
+            {
+                throw new ArgumentException($"{copyCase.GetDisplayName()}: block size and queue depth must be positive.", nameof(plan));
+            }
+        }
+
+        if (plan.DestinationPath != null && Path.GetFullPath(plan.DestinationPath) == Path.GetFullPath(plan.SourcePath))
+        {
+            throw new ArgumentException("Destination must differ from the source.", nameof(plan));
+        }
+    }
+}
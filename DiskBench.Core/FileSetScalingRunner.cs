@@ -0,0 +1,104 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Runs a plan's workloads over file sets of increasing size, with one open handle per file,
+/// and compares throughput and latency across file counts. Each workload's data size is held
+/// constant, so levels differ only in how many files (and handles, extent maps and per-file
+/// locks) that data is spread over.
+/// </summary>
+public sealed class FileSetScalingRunner
+{
+    private readonly IBenchmarkEngine _engine;
+    private readonly IBenchmarkSink _sink;
+
+    /// <summary>
+    /// Creates a new file-set scaling runner.
+    /// </summary>
+    /// <param name="engine">The IO engine to use.</param>
+    /// <param name="sink">Optional sink for progress events (receives every level's run).</param>
+    public FileSetScalingRunner(IBenchmarkEngine engine, IBenchmarkSink? sink = null)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _sink = sink ?? NullBenchmarkSink.Instance;
+    }
+
+    /// <summary>
+    /// Runs the plan once per file count. At each level a workload's <see cref="WorkloadSpec.FileSize"/>
+    /// is split evenly over the files, rounded down to whole blocks.
+    /// </summary>
+    /// <param name="plan">The plan to run at every level.</param>
+    /// <param name="fileCounts">File counts to run (e.g., 1, 64, 1024, 16384).</param>
+    /// <param name="distribution">How IO is spread over the files.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    public async Task<FileSetScalingResult> RunAsync(
+        BenchmarkPlan plan,
+        IReadOnlyList<int> fileCounts,
+        FileDistribution distribution = FileDistribution.Uniform,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(plan);
+        ArgumentNullException.ThrowIfNull(fileCounts);
+        ValidateFileCounts(plan, fileCounts);
+
+        var startTime = DateTimeOffset.UtcNow;
+        var runner = new BenchmarkRunner(_engine, _sink);
+        var levels = new List<FileSetLevelResult>();
+        var name = plan.Name ?? "Benchmark";
+
+        foreach (int count in fileCounts)
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            var fileSet = new FileSetSpec { FileCount = count, Distribution = distribution };
+            var levelName = fileSet.GetDisplayName();
+            var levelPlan = plan with
+            {
+                Name = $"{name} [{levelName}]",
+                Workloads = [.. plan.Workloads.Select(w => w with { FileSet = fileSet, FileSize = GetFileSize(w, count) })]
+            };
+
+            var result = await runner.RunAsync(levelPlan, cancellationToken).ConfigureAwait(false);
+            levels.Add(new FileSetLevelResult { Name = levelName, FileCount = count, Result = result });
+        }
+
+        return new FileSetScalingResult
+        {
+            Distribution = distribution,
+            Levels = levels,
+            Workloads = FilesystemComparisonRunner.Compare(levels.Select(l => (l.Name, l.Result)).ToList()),
+            StartTime = startTime,
+            Duration = DateTimeOffset.UtcNow - startTime
+        };
+    }
+
+    private static long GetFileSize(WorkloadSpec workload, int fileCount) =>
+        workload.FileSize / fileCount / workload.BlockSize * workload.BlockSize;
+
+    private static void ValidateFileCounts(BenchmarkPlan plan, IReadOnlyList<int> fileCounts)
+    {
+        if (fileCounts.Count == 0)
+        {
+            throw new ArgumentException("At least one file count is required.", nameof(fileCounts));
+        }
+
+        if (fileCounts.Any(c => c <= 0))
+        {
+            throw new ArgumentException("File counts must be positive.", nameof(fileCounts));
+        }
+
+        if (fileCounts.Distinct().Count() != fileCounts.Count)
+        {
+            throw new ArgumentException("File counts must be distinct.", nameof(fileCounts));
+        }
+
+        foreach (var workload in plan.Workloads)
+        {
+            if (workload.BlockSize > 0 && GetFileSize(workload, fileCounts.Max()) == 0)
+            {
+                throw new ArgumentException(
+                    $"{workload.GetDisplayName()}: {workload.FileSize} bytes cannot be split into {fileCounts.Max()} files of at least one {workload.BlockSize}-byte block.",
+                    nameof(fileCounts));
+            }
+        }
+    }
+}
@@ -0,0 +1,208 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Runs one benchmark plan in several target directories (different filesystems, mount options
+/// or loop-mounted images) and normalizes the results against the fastest target.
+/// </summary>
+public sealed class FilesystemComparisonRunner
+{
+    /// <summary>
+    /// Subdirectory of each target that holds the test files.
+    /// </summary>
+    public const string TestFileDirectoryName = "diskbench";
+
+    private readonly IBenchmarkEngine _engine;
+    private readonly IBenchmarkSink _sink;
+    private readonly IEnergyMeter? _energyMeter;
+
+    /// <summary>
+    /// Creates a new comparison runner.
+    /// </summary>
+    /// <param name="engine">The IO engine to use.</param>
+    /// <param name="sink">Optional sink for progress events (receives every target's run).</param>
+    /// <param name="energyMeter">Optional energy meter for efficiency metrics.</param>
+    public FilesystemComparisonRunner(IBenchmarkEngine engine, IBenchmarkSink? sink = null, IEnergyMeter? energyMeter = null)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _sink = sink ?? NullBenchmarkSink.Instance;
+        _energyMeter = energyMeter;
+    }
+
+    /// <summary>
+    /// Runs the plan once per target. Each workload's test file is placed in a "diskbench"
+    /// subdirectory of the target under its original file name, so workloads sharing a file share
+    /// one prepare per target, and cleanup never removes the target directory itself. Different files
+    /// with the same name get a numbered prefix so they stay separate files.
+    /// </summary>
+    /// <param name="plan">The plan to run on every target.</param>
+    /// <param name="targets">Target directories (at least two).</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    public async Task<FilesystemComparisonResult> RunAsync(
+        BenchmarkPlan plan,
+        IReadOnlyList<ComparisonTarget> targets,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(plan);
+        ArgumentNullException.ThrowIfNull(targets);
+        ValidateTargets(targets);
+
+        var startTime = DateTimeOffset.UtcNow;
+        var runner = new BenchmarkRunner(_engine, _sink, _energyMeter);
+        var runs = new List<(string Name, ComparisonTarget Target, MountEntry? Mount, string? FileSystem, BenchmarkResult Result)>();
+
+        foreach (var target in targets)
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            var directory = Path.GetFullPath(target.Directory);
+            var mount = MountTable.Find(directory);
+            var fileSystem = mount?.FileSystem ?? _engine.GetDriveDetails(directory)?.FileSystem;
+            var name = target.Name ?? (fileSystem != null ? $"{fileSystem} ({directory})" : directory);
+
+            var fileDirectory = Path.Combine(directory, TestFileDirectoryName);
+            var targetPlan = plan with
+            {
+                Name = $"{plan.Name ?? "Benchmark"} [{name}]",
+                Workloads = RebaseFilePaths(plan.Workloads, fileDirectory)
+            };
+
+            var result = await runner.RunAsync(targetPlan, cancellationToken).ConfigureAwait(false);
+            runs.Add((name, target, mount, fileSystem, result));
+        }
+
+        var workloads = Compare(runs.Select(r => (r.Name, r.Result)).ToList());
+
+        var targetResults = runs.Select((run, index) => new ComparisonTargetResult
+        {
+            Name = run.Name,
+            Directory = Path.GetFullPath(run.Target.Directory),
+            FileSystem = run.FileSystem,
+            MountOptions = run.Mount?.Options,
+            Device = run.Mount?.Device,
+            Score = GeometricMean(workloads.Select(w => w.Scores[index].RelativeIops)),
+            Result = run.Result
+        }).ToList();
+
+        return new FilesystemComparisonResult
+        {
+            Targets = targetResults,
+            Workloads = workloads,
+            StartTime = startTime,
+            Duration = DateTimeOffset.UtcNow - startTime
+        };
+    }
+
+    /// <summary>
+    /// Builds the per-workload comparison from per-target results.
+    /// Workloads are matched by position, since every target ran the same plan.
+    /// </summary>
+    /// <param name="runs">Target names and their results, in target order.</param>
+    public static IReadOnlyList<WorkloadComparison> Compare(IReadOnlyList<(string Name, BenchmarkResult Result)> runs)
+    {
+        ArgumentNullException.ThrowIfNull(runs);
+        if (runs.Count == 0)
+        {
+            return [];
+        }
+
+        int workloadCount = runs.Min(r => r.Result.Workloads.Count);
+        var comparisons = new List<WorkloadComparison>(workloadCount);
+
+        for (int w = 0; w < workloadCount; w++)
+        {
+            var results = runs.Select(r => r.Result.Workloads[w]).ToList();
+            double bestIops = results.Max(r => r.MeanIops);
+            double bestP99 = results.Where(r => r.MeanLatency.P99Us > 0).Select(r => r.MeanLatency.P99Us).DefaultIfEmpty(0).Min();
+            int fastest = results.FindIndex(r => r.MeanIops == bestIops);
+
+            comparisons.Add(new WorkloadComparison
+            {
+                WorkloadName = results[0].Workload.GetDisplayName(),
+                FastestTarget = runs[fastest].Name,
+                Scores = results.Select((r, t) => new TargetScore
+                {
+                    TargetName = runs[t].Name,
+                    MeanIops = r.MeanIops,
+                    MeanBytesPerSecond = r.MeanBytesPerSecond,
+                    P99LatencyUs = r.MeanLatency.P99Us,
+                    RelativeIops = bestIops > 0 ? r.MeanIops / bestIops : 0,
+                    RelativeP99Latency = bestP99 > 0 ? r.MeanLatency.P99Us / bestP99 : 0
+                }).ToList()
+            });
+        }
+
+        return comparisons;
+    }
+
+    /// <summary>
+    /// Moves every workload's file into the target's test file directory. Workloads that shared a file
+    /// still share it; distinct files whose names collide are prefixed with their position among the
+    /// plan's files ("2-bench.dat").
+    /// </summary>
+    private static List<WorkloadSpec> RebaseFilePaths(IReadOnlyList<WorkloadSpec> workloads, string fileDirectory)
+    {
+        var sources = workloads
+            .Select(w => Path.GetFullPath(w.FilePath))
+            .Distinct(StringComparer.OrdinalIgnoreCase)
+            .ToList();
+        var collidingNames = sources
+            .GroupBy(Path.GetFileName, StringComparer.OrdinalIgnoreCase)
+            .Where(g => g.Count() > 1)
+            .Select(g => g.Key)
+            .ToHashSet(StringComparer.OrdinalIgnoreCase);
+
+        var rebased = new Dictionary<string, string>(StringComparer.OrdinalIgnoreCase);
+        for (int i = 0; i < sources.Count; i++)
+        {
+            var fileName = Path.GetFileName(sources[i]);
+            rebased[sources[i]] = Path.Combine(fileDirectory, collidingNames.Contains(fileName) ? $"{i + 1}-{fileName}" : fileName);
+        }
+
+        return [.. workloads.Select(w => w with { FilePath = rebased[Path.GetFullPath(w.FilePath)] })];
+    }
+
+    private static void ValidateTargets(IReadOnlyList<ComparisonTarget> targets)
+    {
+        if (targets.Count < 2)
+        {
+            throw new ArgumentException("A comparison needs at least two targets.", nameof(targets));
+        }
+
+        var directories = new HashSet<string>(StringComparer.Ordinal);
+        foreach (var target in targets)
+        {
+            if (string.IsNullOrWhiteSpace(target.Directory))
+            {
+                throw new ArgumentException("Target directory cannot be empty.", nameof(targets));
+            }
+
+            if (!Directory.Exists(target.Directory))
+            {
+                throw new ArgumentException($"Target directory does not exist: {target.Directory}", nameof(targets));
+            }
+
+            if (!directories.Add(Path.GetFullPath(target.Directory)))
+            {
+                throw new ArgumentException($"Target directory listed twice: {target.Directory}", nameof(targets));
+            }
+        }
+    }
+
+    private static double GeometricMean(IEnumerable<double> values)
+    {
+        double logSum = 0;
+        int count = 0;
+        foreach (var value in values)
+        {
+            if (value <= 0)
+            {
+                return 0;
+            }
+
+            logSum += Math.Log(value);
+            count++;
+        }
+
+        return count > 0 ? Math.Exp(logSum / count) : 0;
+    }
+}
@@ -35,6 +35,11 @@ public sealed class PrepareResult
     /// </summary>
     public required bool UsedSetValidData { get; init; }
 
+    /// <summary>
+    /// Generated content the file holds, as recorded in its manifest (null = zeros, a fill pattern or unknown).
+    /// </summary>
+    public PreparedContent? Content { get; init; }
+
     /// <summary>
     /// Any warnings generated during preparation.
     /// </summary>
@@ -89,6 +94,287 @@ public interface IBenchmarkEngine : IAsyncDisposable
     IReadOnlyList<DriveDetails> GetAllDriveDetails();
 }
 
+/// <summary>
+/// Engine-specific file copy strategies (<see cref="CopyStrategy.Unbuffered"/>, <see cref="CopyStrategy.Clone"/>).
+/// Engines that implement it are picked up by <see cref="FileCopyRunner"/>.
+/// </summary>
+public interface IFileCopyEngine
+{
+    /// <summary>
+    /// Copies a file, replacing the destination.
+    /// </summary>
+    /// <param name="copyCase">Strategy and buffer settings.</param>
+    /// <param name="sourcePath">File to copy.</param>
+    /// <param name="destinationPath">File to create.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    /// <returns>Bytes copied.</returns>
+    /// <exception cref="NotSupportedException">The strategy is not available for these files (e.g., no block cloning).</exception>
+    Task<long> CopyFileAsync(CopyCase copyCase, string sourcePath, string destinationPath, CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Drops a file's pages from the system file cache, so the next copy reads it from the device.
+    /// </summary>
+    /// <param name="path">File to evict.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    Task EvictFromCacheAsync(string path, CancellationToken cancellationToken = default);
+}
+
+/// <summary>
+/// A fault to apply to a single IO.
+/// </summary>
+/// <param name="Kind">Kind of fault.</param>
+/// <param name="Delay">Extra completion delay for latency spikes and stalls.</param>
+/// <param name="BytesTransferred">Bytes actually transferred for short transfers.</param>
+public readonly record struct IoFault(IoFaultKind Kind, TimeSpan Delay = default, int BytesTransferred = 0)
+{
+    /// <summary>
+    /// No fault.
+    /// </summary>
+    public static IoFault None => default;
+}
+
+/// <summary>
+/// Decides which IOs of a trial get faults. Engines call it once per completed IO attempt
+/// from the trial thread, so implementations need not be thread-safe.
+/// </summary>
+public interface IIoFaultInjector
+{
+    /// <summary>
+    /// Returns the fault for an IO that just completed successfully, or <see cref="IoFault.None"/>.
+    /// </summary>
+    /// <param name="offset">File offset of the IO.</param>
+    /// <param name="size">Requested size in bytes.</param>
+    /// <param name="isWrite">Whether the IO is a write.</param>
+    IoFault NextFault(long offset, int size, bool isWrite);
+}
+
+/// <summary>
+/// One IO of a workload's stream. Generator sources each fill in their own field for a batch of descriptors.
+/// </summary>
+/// <param name="Offset">File offset in bytes.</param>
+/// <param name="Size">Size in bytes, at most the workload's block size.</param>
+/// <param name="IsWrite">Whether the IO is a write.</param>
+/// <param name="ThinkTimeTicks">Stopwatch ticks to wait, once a queue slot frees up, before issuing the IO (0 = at once).</param>
+public record struct IoDescriptor(long Offset, int Size, bool IsWrite, long ThinkTimeTicks)
+{
+    /// <summary>
+    /// Index of the file the IO targets within <see cref="WorkloadSpec.FileSet"/> (0 for single-file workloads).
+    /// Chosen by the engine from the file set's distribution.
+    /// </summary>
+    public int FileIndex { get; set; }
+}
+
+/// <summary>
+/// Source of IO offsets. Engines pull IOs in batches, so sources are called once per batch rather than per IO.
+/// Sources are created per trial and called from the trial thread; <c>Fill</c> should not allocate.
+/// </summary>
+public interface IOffsetSource
+{
+    /// <summary>
+    /// Sets <see cref="IoDescriptor.Offset"/> of every descriptor in the batch.
+    /// </summary>
+    /// <param name="batch">Descriptors to fill.</param>
+    void Fill(Span<IoDescriptor> batch);
+}
+
+/// <summary>
+/// Source of read/write decisions, called once per batch like <see cref="IOffsetSource"/>.
+/// </summary>
+public interface IOperationSource
+{
+    /// <summary>
+    /// Sets <see cref="IoDescriptor.IsWrite"/> of every descriptor in the batch.
+    /// </summary>
+    /// <param name="batch">Descriptors to fill.</param>
+    void Fill(Span<IoDescriptor> batch);
+}
+
+/// <summary>
+/// Source of IO sizes, called once per batch like <see cref="IOffsetSource"/>.
+/// </summary>
+public interface ISizeSource
+{
+    /// <summary>
+    /// Sets <see cref="IoDescriptor.Size"/> of every descriptor in the batch.
+    /// </summary>
+    /// <param name="batch">Descriptors to fill.</param>
+    void Fill(Span<IoDescriptor> batch);
+}
+
+/// <summary>
+/// Source of think times between IOs, called once per batch like <see cref="IOffsetSource"/>.
+/// </summary>
+public interface IThinkTimeSource
+{
+    /// <summary>
+    /// Sets <see cref="IoDescriptor.ThinkTimeTicks"/> of every descriptor in the batch.
+    /// </summary>
+    /// <param name="batch">Descriptors to fill.</param>
+    void Fill(Span<IoDescriptor> batch);
+}
+
+/// <summary>
+/// Entry point of an IO generator plugin, named by <see cref="WorkloadSpec.Generator"/>.
+/// One instance is shared by every workload that names the type, so it should hold no per-trial state.
+/// Return null from any method to keep the workload's built-in source for that field.
+/// </summary>
+public interface IIoGeneratorFactory
+{
+    /// <summary>
+    /// Creates the offset source for a trial (null = <see cref="WorkloadSpec.Pattern"/>).
+    /// </summary>
+    /// <param name="context">Workload, seed and parameters.</param>
+    IOffsetSource? CreateOffsetSource(IoGeneratorContext context);
+
+    /// <summary>
+    /// Creates the read/write source for a trial (null = <see cref="WorkloadSpec.WritePercent"/>).
+    /// </summary>
+    /// <param name="context">Workload, seed and parameters.</param>
+    IOperationSource? CreateOperationSource(IoGeneratorContext context);
+
+    /// <summary>
+    /// Creates the size source for a trial (null = every IO is <see cref="WorkloadSpec.BlockSize"/>).
+    /// </summary>
+    /// <param name="context">Workload, seed and parameters.</param>
+    ISizeSource? CreateSizeSource(IoGeneratorContext context);
+
+    /// <summary>
+    /// Creates the think time source for a trial (null = no think time).
+    /// </summary>
+    /// <param name="context">Workload, seed and parameters.</param>
+    IThinkTimeSource? CreateThinkTimeSource(IoGeneratorContext context);
+}
+
+/// <summary>
+/// Observes every IO an engine issues and retires, for conformance and determinism checks.
+/// Engines call it from the trial thread; every issued IO is retired exactly once
+/// (completed or abandoned) before <see cref="IBenchmarkEngine.RunTrialAsync"/> returns.
+/// </summary>
+public interface IIoObserver
+{
+    /// <summary>
+    /// Called when a new IO is issued (retries of the same IO are not reported again).
+    /// </summary>
+    /// <param name="offset">File offset of the IO.</param>
+    /// <param name="size">Requested size in bytes.</param>
+    /// <param name="isWrite">Whether the IO is a write.</param>
+    void OnIssued(long offset, int size, bool isWrite);
+
+    /// <summary>
+    /// Called when an IO completes successfully.
+    /// </summary>
+    /// <param name="offset">File offset of the IO.</param>
+    /// <param name="isWrite">Whether the IO is a write.</param>
+    /// <param name="data">The bytes written or read (empty if the engine does not move real data).</param>
+    void OnCompleted(long offset, bool isWrite, ReadOnlySpan<byte> data);
+
+    /// <summary>
+    /// Called when an IO is given up on: failed after all retries, cancelled, or discarded while draining.
+    /// </summary>
+    /// <param name="offset">File offset of the IO.</param>
+    /// <param name="isWrite">Whether the IO is a write.</param>
+    void OnAbandoned(long offset, bool isWrite);
+}
+
+/// <summary>
+/// Cumulative energy counters at a point in time.
+/// </summary>
+/// <param name="Timestamp">Stopwatch timestamp when the counters were read.</param>
+/// <param name="PackageJoules">Cumulative CPU package energy in joules (all sockets).</param>
+/// <param name="DramJoules">Cumulative DRAM energy in joules, or null if not exposed.</param>
+public readonly record struct EnergySample(long Timestamp, double PackageJoules, double? DramJoules);
+
+/// <summary>
+/// Source of hardware energy counters sampled around each trial.
+/// </summary>
+public interface IEnergyMeter
+{
+    /// <summary>
+    /// Whether energy counters can be read on this system.
+    /// </summary>
+    bool IsAvailable { get; }
+
+    /// <summary>
+    /// Counter source (e.g., "RAPL: package-0, dram") or the reason counters are unavailable.
+    /// </summary>
+    string Description { get; }
+
+    /// <summary>
+    /// Reads the cumulative counters. Counter wraparound is handled by the meter,
+    /// so the difference between two samples is always the energy used in between.
+    /// </summary>
+    EnergySample Read();
+}
+
+/// <summary>
+/// System-wide page cache write-back state at a point in time.
+/// </summary>
+/// <param name="Timestamp">Stopwatch timestamp when the counters were read.</param>
+/// <param name="DirtyBytes">Bytes of dirty pages waiting to be written back.</param>
+/// <param name="WritebackBytes">Bytes of pages being written to the device, or null if not exposed.</param>
+public readonly record struct WriteBackSample(long Timestamp, long DirtyBytes, long? WritebackBytes)
+{
+    /// <summary>
+    /// Bytes written by applications but not yet on the device.
+    /// </summary>
+    public long PendingBytes => DirtyBytes + (WritebackBytes ?? 0);
+}
+
+/// <summary>
+/// Source of page cache dirty/writeback counters sampled during buffered write trials.
+/// </summary>
+public interface IWriteBackMonitor
+{
+    /// <summary>
+    /// Whether the counters can be read on this system.
+    /// </summary>
+    bool IsAvailable { get; }
+
+    /// <summary>
+    /// Counter source (e.g., "/proc/meminfo") or the reason counters are unavailable.
+    /// </summary>
+    string Description { get; }
+
+    /// <summary>
+    /// Reads the current counters. Called every 100 ms while a trial runs, off the IO thread.
+    /// </summary>
+    WriteBackSample Read();
+}
+
+/// <summary>
+/// Cumulative page cache eviction counters at a point in time.
+/// </summary>
+/// <param name="ReclaimedPages">Pages reclaimed (evicted) by the kernel.</param>
+/// <param name="RefaultedPages">Evicted file pages read back in soon after: a sign the cache is too small.</param>
+public readonly record struct PageCacheCounters(long ReclaimedPages, long RefaultedPages);
+
+/// <summary>
+/// Constrains the memory available to the page cache while a scenario runs.
+/// </summary>
+public interface IMemoryPressure
+{
+    /// <summary>
+    /// Whether the constraint can be applied on this system.
+    /// </summary>
+    bool IsAvailable { get; }
+
+    /// <summary>
+    /// Method (e.g., "cgroup /sys/fs/cgroup/bench") or the reason it is unavailable.
+    /// </summary>
+    string Description { get; }
+
+    /// <summary>
+    /// Limits the page cache to about <paramref name="cacheBytes"/> until the returned handle is disposed.
+    /// </summary>
+    /// <param name="cacheBytes">Memory left for cached file pages.</param>
+    IDisposable Apply(long cacheBytes);
+
+    /// <summary>
+    /// Reads the cumulative eviction counters within the constrained scope, or null if not exposed.
+    /// </summary>
+    PageCacheCounters? ReadCounters();
+}
+
 /// <summary>
 /// Sink for receiving benchmark events (for renderers/reporters).
 /// </summary>
@@ -179,3 +465,15 @@ public sealed class NullBenchmarkSink : IBenchmarkSink
     /// <inheritdoc />
     public void OnWarning(string message) { }
 }
+
+/// <summary>
+/// Blocks the calling thread for short intervals with sub-millisecond precision. Stressor threads
+/// create one each and use it for the idle part of their duty cycle, so it need not be thread-safe.
+/// </summary>
+public interface IIdleWaiter : IDisposable
+{
+    /// <summary>
+    /// Blocks the calling thread for about <paramref name="duration"/> without using the CPU.
+    /// </summary>
+    void Wait(TimeSpan duration);
+}
@@ -0,0 +1,179 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Runs a plan on an idle host and then under each interference level (CPU burn, memory streaming,
+/// cache thrashing), and reports how much each workload's latency and IOPS moved against the idle baseline.
+/// Stressors start before each level's run and stop after it, so they also overlap file preparation and warmup.
+/// </summary>
+public sealed class InterferenceRunner
+{
+    private readonly IBenchmarkEngine _engine;
+    private readonly IBenchmarkSink _sink;
+    private readonly Func<int, bool>? _pinCurrentThread;
+    private readonly Func<IIdleWaiter?>? _createIdleWaiter;
+
+    /// <summary>
+    /// Creates a new interference runner.
+    /// </summary>
+    /// <param name="engine">The IO engine to use.</param>
+    /// <param name="sink">Optional sink for progress events (receives every level's run).</param>
+    /// <param name="pinCurrentThread">Pins the calling thread to a processor id; needed for stressors with CPUs set.</param>
+    /// <param name="createIdleWaiter">Creates a precise idle waiter per stressor thread, so duty cycles keep a 10 ms period.</param>
+    public InterferenceRunner(
+        IBenchmarkEngine engine,
+        IBenchmarkSink? sink = null,
+        Func<int, bool>? pinCurrentThread = null,
+        Func<IIdleWaiter?>? createIdleWaiter = null)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _sink = sink ?? NullBenchmarkSink.Instance;
+        _pinCurrentThread = pinCurrentThread;
+        _createIdleWaiter = createIdleWaiter;
+    }
+
+    /// <summary>
+    /// Runs the plan idle, then once per level with that level's stressors running.
+    /// </summary>
+    /// <param name="plan">The plan to run at every level.</param>
+    /// <param name="levels">Interference levels, typically the same stressor at rising intensity.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    public async Task<InterferenceResult> RunAsync(
+        BenchmarkPlan plan,
+        IReadOnlyList<StressorLevel> levels,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(plan);
+        ArgumentNullException.ThrowIfNull(levels);
+
+        if (levels.Count == 0)
+        {
+            throw new ArgumentException("At least one interference level is required.", nameof(levels));
+        }
+
+        foreach (var stressor in levels.SelectMany(l => l.Stressors ?? throw new ArgumentException("Level stressors cannot be null.", nameof(levels))))
+        {
+            ValidateStressor(stressor);
+        }
+
+        var startTime = DateTimeOffset.UtcNow;
+        var runner = new BenchmarkRunner(_engine, _sink);
+        var results = new List<InterferenceLevelResult>();
+        var name = plan.Name ?? "Benchmark";
+
+        // Idle baseline first, so every level has a reference
+        foreach (var level in levels.Prepend(new StressorLevel { Name = "idle", Stressors = [] }))
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            var levelName = level.Name ?? string.Join(" + ", level.Stressors.Select(s => s.GetDisplayName()));
+            var stressors = new List<InterferenceStressor>();
+            BenchmarkResult result;
+            try
+            {
+                foreach (var spec in level.Stressors)
+                {
+                    stressors.Add(new InterferenceStressor(spec, _pinCurrentThread, _createIdleWaiter));
+                }
+
+                result = await runner.RunAsync(plan with { Name = $"{name} [{levelName}]" }, cancellationToken).ConfigureAwait(false);
+            }
+            finally
+            {
+                foreach (var stressor in stressors)
+                {
+                    stressor.Dispose();
+                }
+            }
+
+            foreach (var (stressor, spec) in stressors.Zip(level.Stressors))
+            {
+                if (stressor.UnpinnedThreads > 0)
+                {
+                    _sink.OnWarning($"{spec.GetDisplayName()}: {stressor.UnpinnedThreads} thread(s) could not be pinned and ran unplaced.");
+                }
+            }
+
+            results.Add(new InterferenceLevelResult
+            {
+                Name = levelName,
+                Stressors = level.Stressors,
+                StressorThroughput = [.. stressors.Zip(level.Stressors, (s, spec) => new StressorThroughput
+                {
+                    Name = spec.GetDisplayName(),
+                    PerSecond = s.WorkPerSecond,
+                    Unit = s.Unit,
+                    BusyFraction = s.BusyFraction
+                })],
+                Sensitivity = GetSensitivity(results.Count > 0 ? results[0].Result : result, result),
+                Result = result
+            });
+        }
+
+        return new InterferenceResult
+        {
+            Levels = results,
+            Workloads = FilesystemComparisonRunner.Compare(results.Select(l => (l.Name, l.Result)).ToList()),
+            StartTime = startTime,
+            Duration = DateTimeOffset.UtcNow - startTime
+        };
+    }
+
+    /// <summary>
+    /// Divides each workload's IOPS and latency percentiles by the baseline's (matched by position).
+    /// </summary>
+    /// <param name="baseline">Idle result.</param>
+    /// <param name="result">Result under interference.</param>
+    public static IReadOnlyList<LatencySensitivity> GetSensitivity(BenchmarkResult baseline, BenchmarkResult result)
+    {
+        ArgumentNullException.ThrowIfNull(baseline);
+        ArgumentNullException.ThrowIfNull(result);
+
+        int count = Math.Min(baseline.Workloads.Count, result.Workloads.Count);
+        var sensitivity = new List<LatencySensitivity>(count);
+        for (int w = 0; w < count; w++)
+        {
+            var idle = baseline.Workloads[w];
+            var loaded = result.Workloads[w];
+            sensitivity.Add(new LatencySensitivity
+            {
+                WorkloadName = loaded.Workload.GetDisplayName(),
+                IopsRatio = Ratio(loaded.MeanIops, idle.MeanIops),
+                P50Ratio = Ratio(loaded.MeanLatency.P50Us, idle.MeanLatency.P50Us),
+                P99Ratio = Ratio(loaded.MeanLatency.P99Us, idle.MeanLatency.P99Us),
+                P999Ratio = Ratio(loaded.MeanLatency.P999Us, idle.MeanLatency.P999Us)
+            });
+        }
+
+        return sensitivity;
+    }
+
+    private static double Ratio(double value, double baseline) => baseline > 0 ? value / baseline : 0;
+
+    private static void ValidateStressor(StressorSpec stressor)
+    {
+        if (stressor.Threads <= 0)
+        {
+            throw new ArgumentException($"{stressor.Kind}: stressor threads must be positive.", nameof(stressor));
+        }
+
+        if (stressor.Intensity is <= 0 or > 1)
+        {
+            throw new ArgumentException($"{stressor.Kind}: intensity must be greater than 0 and at most 1.", nameof(stressor));
+        }
+
+        if (stressor.Cpus is { Count: 0 } || stressor.Cpus?.Any(c => c < 0) == true)
+        {
+            throw new ArgumentException($"{stressor.Kind}: CPUs must be a non-empty list of processor ids.", nameof(stressor));
+        }
+
+        if (stressor.BufferBytes is < 4096)
+        {
+            throw new ArgumentException($"{stressor.Kind}: buffer must be at least 4 KB.", nameof(stressor));
+        }
+
+        if (!Enum.IsDefined(stressor.Kind))
+        {
+            throw new ArgumentException($"Unknown stressor kind: {stressor.Kind}", nameof(stressor));
+        }
+    }
+}
@@ -0,0 +1,321 @@
+using System.Diagnostics;
+using System.Numerics;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Runs the threads of one <see cref="StressorSpec"/> until disposed. Each thread works in short
+/// batches for <see cref="StressorSpec.Intensity"/> of every period and idles for the rest.
+/// </summary>
+/// <remarks>
+/// The idle part uses an <see cref="IIdleWaiter"/> when one is supplied, so the period stays 10 ms.
+/// Without one, threads fall back to <see cref="Thread.Sleep(int)"/>, which is rounded up to the OS
+/// timer tick (about 15.6 ms on Windows), so the period is stretched to ten ticks and threads sleep
+/// while a whole tick fits and yield for the rest. Yielding keeps the core busy, so it counts towards
+/// <see cref="BusyFraction"/>, which reports the CPU share the threads actually took.
+/// </remarks>
+public sealed class InterferenceStressor : IDisposable
+{
+    /// <summary>
+    /// Duty cycle period (stretched to ten OS timer ticks when threads have no <see cref="IIdleWaiter"/>).
+    /// </summary>
+    public static readonly TimeSpan Period = TimeSpan.FromMilliseconds(10);
+
+    private const long DefaultStreamBytes = 64 * 1024 * 1024;
+    private const long DefaultThrashBytes = 32 * 1024 * 1024;
+    private const int CacheLineBytes = 64;
+
+    // Longest observed Thread.Sleep(1), measured once per process
+    private static readonly Lazy<long> SleepGranularityTicks = new(MeasureSleepGranularity);
+
+    private readonly StressorSpec _spec;
+    private readonly Func<int, bool>? _pinCurrentThread;
+    private readonly Func<IIdleWaiter?>? _createIdleWaiter;
+    private readonly Thread[] _threads;
+    private readonly long _startTimestamp;
+    private volatile bool _stopping;
+    private long _work;
+    private long _busyTicks;
+    private int _unpinnedThreads;
+    private long _stopTimestamp;
+
+    /// <summary>
+    /// Starts the stressor threads.
+    /// </summary>
+    /// <param name="spec">What to run.</param>
+    /// <param name="pinCurrentThread">
+    /// Pins the calling thread to a processor id, returning false if it could not; required when
+    /// <see cref="StressorSpec.Cpus"/> is set, since thread affinity is platform-specific.
+    /// </param>
+    /// <param name="createIdleWaiter">
+    /// Creates a precise waiter for the calling thread, or returns null if none is available; called once
+    /// per stressor thread. Without one, threads sleep in OS timer ticks.
+    /// </param>
+    public InterferenceStressor(StressorSpec spec, Func<int, bool>? pinCurrentThread = null, Func<IIdleWaiter?>? createIdleWaiter = null)
+    {
+        ArgumentNullException.ThrowIfNull(spec);
+        _spec = spec;
+        _pinCurrentThread = pinCurrentThread;
+        _createIdleWaiter = createIdleWaiter;
+        _startTimestamp = Stopwatch.GetTimestamp();
+        _threads = new Thread[spec.Threads];
+
+        for (int i = 0; i < _threads.Length; i++)
+        {
+            int index = i;
+            _threads[i] = new Thread(() => Run(index))
+            {
+                IsBackground = true,
+                Name = $"DiskBench {spec.Kind} {i}"
+            };
+            _threads[i].Start();
+        }
+    }
+
+    /// <summary>
+    /// Unit of <see cref="Work"/>: "ops", "bytes" or "lines".
+    /// </summary>
+    public string Unit => _spec.Kind switch
+    {
+        StressorKind.MemoryStream => "bytes",
+        StressorKind.CacheThrash => "lines",
+        _ => "ops"
+    };
+
+    /// <summary>
+    /// Work completed so far across all threads.
+    /// </summary>
+    public long Work => Interlocked.Read(ref _work);
+
+    /// <summary>
+    /// Threads that could not be pinned to their processor.
+    /// </summary>
+    public int UnpinnedThreads => Volatile.Read(ref _unpinnedThreads);
+
+    /// <summary>
+    /// Work per second from start until now, or until the stressor was stopped.
+    /// </summary>
+    public double WorkPerSecond
+    {
+        get
+        {
+            long end = _stopTimestamp != 0 ? _stopTimestamp : Stopwatch.GetTimestamp();
+            double seconds = (double)(end - _startTimestamp) / Stopwatch.Frequency;
+            return seconds > 0 ? Work / seconds : 0;
+        }
+    }
+
+    /// <summary>
+    /// Fraction of the time since start that the threads spent working or spinning rather than
+    /// blocked, averaged over threads. Compare it with <see cref="StressorSpec.Intensity"/> to confirm
+    /// the load was applied.
+    /// </summary>
+    public double BusyFraction
+    {
+        get
+        {
+            long end = _stopTimestamp != 0 ? _stopTimestamp : Stopwatch.GetTimestamp();
+            double elapsed = (double)(end - _startTimestamp) * _threads.Length;
+            return elapsed > 0 ? Math.Min(1.0, Interlocked.Read(ref _busyTicks) / elapsed) : 0;
+        }
+    }
+
+    /// <summary>
+    /// Stops the threads and waits for them to exit.
+    /// </summary>
+    public void Dispose()
+    {
+        if (_stopping)
+        {
+            return;
+        }
+
+        _stopping = true;
+        foreach (var thread in _threads)
+        {
+            thread.Join();
+        }
+
+        _stopTimestamp = Stopwatch.GetTimestamp();
+    }
+
+    private void Run(int index)
+    {
+        if (_spec.Cpus != null && (_pinCurrentThread == null || !_pinCurrentThread(_spec.Cpus[index % _spec.Cpus.Count])))
+        {
+            Interlocked.Increment(ref _unpinnedThreads);
+        }
+
+        Func<long> batch = _spec.Kind switch
+        {
+            StressorKind.IntegerBurn => IntegerBatch(index),
+            StressorKind.VectorBurn => VectorBatch(index),
+            StressorKind.MemoryStream => StreamBatch(_spec.BufferBytes ?? DefaultStreamBytes),
+            StressorKind.CacheThrash => ThrashBatch(_spec.BufferBytes ?? DefaultThrashBytes, index),
+            _ => throw new ArgumentOutOfRangeException(nameof(index), _spec.Kind, "Unknown stressor kind")
+        };
+
+        using var waiter = _spec.Intensity < 1 ? _createIdleWaiter?.Invoke() : null;
+        long periodTicks = (long)(Period.TotalSeconds * Stopwatch.Frequency);
+        if (waiter == null && _spec.Intensity < 1)
+        {
+            periodTicks = Math.Max(periodTicks, 10 * SleepGranularityTicks.Value);
+        }
+
+        long busyTicks = (long)(periodTicks * _spec.Intensity);
+
+        while (!_stopping)
+        {
+            long periodStart = Stopwatch.GetTimestamp();
+            long work = 0;
+            do
+            {
+                work += batch();
+            }
+            while (Stopwatch.GetTimestamp() - periodStart < busyTicks && !_stopping);
+
+            Interlocked.Add(ref _work, work);
+            Interlocked.Add(ref _busyTicks, Stopwatch.GetTimestamp() - periodStart);
+
+            if (busyTicks < periodTicks)
+            {
+                WaitUntil(periodStart + periodTicks, waiter);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Idles until the deadline without overshooting it by a timer tick. Time spent yielding
+    /// rather than blocked is added to the busy time.
+    /// </summary>
+    private void WaitUntil(long deadline, IIdleWaiter? waiter)
+    {
+        if (waiter != null)
+        {
+            long remaining = deadline - Stopwatch.GetTimestamp();
+            if (remaining > 0 && !_stopping)
+            {
+                waiter.Wait(TimeSpan.FromSeconds((double)remaining / Stopwatch.Frequency));
+            }
+
+            return;
+        }
+
+        long granularity = SleepGranularityTicks.Value;
+        while (deadline - Stopwatch.GetTimestamp() > granularity && !_stopping)
+        {
+            Thread.Sleep(1);
+        }
+
+        long spinStart = Stopwatch.GetTimestamp();
+        while (Stopwatch.GetTimestamp() < deadline && !_stopping)
+        {
+            Thread.Yield();
+        }
+
+        Interlocked.Add(ref _busyTicks, Stopwatch.GetTimestamp() - spinStart);
+    }
+
+    private static long MeasureSleepGranularity()
+    {
+        long longest = 0;
+        for (int i = 0; i < 3; i++)
+        {
+            long start = Stopwatch.GetTimestamp();
+            Thread.Sleep(1);
+            longest = Math.Max(longest, Stopwatch.GetTimestamp() - start);
+        }
+
+        return longest;
+    }
+
+    // Each batch runs for a few microseconds and stores its state back to the closure, so the JIT cannot drop the loop
+
+    private static Func<long> IntegerBatch(int seed)
+    {
+        ulong state = 0x9E3779B97F4A7C15UL ^ (ulong)seed;
+        ulong sum = 0;
+        return () =>
+        {
+            ulong x = state;
+            ulong acc = sum;
+            for (int i = 0; i < 4096; i++)
+            {
+                x ^= x << 13;
+                x ^= x >> 7;
+                x ^= x << 17;
+                acc += x * 0xBF58476D1CE4E5B9UL;
+            }
+
+            (state, sum) = (x, acc);
+            return 4096;
+        };
+    }
+
+    private static Func<long> VectorBatch(int seed)
+    {
+        var accumulators = new[]
+        {
+            new Vector<float>(1.0f + seed),
+            new Vector<float>(1.5f),
+            new Vector<float>(0.5f),
+            new Vector<float>(2.0f)
+        };
+        var mul = new Vector<float>(0.999f);
+        var add = new Vector<float>(0.001f);
+        return () =>
+        {
+            // Four independent chains keep the multiply-add pipes busy
+            var (a, b, c, d) = (accumulators[0], accumulators[1], accumulators[2], accumulators[3]);
+            for (int i = 0; i < 1024; i++)
+            {
+                a = a * mul + add;
+                b = b * mul + add;
+                c = c * mul + add;
+                d = d * mul + add;
+            }
+
+            (accumulators[0], accumulators[1], accumulators[2], accumulators[3]) = (a, b, c, d);
+            return 4 * 1024L * Vector<float>.Count;
+        };
+    }
+
+    private static Func<long> StreamBatch(long bufferBytes)
+    {
+        // Copy one half of the buffer into the other, 1 MB per batch, wrapping around
+        int half = (int)Math.Min(bufferBytes / 2, int.MaxValue);
+        var buffer = GC.AllocateUninitializedArray<byte>(half * 2);
+        int chunk = Math.Min(half, 1024 * 1024);
+        int position = 0;
+        return () =>
+        {
+            if (position + chunk > half)
+            {
+                position = 0;
+            }
+
+            buffer.AsSpan(position, chunk).CopyTo(buffer.AsSpan(half + position, chunk));
+            position += chunk;
+            return 2L * chunk;
+        };
+    }
+
+    private static Func<long> ThrashBatch(long bufferBytes, int seed)
+    {
+        // Power-of-two line count: the full-period LCG then visits every line once per cycle
+        long lines = 1L << (63 - BitOperations.LeadingZeroCount((ulong)Math.Max(1, bufferBytes / CacheLineBytes)));
+        var buffer = new byte[lines * CacheLineBytes];
+        ulong mask = (ulong)lines - 1;
+        ulong index = (ulong)seed;
+        return () =>
+        {
+            for (int i = 0; i < 1024; i++)
+            {
+                index = (index * 6364136223846793005UL + 1442695040888963407UL) & mask;
+                buffer[(long)index * CacheLineBytes]++;
+            }
+
+            return 1024;
+        };
+    }
+}
@@ -0,0 +1,91 @@
+using System.Collections.Concurrent;
+using System.Runtime.Loader;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Loads IO generator plugins named by <see cref="WorkloadSpec.Generator"/>.
+/// Each factory type is instantiated once per process and shared.
+/// </summary>
+public static class IoGeneratorLoader
+{
+    private static readonly ConcurrentDictionary<(string? AssemblyPath, string TypeName), IIoGeneratorFactory> Factories = new();
+
+    /// <summary>
+    /// Gets the factory for a generator reference, loading its assembly on first use.
+    /// </summary>
+    /// <param name="reference">Generator to load.</param>
+    /// <exception cref="FileNotFoundException">The assembly does not exist.</exception>
+    /// <exception cref="InvalidOperationException">The type is missing or is not an <see cref="IIoGeneratorFactory"/>.</exception>
+    public static IIoGeneratorFactory Load(IoGeneratorReference reference)
+    {
+        ArgumentNullException.ThrowIfNull(reference);
+        if (string.IsNullOrWhiteSpace(reference.TypeName))
+        {
+            throw new ArgumentException("Generator type name cannot be empty.", nameof(reference));
+        }
+
+        var assemblyPath = reference.AssemblyPath != null ? Path.GetFullPath(reference.AssemblyPath) : null;
+        return Factories.GetOrAdd((assemblyPath, reference.TypeName), static key => Create(key.AssemblyPath, key.TypeName));
+    }
+
+    /// <summary>
+    /// Creates a trial's sources from a generator reference. Null entries keep the built-in source.
+    /// </summary>
+    /// <param name="reference">Generator to use.</param>
+    /// <param name="workload">Workload the sources generate IOs for.</param>
+    /// <param name="seed">Trial seed.</param>
+    public static (IOffsetSource? Offsets, IOperationSource? Operations, ISizeSource? Sizes, IThinkTimeSource? ThinkTimes) CreateSources(
+        IoGeneratorReference reference,
+        WorkloadSpec workload,
+        int seed)
+    {
+        ArgumentNullException.ThrowIfNull(workload);
+
+        var factory = Load(reference);
+        var context = new IoGeneratorContext
+        {
+            Workload = workload,
+            Seed = seed,
+            Parameters = reference.Parameters ?? new Dictionary<string, string>()
+        };
+
+        return (
+            factory.CreateOffsetSource(context),
+            factory.CreateOperationSource(context),
+            factory.CreateSizeSource(context),
+            factory.CreateThinkTimeSource(context));
+    }
+
+    private static IIoGeneratorFactory Create(string? assemblyPath, string typeName)
+    {
+        Type? type;
+        if (assemblyPath != null)
+        {
+            if (!File.Exists(assemblyPath))
+            {
+                throw new FileNotFoundException($"Generator assembly not found: {assemblyPath}", assemblyPath);
+            }
+
+            type = AssemblyLoadContext.Default.LoadFromAssemblyPath(assemblyPath).GetType(typeName, throwOnError: false);
+        }
+        else
+        {
+            type = Type.GetType(typeName, throwOnError: false);
+        }
+
+        if (type == null)
+        {
+            throw new InvalidOperationException(assemblyPath != null
+                ? $"Generator type '{typeName}' not found in {assemblyPath}."
+                : $"Generator type '{typeName}' not found; use an assembly-qualified name or set the assembly path.");
+        }
+
+        if (!typeof(IIoGeneratorFactory).IsAssignableFrom(type))
+        {
+            throw new InvalidOperationException($"Generator type '{typeName}' does not implement {nameof(IIoGeneratorFactory)}.");
+        }
+
+        return (IIoGeneratorFactory)Activator.CreateInstance(type)!;
+    }
+}
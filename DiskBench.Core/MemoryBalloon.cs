@@ -0,0 +1,171 @@
+using System.Runtime.InteropServices;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Squeezes the page cache by allocating and touching native memory until only the requested amount
+/// is left available. The kernel reclaims cached file pages before anything else to make room, so the
+/// cache cannot grow past what the balloon leaves. Works without privileges on any OS; eviction counters
+/// come from /proc/vmstat (system-wide) on Linux.
+/// </summary>
+/// <remarks>
+/// The balloon is allocated outside the managed heap and freed chunk by chunk on dispose, so its memory is
+/// back with the OS before the next pressure level inflates. The pages are not locked in RAM: with swap
+/// enabled the kernel may page some of them out instead of dropping cache, which weakens the constraint.
+/// </remarks>
+public sealed class MemoryBalloon : IMemoryPressure
+{
+    /// <summary>
+    /// Default allocation granularity.
+    /// </summary>
+    public const int DefaultChunkBytes = 64 * 1024 * 1024;
+
+    private const string MeminfoPath = "/proc/meminfo";
+    private const string VmstatPath = "/proc/vmstat";
+
+    private readonly Func<long>? _availableBytes;
+    private readonly string? _vmstatPath;
+    private readonly int _chunkBytes;
+
+    /// <summary>
+    /// Creates a balloon sized from MemAvailable in /proc/meminfo.
+    /// Unavailable on platforms other than Linux; use the provider overload there.
+    /// </summary>
+    public MemoryBalloon()
+    {
+        _chunkBytes = DefaultChunkBytes;
+        if (!OperatingSystem.IsLinux())
+        {
+            Description = "balloon needs an available-memory source on this platform";
+            return;
+        }
+
+        if (!File.Exists(MeminfoPath))
+        {
+            Description = $"{MeminfoPath} not present";
+            return;
+        }
+
+        _availableBytes = ReadMemAvailable;
+        _vmstatPath = File.Exists(VmstatPath) ? VmstatPath : null;
+        Description = "balloon (MemAvailable)";
+    }
+
+    /// <summary>
+    /// Creates a balloon sized from a custom available-memory source.
+    /// </summary>
+    /// <param name="availableBytes">Returns the physical memory currently available, including reclaimable cache.</param>
+    /// <param name="vmstatPath">Optional file in /proc/vmstat format for eviction counters.</param>
+    /// <param name="chunkBytes">Allocation granularity.</param>
+    public MemoryBalloon(Func<long> availableBytes, string? vmstatPath = null, int chunkBytes = DefaultChunkBytes)
+    {
+        ArgumentNullException.ThrowIfNull(availableBytes);
+        ArgumentOutOfRangeException.ThrowIfLessThan(chunkBytes, Environment.SystemPageSize);
+        _availableBytes = availableBytes;
+        _vmstatPath = vmstatPath;
+        _chunkBytes = chunkBytes;
+        Description = "balloon";
+    }
+
+    /// <inheritdoc />
+    public bool IsAvailable => _availableBytes != null;
+
+    /// <inheritdoc />
+    public string Description { get; }
+
+    /// <summary>
+    /// Inflates the balloon until no more than <paramref name="cacheBytes"/> (plus one chunk) is available.
+    /// </summary>
+    /// <param name="cacheBytes">Memory to leave available for the page cache.</param>
+    /// <returns>The inflated balloon; dispose it to release the memory.</returns>
+    public IDisposable Apply(long cacheBytes)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(cacheBytes);
+        if (_availableBytes == null)
+        {
+            throw new InvalidOperationException($"Memory balloon unavailable: {Description}");
+        }
+
+        var balloon = new Balloon();
+        try
+        {
+            // Never inflate past the initial surplus, in case the source lags behind the allocations
+            long target = _availableBytes() - cacheBytes;
+            while (balloon.Bytes + _chunkBytes <= target && _availableBytes() - _chunkBytes >= cacheBytes)
+            {
+                balloon.Inflate(_chunkBytes);
+            }
+        }
+        catch (OutOfMemoryException)
+        {
+            // Keep what was allocated: the system is already as tight as it can get
+        }
+
+        return balloon;
+    }
+
+    /// <inheritdoc />
+    public PageCacheCounters? ReadCounters()
+    {
+        if (_vmstatPath == null)
+        {
+            return null;
+        }
+
+        try
+        {
+            return PageCacheStats.ParseCounters(File.ReadAllText(_vmstatPath));
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return null;
+        }
+    }
+
+    private static long ReadMemAvailable()
+    {
+        var kilobytes = PageCacheStats.GetMeminfoKilobytes(File.ReadAllText(MeminfoPath), "MemAvailable")
+            ?? throw new FormatException($"No MemAvailable line in {MeminfoPath}");
+        return kilobytes * 1024;
+    }
+
+    /// <summary>
+    /// Native chunks, freed on dispose.
+    /// </summary>
+    private sealed unsafe class Balloon : IDisposable
+    {
+        private readonly List<IntPtr> _chunks = [];
+
+        public long Bytes { get; private set; }
+
+        public void Inflate(int chunkBytes)
+        {
+            // Chunks this large are mapped directly by the OS, and freeing them unmaps them again
+            var chunk = (byte*)NativeMemory.Alloc((nuint)chunkBytes);
+            _chunks.Add((IntPtr)chunk);
+            Bytes += chunkBytes;
+
+            // Fresh pages are not backed until written: touch one byte per page
+            int pageSize = Environment.SystemPageSize;
+            for (int i = 0; i < chunkBytes; i += pageSize)
+            {
+                chunk[i] = 1;
+            }
+        }
+
+        public void Dispose()
+        {
+            foreach (var chunk in _chunks)
+            {
+                NativeMemory.Free((void*)chunk);
+            }
+
+            _chunks.Clear();
+            Bytes = 0;
+        }
+    }
+}
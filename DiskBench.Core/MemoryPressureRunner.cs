@@ -0,0 +1,121 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Runs a plan's buffered workloads with the page cache constrained to several fractions of the
+/// working set, after an unconstrained baseline, and compares throughput, latency and evictions.
+/// </summary>
+public sealed class MemoryPressureRunner
+{
+    private readonly IBenchmarkEngine _engine;
+    private readonly IMemoryPressure _pressure;
+    private readonly IBenchmarkSink _sink;
+
+    /// <summary>
+    /// Creates a new memory pressure runner.
+    /// </summary>
+    /// <param name="engine">The IO engine to use.</param>
+    /// <param name="pressure">How to constrain the page cache.</param>
+    /// <param name="sink">Optional sink for progress events (receives every level's run).</param>
+    public MemoryPressureRunner(IBenchmarkEngine engine, IMemoryPressure pressure, IBenchmarkSink? sink = null)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _pressure = pressure ?? throw new ArgumentNullException(nameof(pressure));
+        _sink = sink ?? NullBenchmarkSink.Instance;
+    }
+
+    /// <summary>
+    /// Runs the plan unconstrained, then once per cache budget. Unbuffered workloads bypass
+    /// the page cache and are dropped with a warning.
+    /// </summary>
+    /// <param name="plan">The plan to run at every level.</param>
+    /// <param name="cacheFractions">Cache budgets as fractions of the working set (e.g., 1, 0.5, 0.25).</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    public async Task<MemoryPressureResult> RunAsync(
+        BenchmarkPlan plan,
+        IReadOnlyList<double> cacheFractions,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(plan);
+        ArgumentNullException.ThrowIfNull(cacheFractions);
+
+        if (cacheFractions.Count == 0)
+        {
+            throw new ArgumentException("At least one cache budget is required.", nameof(cacheFractions));
+        }
+
+        if (cacheFractions.Any(f => !(f > 0) || double.IsInfinity(f)))
+        {
+            throw new ArgumentException("Cache budgets must be positive fractions of the working set.", nameof(cacheFractions));
+        }
+
+        if (!_pressure.IsAvailable)
+        {
+            throw new InvalidOperationException($"Memory pressure unavailable: {_pressure.Description}");
+        }
+
+        var buffered = plan.Workloads.Where(w => !w.NoBuffering).ToList();
+        if (buffered.Count == 0)
+        {
+            throw new ArgumentException("Memory pressure needs at least one buffered workload.", nameof(plan));
+        }
+
+        if (buffered.Count < plan.Workloads.Count)
+        {
+            _sink.OnWarning($"Skipping {plan.Workloads.Count - buffered.Count} unbuffered workload(s): they bypass the page cache.");
+        }
+
+        // Workloads sharing a file share its cache footprint
+        long workingSet = buffered
+            .GroupBy(w => Path.GetFullPath(w.FilePath), StringComparer.Ordinal)
+            .Sum(g => g.Max(w => w.FileSize));
+
+        var startTime = DateTimeOffset.UtcNow;
+        var runner = new BenchmarkRunner(_engine, _sink);
+        var levels = new List<MemoryPressureLevelResult>();
+        var name = plan.Name ?? "Benchmark";
+
+        // Baseline first, so every constrained level has an unconstrained reference
+        foreach (double? fraction in cacheFractions.Select(f => (double?)f).Prepend(null))
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            long? cacheBytes = fraction.HasValue ? (long)(fraction.Value * workingSet) : null;
+            var levelName = fraction.HasValue
+                ? string.Create(CultureInfo.InvariantCulture, $"cache {fraction.Value * 100:F0}%")
+                : "unconstrained";
+            var levelPlan = plan with { Name = $"{name} [{levelName}]", Workloads = buffered };
+
+            BenchmarkResult result;
+            PageCacheCounters? before;
+            PageCacheCounters? after;
+            using (cacheBytes.HasValue ? _pressure.Apply(cacheBytes.Value) : null)
+            {
+                before = _pressure.ReadCounters();
+                result = await runner.RunAsync(levelPlan, cancellationToken).ConfigureAwait(false);
+                after = _pressure.ReadCounters();
+            }
+
+            levels.Add(new MemoryPressureLevelResult
+            {
+                Name = levelName,
+                CacheFraction = fraction,
+                CacheBytes = cacheBytes,
+                ReclaimedPages = before.HasValue && after.HasValue ? after.Value.ReclaimedPages - before.Value.ReclaimedPages : null,
+                RefaultedPages = before.HasValue && after.HasValue ? after.Value.RefaultedPages - before.Value.RefaultedPages : null,
+                Result = result
+            });
+        }
+
+        return new MemoryPressureResult
+        {
+            Method = _pressure.Description,
+            WorkingSetBytes = workingSet,
+            Levels = levels,
+            Workloads = FilesystemComparisonRunner.Compare(levels.Select(l => (l.Name, l.Result)).ToList()),
+            StartTime = startTime,
+            Duration = DateTimeOffset.UtcNow - startTime
+        };
+    }
+}
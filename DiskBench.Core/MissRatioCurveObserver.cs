@@ -0,0 +1,48 @@
+using DiskBench.Metrics;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Feeds every IO a trial issues into a <see cref="MissRatioCurveBuilder"/>, so the cache behaviour of
+/// a captured IO stream can be analysed. Attach it through <see cref="TrialSpec.IoObserver"/>; the
+/// same observer may be reused across trials to analyse their combined stream.
+/// </summary>
+public sealed class MissRatioCurveObserver : IIoObserver
+{
+    private readonly bool _includeWrites;
+
+    /// <summary>
+    /// Creates an observer.
+    /// </summary>
+    /// <param name="options">Curve options (null = defaults).</param>
+    /// <param name="includeWrites">Whether writes reference the cache as well as reads.</param>
+    public MissRatioCurveObserver(MissRatioCurveOptions? options = null, bool includeWrites = true)
+    {
+        Builder = new MissRatioCurveBuilder(options);
+        _includeWrites = includeWrites;
+    }
+
+    /// <summary>
+    /// Builder receiving the issued IOs.
+    /// </summary>
+    public MissRatioCurveBuilder Builder { get; }
+
+    /// <inheritdoc />
+    public void OnIssued(long offset, int size, bool isWrite)
+    {
+        if (_includeWrites || !isWrite)
+        {
+            Builder.Access(offset, size);
+        }
+    }
+
+    /// <inheritdoc />
+    public void OnCompleted(long offset, bool isWrite, ReadOnlySpan<byte> data)
+    {
+    }
+
+    /// <inheritdoc />
+    public void OnAbandoned(long offset, bool isWrite)
+    {
+    }
+}
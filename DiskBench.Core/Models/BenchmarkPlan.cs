@@ -3,7 +3,7 @@ namespace DiskBench.Core;
 /// <summary>
 /// Defines a complete benchmark plan with multiple workloads and global options.
 /// </summary>
-public sealed class BenchmarkPlan
+public sealed record BenchmarkPlan
 {
     /// <summary>
     /// List of workloads to execute.
@@ -41,6 +41,12 @@ public sealed class BenchmarkPlan
     /// </summary>
     public int BootstrapIterations { get; init; } = 10000;
 
+    /// <summary>
+    /// Latency percentiles resting on fewer samples above them than this (in any trial) are flagged
+    /// and warned about when confidence intervals are computed.
+    /// </summary>
+    public int MinTailSamples { get; init; } = 10;
+
     /// <summary>
     /// Whether to track per-second time series data.
     /// Useful for detecting cache effects and SLC exhaustion.
@@ -52,6 +58,12 @@ public sealed class BenchmarkPlan
     /// </summary>
     public bool ReuseExistingFiles { get; init; } = true;
 
+    /// <summary>
+    /// Content written into test files when they are prepared (null = engine default, typically zeros).
+    /// Compressing or deduplicating storage reads zeros artificially fast.
+    /// </summary>
+    public PreparedContent? Content { get; init; }
+
     /// <summary>
     /// Whether to automatically delete test files when benchmark completes.
     /// </summary>
@@ -62,6 +74,38 @@ public sealed class BenchmarkPlan
     /// </summary>
     public bool TrackAllocations { get; init; }
 
+    /// <summary>
+    /// Number of slowest IOs to keep per trial (0 = disabled).
+    /// </summary>
+    public int SlowIoTopK { get; init; } = 10;
+
+    /// <summary>
+    /// Record every IO at or above this latency (null = disabled).
+    /// </summary>
+    public TimeSpan? SlowIoThreshold { get; init; }
+
+    /// <summary>
+    /// Report IOs still in flight after this long as stuck (null = disabled).
+    /// Stuck IOs at specific offsets are an early sign of a failing device.
+    /// </summary>
+    public TimeSpan? StuckIoTimeout { get; init; } = TimeSpan.FromSeconds(2);
+
+    /// <summary>
+    /// Directory for per-IO traces of every trial (null = no traces), one file per workload and trial.
+    /// </summary>
+    public string? TraceDirectory { get; init; }
+
+    /// <summary>
+    /// Buffered write latency at or above which a write call counts as stalled by dirty page throttling
+    /// (used when a write-back monitor is attached).
+    /// </summary>
+    public TimeSpan WriteStallThreshold { get; init; } = TimeSpan.FromMilliseconds(100);
+
+    /// <summary>
+    /// How failed IOs are handled (null = abort the trial on the first failure).
+    /// </summary>
+    public IoErrorPolicy? ErrorPolicy { get; init; }
+
     /// <summary>
     /// Optional plan name for reporting.
     /// </summary>
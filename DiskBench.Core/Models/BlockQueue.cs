@@ -0,0 +1,148 @@
+using System.Globalization;
+using System.Text;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Linux block-layer queue settings to apply to a device. Null settings are left as they are.
+/// </summary>
+public sealed record BlockQueueConfig
+{
+    /// <summary>
+    /// IO scheduler (e.g., "none", "mq-deadline", "kyber", "bfq").
+    /// </summary>
+    public string? Scheduler { get; init; }
+
+    /// <summary>
+    /// Requests the scheduler may hold per hardware queue (queue/nr_requests).
+    /// </summary>
+    public int? NrRequests { get; init; }
+
+    /// <summary>
+    /// Completion CPU steering (queue/rq_affinity): 0 = complete anywhere, 1 = the submitting CPU's
+    /// cache group, 2 = the submitting CPU itself.
+    /// </summary>
+    public int? RqAffinity { get; init; }
+
+    /// <summary>
+    /// Gets a short display name, e.g. "kyber nr_requests=64 rq_affinity=2".
+    /// </summary>
+    public string GetDisplayName()
+    {
+        var name = new StringBuilder(Scheduler ?? "current");
+        if (NrRequests.HasValue)
+        {
+            name.Append(CultureInfo.InvariantCulture, $" nr_requests={NrRequests}");
+        }
+
+        if (RqAffinity.HasValue)
+        {
+            name.Append(CultureInfo.InvariantCulture, $" rq_affinity={RqAffinity}");
+        }
+
+        return name.ToString();
+    }
+}
+
+/// <summary>
+/// A block device's queue settings as read from sysfs.
+/// </summary>
+public sealed class BlockQueueState
+{
+    /// <summary>
+    /// Kernel device name (e.g., "nvme0n1", "sda").
+    /// </summary>
+    public required string Device { get; init; }
+
+    /// <summary>
+    /// Active IO scheduler, or null if the device does not expose one.
+    /// </summary>
+    public string? Scheduler { get; init; }
+
+    /// <summary>
+    /// Schedulers the kernel offers for the device.
+    /// </summary>
+    public IReadOnlyList<string> AvailableSchedulers { get; init; } = [];
+
+    /// <summary>
+    /// Current queue/nr_requests.
+    /// </summary>
+    public int? NrRequests { get; init; }
+
+    /// <summary>
+    /// Current queue/rq_affinity.
+    /// </summary>
+    public int? RqAffinity { get; init; }
+
+    /// <summary>
+    /// Gets the settings as a config that restores them.
+    /// </summary>
+    public BlockQueueConfig ToConfig() => new()
+    {
+        Scheduler = Scheduler,
+        NrRequests = NrRequests,
+        RqAffinity = RqAffinity
+    };
+}
+
+/// <summary>
+/// Result of running a plan under several block queue configurations.
+/// </summary>
+public sealed class BlockQueueMatrixResult
+{
+    /// <summary>
+    /// Settings of the plan's devices before the matrix ran; restored afterwards.
+    /// </summary>
+    public required IReadOnlyList<BlockQueueState> Original { get; init; }
+
+    /// <summary>
+    /// Per-configuration results: the current settings first, then each configuration in the order given.
+    /// </summary>
+    public required IReadOnlyList<BlockQueueConfigResult> Configurations { get; init; }
+
+    /// <summary>
+    /// Per-workload comparison across the configurations that ran, normalized to the fastest.
+    /// </summary>
+    public required IReadOnlyList<WorkloadComparison> Workloads { get; init; }
+
+    /// <summary>
+    /// When the matrix started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// Total matrix duration.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+}
+
+/// <summary>
+/// One configuration's run, or why it was skipped.
+/// </summary>
+public sealed class BlockQueueConfigResult
+{
+    /// <summary>
+    /// Display name (e.g., "current", "bfq nr_requests=64").
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Configuration applied, or null for the current settings.
+    /// </summary>
+    public BlockQueueConfig? Config { get; init; }
+
+    /// <summary>
+    /// Why the configuration could not be applied (e.g., scheduler not available, permission denied), or null if it ran.
+    /// </summary>
+    public string? SkipReason { get; init; }
+
+    /// <summary>
+    /// Device settings while the configuration ran, as read back from sysfs.
+    /// </summary>
+    public IReadOnlyList<BlockQueueState> Applied { get; init; } = [];
+
+    /// <summary>
+    /// Full benchmark result, or null if skipped.
+    /// </summary>
+    public BenchmarkResult? Result { get; init; }
+}
@@ -0,0 +1,93 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// A logical processor (hardware thread) and where it sits in the CPU topology.
+/// </summary>
+public sealed record LogicalProcessor
+{
+    /// <summary>
+    /// Processor id used for pinning (Linux CPU number; on Windows group * 64 + index in group).
+    /// </summary>
+    public required int Id { get; init; }
+
+    /// <summary>
+    /// Physical package (socket).
+    /// </summary>
+    public required int Package { get; init; }
+
+    /// <summary>
+    /// Physical core, identified by the lowest processor id among its SMT siblings.
+    /// </summary>
+    public required int Core { get; init; }
+
+    /// <summary>
+    /// NUMA node.
+    /// </summary>
+    public required int NumaNode { get; init; }
+
+    /// <summary>
+    /// Last-level (L3) cache domain, identified by its lowest processor id (-1 = unknown).
+    /// </summary>
+    public int L3Domain { get; init; } = -1;
+
+    /// <summary>
+    /// Whether this is the first hardware thread of its core (the others are SMT siblings).
+    /// </summary>
+    public bool IsPrimaryThread => Id == Core;
+}
+
+/// <summary>
+/// Logical processors of the machine grouped by package, core, NUMA node and L3 domain.
+/// </summary>
+public sealed class CpuTopology
+{
+    /// <summary>
+    /// All online logical processors, ordered by id.
+    /// </summary>
+    public required IReadOnlyList<LogicalProcessor> Processors { get; init; }
+
+    /// <summary>
+    /// Number of physical packages (sockets).
+    /// </summary>
+    public int PackageCount => Processors.Select(p => p.Package).Distinct().Count();
+
+    /// <summary>
+    /// Number of NUMA nodes.
+    /// </summary>
+    public int NumaNodeCount => Processors.Select(p => p.NumaNode).Distinct().Count();
+
+    /// <summary>
+    /// Number of physical cores.
+    /// </summary>
+    public int CoreCount => Processors.Select(p => p.Core).Distinct().Count();
+
+    /// <summary>
+    /// Whether any core runs more than one hardware thread.
+    /// </summary>
+    public bool HasSmt => CoreCount < Processors.Count;
+
+    /// <inheritdoc />
+    public override string ToString() =>
+        $"{PackageCount} package(s), {NumaNodeCount} NUMA node(s), {CoreCount} cores, {Processors.Count} threads";
+}
+
+/// <summary>
+/// Where the block device behind a test file attaches to the machine.
+/// </summary>
+public sealed class DeviceTopology
+{
+    /// <summary>
+    /// Block device name (e.g., nvme0n1).
+    /// </summary>
+    public required string Device { get; init; }
+
+    /// <summary>
+    /// NUMA node the device's controller is attached to (-1 = unknown).
+    /// </summary>
+    public int NumaNode { get; init; } = -1;
+
+    /// <summary>
+    /// Processors that service the device's interrupts.
+    /// </summary>
+    public IReadOnlyList<int> InterruptCpus { get; init; } = [];
+}
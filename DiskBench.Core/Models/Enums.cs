@@ -16,6 +16,43 @@ public enum AccessPattern
     Random
 }
 
+/// <summary>
+/// How IOs are spread over the files of a file set.
+/// </summary>
+public enum FileDistribution
+{
+    /// <summary>
+    /// Every file is equally likely.
+    /// </summary>
+    Uniform,
+
+    /// <summary>
+    /// File popularity follows a Zipf law: a few hot files take most of the IO.
+    /// </summary>
+    Zipf
+}
+
+/// <summary>
+/// What the data of a prepared file looks like to a compressing controller or filesystem.
+/// </summary>
+public enum ContentMode
+{
+    /// <summary>
+    /// Random bytes: nothing to compress.
+    /// </summary>
+    Incompressible,
+
+    /// <summary>
+    /// Alternating runs of random bytes and zeros, compressing about 2:1.
+    /// </summary>
+    Compressible,
+
+    /// <summary>
+    /// Words from a small English vocabulary separated by spaces, compressing like plain text.
+    /// </summary>
+    Text
+}
+
 /// <summary>
 /// Specifies when to flush file buffers to disk.
 /// </summary>
@@ -41,3 +78,147 @@ public enum FlushPolicy
     /// </summary>
     EveryIO
 }
+
+/// <summary>
+/// Kind of fault injected into a single IO.
+/// </summary>
+public enum IoFaultKind
+{
+    /// <summary>
+    /// No fault - the IO completes normally.
+    /// </summary>
+    None,
+
+    /// <summary>
+    /// The IO fails with an error.
+    /// </summary>
+    Error,
+
+    /// <summary>
+    /// The IO completion is delayed (a single slow IO).
+    /// </summary>
+    LatencySpike,
+
+    /// <summary>
+    /// The device stops completing IOs for a while; every completion in the window is delayed.
+    /// </summary>
+    Stall,
+
+    /// <summary>
+    /// The IO transfers fewer bytes than requested.
+    /// </summary>
+    ShortTransfer
+}
+
+/// <summary>
+/// Metric a service level objective constrains.
+/// </summary>
+public enum SloMetric
+{
+    /// <summary>
+    /// Latency at a percentile must stay at or below the threshold (microseconds).
+    /// </summary>
+    Latency,
+
+    /// <summary>
+    /// IOPS must stay at or above the threshold.
+    /// </summary>
+    Iops,
+
+    /// <summary>
+    /// Throughput must stay at or above the threshold (bytes per second).
+    /// </summary>
+    Throughput
+}
+
+/// <summary>
+/// Anomalies found in a region of a surface scan.
+/// </summary>
+[Flags]
+public enum SurfaceAnomaly
+{
+    /// <summary>
+    /// Nothing unusual.
+    /// </summary>
+    None = 0,
+
+    /// <summary>
+    /// Throughput well below the neighbouring regions.
+    /// </summary>
+    SlowZone = 1,
+
+    /// <summary>
+    /// p99 latency well above the neighbouring regions.
+    /// </summary>
+    HighLatency = 2,
+
+    /// <summary>
+    /// Some IOs needed retries but eventually succeeded.
+    /// </summary>
+    Retries = 4,
+
+    /// <summary>
+    /// Some IOs failed after all retries.
+    /// </summary>
+    Errors = 8,
+
+    /// <summary>
+    /// The region was not fully covered before the region timeout.
+    /// </summary>
+    Incomplete = 16
+}
+
+/// <summary>
+/// Kind of host interference generated alongside an IO workload.
+/// </summary>
+public enum StressorKind
+{
+    /// <summary>
+    /// Integer multiply/xor loop: occupies the scalar ALUs of a core.
+    /// </summary>
+    IntegerBurn,
+
+    /// <summary>
+    /// Multiply-add loop on hardware SIMD vectors (<c>Vector&lt;float&gt;</c>, 256-bit AVX on most x64):
+    /// raises power draw and can lower the clock of the whole package.
+    /// </summary>
+    VectorBurn,
+
+    /// <summary>
+    /// Sequential copies through a buffer much larger than the caches: consumes memory bandwidth.
+    /// </summary>
+    MemoryStream,
+
+    /// <summary>
+    /// Random cache line updates across a buffer larger than the last-level cache: evicts other threads' lines.
+    /// </summary>
+    CacheThrash
+}
+
+/// <summary>
+/// How a file copy moves its data.
+/// </summary>
+public enum CopyStrategy
+{
+    /// <summary>
+    /// Read and write through the page cache with a buffer of the case's block size.
+    /// </summary>
+    Buffered,
+
+    /// <summary>
+    /// Unbuffered asynchronous reads and writes, each buffer written as soon as its read completes
+    /// (double-buffered at queue depth 2). Needs engine support.
+    /// </summary>
+    Unbuffered,
+
+    /// <summary>
+    /// The platform's copy call: CopyFileEx on Windows; on Linux, .NET tries a reflink (FICLONE),
+    /// then copy_file_range, then sendfile.
+    /// </summary>
+    SystemCopy,
+
+    /// <summary>
+    /// Share the source's extents instead of copying data (ReFS block cloning). Needs engine and filesystem support.
+    /// </summary>
+    Clone
+}
@@ -0,0 +1,43 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Fault rates for <see cref="FaultInjectingEngine"/>.
+/// Rates are probabilities per completed IO attempt (0.001 = one in a thousand).
+/// </summary>
+public sealed class FaultInjectionOptions
+{
+    /// <summary>
+    /// Probability that an IO fails.
+    /// </summary>
+    public double ErrorRate { get; init; }
+
+    /// <summary>
+    /// Probability that an IO completion is delayed by <see cref="LatencySpike"/>.
+    /// </summary>
+    public double LatencySpikeRate { get; init; }
+
+    /// <summary>
+    /// Extra latency for a spiked IO.
+    /// </summary>
+    public TimeSpan LatencySpike { get; init; } = TimeSpan.FromMilliseconds(50);
+
+    /// <summary>
+    /// Probability that the device stalls for <see cref="StallDuration"/>.
+    /// </summary>
+    public double StallRate { get; init; }
+
+    /// <summary>
+    /// How long a stall holds back every completion.
+    /// </summary>
+    public TimeSpan StallDuration { get; init; } = TimeSpan.FromMilliseconds(500);
+
+    /// <summary>
+    /// Probability that an IO transfers only part of its data.
+    /// </summary>
+    public double ShortTransferRate { get; init; }
+
+    /// <summary>
+    /// Random seed for fault decisions. Combined with each trial's seed for reproducible faults.
+    /// </summary>
+    public int Seed { get; init; }
+}
@@ -0,0 +1,203 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// One way of copying the source file.
+/// </summary>
+public sealed record CopyCase
+{
+    /// <summary>
+    /// Copy strategy.
+    /// </summary>
+    public required CopyStrategy Strategy { get; init; }
+
+    /// <summary>
+    /// Buffer size per IO for buffered and unbuffered copies (ignored by system copy and clone).
+    /// </summary>
+    public int BlockSize { get; init; } = 1024 * 1024;
+
+    /// <summary>
+    /// Buffers in flight for unbuffered copies (2 = double-buffered).
+    /// </summary>
+    public int QueueDepth { get; init; } = 2;
+
+    /// <summary>
+    /// Gets a short display name, e.g. "Unbuffered 1M x2".
+    /// </summary>
+    public string GetDisplayName() => Strategy switch
+    {
+        CopyStrategy.Buffered => $"Buffered {FormatSize(BlockSize)}",
+        CopyStrategy.Unbuffered => string.Create(CultureInfo.InvariantCulture, $"Unbuffered {FormatSize(BlockSize)} x{QueueDepth}"),
+        _ => Strategy.ToString()
+    };
+
+    private static string FormatSize(int bytes) => bytes switch
+    {
+        >= 1024 * 1024 when bytes % (1024 * 1024) == 0 => string.Create(CultureInfo.InvariantCulture, $"{bytes / (1024 * 1024)}M"),
+        >= 1024 when bytes % 1024 == 0 => string.Create(CultureInfo.InvariantCulture, $"{bytes / 1024}K"),
+        _ => bytes.ToString(CultureInfo.InvariantCulture)
+    };
+}
+
+/// <summary>
+/// A copy benchmark: one prepared source copied with several strategies.
+/// </summary>
+public sealed class FileCopyPlan
+{
+    /// <summary>
+    /// Source file, prepared (created and filled) if it does not exist at the right size.
+    /// </summary>
+    public required string SourcePath { get; init; }
+
+    /// <summary>
+    /// Destination file; defaults to the source path with ".copy" appended.
+    /// </summary>
+    public string? DestinationPath { get; init; }
+
+    /// <summary>
+    /// Source file size in bytes.
+    /// </summary>
+    public required long FileSize { get; init; }
+
+    /// <summary>
+    /// Copy strategies to compare.
+    /// </summary>
+    public required IReadOnlyList<CopyCase> Cases { get; init; }
+
+    /// <summary>
+    /// Copies per case.
+    /// </summary>
+    public int Trials { get; init; } = 3;
+
+    /// <summary>
+    /// Whether each copy includes flushing the destination to the device, so strategies that
+    /// finish in the page cache are not credited for writes still pending.
+    /// </summary>
+    public bool FlushDestination { get; init; } = true;
+
+    /// <summary>
+    /// Whether to delete the source and destination when done.
+    /// </summary>
+    public bool DeleteOnComplete { get; init; } = true;
+}
+
+/// <summary>
+/// Result of a copy benchmark.
+/// </summary>
+public sealed class FileCopyResult
+{
+    /// <summary>
+    /// Source file copied.
+    /// </summary>
+    public required string SourcePath { get; init; }
+
+    /// <summary>
+    /// Source file size in bytes.
+    /// </summary>
+    public required long FileSize { get; init; }
+
+    /// <summary>
+    /// Per-case results, in plan order.
+    /// </summary>
+    public required IReadOnlyList<CopyCaseResult> Cases { get; init; }
+
+    /// <summary>
+    /// Whether the source was evicted from the page cache before every copy. When false, buffered and
+    /// system copies may have read a cached source and their numbers are not comparable with unbuffered ones.
+    /// </summary>
+    public bool SourceCacheEvicted { get; init; }
+
+    /// <summary>
+    /// When the benchmark started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// Total benchmark duration.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+}
+
+/// <summary>
+/// Result of copying with one strategy.
+/// </summary>
+public sealed class CopyCaseResult
+{
+    /// <summary>
+    /// The case that was run.
+    /// </summary>
+    public required CopyCase Case { get; init; }
+
+    /// <summary>
+    /// Case display name.
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Why the case was skipped (strategy not supported here), or null if it ran.
+    /// </summary>
+    public string? SkipReason { get; init; }
+
+    /// <summary>
+    /// Individual copies.
+    /// </summary>
+    public required IReadOnlyList<CopyTrialResult> Trials { get; init; }
+
+    /// <summary>
+    /// Mean throughput in bytes per second.
+    /// </summary>
+    public double MeanBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Mean process CPU time (user + kernel) per GB copied, in seconds.
+    /// </summary>
+    public double MeanCpuSecondsPerGB { get; init; }
+
+    /// <summary>
+    /// Mean growth of the system page cache per copy, if it could be measured.
+    /// </summary>
+    public double? MeanPageCacheGrowthBytes { get; init; }
+}
+
+/// <summary>
+/// One copy.
+/// </summary>
+public sealed class CopyTrialResult
+{
+    /// <summary>
+    /// Trial number (1-based).
+    /// </summary>
+    public required int TrialNumber { get; init; }
+
+    /// <summary>
+    /// Bytes copied.
+    /// </summary>
+    public required long Bytes { get; init; }
+
+    /// <summary>
+    /// Wall-clock time, including the destination flush when enabled.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+
+    /// <summary>
+    /// Process CPU time (user + kernel) used by the copy.
+    /// </summary>
+    public required TimeSpan CpuTime { get; init; }
+
+    /// <summary>
+    /// Change in system page cache size across the copy, if it could be measured.
+    /// Clones and unbuffered copies should leave it nearly flat; buffered copies grow it by up to twice the file.
+    /// </summary>
+    public long? PageCacheGrowthBytes { get; init; }
+
+    /// <summary>
+    /// Throughput in bytes per second.
+    /// </summary>
+    public double BytesPerSecond => Duration.TotalSeconds > 0 ? Bytes / Duration.TotalSeconds : 0;
+
+    /// <summary>
+    /// CPU seconds per GB copied.
+    /// </summary>
+    public double CpuSecondsPerGB => Bytes > 0 ? CpuTime.TotalSeconds / (Bytes / 1e9) : 0;
+}
@@ -0,0 +1,53 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Result of running a plan over file sets of increasing size.
+/// </summary>
+public sealed class FileSetScalingResult
+{
+    /// <summary>
+    /// How IO was spread over the files at every level.
+    /// </summary>
+    public required FileDistribution Distribution { get; init; }
+
+    /// <summary>
+    /// Per-level results, in the order the file counts were given.
+    /// </summary>
+    public required IReadOnlyList<FileSetLevelResult> Levels { get; init; }
+
+    /// <summary>
+    /// Per-workload comparison across file counts, normalized to the fastest level.
+    /// </summary>
+    public required IReadOnlyList<WorkloadComparison> Workloads { get; init; }
+
+    /// <summary>
+    /// When the scenario started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// Total scenario duration.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+}
+
+/// <summary>
+/// One file count's run.
+/// </summary>
+public sealed class FileSetLevelResult
+{
+    /// <summary>
+    /// Display name (e.g., "1 file", "4096 files").
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Number of files each workload spread its IO over.
+    /// </summary>
+    public required int FileCount { get; init; }
+
+    /// <summary>
+    /// Full benchmark result for the level.
+    /// </summary>
+    public required BenchmarkResult Result { get; init; }
+}
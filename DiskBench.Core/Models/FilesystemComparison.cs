@@ -0,0 +1,141 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// A directory to run a comparison plan in, typically on its own filesystem or mount options.
+/// </summary>
+public sealed class ComparisonTarget
+{
+    /// <summary>
+    /// Directory the test files are created in.
+    /// </summary>
+    public required string Directory { get; init; }
+
+    /// <summary>
+    /// Optional display name (defaults to the filesystem and directory).
+    /// </summary>
+    public string? Name { get; init; }
+}
+
+/// <summary>
+/// Result of running one plan across several targets.
+/// </summary>
+public sealed class FilesystemComparisonResult
+{
+    /// <summary>
+    /// Per-target results, in the order the targets were given.
+    /// </summary>
+    public required IReadOnlyList<ComparisonTargetResult> Targets { get; init; }
+
+    /// <summary>
+    /// Per-workload comparison, normalized to the fastest target.
+    /// </summary>
+    public required IReadOnlyList<WorkloadComparison> Workloads { get; init; }
+
+    /// <summary>
+    /// When the comparison started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// Total comparison duration.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+}
+
+/// <summary>
+/// One target's run within a comparison.
+/// </summary>
+public sealed class ComparisonTargetResult
+{
+    /// <summary>
+    /// Display name of the target.
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Directory the target's test files were created in.
+    /// </summary>
+    public required string Directory { get; init; }
+
+    /// <summary>
+    /// Filesystem type (e.g., ext4, xfs, NTFS), if it could be determined.
+    /// </summary>
+    public string? FileSystem { get; init; }
+
+    /// <summary>
+    /// Mount options (Linux), if they could be determined.
+    /// </summary>
+    public string? MountOptions { get; init; }
+
+    /// <summary>
+    /// Mounted device (e.g., /dev/loop3 for a loop-mounted image), if it could be determined.
+    /// </summary>
+    public string? Device { get; init; }
+
+    /// <summary>
+    /// Geometric mean of the target's relative IOPS across workloads (1.0 = fastest everywhere).
+    /// </summary>
+    public required double Score { get; init; }
+
+    /// <summary>
+    /// Full benchmark result for the target.
+    /// </summary>
+    public required BenchmarkResult Result { get; init; }
+}
+
+/// <summary>
+/// One workload compared across targets.
+/// </summary>
+public sealed class WorkloadComparison
+{
+    /// <summary>
+    /// Workload display name.
+    /// </summary>
+    public required string WorkloadName { get; init; }
+
+    /// <summary>
+    /// Name of the target with the highest IOPS.
+    /// </summary>
+    public required string FastestTarget { get; init; }
+
+    /// <summary>
+    /// Scores per target, in target order.
+    /// </summary>
+    public required IReadOnlyList<TargetScore> Scores { get; init; }
+}
+
+/// <summary>
+/// A target's numbers for one workload, absolute and relative to the fastest target.
+/// </summary>
+public sealed class TargetScore
+{
+    /// <summary>
+    /// Target display name.
+    /// </summary>
+    public required string TargetName { get; init; }
+
+    /// <summary>
+    /// Mean IOPS.
+    /// </summary>
+    public required double MeanIops { get; init; }
+
+    /// <summary>
+    /// Mean throughput in bytes per second.
+    /// </summary>
+    public required double MeanBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Mean 99th percentile latency in microseconds.
+    /// </summary>
+    public required double P99LatencyUs { get; init; }
+
+    /// <summary>
+    /// IOPS relative to the fastest target (1.0 = fastest).
+    /// </summary>
+    public required double RelativeIops { get; init; }
+
+    /// <summary>
+    /// p99 latency relative to the lowest p99 across targets (1.0 = best, 2.0 = twice as slow).
+    /// </summary>
+    public required double RelativeP99Latency { get; init; }
+}
@@ -0,0 +1,170 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Stressor threads to run concurrently with the IO workloads.
+/// </summary>
+public sealed record StressorSpec
+{
+    /// <summary>
+    /// Kind of load each thread generates.
+    /// </summary>
+    public required StressorKind Kind { get; init; }
+
+    /// <summary>
+    /// Number of stressor threads.
+    /// </summary>
+    public int Threads { get; init; } = 1;
+
+    /// <summary>
+    /// Fraction of each 10 ms period a thread is busy (0.0 to 1.0).
+    /// </summary>
+    public double Intensity { get; init; } = 1.0;
+
+    /// <summary>
+    /// Processors to pin threads to, assigned round-robin; null leaves placement to the OS.
+    /// </summary>
+    public IReadOnlyList<int>? Cpus { get; init; }
+
+    /// <summary>
+    /// Buffer per thread for memory stressors; null uses 64 MB for streaming and 32 MB for cache thrashing.
+    /// </summary>
+    public long? BufferBytes { get; init; }
+
+    /// <summary>
+    /// Gets a short display name, e.g. "2x VectorBurn 50%".
+    /// </summary>
+    public string GetDisplayName() =>
+        string.Create(CultureInfo.InvariantCulture, $"{Threads}x {Kind} {Intensity * 100:F0}%") +
+        (Cpus != null ? $" @CPU {string.Join(",", Cpus)}" : string.Empty);
+}
+
+/// <summary>
+/// One interference level: the stressors that run together while the plan runs.
+/// </summary>
+public sealed class StressorLevel
+{
+    /// <summary>
+    /// Optional display name (defaults to the stressors' names).
+    /// </summary>
+    public string? Name { get; init; }
+
+    /// <summary>
+    /// Stressors running during the level.
+    /// </summary>
+    public required IReadOnlyList<StressorSpec> Stressors { get; init; }
+}
+
+/// <summary>
+/// Result of running a plan under several interference levels.
+/// </summary>
+public sealed class InterferenceResult
+{
+    /// <summary>
+    /// Per-level results: the idle baseline first, then each level in the order given.
+    /// </summary>
+    public required IReadOnlyList<InterferenceLevelResult> Levels { get; init; }
+
+    /// <summary>
+    /// Per-workload comparison across levels, normalized to the fastest level.
+    /// </summary>
+    public required IReadOnlyList<WorkloadComparison> Workloads { get; init; }
+
+    /// <summary>
+    /// When the scenario started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// Total scenario duration.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+}
+
+/// <summary>
+/// One interference level's run.
+/// </summary>
+public sealed class InterferenceLevelResult
+{
+    /// <summary>
+    /// Display name ("idle" for the baseline).
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Stressors that ran (empty for the baseline).
+    /// </summary>
+    public required IReadOnlyList<StressorSpec> Stressors { get; init; }
+
+    /// <summary>
+    /// Work each stressor completed per second, in stressor order, to confirm the load was applied.
+    /// </summary>
+    public required IReadOnlyList<StressorThroughput> StressorThroughput { get; init; }
+
+    /// <summary>
+    /// Each workload's latency and IOPS relative to the idle baseline, in workload order.
+    /// </summary>
+    public required IReadOnlyList<LatencySensitivity> Sensitivity { get; init; }
+
+    /// <summary>
+    /// Full benchmark result for the level.
+    /// </summary>
+    public required BenchmarkResult Result { get; init; }
+}
+
+/// <summary>
+/// Work a stressor got through while it ran.
+/// </summary>
+public sealed class StressorThroughput
+{
+    /// <summary>
+    /// Stressor display name.
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Work per second across all of the stressor's threads.
+    /// </summary>
+    public required double PerSecond { get; init; }
+
+    /// <summary>
+    /// Unit of work ("ops" for CPU burn, "bytes" for streaming, "lines" for cache thrashing).
+    /// </summary>
+    public required string Unit { get; init; }
+    /// <summary>
+    /// Fraction of the time the stressor's threads spent working (the achieved duty cycle, to compare with the intensity).
+    /// </summary>
+    public required double BusyFraction { get; init; }
+}
+
+/// <summary>
+/// A workload's numbers under interference divided by its idle baseline (1.0 = unaffected).
+/// </summary>
+public sealed class LatencySensitivity
+{
+    /// <summary>
+    /// Workload display name.
+    /// </summary>
+    public required string WorkloadName { get; init; }
+
+    /// <summary>
+    /// Mean IOPS relative to the baseline (below 1.0 = slower).
+    /// </summary>
+    public required double IopsRatio { get; init; }
+
+    /// <summary>
+    /// Median latency relative to the baseline.
+    /// </summary>
+    public required double P50Ratio { get; init; }
+
+    /// <summary>
+    /// 99th percentile latency relative to the baseline.
+    /// </summary>
+    public required double P99Ratio { get; init; }
+
+    /// <summary>
+    /// 99.9th percentile latency relative to the baseline.
+    /// </summary>
+    public required double P999Ratio { get; init; }
+}
@@ -0,0 +1,46 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// How engines handle failed IOs.
+/// By default the first failed IO aborts the trial.
+/// </summary>
+public sealed class IoErrorPolicy
+{
+    /// <summary>
+    /// Policy that aborts the trial on the first failed IO.
+    /// </summary>
+    public static IoErrorPolicy Abort { get; } = new();
+
+    /// <summary>
+    /// Whether to count failed IOs and keep running instead of aborting the trial.
+    /// </summary>
+    public bool ContinueOnError { get; init; }
+
+    /// <summary>
+    /// Number of times a failed IO is retried at the same offset before it is counted as failed.
+    /// </summary>
+    public int MaxRetries { get; init; } = 3;
+
+    /// <summary>
+    /// Delay before the first retry. Zero retries immediately.
+    /// </summary>
+    public TimeSpan RetryDelay { get; init; }
+
+    /// <summary>
+    /// Multiplier applied to the delay for each further retry (exponential backoff).
+    /// </summary>
+    public double BackoffMultiplier { get; init; } = 2.0;
+
+    /// <summary>
+    /// Gets the delay before the given retry attempt (1-based).
+    /// </summary>
+    public TimeSpan DelayBeforeRetry(int attempt)
+    {
+        if (RetryDelay <= TimeSpan.Zero || attempt <= 1)
+        {
+            return RetryDelay;
+        }
+
+        return RetryDelay * Math.Pow(BackoffMultiplier, attempt - 1);
+    }
+}
@@ -0,0 +1,54 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Names a custom IO generator for a workload, loaded by <see cref="IoGeneratorLoader"/>.
+/// </summary>
+public sealed record IoGeneratorReference
+{
+    /// <summary>
+    /// Type implementing <see cref="IIoGeneratorFactory"/> with a public parameterless constructor:
+    /// the full type name when <see cref="AssemblyPath"/> is set, otherwise an assembly-qualified name.
+    /// </summary>
+    public required string TypeName { get; init; }
+
+    /// <summary>
+    /// Path of the assembly to load the type from (null = resolve <see cref="TypeName"/> as assembly-qualified).
+    /// </summary>
+    public string? AssemblyPath { get; init; }
+
+    /// <summary>
+    /// Settings passed to the factory, e.g. a skew or a trace file (null = none).
+    /// </summary>
+    public IReadOnlyDictionary<string, string>? Parameters { get; init; }
+
+    /// <summary>
+    /// Gets the type name without namespace or assembly, e.g. "ZipfOffsets".
+    /// </summary>
+    public string GetDisplayName()
+    {
+        int comma = TypeName.IndexOf(',', StringComparison.Ordinal);
+        var name = (comma >= 0 ? TypeName[..comma] : TypeName).Trim();
+        return name[(name.LastIndexOfAny(['.', '+']) + 1)..];
+    }
+}
+
+/// <summary>
+/// What an <see cref="IIoGeneratorFactory"/> is creating sources for.
+/// </summary>
+public sealed class IoGeneratorContext
+{
+    /// <summary>
+    /// The workload; IOs must stay within its file (or region) and block size.
+    /// </summary>
+    public required WorkloadSpec Workload { get; init; }
+
+    /// <summary>
+    /// Trial seed. Sources seeded from it reproduce the same stream for the same trial spec.
+    /// </summary>
+    public required int Seed { get; init; }
+
+    /// <summary>
+    /// Settings from the workload's <see cref="IoGeneratorReference.Parameters"/>.
+    /// </summary>
+    public IReadOnlyDictionary<string, string> Parameters { get; init; } = new Dictionary<string, string>();
+}
@@ -0,0 +1,74 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Result of running buffered workloads at several page cache budgets.
+/// </summary>
+public sealed class MemoryPressureResult
+{
+    /// <summary>
+    /// How the cache was constrained (e.g., "cgroup /sys/fs/cgroup/bench", "balloon").
+    /// </summary>
+    public required string Method { get; init; }
+
+    /// <summary>
+    /// Total size of the workloads' test files: the budget fractions are relative to this.
+    /// </summary>
+    public required long WorkingSetBytes { get; init; }
+
+    /// <summary>
+    /// Per-level results: the unconstrained baseline first, then each budget in the order given.
+    /// </summary>
+    public required IReadOnlyList<MemoryPressureLevelResult> Levels { get; init; }
+
+    /// <summary>
+    /// Per-workload comparison across levels, normalized to the fastest level.
+    /// </summary>
+    public required IReadOnlyList<WorkloadComparison> Workloads { get; init; }
+
+    /// <summary>
+    /// When the scenario started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// Total scenario duration.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+}
+
+/// <summary>
+/// One pressure level's run.
+/// </summary>
+public sealed class MemoryPressureLevelResult
+{
+    /// <summary>
+    /// Display name (e.g., "unconstrained", "cache 25%").
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Cache budget as a fraction of the working set, or null for the unconstrained baseline.
+    /// </summary>
+    public double? CacheFraction { get; init; }
+
+    /// <summary>
+    /// Cache budget in bytes, or null for the unconstrained baseline.
+    /// </summary>
+    public long? CacheBytes { get; init; }
+
+    /// <summary>
+    /// Pages reclaimed while the level ran (including file preparation), if the counters are exposed.
+    /// System-wide for the balloon, per cgroup for cgroup limits.
+    /// </summary>
+    public long? ReclaimedPages { get; init; }
+
+    /// <summary>
+    /// Evicted file pages that had to be read back while the level ran, if the counters are exposed.
+    /// </summary>
+    public long? RefaultedPages { get; init; }
+
+    /// <summary>
+    /// Full benchmark result for the level.
+    /// </summary>
+    public required BenchmarkResult Result { get; init; }
+}
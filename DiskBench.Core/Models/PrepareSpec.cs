@@ -1,3 +1,6 @@
+using System.Diagnostics;
+using DiskBench.Metrics;
+
 namespace DiskBench.Core;
 
 /// <summary>
@@ -29,12 +32,19 @@ public sealed class PrepareSpec
     /// Optional pattern to write during preparation (null = zero-fill).
     /// </summary>
     public IReadOnlyList<byte>? FillPattern { get; init; }
+
+    /// <summary>
+    /// Content to generate and write in full (null = <see cref="FillPattern"/> or whatever
+    /// SetFileValidData exposes). Takes precedence over both, and a file is reused only when its
+    /// manifest records the same content.
+    /// </summary>
+    public PreparedContent? Content { get; init; }
 }
 
 /// <summary>
 /// Specifies parameters for running a single trial.
 /// </summary>
-public sealed class TrialSpec
+public sealed record TrialSpec
 {
     /// <summary>
     /// The workload configuration.
@@ -61,11 +71,23 @@ public sealed class TrialSpec
     /// </summary>
     public int TrialNumber { get; init; }
 
+    /// <summary>
+    /// Number of IOs after which the trial stops issuing and ends once they complete
+    /// (0 = no limit). Counts every new IO from the start of the trial, including warmup;
+    /// retries do not count. <see cref="MeasuredDuration"/> still caps the trial.
+    /// </summary>
+    public long IoLimit { get; init; }
+
     /// <summary>
     /// Whether to collect per-second time series.
     /// </summary>
     public bool CollectTimeSeries { get; init; }
 
+    /// <summary>
+    /// Whether to collect latency percentiles for every second of the time series.
+    /// </summary>
+    public bool CollectIntervalLatency { get; init; }
+
     /// <summary>
     /// Whether to track allocations during measured window.
     /// </summary>
@@ -75,4 +97,60 @@ public sealed class TrialSpec
     /// Sector size for alignment (discovered during prepare).
     /// </summary>
     public int SectorSize { get; init; } = 512;
+
+    /// <summary>
+    /// Number of slowest IOs to keep (0 = disabled).
+    /// </summary>
+    public int SlowIoTopK { get; init; }
+
+    /// <summary>
+    /// Record every IO at or above this latency (null = disabled).
+    /// </summary>
+    public TimeSpan? SlowIoThreshold { get; init; }
+
+    /// <summary>
+    /// Report IOs still in flight after this long as stuck (null = disabled).
+    /// </summary>
+    public TimeSpan? StuckIoTimeout { get; init; }
+
+    /// <summary>
+    /// How failed IOs are handled (null = abort the trial on the first failure).
+    /// </summary>
+    public IoErrorPolicy? ErrorPolicy { get; init; }
+
+    /// <summary>
+    /// Optional per-IO fault injection (see <see cref="FaultInjectingEngine"/>).
+    /// </summary>
+    public IIoFaultInjector? FaultInjector { get; init; }
+
+    /// <summary>
+    /// Optional observer of every issued and retired IO (see <see cref="IIoObserver"/>).
+    /// </summary>
+    public IIoObserver? IoObserver { get; init; }
+
+    /// <summary>
+    /// Write every IO completed in the measured window to this columnar trace file (null = no trace).
+    /// </summary>
+    public string? TracePath { get; init; }
+
+    /// <summary>
+    /// Whether any slow IO capture is enabled.
+    /// </summary>
+    public bool TracksSlowIos => SlowIoTopK > 0 || SlowIoThreshold.HasValue || StuckIoTimeout.HasValue;
+
+    /// <summary>
+    /// Creates a slow IO tracker for this trial, or null if capture is disabled.
+    /// </summary>
+    public SlowIoTracker? CreateSlowIoTracker()
+    {
+        if (!TracksSlowIos)
+        {
+            return null;
+        }
+
+        return new SlowIoTracker(
+            SlowIoTopK,
+            SlowIoThreshold.HasValue ? (long)(SlowIoThreshold.Value.TotalSeconds * Stopwatch.Frequency) : 0,
+            StuckIoTimeout.HasValue ? (long)(StuckIoTimeout.Value.TotalSeconds * Stopwatch.Frequency) : 0);
+    }
 }
@@ -0,0 +1,47 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Content written into a prepared test file, so controllers and filesystems that compress or
+/// deduplicate see data shaped like a real workload's instead of zeros or a short repeating pattern.
+/// </summary>
+public sealed record PreparedContent
+{
+    /// <summary>
+    /// Compressibility of the data.
+    /// </summary>
+    public ContentMode Mode { get; init; } = ContentMode.Incompressible;
+
+    /// <summary>
+    /// Fraction of blocks with distinct content (1 = every block unique, 0.25 = each block appears four times).
+    /// </summary>
+    public double UniqueBlockRatio { get; init; } = 1.0;
+
+    /// <summary>
+    /// Deduplication granularity in bytes (a multiple of 512).
+    /// </summary>
+    public int BlockSize { get; init; } = 4096;
+
+    /// <summary>
+    /// Seed of the generated data; files with different seeds share no blocks.
+    /// </summary>
+    public int Seed { get; init; } = 1;
+
+    /// <summary>
+    /// Gets a short description (e.g., "2:1 compressible, 25% unique").
+    /// </summary>
+    public string GetDisplayName()
+    {
+        var mode = Mode switch
+        {
+            ContentMode.Compressible => "2:1 compressible",
+            ContentMode.Text => "text",
+            _ => "incompressible"
+        };
+
+        return UniqueBlockRatio < 1
+            ? string.Create(CultureInfo.InvariantCulture, $"{mode}, {UniqueBlockRatio * 100:0.#}% unique")
+            : mode;
+    }
+}
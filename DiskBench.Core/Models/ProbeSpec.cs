@@ -0,0 +1,61 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Specifies a quick screening probe.
+/// A probe estimates sequential throughput and 4K random IOPS in a couple of seconds
+/// using a small prepared region and short adaptive trials with early stopping.
+/// </summary>
+public sealed class ProbeSpec
+{
+    /// <summary>
+    /// Path to the probe file.
+    /// </summary>
+    public required string FilePath { get; init; }
+
+    /// <summary>
+    /// Size of the prepared region in bytes. Kept small so preparation is near-instant.
+    /// </summary>
+    public long FileSize { get; init; } = 128L * 1024 * 1024;
+
+    /// <summary>
+    /// Total time budget for all probe workloads (excluding file preparation).
+    /// The budget is split evenly between the workloads.
+    /// </summary>
+    public TimeSpan TimeBudget { get; init; } = TimeSpan.FromSeconds(2);
+
+    /// <summary>
+    /// Duration of each measured slice. Each slice is one short engine trial.
+    /// </summary>
+    public TimeSpan SliceDuration { get; init; } = TimeSpan.FromMilliseconds(100);
+
+    /// <summary>
+    /// Warmup before the first slice of each workload (not measured).
+    /// </summary>
+    public TimeSpan WarmupDuration { get; init; } = TimeSpan.FromMilliseconds(50);
+
+    /// <summary>
+    /// Minimum number of slices before early stopping is considered.
+    /// </summary>
+    public int MinSlices { get; init; } = 3;
+
+    /// <summary>
+    /// Target relative half-width of the 95% confidence band.
+    /// A workload stops early once its band is at least this tight.
+    /// </summary>
+    public double TargetRelativeError { get; init; } = 0.05;
+
+    /// <summary>
+    /// Random seed for reproducible IO patterns. Use 0 for random seed.
+    /// </summary>
+    public int Seed { get; init; }
+
+    /// <summary>
+    /// Whether to reuse an existing probe file if it matches the size.
+    /// </summary>
+    public bool ReuseExistingFile { get; init; } = true;
+
+    /// <summary>
+    /// Whether to delete the probe file when the probe completes.
+    /// </summary>
+    public bool DeleteOnComplete { get; init; } = true;
+}
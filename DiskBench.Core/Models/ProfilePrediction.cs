@@ -0,0 +1,112 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Mean IOPS and p99 latency of one workload, the quantities profile prediction learns and predicts.
+/// </summary>
+/// <param name="Iops">Mean IOPS.</param>
+/// <param name="P99LatencyUs">Mean p99 latency in microseconds.</param>
+public readonly record struct WorkloadScore(double Iops, double P99LatencyUs);
+
+/// <summary>
+/// How well a profile workload can be predicted from the basis, estimated by leave-one-out cross-validation.
+/// </summary>
+public sealed class PredictorTargetFit
+{
+    /// <summary>
+    /// Workload name (e.g., "Database: OLTP Reads").
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Number of training results that measured the workload and the whole basis.
+    /// </summary>
+    public required int Samples { get; init; }
+
+    /// <summary>
+    /// Typical relative error of predicted IOPS on drives left out of training (0.1 = ±10%).
+    /// </summary>
+    public required double IopsError { get; init; }
+
+    /// <summary>
+    /// Typical relative error of predicted p99 latency on drives left out of training.
+    /// </summary>
+    public required double P99LatencyError { get; init; }
+}
+
+/// <summary>
+/// Predicted result of one profile workload.
+/// </summary>
+public sealed class WorkloadPrediction
+{
+    /// <summary>
+    /// Workload name (e.g., "Database: OLTP Reads").
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Predicted mean IOPS.
+    /// </summary>
+    public required double Iops { get; init; }
+
+    /// <summary>
+    /// 95% prediction band for IOPS: the nested cross-validated error scaled by Student's t.
+    /// </summary>
+    public required (double Lower, double Upper) IopsBand { get; init; }
+
+    /// <summary>
+    /// Predicted mean p99 latency in microseconds.
+    /// </summary>
+    public required double P99LatencyUs { get; init; }
+
+    /// <summary>
+    /// 95% prediction band for p99 latency, built like <see cref="IopsBand"/>.
+    /// </summary>
+    public required (double Lower, double Upper) P99LatencyBand { get; init; }
+
+    /// <summary>
+    /// Predicted mean throughput in bytes per second (IOPS times the workload's block size).
+    /// </summary>
+    public required double BytesPerSecond { get; init; }
+}
+
+/// <summary>
+/// Predicted results of one usage profile.
+/// </summary>
+public sealed class ProfilePrediction
+{
+    /// <summary>
+    /// Profile type.
+    /// </summary>
+    public required UsageProfileType Type { get; init; }
+
+    /// <summary>
+    /// Profile display name.
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Predictions for the profile's workloads that the model could be trained for.
+    /// </summary>
+    public required IReadOnlyList<WorkloadPrediction> Workloads { get; init; }
+}
+
+/// <summary>
+/// Result of predicting every usage profile from a run of the basis.
+/// </summary>
+public sealed class ProfilePredictionResult
+{
+    /// <summary>
+    /// The measured basis scores the prediction was made from, by workload name.
+    /// </summary>
+    public required IReadOnlyDictionary<string, WorkloadScore> Basis { get; init; }
+
+    /// <summary>
+    /// Predictions per profile.
+    /// </summary>
+    public required IReadOnlyList<ProfilePrediction> Profiles { get; init; }
+
+    /// <summary>
+    /// Cross-validated fit of every predicted workload.
+    /// </summary>
+    public required IReadOnlyList<PredictorTargetFit> Fits { get; init; }
+}
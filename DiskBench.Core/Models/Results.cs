@@ -31,6 +31,35 @@ public sealed class TimeSeriesSample
     /// Throughput in IOPS.
     /// </summary>
     public double Iops => Operations;
+
+    /// <summary>
+    /// Latency of the IOs that completed during this second (if interval latency was collected).
+    /// </summary>
+    public LatencyPercentiles? Latency { get; init; }
+
+    /// <summary>
+    /// Creates samples from a collected time series, including per-second latency when it was tracked.
+    /// </summary>
+    public static IReadOnlyList<TimeSeriesSample> FromTimeSeries(ThroughputTimeSeries timeSeries, double ticksPerMicrosecond)
+    {
+        ArgumentNullException.ThrowIfNull(timeSeries);
+
+        var snapshot = timeSeries.CreateSnapshot();
+        var samples = new List<TimeSeriesSample>(snapshot.Samples.Count);
+        foreach (var sample in snapshot.Samples)
+        {
+            var histogram = timeSeries.GetLatencyHistogram(sample.SecondOffset);
+            samples.Add(new TimeSeriesSample
+            {
+                SecondOffset = sample.SecondOffset,
+                Bytes = sample.Bytes,
+                Operations = sample.Operations,
+                Latency = histogram is { Count: > 0 } ? LatencyPercentiles.FromHistogram(histogram, ticksPerMicrosecond) : null
+            });
+        }
+
+        return samples;
+    }
 }
 
 /// <summary>
@@ -78,6 +107,28 @@ public sealed class LatencyPercentiles
     /// </summary>
     public required double MeanUs { get; init; }
 
+    /// <summary>
+    /// Gets the latency at one of the recorded percentiles (0 = min, 50, 90, 95, 99, 99.9, 100 = max).
+    /// </summary>
+    /// <param name="percentile">Percentile (0-100).</param>
+    public double GetPercentile(double percentile) => percentile switch
+    {
+        0 => MinUs,
+        50 => P50Us,
+        90 => P90Us,
+        95 => P95Us,
+        99 => P99Us,
+        99.9 => P999Us,
+        100 => MaxUs,
+        _ => throw new ArgumentOutOfRangeException(nameof(percentile), percentile, "Percentile must be 0, 50, 90, 95, 99, 99.9 or 100.")
+    };
+
+    /// <summary>
+    /// Whether <see cref="GetPercentile"/> supports a percentile.
+    /// </summary>
+    /// <param name="percentile">Percentile (0-100).</param>
+    public static bool IsRecordedPercentile(double percentile) => percentile is 0 or 50 or 90 or 95 or 99 or 99.9 or 100;
+
     /// <summary>
     /// Creates latency percentiles from a histogram.
     /// </summary>
@@ -133,6 +184,12 @@ public sealed class TrialResult
     /// </summary>
     public required TimeSpan Duration { get; init; }
 
+    /// <summary>
+    /// Stopwatch timestamp when the measured window started (0 if the engine did not report it).
+    /// Slow IO and time series offsets are relative to this point.
+    /// </summary>
+    public long MeasuredStartTimestamp { get; init; }
+
     /// <summary>
     /// Throughput in bytes per second.
     /// </summary>
@@ -148,6 +205,11 @@ public sealed class TrialResult
     /// </summary>
     public required LatencyPercentiles Latency { get; init; }
 
+    /// <summary>
+    /// Latency histogram of the measured window, for percentile confidence intervals (if reported by the engine).
+    /// </summary>
+    public HistogramSnapshot? Histogram { get; init; }
+
     /// <summary>
     /// Per-second time series (if collected).
     /// </summary>
@@ -158,12 +220,203 @@ public sealed class TrialResult
     /// </summary>
     public long? AllocatedBytes { get; init; }
 
+    /// <summary>
+    /// Slowest, over-threshold and stuck IOs (if tracked).
+    /// </summary>
+    public SlowIoReport? SlowIos { get; init; }
+
+    /// <summary>
+    /// Per-IO trace of the measured window (if traced; read it with <see cref="IoTraceReader"/>).
+    /// </summary>
+    public string? TracePath { get; init; }
+
+    /// <summary>
+    /// IO errors and retries (when running with continue-on-error or fault injection).
+    /// </summary>
+    public IoErrorSummary? Errors { get; init; }
+
+    /// <summary>
+    /// Processors the IO threads were pinned to (if placement was enabled).
+    /// </summary>
+    public WorkerPlacement? Placement { get; init; }
+
     /// <summary>
     /// Any warnings generated during the trial.
     /// </summary>
     public IReadOnlyList<string>? Warnings { get; init; }
 }
 
+/// <summary>
+/// IO errors and retries during a trial's measured window.
+/// </summary>
+public sealed class IoErrorSummary
+{
+    /// <summary>
+    /// Failed IO attempts (including ones later recovered by a retry).
+    /// </summary>
+    public required long Errors { get; init; }
+
+    /// <summary>
+    /// Retries issued.
+    /// </summary>
+    public required long Retries { get; init; }
+
+    /// <summary>
+    /// IOs that failed at least once and then succeeded on retry.
+    /// </summary>
+    public required long Recovered { get; init; }
+
+    /// <summary>
+    /// IOs that still failed after all retries.
+    /// </summary>
+    public required long Failed { get; init; }
+
+    /// <summary>
+    /// IOs that transferred fewer bytes than requested.
+    /// </summary>
+    public required long ShortTransfers { get; init; }
+
+    /// <summary>
+    /// Injected faults applied (0 without fault injection).
+    /// </summary>
+    public required long InjectedFaults { get; init; }
+
+    /// <summary>
+    /// Error code of the first failure (0 if none).
+    /// </summary>
+    public required int FirstErrorCode { get; init; }
+
+    /// <summary>
+    /// Latency of recovered IOs from first submit to final completion, including retry delays (null if none).
+    /// </summary>
+    public LatencyPercentiles? RetryLatency { get; init; }
+
+    /// <summary>
+    /// Creates a summary from trial error statistics.
+    /// </summary>
+    public static IoErrorSummary FromStats(IoErrorStats stats, double ticksPerMicrosecond)
+    {
+        ArgumentNullException.ThrowIfNull(stats);
+        return new IoErrorSummary
+        {
+            Errors = stats.Errors,
+            Retries = stats.Retries,
+            Recovered = stats.Recovered,
+            Failed = stats.Failed,
+            ShortTransfers = stats.ShortTransfers,
+            InjectedFaults = stats.InjectedFaults,
+            FirstErrorCode = stats.FirstErrorCode,
+            RetryLatency = stats.Recovered > 0
+                ? LatencyPercentiles.FromHistogram(stats.RetryLatency, ticksPerMicrosecond)
+                : null
+        };
+    }
+}
+
+/// <summary>
+/// A single slow or stuck IO. Times are relative to the start of the measured window.
+/// </summary>
+public sealed class SlowIoEntry
+{
+    /// <summary>
+    /// File offset of the IO.
+    /// </summary>
+    public required long Offset { get; init; }
+
+    /// <summary>
+    /// IO size in bytes.
+    /// </summary>
+    public required int Size { get; init; }
+
+    /// <summary>
+    /// Whether the IO was a write.
+    /// </summary>
+    public required bool IsWrite { get; init; }
+
+    /// <summary>
+    /// Engine slot (queue position) that issued the IO.
+    /// </summary>
+    public required int Slot { get; init; }
+
+    /// <summary>
+    /// Submit time in microseconds (negative if submitted during warmup).
+    /// </summary>
+    public required double SubmitUs { get; init; }
+
+    /// <summary>
+    /// Completion time in microseconds, or when the IO was observed still in flight if stuck.
+    /// </summary>
+    public required double CompleteUs { get; init; }
+
+    /// <summary>
+    /// Latency in microseconds (age when observed, for stuck IOs).
+    /// </summary>
+    public double LatencyUs => CompleteUs - SubmitUs;
+}
+
+/// <summary>
+/// Slow IO capture for a trial.
+/// </summary>
+public sealed class SlowIoReport
+{
+    /// <summary>
+    /// The slowest completed IOs, slowest first.
+    /// </summary>
+    public required IReadOnlyList<SlowIoEntry> Slowest { get; init; }
+
+    /// <summary>
+    /// Completed IOs at or above the threshold, in completion order (bounded).
+    /// </summary>
+    public required IReadOnlyList<SlowIoEntry> OverThreshold { get; init; }
+
+    /// <summary>
+    /// Total completions at or above the threshold, including any beyond the logged ones.
+    /// </summary>
+    public required long OverThresholdCount { get; init; }
+
+    /// <summary>
+    /// IOs found in flight longer than the stuck timeout, in detection order (bounded).
+    /// </summary>
+    public required IReadOnlyList<SlowIoEntry> Stuck { get; init; }
+
+    /// <summary>
+    /// Total stuck IOs detected, including any beyond the logged ones.
+    /// </summary>
+    public required long StuckCount { get; init; }
+
+    /// <summary>
+    /// Creates a report from a tracker.
+    /// </summary>
+    /// <param name="tracker">The tracker populated during the trial.</param>
+    /// <param name="originTimestamp">Stopwatch timestamp of the measured window start.</param>
+    /// <param name="ticksPerMicrosecond">Stopwatch ticks per microsecond.</param>
+    public static SlowIoReport FromTracker(SlowIoTracker tracker, long originTimestamp, double ticksPerMicrosecond)
+    {
+        ArgumentNullException.ThrowIfNull(tracker);
+
+        List<SlowIoEntry> Convert(SlowIoRecord[] records) => records
+            .Select(r => new SlowIoEntry
+            {
+                Offset = r.Offset,
+                Size = r.Size,
+                IsWrite = r.IsWrite,
+                Slot = r.Slot,
+                SubmitUs = (r.SubmitTimestamp - originTimestamp) / ticksPerMicrosecond,
+                CompleteUs = (r.CompleteTimestamp - originTimestamp) / ticksPerMicrosecond
+            })
+            .ToList();
+
+        return new SlowIoReport
+        {
+            Slowest = Convert(tracker.GetTopSlowest()),
+            OverThreshold = Convert(tracker.GetOverThreshold()),
+            OverThresholdCount = tracker.OverThresholdCount,
+            Stuck = Convert(tracker.GetStuck()),
+            StuckCount = tracker.StuckCount
+        };
+    }
+}
+
 /// <summary>
 /// Aggregated result for a workload across all trials.
 /// </summary>
@@ -213,6 +466,356 @@ public sealed record WorkloadResult
     /// 95% confidence interval for IOPS (if computed).
     /// </summary>
     public (double Lower, double Upper)? IopsCI { get; init; }
+
+    /// <summary>
+    /// 95% confidence intervals for the latency percentiles of <see cref="MeanLatency"/> (if computed).
+    /// </summary>
+    public IReadOnlyList<LatencyPercentileInterval>? LatencyCI { get; init; }
+
+    /// <summary>
+    /// Energy efficiency (if an energy meter was available).
+    /// </summary>
+    public EnergyResult? Energy { get; init; }
+
+    /// <summary>
+    /// Evaluation of the workload's service level objectives (null if it declared none).
+    /// </summary>
+    public IReadOnlyList<SloResult>? Objectives { get; init; }
+
+    /// <summary>
+    /// Page cache write-back analysis per trial (if a write-back monitor was attached to a buffered write workload).
+    /// </summary>
+    public IReadOnlyList<WriteBackResult>? WriteBack { get; init; }
+
+    /// <summary>
+    /// Whether every objective passed (null if the workload declared none).
+    /// </summary>
+    public bool? ObjectivesPassed => Objectives?.All(o => o.Passed);
+}
+
+/// <summary>
+/// 95% confidence interval for one latency percentile of a workload.
+/// </summary>
+public sealed class LatencyPercentileInterval
+{
+    /// <summary>
+    /// Percentile (0-100, e.g. 99.9).
+    /// </summary>
+    public required double Percentile { get; init; }
+
+    /// <summary>
+    /// Point estimate: the mean of the trials' percentiles, as reported in <see cref="WorkloadResult.MeanLatency"/>.
+    /// </summary>
+    public required double EstimateUs { get; init; }
+
+    /// <summary>
+    /// Lower bound from the bucket bootstrap across trials.
+    /// </summary>
+    public required double LowerUs { get; init; }
+
+    /// <summary>
+    /// Upper bound from the bucket bootstrap across trials.
+    /// </summary>
+    public required double UpperUs { get; init; }
+
+    /// <summary>
+    /// Distribution-free lower bound from the order statistics of all trials' samples combined.
+    /// </summary>
+    public required double OrderStatisticLowerUs { get; init; }
+
+    /// <summary>
+    /// Distribution-free upper bound from the order statistics of all trials' samples combined.
+    /// </summary>
+    public required double OrderStatisticUpperUs { get; init; }
+
+    /// <summary>
+    /// Fewest samples above the percentile in any trial.
+    /// </summary>
+    public required long TailSamples { get; init; }
+
+    /// <summary>
+    /// Whether <see cref="TailSamples"/> is below <see cref="BenchmarkPlan.MinTailSamples"/>,
+    /// so the estimate is mostly noise.
+    /// </summary>
+    public required bool InsufficientSamples { get; init; }
+}
+
+/// <summary>
+/// Outcome of one service level objective across a workload's trials.
+/// </summary>
+public sealed class SloResult
+{
+    /// <summary>
+    /// The objective.
+    /// </summary>
+    public required ServiceLevelObjective Objective { get; init; }
+
+    /// <summary>
+    /// Whether every trial met the objective and enough intervals complied.
+    /// </summary>
+    public required bool Passed { get; init; }
+
+    /// <summary>
+    /// Worst whole-trial value (highest latency, lowest IOPS or throughput).
+    /// </summary>
+    public required double WorstTrialValue { get; init; }
+
+    /// <summary>
+    /// Number of trials whose whole-trial value missed the objective.
+    /// </summary>
+    public required int TrialsFailed { get; init; }
+
+    /// <summary>
+    /// Number of one-second intervals evaluated (0 if no interval data was collected).
+    /// </summary>
+    public required int IntervalsEvaluated { get; init; }
+
+    /// <summary>
+    /// Number of intervals that missed the objective.
+    /// </summary>
+    public required int IntervalsViolated { get; init; }
+
+    /// <summary>
+    /// Fraction of intervals that met the objective (1.0 when none were evaluated).
+    /// </summary>
+    public double IntervalCompliance => IntervalsEvaluated > 0 ? 1.0 - (double)IntervalsViolated / IntervalsEvaluated : 1.0;
+
+    /// <summary>
+    /// Share of the interval error budget used: violated intervals over allowed violations
+    /// (1.0 = exhausted). Null when the objective sets no interval compliance target.
+    /// </summary>
+    public double? ErrorBudgetConsumed { get; init; }
+
+    /// <summary>
+    /// Runs of consecutive violating intervals.
+    /// </summary>
+    public required IReadOnlyList<SloViolationWindow> Violations { get; init; }
+}
+
+/// <summary>
+/// A run of consecutive one-second intervals that missed an objective.
+/// </summary>
+public sealed class SloViolationWindow
+{
+    /// <summary>
+    /// Trial number (1-based).
+    /// </summary>
+    public required int TrialNumber { get; init; }
+
+    /// <summary>
+    /// First violating second, from the start of the measured period.
+    /// </summary>
+    public required int StartSecond { get; init; }
+
+    /// <summary>
+    /// Number of consecutive violating seconds.
+    /// </summary>
+    public required int Seconds { get; init; }
+
+    /// <summary>
+    /// Worst value within the window.
+    /// </summary>
+    public required double WorstValue { get; init; }
+}
+
+/// <summary>
+/// Energy use for a workload, sampled from hardware counters across its trials.
+/// Counters cover the whole CPU package and DRAM, so idle platform power is included.
+/// </summary>
+public sealed class EnergyResult
+{
+    /// <summary>
+    /// Counter source (e.g., "RAPL: package-0, dram").
+    /// </summary>
+    public required string Source { get; init; }
+
+    /// <summary>
+    /// Total energy used across the sampled intervals in joules (package + DRAM).
+    /// </summary>
+    public required double Joules { get; init; }
+
+    /// <summary>
+    /// Total time covered by the samples. Each trial is sampled from start to finish,
+    /// including warmup, since warmup runs the same load.
+    /// </summary>
+    public required TimeSpan SampledDuration { get; init; }
+
+    /// <summary>
+    /// Average CPU package power in watts.
+    /// </summary>
+    public required double PackageWatts { get; init; }
+
+    /// <summary>
+    /// Average DRAM power in watts (if exposed).
+    /// </summary>
+    public double? DramWatts { get; init; }
+
+    /// <summary>
+    /// Average total power in watts.
+    /// </summary>
+    public double AverageWatts => PackageWatts + (DramWatts ?? 0);
+
+    /// <summary>
+    /// Mean IOPS divided by average power.
+    /// </summary>
+    public required double IopsPerWatt { get; init; }
+
+    /// <summary>
+    /// Energy per gigabyte (10^9 bytes) transferred.
+    /// </summary>
+    public required double JoulesPerGigabyte { get; init; }
+}
+
+/// <summary>
+/// Buffered write behaviour of one trial: what the application saw against what the device absorbed,
+/// and the episodes where write calls were throttled by the kernel's dirty page limits.
+/// The dirty and writeback counters are system-wide, so other writers on the machine are included.
+/// </summary>
+public sealed class WriteBackResult
+{
+    /// <summary>
+    /// Trial number (1-based).
+    /// </summary>
+    public required int TrialNumber { get; init; }
+
+    /// <summary>
+    /// Counter source (e.g., "/proc/meminfo").
+    /// </summary>
+    public required string Source { get; init; }
+
+    /// <summary>
+    /// Rate at which write calls completed, in bytes per second.
+    /// </summary>
+    public required double ApplicationBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Rate at which written data left the page cache for the device, in bytes per second:
+    /// application writes minus the growth of dirty and writeback pages over the measured window.
+    /// </summary>
+    public required double DeviceBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Dirty plus writeback bytes when the measured window started.
+    /// </summary>
+    public required long StartPendingBytes { get; init; }
+
+    /// <summary>
+    /// Dirty plus writeback bytes when the measured window ended.
+    /// </summary>
+    public required long EndPendingBytes { get; init; }
+
+    /// <summary>
+    /// Highest dirty page total sampled during the measured window.
+    /// </summary>
+    public required long PeakDirtyBytes { get; init; }
+
+    /// <summary>
+    /// Highest writeback page total sampled during the measured window (null if not exposed).
+    /// </summary>
+    public long? PeakWritebackBytes { get; init; }
+
+    /// <summary>
+    /// Per-second application and device throughput with the page cache state.
+    /// </summary>
+    public required IReadOnlyList<WriteBackInterval> Intervals { get; init; }
+
+    /// <summary>
+    /// Write stall episodes in time order.
+    /// </summary>
+    public required IReadOnlyList<WriteStall> Stalls { get; init; }
+
+    /// <summary>
+    /// Whether some stalled writes were not logged (the over-threshold log is bounded), so episodes may be missing.
+    /// </summary>
+    public required bool StallsTruncated { get; init; }
+
+    /// <summary>
+    /// Fraction of the measured window during which at least one write was stalled.
+    /// </summary>
+    public required double StallFraction { get; init; }
+
+    /// <summary>
+    /// Longest stall episode in microseconds (0 if none).
+    /// </summary>
+    public double LongestStallUs => Stalls.Count > 0 ? Stalls.Max(s => s.DurationUs) : 0;
+}
+
+/// <summary>
+/// One second of a buffered write trial.
+/// </summary>
+public sealed class WriteBackInterval
+{
+    /// <summary>
+    /// Second offset from start of measured period.
+    /// </summary>
+    public required int SecondOffset { get; init; }
+
+    /// <summary>
+    /// Bytes the application wrote during this second (estimated from the trial's write share for mixed workloads).
+    /// </summary>
+    public required long ApplicationBytes { get; init; }
+
+    /// <summary>
+    /// Bytes the device absorbed during this second (never negative).
+    /// </summary>
+    public required long DeviceBytes { get; init; }
+
+    /// <summary>
+    /// Dirty bytes at the end of this second.
+    /// </summary>
+    public required long DirtyBytes { get; init; }
+
+    /// <summary>
+    /// Writeback bytes at the end of this second (null if not exposed).
+    /// </summary>
+    public long? WritebackBytes { get; init; }
+
+    /// <summary>
+    /// Slowest IO completed during this second in microseconds (null if interval latency was not collected).
+    /// </summary>
+    public double? MaxLatencyUs { get; init; }
+}
+
+/// <summary>
+/// A period during which one or more write calls were blocked at or above the stall threshold.
+/// Times are relative to the start of the measured window.
+/// </summary>
+public sealed class WriteStall
+{
+    /// <summary>
+    /// Submit time of the first stalled write in microseconds.
+    /// </summary>
+    public required double StartUs { get; init; }
+
+    /// <summary>
+    /// Completion time of the last stalled write in microseconds.
+    /// </summary>
+    public required double EndUs { get; init; }
+
+    /// <summary>
+    /// Episode length in microseconds.
+    /// </summary>
+    public double DurationUs => EndUs - StartUs;
+
+    /// <summary>
+    /// Number of stalled writes in the episode.
+    /// </summary>
+    public required int Writes { get; init; }
+
+    /// <summary>
+    /// Latency of the slowest write in the episode in microseconds.
+    /// </summary>
+    public required double MaxLatencyUs { get; init; }
+
+    /// <summary>
+    /// Dirty bytes sampled when the episode started.
+    /// </summary>
+    public required long DirtyBytes { get; init; }
+
+    /// <summary>
+    /// Writeback bytes sampled when the episode started (null if not exposed).
+    /// </summary>
+    public long? WritebackBytes { get; init; }
 }
 
 /// <summary>
@@ -249,6 +852,264 @@ public sealed class BenchmarkResult
     /// System information at time of benchmark.
     /// </summary>
     public SystemInfo? SystemInfo { get; init; }
+
+    /// <summary>
+    /// Whether every workload met its service level objectives (null if none declared any).
+    /// </summary>
+    public bool? ObjectivesPassed => Workloads.Any(w => w.Objectives != null)
+        ? Workloads.All(w => w.ObjectivesPassed != false)
+        : null;
+}
+
+/// <summary>
+/// Estimate for a single probe workload.
+/// </summary>
+public sealed class ProbeMeasurement
+{
+    /// <summary>
+    /// The probe workload.
+    /// </summary>
+    public required WorkloadSpec Workload { get; init; }
+
+    /// <summary>
+    /// Number of measured slices.
+    /// </summary>
+    public required int Slices { get; init; }
+
+    /// <summary>
+    /// Whether the confidence band reached the target before the budget ran out.
+    /// </summary>
+    public required bool Converged { get; init; }
+
+    /// <summary>
+    /// Mean throughput across slices in bytes per second.
+    /// </summary>
+    public required double MeanBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Mean IOPS across slices.
+    /// </summary>
+    public required double MeanIops { get; init; }
+
+    /// <summary>
+    /// 95% confidence band for throughput.
+    /// </summary>
+    public required (double Lower, double Upper) BytesPerSecondBand { get; init; }
+
+    /// <summary>
+    /// 95% confidence band for IOPS.
+    /// </summary>
+    public required (double Lower, double Upper) IopsBand { get; init; }
+
+    /// <summary>
+    /// Relative half-width of the confidence band (0.05 = ±5%).
+    /// </summary>
+    public required double RelativeError { get; init; }
+
+    /// <summary>
+    /// Aggregated latency percentiles (mean across slices).
+    /// </summary>
+    public required LatencyPercentiles MeanLatency { get; init; }
+
+    /// <summary>
+    /// Wall-clock time spent on this workload, including warmup.
+    /// </summary>
+    public required TimeSpan Elapsed { get; init; }
+}
+
+/// <summary>
+/// Result of a quick screening probe.
+/// </summary>
+public sealed class ProbeResult
+{
+    /// <summary>
+    /// The probe specification that was executed.
+    /// </summary>
+    public required ProbeSpec Spec { get; init; }
+
+    /// <summary>
+    /// Estimates for each probe workload.
+    /// </summary>
+    public required IReadOnlyList<ProbeMeasurement> Measurements { get; init; }
+
+    /// <summary>
+    /// Time spent preparing the probe file.
+    /// </summary>
+    public required TimeSpan PrepareDuration { get; init; }
+
+    /// <summary>
+    /// When the probe started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// When the probe completed.
+    /// </summary>
+    public required DateTimeOffset EndTime { get; init; }
+
+    /// <summary>
+    /// Total duration of the probe.
+    /// </summary>
+    public TimeSpan Duration => EndTime - StartTime;
+
+    /// <summary>
+    /// Whether every workload converged to the target confidence band.
+    /// </summary>
+    public bool Converged => Measurements.All(m => m.Converged);
+}
+
+/// <summary>
+/// One sequential pass (read or write) over a region of a surface scan.
+/// </summary>
+public sealed class SurfacePass
+{
+    /// <summary>
+    /// Region start offset in bytes.
+    /// </summary>
+    public required long Offset { get; init; }
+
+    /// <summary>
+    /// Region length in bytes.
+    /// </summary>
+    public required long Length { get; init; }
+
+    /// <summary>
+    /// Whether this was the write pass.
+    /// </summary>
+    public required bool IsWrite { get; init; }
+
+    /// <summary>
+    /// Bytes successfully transferred.
+    /// </summary>
+    public required long BytesTransferred { get; init; }
+
+    /// <summary>
+    /// Time the pass took.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+
+    /// <summary>
+    /// Latency percentiles of the pass.
+    /// </summary>
+    public required LatencyPercentiles Latency { get; init; }
+
+    /// <summary>
+    /// Failed and retried IOs, if any error handling was active.
+    /// </summary>
+    public IoErrorSummary? Errors { get; init; }
+
+    /// <summary>
+    /// Whether every block of the region was transferred or given up on before the region timeout.
+    /// </summary>
+    public required bool Complete { get; init; }
+
+    /// <summary>
+    /// Throughput in bytes per second.
+    /// </summary>
+    public double BytesPerSecond => Duration > TimeSpan.Zero ? BytesTransferred / Duration.TotalSeconds : 0;
+}
+
+/// <summary>
+/// One region of a surface scan map.
+/// </summary>
+public sealed class SurfaceRegion
+{
+    /// <summary>
+    /// Region number (0-based, in offset order).
+    /// </summary>
+    public required int Index { get; init; }
+
+    /// <summary>
+    /// The read pass.
+    /// </summary>
+    public required SurfacePass Read { get; init; }
+
+    /// <summary>
+    /// The write pass, if the scan wrote.
+    /// </summary>
+    public SurfacePass? Write { get; init; }
+
+    /// <summary>
+    /// Anomalies found in either pass.
+    /// </summary>
+    public required SurfaceAnomaly Anomalies { get; init; }
+
+    /// <summary>
+    /// Region start offset in bytes.
+    /// </summary>
+    public long Offset => Read.Offset;
+
+    /// <summary>
+    /// Region length in bytes.
+    /// </summary>
+    public long Length => Read.Length;
+}
+
+/// <summary>
+/// Result of a full-surface scan.
+/// </summary>
+public sealed class SurfaceScanResult
+{
+    /// <summary>
+    /// The scan specification that was executed.
+    /// </summary>
+    public required SurfaceScanSpec Spec { get; init; }
+
+    /// <summary>
+    /// Size of the scanned file in bytes.
+    /// </summary>
+    public required long FileSize { get; init; }
+
+    /// <summary>
+    /// Regions in offset order.
+    /// </summary>
+    public required IReadOnlyList<SurfaceRegion> Regions { get; init; }
+
+    /// <summary>
+    /// Median read throughput across regions in bytes per second.
+    /// </summary>
+    public required double MedianReadBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Median write throughput across regions in bytes per second, if the scan wrote.
+    /// </summary>
+    public double? MedianWriteBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Fitted drop in read throughput from the first to the last region (0.3 = 30%).
+    /// HDDs typically lose 30-50% from the outer to the inner tracks.
+    /// </summary>
+    public required double ZoneDropOff { get; init; }
+
+    /// <summary>
+    /// Time spent preparing the file.
+    /// </summary>
+    public required TimeSpan PrepareDuration { get; init; }
+
+    /// <summary>
+    /// When the scan started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// When the scan completed.
+    /// </summary>
+    public required DateTimeOffset EndTime { get; init; }
+
+    /// <summary>
+    /// Total duration of the scan.
+    /// </summary>
+    public TimeSpan Duration => EndTime - StartTime;
+
+    /// <summary>
+    /// Regions with at least one anomaly.
+    /// </summary>
+    public IReadOnlyList<SurfaceRegion> AnomalousRegions => Regions.Where(r => r.Anomalies != SurfaceAnomaly.None).ToList();
+
+    /// <summary>
+    /// Whether read throughput falls off across the surface by at least the spec's threshold.
+    /// </summary>
+    public bool HasZoneDropOff => ZoneDropOff >= Spec.ZoneDropOffThreshold;
 }
 
 /// <summary>
@@ -280,4 +1141,9 @@ public sealed class SystemInfo
     /// .NET runtime version.
     /// </summary>
     public required string RuntimeVersion { get; init; }
+
+    /// <summary>
+    /// Block-layer queue settings of the devices holding the test files at the end of the run (Linux only, else null).
+    /// </summary>
+    public IReadOnlyList<BlockQueueState>? BlockQueues { get; init; }
 }
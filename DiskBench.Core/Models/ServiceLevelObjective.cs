@@ -0,0 +1,168 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// A latency or throughput objective for a workload, checked over every whole trial and over each
+/// one-second interval of the trial's time series.
+/// </summary>
+public sealed record ServiceLevelObjective
+{
+    /// <summary>
+    /// Metric the objective constrains.
+    /// </summary>
+    public required SloMetric Metric { get; init; }
+
+    /// <summary>
+    /// Latency ceiling in microseconds, or IOPS / bytes-per-second floor.
+    /// </summary>
+    public required double Threshold { get; init; }
+
+    /// <summary>
+    /// Latency percentile (0 = min, 50, 90, 95, 99, 99.9, 100 = max). Ignored for throughput metrics.
+    /// </summary>
+    public double Percentile { get; init; } = 99;
+
+    /// <summary>
+    /// Fraction of one-second intervals that must meet the threshold (e.g., 0.99), or null to gate on
+    /// whole trials only. Interval violations are reported either way.
+    /// </summary>
+    public double? IntervalCompliance { get; init; }
+
+    /// <summary>
+    /// Whether a measured value meets the objective.
+    /// </summary>
+    /// <param name="value">Latency in microseconds, IOPS or bytes per second.</param>
+    public bool IsMet(double value) => Metric == SloMetric.Latency ? value <= Threshold : value >= Threshold;
+
+    /// <summary>
+    /// Parses an objective such as "p99&lt;500us", "p99.9&lt;2ms@99%", "iops&gt;100k@99%" or "mbps&gt;500".
+    /// Latency defaults to microseconds; "mbps" is MB/s (1024 * 1024 bytes).
+    /// </summary>
+    /// <param name="text">Objective text.</param>
+    public static ServiceLevelObjective Parse(string text)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(text);
+
+        var spec = text.Replace(" ", string.Empty, StringComparison.Ordinal);
+        double? compliance = null;
+
+        int at = spec.IndexOf('@', StringComparison.Ordinal);
+        if (at >= 0)
+        {
+            var fraction = spec[(at + 1)..].TrimEnd('%');
+            if (!double.TryParse(fraction, NumberStyles.Float, CultureInfo.InvariantCulture, out double percent) ||
+                percent <= 0 || percent > 100)
+            {
+                throw new FormatException($"Invalid interval compliance in objective: {text}");
+            }
+
+            compliance = percent / 100;
+            spec = spec[..at];
+        }
+
+        int op = spec.IndexOfAny(['<', '>']);
+        if (op <= 0)
+        {
+            throw new FormatException($"Objective must look like p99<500us or iops>100k: {text}");
+        }
+
+        var name = spec[..op];
+        var value = spec[(op + 1)..].TrimStart('=');
+        bool isCeiling = spec[op] == '<';
+
+        ServiceLevelObjective objective;
+        bool isMax = name.Equals("max", StringComparison.OrdinalIgnoreCase);
+        if (isMax || name[0] is 'p' or 'P')
+        {
+            double percentile = isMax ? 100 : ParseNumber(name[1..], text);
+            if (!LatencyPercentiles.IsRecordedPercentile(percentile))
+            {
+                throw new FormatException($"Latency percentile must be p50, p90, p95, p99, p99.9 or max: {text}");
+            }
+
+            objective = new ServiceLevelObjective { Metric = SloMetric.Latency, Percentile = percentile, Threshold = ParseLatency(value, text) };
+        }
+        else if (name.Equals("iops", StringComparison.OrdinalIgnoreCase))
+        {
+            objective = new ServiceLevelObjective { Metric = SloMetric.Iops, Threshold = ParseCount(value, text) };
+        }
+        else if (name.Equals("mbps", StringComparison.OrdinalIgnoreCase))
+        {
+            objective = new ServiceLevelObjective { Metric = SloMetric.Throughput, Threshold = ParseNumber(value, text) * 1024 * 1024 };
+        }
+        else
+        {
+            throw new FormatException($"Unknown objective metric '{name}' (use pNN, max, iops or mbps): {text}");
+        }
+
+        if (isCeiling != (objective.Metric == SloMetric.Latency))
+        {
+            throw new FormatException($"Latency objectives use '<' and throughput objectives use '>': {text}");
+        }
+
+        return objective with { IntervalCompliance = compliance };
+    }
+
+    /// <inheritdoc />
+    public override string ToString()
+    {
+        var target = Metric switch
+        {
+            SloMetric.Latency => string.Create(CultureInfo.InvariantCulture, $"{PercentileName} <= {Threshold:0.#}µs"),
+            SloMetric.Iops => string.Create(CultureInfo.InvariantCulture, $"IOPS >= {Threshold:0}"),
+            _ => string.Create(CultureInfo.InvariantCulture, $"throughput >= {Threshold / (1024 * 1024):0.#} MB/s")
+        };
+
+        return IntervalCompliance.HasValue
+            ? string.Create(CultureInfo.InvariantCulture, $"{target} in {IntervalCompliance.Value * 100:0.##}% of 1s intervals")
+            : target;
+    }
+
+    private string PercentileName => Percentile switch
+    {
+        0 => "min",
+        100 => "max",
+        _ => string.Create(CultureInfo.InvariantCulture, $"p{Percentile:0.#}")
+    };
+
+    private static double ParseLatency(string value, string text)
+    {
+        if (value.EndsWith("ms", StringComparison.OrdinalIgnoreCase))
+        {
+            return ParseNumber(value[..^2], text) * 1000;
+        }
+
+        if (value.EndsWith("us", StringComparison.OrdinalIgnoreCase) || value.EndsWith("µs", StringComparison.Ordinal))
+        {
+            return ParseNumber(value[..^2], text);
+        }
+
+        return ParseNumber(value, text);
+    }
+
+    private static double ParseCount(string value, string text)
+    {
+        if (value.Length == 0)
+        {
+            throw new FormatException($"Missing threshold in objective: {text}");
+        }
+
+        return value[^1] switch
+        {
+            'k' or 'K' => ParseNumber(value[..^1], text) * 1_000,
+            'm' or 'M' => ParseNumber(value[..^1], text) * 1_000_000,
+            _ => ParseNumber(value, text)
+        };
+    }
+
+    private static double ParseNumber(string value, string text)
+    {
+        if (!double.TryParse(value, NumberStyles.Float, CultureInfo.InvariantCulture, out double number) || number < 0)
+        {
+            throw new FormatException($"Invalid number '{value}' in objective: {text}");
+        }
+
+        return number;
+    }
+}
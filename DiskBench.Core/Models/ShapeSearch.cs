@@ -0,0 +1,197 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Search space and budget of an IO shape search.
+/// </summary>
+public sealed record ShapeSearchSpec
+{
+    /// <summary>
+    /// Template workload: file, size, pattern, write mix and buffering. Block size, queue depth and
+    /// thread count are searched.
+    /// </summary>
+    public required WorkloadSpec Workload { get; init; }
+
+    /// <summary>
+    /// Block sizes to search, in bytes.
+    /// </summary>
+    public IReadOnlyList<int> BlockSizes { get; init; } = [4096, 16384, 65536, 262144, 1048576];
+
+    /// <summary>
+    /// Queue depths per thread to search.
+    /// </summary>
+    public IReadOnlyList<int> QueueDepths { get; init; } = [1, 2, 4, 8, 16, 32, 64, 128];
+
+    /// <summary>
+    /// Thread counts to search.
+    /// </summary>
+    public IReadOnlyList<int> ThreadCounts { get; init; } = [1, 2, 4];
+
+    /// <summary>
+    /// Measured duration of every shape in the first round; each later round multiplies it by <see cref="Reduction"/>.
+    /// </summary>
+    public TimeSpan InitialDuration { get; init; } = TimeSpan.FromMilliseconds(500);
+
+    /// <summary>
+    /// Warmup before every measurement.
+    /// </summary>
+    public TimeSpan WarmupDuration { get; init; } = TimeSpan.FromMilliseconds(250);
+
+    /// <summary>
+    /// Successive-halving rate: each round keeps one in this many shapes and measures them this many times longer.
+    /// </summary>
+    public int Reduction { get; init; } = 3;
+
+    /// <summary>
+    /// Maximum number of rounds.
+    /// </summary>
+    public int MaxRounds { get; init; } = 4;
+
+    /// <summary>
+    /// Fraction of peak throughput the cheapest shape must reach (e.g., 0.95).
+    /// </summary>
+    public double TargetFraction { get; init; } = 0.95;
+
+    /// <summary>
+    /// Whether to delete the test file when the search completes.
+    /// </summary>
+    public bool DeleteOnComplete { get; init; } = true;
+}
+
+/// <summary>
+/// The latest measurement of one IO shape.
+/// </summary>
+public sealed class ShapePoint
+{
+    /// <summary>
+    /// The workload at this shape.
+    /// </summary>
+    public required WorkloadSpec Workload { get; init; }
+
+    /// <summary>
+    /// Display name (e.g., "SeqRead_64K_Q8T2").
+    /// </summary>
+    public required string Name { get; init; }
+
+    /// <summary>
+    /// Bytes in flight when every queue is full (block size × queue depth × threads), the shape's cost.
+    /// </summary>
+    public long OutstandingBytes => (long)Workload.BlockSize * Workload.QueueDepth * Workload.Threads;
+
+    /// <summary>
+    /// Measured throughput in bytes per second.
+    /// </summary>
+    public required double BytesPerSecond { get; init; }
+
+    /// <summary>
+    /// Measured IOPS.
+    /// </summary>
+    public required double Iops { get; init; }
+
+    /// <summary>
+    /// Measured p99 latency in microseconds.
+    /// </summary>
+    public required double P99LatencyUs { get; init; }
+
+    /// <summary>
+    /// Process CPU time per IO in microseconds.
+    /// </summary>
+    public required double CpuUsPerIo { get; init; }
+
+    /// <summary>
+    /// Number of rounds the shape was measured in (1 = discarded after the first round).
+    /// </summary>
+    public required int Rounds { get; init; }
+
+    /// <summary>
+    /// Measured duration of the latest measurement.
+    /// </summary>
+    public required TimeSpan MeasuredDuration { get; init; }
+}
+
+/// <summary>
+/// One round of a shape search.
+/// </summary>
+public sealed class ShapeSearchRound
+{
+    /// <summary>
+    /// Round number (1-based).
+    /// </summary>
+    public required int Round { get; init; }
+
+    /// <summary>
+    /// Measured duration of every shape in the round.
+    /// </summary>
+    public required TimeSpan MeasuredDuration { get; init; }
+
+    /// <summary>
+    /// Number of shapes measured.
+    /// </summary>
+    public required int Evaluated { get; init; }
+
+    /// <summary>
+    /// Number of shapes kept for the next round (equal to <see cref="Evaluated"/> in the last round).
+    /// </summary>
+    public required int Kept { get; init; }
+}
+
+/// <summary>
+/// Result of an IO shape search.
+/// </summary>
+public sealed class ShapeSearchResult
+{
+    /// <summary>
+    /// The search specification.
+    /// </summary>
+    public required ShapeSearchSpec Spec { get; init; }
+
+    /// <summary>
+    /// Latest measurement of every shape, in grid order (block size, then queue depth, then threads).
+    /// </summary>
+    public required IReadOnlyList<ShapePoint> Points { get; init; }
+
+    /// <summary>
+    /// Shapes measured in the last round, at its duration, in grid order. Peak, frontier and cheapest
+    /// shape come from these only; shapes dropped earlier were measured on shorter, noisier trials.
+    /// </summary>
+    public required IReadOnlyList<ShapePoint> Finalists { get; init; }
+
+    /// <summary>
+    /// Finalists no other finalist beats on throughput, p99 latency and CPU per IO at once, fastest first.
+    /// </summary>
+    public required IReadOnlyList<ShapePoint> Frontier { get; init; }
+
+    /// <summary>
+    /// Highest finalist throughput, in bytes per second.
+    /// </summary>
+    public required double PeakBytesPerSecond { get; init; }
+
+    /// <summary>
+    /// The finalist with the fewest outstanding bytes reaching <see cref="ShapeSearchSpec.TargetFraction"/> of peak.
+    /// </summary>
+    public required ShapePoint Cheapest { get; init; }
+
+    /// <summary>
+    /// Rounds of the search.
+    /// </summary>
+    public required IReadOnlyList<ShapeSearchRound> Rounds { get; init; }
+
+    /// <summary>
+    /// Total measured time over every round.
+    /// </summary>
+    public required TimeSpan MeasuredTime { get; init; }
+
+    /// <summary>
+    /// Measured time an exhaustive grid at the last round's duration would have taken.
+    /// </summary>
+    public required TimeSpan ExhaustiveTime { get; init; }
+
+    /// <summary>
+    /// When the search started.
+    /// </summary>
+    public required DateTimeOffset StartTime { get; init; }
+
+    /// <summary>
+    /// Total search duration.
+    /// </summary>
+    public required TimeSpan Duration { get; init; }
+}
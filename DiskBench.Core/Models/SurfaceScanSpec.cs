@@ -0,0 +1,83 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Specifies a full-surface scan.
+/// A scan reads (and optionally first writes) the whole target once in large sequential blocks
+/// at high queue depth, measuring throughput, latency and errors per fixed-size region.
+/// </summary>
+public sealed class SurfaceScanSpec
+{
+    /// <summary>
+    /// Path to the file to scan.
+    /// </summary>
+    public required string FilePath { get; init; }
+
+    /// <summary>
+    /// Size of the file to scan in bytes (0 = the size of the existing file).
+    /// A file that does not exist yet is created at this size.
+    /// </summary>
+    public long FileSize { get; init; }
+
+    /// <summary>
+    /// Size of each mapped region in bytes. Must be a multiple of <see cref="BlockSize"/>.
+    /// </summary>
+    public long RegionSize { get; init; } = 1024L * 1024 * 1024;
+
+    /// <summary>
+    /// IO size in bytes.
+    /// </summary>
+    public int BlockSize { get; init; } = 1024 * 1024;
+
+    /// <summary>
+    /// Number of outstanding IOs.
+    /// </summary>
+    public int QueueDepth { get; init; } = 32;
+
+    /// <summary>
+    /// Whether to write every region before reading it back. Destroys the file's contents.
+    /// </summary>
+    public bool Write { get; init; }
+
+    /// <summary>
+    /// Longest time to spend on one pass over a region; a slower region is marked incomplete.
+    /// </summary>
+    public TimeSpan RegionTimeout { get; init; } = TimeSpan.FromMinutes(5);
+
+    /// <summary>
+    /// How failed IOs are handled. By default failed blocks are retried, counted and skipped,
+    /// so bad areas show up on the map instead of aborting the scan.
+    /// </summary>
+    public IoErrorPolicy ErrorPolicy { get; init; } = new() { ContinueOnError = true };
+
+    /// <summary>
+    /// A region is a slow zone when its throughput is below this fraction of its neighbours' median.
+    /// </summary>
+    public double SlowRegionFactor { get; init; } = 0.7;
+
+    /// <summary>
+    /// A region has high latency when its p99 is above this multiple of its neighbours' median p99.
+    /// </summary>
+    public double HighLatencyFactor { get; init; } = 4.0;
+
+    /// <summary>
+    /// Number of regions on each side a region is compared with. Comparing with neighbours rather
+    /// than the whole surface keeps the gradual outer-to-inner slowdown of HDDs from being flagged.
+    /// </summary>
+    public int NeighbourRegions { get; init; } = 4;
+
+    /// <summary>
+    /// Fitted drop in read throughput from the first to the last region (0.3 = 30%) at or above
+    /// which the scan reports a zone drop-off.
+    /// </summary>
+    public double ZoneDropOffThreshold { get; init; } = 0.2;
+
+    /// <summary>
+    /// Whether to reuse an existing file if it matches the size.
+    /// </summary>
+    public bool ReuseExistingFile { get; init; } = true;
+
+    /// <summary>
+    /// Whether to delete the file when the scan completes.
+    /// </summary>
+    public bool DeleteOnComplete { get; init; }
+}
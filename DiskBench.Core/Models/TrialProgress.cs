@@ -51,4 +51,14 @@ public sealed class TrialProgress
     /// Total operations completed so far.
     /// </summary>
     public required long TotalOperations { get; init; }
+
+    /// <summary>
+    /// IOs in flight when the snapshot was taken.
+    /// </summary>
+    public int InFlightIos { get; init; }
+
+    /// <summary>
+    /// 99th percentile latency in microseconds of the IOs completed since the previous snapshot (0 if none).
+    /// </summary>
+    public double IntervalP99Us { get; init; }
 }
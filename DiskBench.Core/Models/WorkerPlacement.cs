@@ -0,0 +1,36 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Processors chosen for IO worker threads, and why.
+/// </summary>
+public sealed class WorkerPlacement
+{
+    /// <summary>
+    /// Processor id for each worker, in worker order.
+    /// </summary>
+    public required IReadOnlyList<int> Cpus { get; init; }
+
+    /// <summary>
+    /// NUMA node the placement targeted (the device's node when known; -1 = none).
+    /// </summary>
+    public int NumaNode { get; init; } = -1;
+
+    /// <summary>
+    /// Block device the placement was planned for, if known.
+    /// </summary>
+    public string? Device { get; init; }
+
+    /// <summary>
+    /// Processors that service the device's interrupts.
+    /// </summary>
+    public IReadOnlyList<int> InterruptCpus { get; init; } = [];
+
+    /// <summary>
+    /// Placement decisions and compromises (e.g., workers that had to share a core).
+    /// </summary>
+    public IReadOnlyList<string> Notes { get; init; } = [];
+
+    /// <inheritdoc />
+    public override string ToString() =>
+        $"CPU {string.Join(",", Cpus)}" + (NumaNode >= 0 ? $" (node {NumaNode})" : string.Empty);
+}
@@ -1,3 +1,5 @@
+using System.Globalization;
+
 namespace DiskBench.Core;
 
 /// <summary>
@@ -18,10 +20,47 @@ public readonly record struct FileRegion(long Offset, long Length)
     public static FileRegion FromOffset(long offset) => new(offset, 0);
 }
 
+/// <summary>
+/// A set of equally sized files a workload spreads its IO over, each open with its own handle.
+/// Files are named after the workload's file path with a numeric suffix.
+/// </summary>
+public sealed record FileSetSpec
+{
+    /// <summary>
+    /// Number of files.
+    /// </summary>
+    public required int FileCount { get; init; }
+
+    /// <summary>
+    /// How IOs are spread over the files.
+    /// </summary>
+    public FileDistribution Distribution { get; init; } = FileDistribution.Uniform;
+
+    /// <summary>
+    /// Zipf exponent for <see cref="FileDistribution.Zipf"/>: the k-th most popular file gets IO in proportion to 1/k^s.
+    /// </summary>
+    public double ZipfExponent { get; init; } = 0.99;
+
+    /// <summary>
+    /// Gets the path of a file in the set.
+    /// </summary>
+    /// <param name="basePath">The workload's file path.</param>
+    /// <param name="index">File index (0-based).</param>
+    public static string GetFilePath(string basePath, int index) =>
+        $"{basePath}.{index:D5}";
+
+    /// <summary>
+    /// Gets a short description, e.g. "1000 files zipf".
+    /// </summary>
+    public string GetDisplayName() =>
+        string.Create(CultureInfo.InvariantCulture, $"{FileCount} file{(FileCount == 1 ? "" : "s")}") +
+        (Distribution == FileDistribution.Zipf ? " zipf" : string.Empty);
+}
+
 /// <summary>
 /// Specifies a workload configuration for benchmarking.
 /// </summary>
-public sealed class WorkloadSpec
+public sealed record WorkloadSpec
 {
     /// <summary>
     /// Path to the target file for IO operations.
@@ -63,6 +102,12 @@ public sealed class WorkloadSpec
     /// </summary>
     public int Threads { get; init; } = 1;
 
+    /// <summary>
+    /// Custom IO generator supplying some or all of the IO stream (null = built-in pattern).
+    /// Fields its factory does not supply come from <see cref="Pattern"/>, <see cref="WritePercent"/> and <see cref="BlockSize"/>.
+    /// </summary>
+    public IoGeneratorReference? Generator { get; init; }
+
     /// <summary>
     /// Region of the file to operate on. Use FileRegion.EntireFile for the whole file.
     /// </summary>
@@ -91,11 +136,22 @@ public sealed class WorkloadSpec
     /// </summary>
     public bool WriteThrough { get; init; }
 
+    /// <summary>
+    /// Spread IO over a set of files instead of the single file at <see cref="FilePath"/> (null = one file).
+    /// <see cref="FileSize"/> is then the size of each file.
+    /// </summary>
+    public FileSetSpec? FileSet { get; init; }
+
     /// <summary>
     /// Optional name for this workload (for reporting).
     /// </summary>
     public string? Name { get; init; }
 
+    /// <summary>
+    /// Service level objectives to evaluate this workload's trials against (null = none).
+    /// </summary>
+    public IReadOnlyList<ServiceLevelObjective>? Objectives { get; init; }
+
     /// <summary>
     /// Creates a descriptive name for the workload based on its configuration.
     /// </summary>
@@ -106,7 +162,7 @@ public sealed class WorkloadSpec
             return Name;
         }
 
-        var patternStr = Pattern == AccessPattern.Sequential ? "Seq" : "Rand";
+        var patternStr = Generator != null ? Generator.GetDisplayName() : Pattern == AccessPattern.Sequential ? "Seq" : "Rand";
         var opStr = WritePercent switch
         {
             0 => "Read",
@@ -114,7 +170,27 @@ public sealed class WorkloadSpec
             _ => $"Mix{WritePercent}"
         };
         var sizeStr = FormatBlockSize(BlockSize);
-        return $"{patternStr}{opStr}_{sizeStr}_Q{QueueDepth}T{Threads}";
+        var name = $"{patternStr}{opStr}_{sizeStr}_Q{QueueDepth}T{Threads}";
+        return FileSet != null ? $"{name} ({FileSet.GetDisplayName()})" : name;
+    }
+
+    /// <summary>
+    /// Gets the paths of the files the workload uses: <see cref="FilePath"/>, or every file of the file set.
+    /// </summary>
+    public IReadOnlyList<string> GetFilePaths()
+    {
+        if (FileSet == null)
+        {
+            return [FilePath];
+        }
+
+        var paths = new string[FileSet.FileCount];
+        for (int i = 0; i < paths.Length; i++)
+        {
+            paths[i] = FileSetSpec.GetFilePath(FilePath, i);
+        }
+
+        return paths;
     }
 
     private static string FormatBlockSize(int blockSize)
@@ -0,0 +1,118 @@
+using System.Text;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// A mounted filesystem.
+/// </summary>
+/// <param name="Device">Mounted device or source (e.g., /dev/nvme0n1p2, /dev/loop3).</param>
+/// <param name="MountPoint">Directory the filesystem is mounted on.</param>
+/// <param name="FileSystem">Filesystem type (e.g., ext4, xfs, btrfs).</param>
+/// <param name="Options">Mount options as listed in the mount table.</param>
+public sealed record MountEntry(string Device, string MountPoint, string FileSystem, string Options);
+
+/// <summary>
+/// Reads the Linux mount table to find which filesystem and mount options back a path.
+/// </summary>
+public static class MountTable
+{
+    /// <summary>
+    /// Default mount table for the current process.
+    /// </summary>
+    public const string DefaultMountsPath = "/proc/self/mounts";
+
+    /// <summary>
+    /// Finds the mount containing <paramref name="path"/> (the longest matching mount point).
+    /// Returns null on platforms other than Linux or when the mount table cannot be read.
+    /// </summary>
+    /// <param name="path">File or directory path.</param>
+    /// <param name="mountsPath">Mount table to read (for tests).</param>
+    public static MountEntry? Find(string path, string mountsPath = DefaultMountsPath)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(path);
+
+        if (mountsPath == DefaultMountsPath && !OperatingSystem.IsLinux())
+        {
+            return null;
+        }
+
+        string[] lines;
+        try
+        {
+            lines = File.ReadAllLines(mountsPath);
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return null;
+        }
+
+        var fullPath = Path.GetFullPath(path);
+        MountEntry? best = null;
+
+        foreach (var line in lines)
+        {
+            var fields = line.Split(' ', StringSplitOptions.RemoveEmptyEntries);
+            if (fields.Length < 4)
+            {
+                continue;
+            }
+
+            var mountPoint = Unescape(fields[1]);
+            if (!IsUnder(fullPath, mountPoint))
+            {
+                continue;
+            }
+
+            // Later entries shadow earlier ones mounted on the same directory
+            if (best == null || mountPoint.Length >= best.MountPoint.Length)
+            {
+                best = new MountEntry(Unescape(fields[0]), mountPoint, fields[2], fields[3]);
+            }
+        }
+
+        return best;
+    }
+
+    private static bool IsUnder(string path, string mountPoint)
+    {
+        if (mountPoint == "/")
+        {
+            return path.StartsWith('/');
+        }
+
+        return path.StartsWith(mountPoint, StringComparison.Ordinal) &&
+            (path.Length == mountPoint.Length || path[mountPoint.Length] == '/');
+    }
+
+    private static string Unescape(string field)
+    {
+        // The kernel escapes space, tab, newline and backslash as \ooo octal
+        if (!field.Contains('\\', StringComparison.Ordinal))
+        {
+            return field;
+        }
+
+        var sb = new StringBuilder(field.Length);
+        for (int i = 0; i < field.Length; i++)
+        {
+            if (field[i] == '\\' && i + 3 < field.Length &&
+                IsOctal(field[i + 1]) && IsOctal(field[i + 2]) && IsOctal(field[i + 3]))
+            {
+                sb.Append((char)(((field[i + 1] - '0') << 6) | ((field[i + 2] - '0') << 3) | (field[i + 3] - '0')));
+                i += 3;
+            }
+            else
+            {
+                sb.Append(field[i]);
+            }
+        }
+
+        return sb.ToString();
+    }
+
+    private static bool IsOctal(char c) => c is >= '0' and <= '7';
+}
@@ -0,0 +1,118 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Parses Linux memory statistics: "name value" counter files (/proc/vmstat, cgroup memory.stat)
+/// and "Name:   value kB" lines of /proc/meminfo.
+/// </summary>
+public static class PageCacheStats
+{
+    /// <summary>
+    /// Extracts the eviction counters from /proc/vmstat or a cgroup v2 memory.stat.
+    /// Reclaimed pages are "pgsteal" (memory.stat) or the sum of the "pgsteal_*" lines (vmstat);
+    /// refaults are "workingset_refault_file", or "workingset_refault" on kernels before 5.9.
+    /// </summary>
+    /// <param name="stats">File contents.</param>
+    /// <returns>The counters, or null if the file has neither.</returns>
+    public static PageCacheCounters? ParseCounters(string stats)
+    {
+        ArgumentNullException.ThrowIfNull(stats);
+
+        long? total = null;
+        long? perReason = null;
+        long? refaultFile = null;
+        long? refault = null;
+        foreach (var (name, value) in ParseValues(stats))
+        {
+            if (name == "pgsteal")
+            {
+                total = value;
+            }
+            else if (name.StartsWith("pgsteal_", StringComparison.Ordinal))
+            {
+                perReason = (perReason ?? 0) + value;
+            }
+            else if (name == "workingset_refault_file")
+            {
+                refaultFile = value;
+            }
+            else if (name == "workingset_refault")
+            {
+                refault = value;
+            }
+        }
+
+        long? reclaimed = total ?? perReason;
+        long? refaulted = refaultFile ?? refault;
+        if (reclaimed == null && refaulted == null)
+        {
+            return null;
+        }
+
+        return new PageCacheCounters(reclaimed ?? 0, refaulted ?? 0);
+    }
+
+    /// <summary>
+    /// Gets one value from a "name value" counter file.
+    /// </summary>
+    /// <param name="stats">File contents.</param>
+    /// <param name="name">Counter name (e.g., "anon").</param>
+    public static long? GetValue(string stats, string name)
+    {
+        ArgumentNullException.ThrowIfNull(stats);
+        ArgumentNullException.ThrowIfNull(name);
+
+        foreach (var (key, value) in ParseValues(stats))
+        {
+            if (key == name)
+            {
+                return value;
+            }
+        }
+
+        return null;
+    }
+
+    /// <summary>
+    /// Gets one field of /proc/meminfo, in kB.
+    /// </summary>
+    /// <param name="meminfo">Contents of /proc/meminfo.</param>
+    /// <param name="field">Field name (e.g., "MemAvailable").</param>
+    public static long? GetMeminfoKilobytes(string meminfo, string field)
+    {
+        ArgumentNullException.ThrowIfNull(meminfo);
+        ArgumentNullException.ThrowIfNull(field);
+
+        foreach (var line in meminfo.Split('\n'))
+        {
+            int colon = line.IndexOf(':', StringComparison.Ordinal);
+            if (colon <= 0 || !line.AsSpan(0, colon).SequenceEqual(field))
+            {
+                continue;
+            }
+
+            var value = line.AsSpan(colon + 1).Trim();
+            if (value.EndsWith("kB", StringComparison.Ordinal))
+            {
+                value = value[..^2].TrimEnd();
+            }
+
+            return long.Parse(value, NumberStyles.None, CultureInfo.InvariantCulture);
+        }
+
+        return null;
+    }
+
+    private static IEnumerable<(string Name, long Value)> ParseValues(string stats)
+    {
+        foreach (var line in stats.Split('\n'))
+        {
+            int space = line.IndexOf(' ', StringComparison.Ordinal);
+            if (space > 0 && long.TryParse(line.AsSpan(space + 1).Trim(), NumberStyles.None, CultureInfo.InvariantCulture, out long value))
+            {
+                yield return (line[..space], value);
+            }
+        }
+    }
+}
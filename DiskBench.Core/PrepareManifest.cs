@@ -0,0 +1,99 @@
+using System.Globalization;
+using System.Text;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Sidecar file recording what a prepared file holds, so a later run reuses the file only when its
+/// content is what the run asks for.
+/// </summary>
+/// <remarks>
+/// The manifest sits next to the file as "&lt;file&gt;.prepare" and is plain key=value text. Files prepared
+/// without generated content have no manifest.
+/// </remarks>
+public static class PrepareManifest
+{
+    /// <summary>
+    /// Extension appended to a prepared file's path to name its manifest.
+    /// </summary>
+    public const string Extension = ".prepare";
+
+    /// <summary>
+    /// Gets the manifest path of a prepared file.
+    /// </summary>
+    /// <param name="filePath">Path to the prepared file.</param>
+    public static string GetPath(string filePath) => filePath + Extension;
+
+    /// <summary>
+    /// Formats the manifest of a file of the given size and content.
+    /// </summary>
+    /// <param name="fileSize">File size in bytes.</param>
+    /// <param name="content">Content written to the file.</param>
+    public static string Format(long fileSize, PreparedContent content)
+    {
+        ArgumentNullException.ThrowIfNull(content);
+
+        var manifest = new StringBuilder();
+        manifest.Append(CultureInfo.InvariantCulture, $"size={fileSize}\n");
+        manifest.Append(CultureInfo.InvariantCulture, $"content={content.Mode}\n");
+        manifest.Append(CultureInfo.InvariantCulture, $"unique={content.UniqueBlockRatio:R}\n");
+        manifest.Append(CultureInfo.InvariantCulture, $"block={content.BlockSize}\n");
+        manifest.Append(CultureInfo.InvariantCulture, $"seed={content.Seed}\n");
+        return manifest.ToString();
+    }
+
+    /// <summary>
+    /// Writes the manifest of a prepared file.
+    /// </summary>
+    /// <param name="filePath">Path to the prepared file.</param>
+    /// <param name="fileSize">File size in bytes.</param>
+    /// <param name="content">Content written to the file.</param>
+    public static void Write(string filePath, long fileSize, PreparedContent content) =>
+        File.WriteAllText(GetPath(filePath), Format(fileSize, content));
+
+    /// <summary>
+    /// Whether a prepared file has a manifest recording exactly this size and content.
+    /// </summary>
+    /// <param name="filePath">Path to the prepared file.</param>
+    /// <param name="fileSize">Expected file size in bytes.</param>
+    /// <param name="content">Expected content.</param>
+    public static bool Matches(string filePath, long fileSize, PreparedContent content)
+    {
+        var path = GetPath(filePath);
+        return File.Exists(path) && string.Equals(File.ReadAllText(path), Format(fileSize, content), StringComparison.Ordinal);
+    }
+
+    /// <summary>
+    /// Deletes the manifest of a prepared file, if it has one.
+    /// </summary>
+    /// <param name="filePath">Path to the prepared file.</param>
+    public static void Delete(string filePath)
+    {
+        var path = GetPath(filePath);
+        if (File.Exists(path))
+        {
+            File.Delete(path);
+        }
+    }
+
+    /// <summary>
+    /// Deletes the manifests of the files a workload may write to. Writes fill blocks with buffers
+    /// that are not the recorded content, so a later run must prepare those files again.
+    /// </summary>
+    /// <param name="workload">Workload about to run.</param>
+    public static void Invalidate(WorkloadSpec workload)
+    {
+        ArgumentNullException.ThrowIfNull(workload);
+
+        // A custom generator may supply its own read/write decisions
+        if (workload.WritePercent == 0 && workload.Generator == null)
+        {
+            return;
+        }
+
+        foreach (var filePath in workload.GetFilePaths())
+        {
+            Delete(filePath);
+        }
+    }
+}
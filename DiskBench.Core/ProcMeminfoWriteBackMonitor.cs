@@ -0,0 +1,142 @@
+using System.Diagnostics;
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Reads the Dirty and Writeback page counts from Linux /proc/meminfo.
+/// </summary>
+public sealed class ProcMeminfoWriteBackMonitor : IWriteBackMonitor
+{
+    /// <summary>
+    /// Default meminfo path.
+    /// </summary>
+    public const string DefaultMeminfoPath = "/proc/meminfo";
+
+    private const long BytesPerKilobyte = 1024;
+
+    private readonly string _path;
+    private readonly bool _available;
+
+    /// <summary>
+    /// Creates a monitor over the system meminfo file.
+    /// Unavailable on platforms other than Linux.
+    /// </summary>
+    public ProcMeminfoWriteBackMonitor()
+    {
+        _path = DefaultMeminfoPath;
+        if (!OperatingSystem.IsLinux())
+        {
+            Description = "/proc/meminfo write-back counters require Linux";
+            return;
+        }
+
+        (_available, Description) = Discover();
+    }
+
+    /// <summary>
+    /// Creates a monitor over a specific meminfo file.
+    /// </summary>
+    /// <param name="meminfoPath">File in /proc/meminfo format.</param>
+    public ProcMeminfoWriteBackMonitor(string meminfoPath)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(meminfoPath);
+        _path = meminfoPath;
+        (_available, Description) = Discover();
+    }
+
+    /// <inheritdoc />
+    public bool IsAvailable => _available;
+
+    /// <inheritdoc />
+    public string Description { get; }
+
+    /// <inheritdoc />
+    public WriteBackSample Read()
+    {
+        if (!_available)
+        {
+            throw new InvalidOperationException($"Write-back counters unavailable: {Description}");
+        }
+
+        var timestamp = Stopwatch.GetTimestamp();
+        var (dirty, writeback) = Parse(File.ReadAllText(_path));
+        return new WriteBackSample(
+            timestamp,
+            (dirty ?? throw new FormatException($"No Dirty line in {_path}")) * BytesPerKilobyte,
+            writeback * BytesPerKilobyte);
+    }
+
+    /// <summary>
+    /// Parses the Dirty and Writeback lines (in kB) of meminfo text.
+    /// </summary>
+    /// <param name="meminfo">Contents of /proc/meminfo.</param>
+    /// <returns>Dirty and Writeback in kB, null where the line is missing.</returns>
+    public static (long? DirtyKilobytes, long? WritebackKilobytes) Parse(string meminfo)
+    {
+        ArgumentNullException.ThrowIfNull(meminfo);
+
+        long? dirty = null;
+        long? writeback = null;
+        foreach (var line in meminfo.Split('\n'))
+        {
+            // "Dirty:              1234 kB"; WritebackTmp is FUSE and is not device write-back
+            int colon = line.IndexOf(':', StringComparison.Ordinal);
+            if (colon <= 0)
+            {
+                continue;
+            }
+
+            var name = line.AsSpan(0, colon);
+            bool isDirty = name.SequenceEqual("Dirty");
+            if (!isDirty && !name.SequenceEqual("Writeback"))
+            {
+                continue;
+            }
+
+            var value = line.AsSpan(colon + 1).Trim();
+            if (value.EndsWith("kB", StringComparison.Ordinal))
+            {
+                value = value[..^2].TrimEnd();
+            }
+
+            long kilobytes = long.Parse(value, NumberStyles.None, CultureInfo.InvariantCulture);
+            if (isDirty)
+            {
+                dirty = kilobytes;
+            }
+            else
+            {
+                writeback = kilobytes;
+            }
+        }
+
+        return (dirty, writeback);
+    }
+
+    private (bool Available, string Description) Discover()
+    {
+        try
+        {
+            if (!File.Exists(_path))
+            {
+                return (false, $"{_path} not present");
+            }
+
+            var (dirty, _) = Parse(File.ReadAllText(_path));
+            return dirty.HasValue ? (true, _path) : (false, $"no Dirty line in {_path}");
+        }
+        catch (IOException)
+        {
+            return (false, $"{_path} is not readable");
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return (false, $"{_path} is not readable");
+        }
+        catch (FormatException)
+        {
+            return (false, $"{_path} has an unexpected format");
+        }
+    }
+}
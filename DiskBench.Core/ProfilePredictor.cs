@@ -0,0 +1,326 @@
+using DiskBench.Metrics;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Predicts the results of every usage profile from a short run of a small basis of workloads,
+/// using a model learned from earlier results that measured both the basis and the profiles.
+/// </summary>
+/// <remarks>
+/// Each profile workload's IOPS and p99 latency get their own ridge regression on the logs of the
+/// basis IOPS and p99 latencies, so the model captures ratios ("random reads at QD32 scale like
+/// this drive's 4K QD1 and QD32 points") rather than absolute differences. Errors come from nested
+/// leave-one-out cross-validation, i.e. how well a drive that was not in the training set is predicted,
+/// and 95% prediction bands scale that error by Student's t for the residual degrees of freedom, so
+/// small training sets get wide bands. A workload is only predicted once more training results measured
+/// it than the model has features.
+/// </remarks>
+public sealed class ProfilePredictor
+{
+    /// <summary>
+    /// Minimum number of training results for a workload to be predicted: two more than the ten
+    /// features of the default basis. Larger bases need two more results than they have features.
+    /// </summary>
+    public const int MinimumSamples = 12;
+
+    /// <summary>
+    /// Prefix of basis workload names.
+    /// </summary>
+    public const string BasisPrefix = "Basis: ";
+
+    private readonly IReadOnlyList<UsageProfile> _profiles;
+    private readonly Dictionary<string, (RidgeRegression Iops, RidgeRegression P99, int BlockSize)> _models;
+
+    private ProfilePredictor(
+        IReadOnlyList<string> basis,
+        IReadOnlyList<UsageProfile> profiles,
+        Dictionary<string, (RidgeRegression Iops, RidgeRegression P99, int BlockSize)> models,
+        IReadOnlyList<PredictorTargetFit> fits)
+    {
+        BasisNames = basis;
+        _profiles = profiles;
+        _models = models;
+        Fits = fits;
+    }
+
+    /// <summary>
+    /// Default basis: short BS/QD/mix points spanning latency, parallelism, mixed IO and bandwidth.
+    /// </summary>
+    public static IReadOnlyList<ProfileWorkload> DefaultBasis { get; } =
+    [
+        new ProfileWorkload { Name = "4K Random Read QD1", Weight = 20, BlockSize = 4096, Pattern = AccessPattern.Random, QueueDepth = 1 },
+        new ProfileWorkload { Name = "4K Random Read QD32", Weight = 20, BlockSize = 4096, Pattern = AccessPattern.Random, QueueDepth = 32 },
+        new ProfileWorkload { Name = "4K Random 30% Write QD8", Weight = 20, BlockSize = 4096, Pattern = AccessPattern.Random, WritePercent = 30, QueueDepth = 8 },
+        new ProfileWorkload { Name = "128K Sequential Read QD8", Weight = 20, BlockSize = 128 * 1024, Pattern = AccessPattern.Sequential, QueueDepth = 8 },
+        new ProfileWorkload { Name = "1M Sequential Write QD4", Weight = 20, BlockSize = 1024 * 1024, Pattern = AccessPattern.Sequential, WritePercent = 100, QueueDepth = 4 }
+    ];
+
+    /// <summary>
+    /// Gets the names of the basis workloads the model predicts from.
+    /// </summary>
+    public IReadOnlyList<string> BasisNames { get; }
+
+    /// <summary>
+    /// Gets the cross-validated fit of every workload the model predicts.
+    /// </summary>
+    public IReadOnlyList<PredictorTargetFit> Fits { get; }
+
+    /// <summary>
+    /// Gets the name a basis workload runs under.
+    /// </summary>
+    /// <param name="workload">Basis workload.</param>
+    public static string GetBasisName(ProfileWorkload workload)
+    {
+        ArgumentNullException.ThrowIfNull(workload);
+        return BasisPrefix + workload.Name;
+    }
+
+    /// <summary>
+    /// Creates a plan that runs only the basis.
+    /// </summary>
+    /// <param name="filePath">Path to the test file.</param>
+    /// <param name="fileSize">Test file size.</param>
+    /// <param name="trials">Trials per workload.</param>
+    /// <param name="warmupDuration">Warmup per workload (default 2 seconds).</param>
+    /// <param name="measuredDuration">Measured duration per workload (default 5 seconds).</param>
+    /// <param name="basis">Basis workloads (default <see cref="DefaultBasis"/>).</param>
+    public static BenchmarkPlan CreateBasisPlan(
+        string filePath,
+        long fileSize,
+        int trials = 1,
+        TimeSpan? warmupDuration = null,
+        TimeSpan? measuredDuration = null,
+        IReadOnlyList<ProfileWorkload>? basis = null)
+    {
+        ArgumentException.ThrowIfNullOrEmpty(filePath);
+
+        return new BenchmarkPlan
+        {
+            Name = "Profile Basis",
+            Workloads =
+            [
+                .. (basis ?? DefaultBasis).Select(w => new WorkloadSpec
+                {
+                    Name = GetBasisName(w),
+                    FilePath = filePath,
+                    FileSize = fileSize,
+                    BlockSize = w.BlockSize,
+                    Pattern = w.Pattern,
+                    WritePercent = w.WritePercent,
+                    QueueDepth = w.QueueDepth,
+                    Threads = w.Threads,
+                    NoBuffering = w.NoBuffering,
+                    WriteThrough = w.WriteThrough
+                })
+            ],
+            Trials = trials,
+            WarmupDuration = warmupDuration ?? TimeSpan.FromSeconds(2),
+            MeasuredDuration = measuredDuration ?? TimeSpan.FromSeconds(5)
+        };
+    }
+
+    /// <summary>
+    /// Creates a plan that runs the basis and every profile's workloads on one drive,
+    /// producing one training result for <see cref="Fit"/>.
+    /// </summary>
+    /// <param name="filePath">Path to the test file.</param>
+    /// <param name="fileSize">Test file size.</param>
+    /// <param name="trials">Trials per workload.</param>
+    /// <param name="warmupDuration">Warmup per workload (default 5 seconds).</param>
+    /// <param name="measuredDuration">Measured duration per workload (default 30 seconds).</param>
+    /// <param name="basis">Basis workloads (default <see cref="DefaultBasis"/>).</param>
+    public static BenchmarkPlan CreateCalibrationPlan(
+        string filePath,
+        long fileSize,
+        int trials = 3,
+        TimeSpan? warmupDuration = null,
+        TimeSpan? measuredDuration = null,
+        IReadOnlyList<ProfileWorkload>? basis = null)
+    {
+        var basisPlan = CreateBasisPlan(
+            filePath,
+            fileSize,
+            trials,
+            warmupDuration ?? TimeSpan.FromSeconds(5),
+            measuredDuration ?? TimeSpan.FromSeconds(30),
+            basis);
+
+        return basisPlan with
+        {
+            Name = "Profile Calibration",
+            Workloads =
+            [
+                .. basisPlan.Workloads,
+                .. UsageProfiles.All.SelectMany(p => UsageProfiles.CreatePlan(p, filePath, fileSize).Workloads)
+            ]
+        };
+    }
+
+    /// <summary>
+    /// Gets the score of every named workload of a result.
+    /// </summary>
+    /// <param name="result">Benchmark result.</param>
+    public static IReadOnlyDictionary<string, WorkloadScore> GetScores(BenchmarkResult result)
+    {
+        ArgumentNullException.ThrowIfNull(result);
+
+        var scores = new Dictionary<string, WorkloadScore>(StringComparer.Ordinal);
+        foreach (var workload in result.Workloads)
+        {
+            scores[workload.Workload.GetDisplayName()] = new WorkloadScore(workload.MeanIops, workload.MeanLatency.P99Us);
+        }
+
+        return scores;
+    }
+
+    /// <summary>
+    /// Fits a model for every profile workload measured, with the basis, by at least <see cref="MinimumSamples"/> results.
+    /// </summary>
+    /// <param name="samples">Workload scores of each training result (typically one calibration run per drive).</param>
+    /// <param name="basis">Basis workloads (default <see cref="DefaultBasis"/>).</param>
+    /// <param name="profiles">Profiles to predict (default <see cref="UsageProfiles.All"/>).</param>
+    /// <exception cref="ArgumentException">Not enough training results to predict any workload.</exception>
+    public static ProfilePredictor Fit(
+        IReadOnlyList<IReadOnlyDictionary<string, WorkloadScore>> samples,
+        IReadOnlyList<ProfileWorkload>? basis = null,
+        IReadOnlyList<UsageProfile>? profiles = null)
+    {
+        ArgumentNullException.ThrowIfNull(samples);
+        var basisNames = (basis ?? DefaultBasis).Select(GetBasisName).ToList();
+        profiles ??= UsageProfiles.All;
+
+        // Results missing part of the basis cannot be used at all
+        var usable = new List<(double[] Features, IReadOnlyDictionary<string, WorkloadScore> Scores)>();
+        foreach (var sample in samples)
+        {
+            var features = GetFeatures(sample, basisNames);
+            if (features != null)
+            {
+                usable.Add((features, sample));
+            }
+        }
+
+        var models = new Dictionary<string, (RidgeRegression Iops, RidgeRegression P99, int BlockSize)>(StringComparer.Ordinal);
+        var fits = new List<PredictorTargetFit>();
+        foreach (var profile in profiles)
+        {
+            foreach (var workload in profile.Workloads)
+            {
+                var name = GetTargetName(profile, workload);
+                var training = usable
+                    .Where(s => s.Scores.TryGetValue(name, out var score) && score.Iops > 0 && score.P99LatencyUs > 0)
+                    .ToList();
+                if (training.Count < Math.Max(MinimumSamples, (2 * basisNames.Count) + 2))
+                {
+                    continue;
+                }
+
+                var features = training.Select(s => s.Features).ToList();
+                var iops = RidgeRegression.Fit(features, [.. training.Select(s => Math.Log(s.Scores[name].Iops))]);
+                var p99 = RidgeRegression.Fit(features, [.. training.Select(s => Math.Log(s.Scores[name].P99LatencyUs))]);
+                models[name] = (iops, p99, workload.BlockSize);
+                fits.Add(new PredictorTargetFit
+                {
+                    Name = name,
+                    Samples = training.Count,
+                    IopsError = Math.Exp(iops.CrossValidatedError) - 1,
+                    P99LatencyError = Math.Exp(p99.CrossValidatedError) - 1
+                });
+            }
+        }
+
+        if (models.Count == 0)
+        {
+            throw new ArgumentException(
+                $"No profile workload was measured together with the basis by at least {Math.Max(MinimumSamples, (2 * basisNames.Count) + 2)} results " +
+                $"({usable.Count} of {samples.Count} results include the whole basis).",
+                nameof(samples));
+        }
+
+        return new ProfilePredictor(basisNames, profiles, models, fits);
+    }
+
+    /// <summary>
+    /// Predicts every profile from measured basis scores.
+    /// </summary>
+    /// <param name="basis">Scores of a run that includes every basis workload (see <see cref="CreateBasisPlan"/>).</param>
+    /// <exception cref="ArgumentException">A basis workload is missing or has no IOPS or latency.</exception>
+    public ProfilePredictionResult Predict(IReadOnlyDictionary<string, WorkloadScore> basis)
+    {
+        ArgumentNullException.ThrowIfNull(basis);
+
+        var features = GetFeatures(basis, BasisNames)
+            ?? throw new ArgumentException(
+                $"Basis measurements are incomplete: need IOPS and p99 latency for {string.Join(", ", BasisNames)}.",
+                nameof(basis));
+
+        var profiles = new List<ProfilePrediction>();
+        foreach (var profile in _profiles)
+        {
+            var workloads = new List<WorkloadPrediction>();
+            foreach (var workload in profile.Workloads)
+            {
+                var name = GetTargetName(profile, workload);
+                if (!_models.TryGetValue(name, out var model))
+                {
+                    continue;
+                }
+
+                var (iops, iopsBand) = PredictWithBand(model.Iops, features);
+                var (p99, p99Band) = PredictWithBand(model.P99, features);
+                workloads.Add(new WorkloadPrediction
+                {
+                    Name = name,
+                    Iops = iops,
+                    IopsBand = iopsBand,
+                    P99LatencyUs = p99,
+                    P99LatencyBand = p99Band,
+                    BytesPerSecond = iops * model.BlockSize
+                });
+            }
+
+            if (workloads.Count > 0)
+            {
+                profiles.Add(new ProfilePrediction { Type = profile.Type, Name = profile.Name, Workloads = workloads });
+            }
+        }
+
+        return new ProfilePredictionResult
+        {
+            Basis = BasisNames.ToDictionary(n => n, n => basis[n], StringComparer.Ordinal),
+            Profiles = profiles,
+            Fits = Fits
+        };
+    }
+
+    private static string GetTargetName(UsageProfile profile, ProfileWorkload workload) =>
+        $"{profile.Name}: {workload.Name}";
+
+    /// <summary>
+    /// Log IOPS and log p99 latency of each basis workload, or null if any is missing or not positive.
+    /// </summary>
+    private static double[]? GetFeatures(IReadOnlyDictionary<string, WorkloadScore> scores, IReadOnlyList<string> basisNames)
+    {
+        var features = new double[basisNames.Count * 2];
+        for (int b = 0; b < basisNames.Count; b++)
+        {
+            if (!scores.TryGetValue(basisNames[b], out var score) || !(score.Iops > 0) || !(score.P99LatencyUs > 0))
+            {
+                return null;
+            }
+
+            features[2 * b] = Math.Log(score.Iops);
+            features[(2 * b) + 1] = Math.Log(score.P99LatencyUs);
+        }
+
+        return features;
+    }
+
+    private static (double Value, (double Lower, double Upper) Band) PredictWithBand(RidgeRegression model, double[] features)
+    {
+        double log = model.Predict(features);
+        int degreesOfFreedom = Math.Max(1, (int)Math.Floor(model.SampleCount - model.EffectiveParameters));
+        double spread = StatisticalAggregation.TCritical95(degreesOfFreedom) * model.CrossValidatedError;
+        return (Math.Exp(log), (Math.Exp(log - spread), Math.Exp(log + spread)));
+    }
+}
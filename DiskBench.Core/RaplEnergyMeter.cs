@@ -0,0 +1,189 @@
+using System.Diagnostics;
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Reads CPU package and DRAM energy from Linux powercap RAPL zones
+/// (/sys/class/powercap/intel-rapl:*; AMD processors expose the same layout).
+/// Sub-zones other than DRAM (core, uncore) are already included in the package total and are ignored.
+/// </summary>
+public sealed class RaplEnergyMeter : IEnergyMeter
+{
+    /// <summary>
+    /// Default powercap sysfs directory.
+    /// </summary>
+    public const string DefaultPowercapRoot = "/sys/class/powercap";
+
+    private const double MicrojoulesPerJoule = 1_000_000.0;
+
+    private readonly List<Zone> _zones = [];
+
+    /// <summary>
+    /// Creates a meter over the system powercap directory.
+    /// Unavailable on platforms other than Linux.
+    /// </summary>
+    public RaplEnergyMeter()
+    {
+        if (!OperatingSystem.IsLinux())
+        {
+            Description = "RAPL energy counters require Linux powercap";
+            return;
+        }
+
+        Description = Discover(DefaultPowercapRoot);
+    }
+
+    /// <summary>
+    /// Creates a meter over a specific powercap directory.
+    /// </summary>
+    /// <param name="powercapRoot">Directory containing intel-rapl:* zones.</param>
+    public RaplEnergyMeter(string powercapRoot)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(powercapRoot);
+        Description = Discover(powercapRoot);
+    }
+
+    /// <inheritdoc />
+    public bool IsAvailable => _zones.Any(z => !z.IsDram);
+
+    /// <inheritdoc />
+    public string Description { get; }
+
+    /// <inheritdoc />
+    public EnergySample Read()
+    {
+        if (!IsAvailable)
+        {
+            throw new InvalidOperationException($"Energy counters unavailable: {Description}");
+        }
+
+        double package = 0;
+        double? dram = null;
+
+        foreach (var zone in _zones)
+        {
+            var raw = ReadCounter(zone.EnergyPath);
+            double delta = raw >= zone.LastRaw ? raw - zone.LastRaw : (double)zone.MaxRange - zone.LastRaw + raw;
+            zone.LastRaw = raw;
+            zone.TotalMicrojoules += delta;
+
+            if (zone.IsDram)
+            {
+                dram = (dram ?? 0) + zone.TotalMicrojoules / MicrojoulesPerJoule;
+            }
+            else
+            {
+                package += zone.TotalMicrojoules / MicrojoulesPerJoule;
+            }
+        }
+
+        return new EnergySample(Stopwatch.GetTimestamp(), package, dram);
+    }
+
+    private string Discover(string powercapRoot)
+    {
+        if (!Directory.Exists(powercapRoot))
+        {
+            return $"powercap not present ({powercapRoot})";
+        }
+
+        var names = new List<string>();
+        string? unreadable = null;
+
+        var zoneDirs = Directory.GetDirectories(powercapRoot, "intel-rapl:*")
+            .OrderBy(d => d, StringComparer.Ordinal);
+
+        foreach (var dir in zoneDirs)
+        {
+            var name = TryReadText(Path.Combine(dir, "name"));
+            if (name == null)
+            {
+                continue;
+            }
+
+            // A package zone is intel-rapl:N; its sub-zones are intel-rapl:N:M
+            bool isSubZone = Path.GetFileName(dir).Count(c => c == ':') > 1;
+            bool isDram = name.Equals("dram", StringComparison.Ordinal);
+            bool isPackage = !isSubZone && name.StartsWith("package", StringComparison.Ordinal);
+            if (!isDram && !isPackage)
+            {
+                continue;
+            }
+
+            var energyPath = Path.Combine(dir, "energy_uj");
+            long raw;
+            long maxRange;
+            try
+            {
+                raw = ReadCounter(energyPath);
+                var maxText = TryReadText(Path.Combine(dir, "max_energy_range_uj"));
+                maxRange = maxText != null ? long.Parse(maxText, CultureInfo.InvariantCulture) : long.MaxValue;
+            }
+            catch (UnauthorizedAccessException)
+            {
+                unreadable ??= energyPath;
+                continue;
+            }
+            catch (IOException)
+            {
+                unreadable ??= energyPath;
+                continue;
+            }
+            catch (FormatException)
+            {
+                unreadable ??= energyPath;
+                continue;
+            }
+
+            _zones.Add(new Zone(energyPath, isDram, maxRange) { LastRaw = raw });
+            names.Add(name);
+        }
+
+        if (IsAvailable)
+        {
+            return "RAPL: " + string.Join(", ", names);
+        }
+
+        if (unreadable != null)
+        {
+            return $"{unreadable} is not readable (run as root or grant read access)";
+        }
+
+        return $"no RAPL package zones under {powercapRoot}";
+    }
+
+    private static long ReadCounter(string path)
+    {
+        return long.Parse(File.ReadAllText(path).Trim(), CultureInfo.InvariantCulture);
+    }
+
+    private static string? TryReadText(string path)
+    {
+        try
+        {
+            return File.Exists(path) ? File.ReadAllText(path).Trim() : null;
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return null;
+        }
+    }
+
+    private sealed class Zone(string energyPath, bool isDram, long maxRange)
+    {
+        public string EnergyPath { get; } = energyPath;
+
+        public bool IsDram { get; } = isDram;
+
+        public long MaxRange { get; } = maxRange;
+
+        public long LastRaw { get; set; }
+
+        public double TotalMicrojoules { get; set; }
+    }
+}
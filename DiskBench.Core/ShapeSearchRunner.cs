@@ -0,0 +1,294 @@
+using System.Diagnostics;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Searches block size × queue depth × thread count for the cheapest IO shape reaching a fraction of
+/// peak throughput and for the Pareto frontier of throughput, p99 latency and CPU per IO.
+/// </summary>
+/// <remarks>
+/// The search is successive halving: every shape runs a short trial, then each round keeps the best
+/// 1/η of the survivors and measures them η times longer. The round's fastest shape and its cheapest
+/// shape within the target fraction of that peak always survive; the rest are chosen by Pareto rank over
+/// throughput, p99 latency, CPU per IO and outstanding bytes. Most shapes share the first front, since
+/// bytes in flight trade against throughput, so a front that does not fit is cut by cost among the shapes
+/// within reach of peak before faster but costlier ones are kept. A grid of N shapes
+/// costs about N × log_η(N) short trials instead of N full ones. Peak, frontier and cheapest shape
+/// are taken from the last round only, so they compare shapes measured at the same, longest duration.
+/// </remarks>
+public sealed class ShapeSearchRunner
+{
+    private readonly IBenchmarkEngine _engine;
+    private readonly IBenchmarkSink _sink;
+
+    /// <summary>
+    /// Creates a new shape search runner.
+    /// </summary>
+    /// <param name="engine">The IO engine to use.</param>
+    /// <param name="sink">Optional sink for progress events (receives every measurement's run).</param>
+    public ShapeSearchRunner(IBenchmarkEngine engine, IBenchmarkSink? sink = null)
+    {
+        _engine = engine ?? throw new ArgumentNullException(nameof(engine));
+        _sink = sink ?? NullBenchmarkSink.Instance;
+    }
+
+    /// <summary>
+    /// Runs the search.
+    /// </summary>
+    /// <param name="spec">The search specification.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    public async Task<ShapeSearchResult> RunAsync(ShapeSearchSpec spec, CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(spec);
+        ValidateSpec(spec);
+
+        var startTime = DateTimeOffset.UtcNow;
+        var runner = new BenchmarkRunner(_engine, _sink);
+        using var process = Process.GetCurrentProcess();
+
+        var shapes = (
+            from blockSize in spec.BlockSizes
+            from queueDepth in spec.QueueDepths
+            from threads in spec.ThreadCounts
+            select spec.Workload with { BlockSize = blockSize, QueueDepth = queueDepth, Threads = threads, Name = null }).ToList();
+
+        // Prepare once up front, so writing the file is not charged to the first shape's CPU time
+        foreach (var path in spec.Workload.GetFilePaths())
+        {
+            await PrepareAsync(path, spec.Workload.FileSize, cancellationToken).ConfigureAwait(false);
+        }
+
+        var points = new ShapePoint[shapes.Count];
+        var survivors = Enumerable.Range(0, shapes.Count).ToList();
+        var rounds = new List<ShapeSearchRound>();
+        var duration = spec.InitialDuration;
+        var measuredTime = TimeSpan.Zero;
+
+        for (int round = 1; ; round++)
+        {
+            foreach (int s in survivors)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+                points[s] = await MeasureAsync(runner, process, spec, shapes[s], duration, round, cancellationToken).ConfigureAwait(false);
+                measuredTime += duration;
+            }
+
+            bool last = survivors.Count <= spec.Reduction || round >= spec.MaxRounds;
+            var kept = last
+                ? survivors
+                : SelectSurvivors(points, survivors, (survivors.Count + spec.Reduction - 1) / spec.Reduction, spec.TargetFraction);
+            rounds.Add(new ShapeSearchRound { Round = round, MeasuredDuration = duration, Evaluated = survivors.Count, Kept = kept.Count });
+
+            if (last)
+            {
+                break;
+            }
+
+            survivors = kept;
+            duration *= spec.Reduction;
+        }
+
+        if (spec.DeleteOnComplete)
+        {
+            foreach (var path in spec.Workload.GetFilePaths())
+            {
+                TryDelete(path);
+            }
+        }
+
+        var finalists = points.Where(p => p.Rounds == rounds.Count).ToList();
+        double peak = finalists.Max(p => p.BytesPerSecond);
+        return new ShapeSearchResult
+        {
+            Spec = spec,
+            Points = points,
+            Finalists = finalists,
+            Frontier = GetFrontier(finalists),
+            PeakBytesPerSecond = peak,
+            Cheapest = ByCost(finalists.Where(p => p.BytesPerSecond >= spec.TargetFraction * peak), p => p).First(),
+            Rounds = rounds,
+            MeasuredTime = measuredTime,
+            ExhaustiveTime = duration * shapes.Count,
+            StartTime = startTime,
+            Duration = DateTimeOffset.UtcNow - startTime
+        };
+    }
+
+    /// <summary>
+    /// Gets the shapes no other shape beats on throughput, p99 latency and CPU per IO at once, fastest first.
+    /// </summary>
+    /// <param name="points">Measured shapes.</param>
+    public static IReadOnlyList<ShapePoint> GetFrontier(IReadOnlyList<ShapePoint> points)
+    {
+        ArgumentNullException.ThrowIfNull(points);
+
+        return [.. points
+            .Where(p => !points.Any(q => Dominates(q, p, withCost: false)))
+            .OrderByDescending(p => p.BytesPerSecond)];
+    }
+
+    /// <summary>
+    /// Keeps the fastest candidate, the cheapest one reaching <paramref name="targetFraction"/> of it, and then
+    /// candidates by Pareto rank over throughput, p99 latency, CPU per IO and outstanding bytes until at least
+    /// <paramref name="keep"/> survive. A front that does not fit whole is cut cheapest first among the shapes
+    /// reaching the target, then fastest first among the rest. Returns indices in grid order.
+    /// </summary>
+    private static List<int> SelectSurvivors(ShapePoint[] points, List<int> candidates, int keep, double targetFraction)
+    {
+        double peak = candidates.Max(i => points[i].BytesPerSecond);
+        bool Qualifies(int i) => points[i].BytesPerSecond >= targetFraction * peak;
+
+        var kept = new List<int> { candidates.MaxBy(i => points[i].BytesPerSecond) };
+        int cheapest = ByCost(candidates.Where(Qualifies), i => points[i]).First();
+        if (cheapest != kept[0])
+        {
+            kept.Add(cheapest);
+        }
+
+        var remaining = candidates.Except(kept).ToList();
+        while (kept.Count < keep && remaining.Count > 0)
+        {
+            var front = remaining.Where(i => !remaining.Any(j => Dominates(points[j], points[i], withCost: true))).ToList();
+            if (kept.Count + front.Count > keep)
+            {
+                var qualifying = ByCost(front.Where(Qualifies), i => points[i]);
+                var rest = front.Where(i => !Qualifies(i)).OrderByDescending(i => points[i].BytesPerSecond);
+                front = [.. qualifying.Concat(rest).Take(keep - kept.Count)];
+            }
+
+            kept.AddRange(front);
+            remaining.RemoveAll(front.Contains);
+        }
+
+        kept.Sort();
+        return kept;
+    }
+
+    /// <summary>
+    /// Orders shapes cheapest first: fewest outstanding bytes, then fewest threads, then fastest.
+    /// </summary>
+    private static IOrderedEnumerable<T> ByCost<T>(IEnumerable<T> items, Func<T, ShapePoint> point) => items
+        .OrderBy(i => point(i).OutstandingBytes)
+        .ThenBy(i => point(i).Workload.Threads)
+        .ThenByDescending(i => point(i).BytesPerSecond);
+
+    private static bool Dominates(ShapePoint a, ShapePoint b, bool withCost)
+    {
+        bool noWorse = a.BytesPerSecond >= b.BytesPerSecond &&
+            a.P99LatencyUs <= b.P99LatencyUs &&
+            a.CpuUsPerIo <= b.CpuUsPerIo &&
+            (!withCost || a.OutstandingBytes <= b.OutstandingBytes);
+        bool better = a.BytesPerSecond > b.BytesPerSecond ||
+            a.P99LatencyUs < b.P99LatencyUs ||
+            a.CpuUsPerIo < b.CpuUsPerIo ||
+            (withCost && a.OutstandingBytes < b.OutstandingBytes);
+        return noWorse && better;
+    }
+
+    private static async Task<ShapePoint> MeasureAsync(
+        BenchmarkRunner runner,
+        Process process,
+        ShapeSearchSpec spec,
+        WorkloadSpec workload,
+        TimeSpan duration,
+        int round,
+        CancellationToken cancellationToken)
+    {
+        var name = workload.GetDisplayName();
+        var plan = new BenchmarkPlan
+        {
+            Name = $"Shape search [{name}]",
+            Workloads = [workload],
+            Trials = 1,
+            WarmupDuration = spec.WarmupDuration,
+            MeasuredDuration = duration,
+            CollectTimeSeries = false,
+            ReuseExistingFiles = true,
+            DeleteOnComplete = false
+        };
+
+        process.Refresh();
+        var cpuBefore = process.TotalProcessorTime;
+        var result = await runner.RunAsync(plan, cancellationToken).ConfigureAwait(false);
+        process.Refresh();
+        var cpuTime = process.TotalProcessorTime - cpuBefore;
+
+        // CPU time covers warmup too, so it is spread over the IOs of both windows at the measured rate
+        var measured = result.Workloads[0];
+        double ios = measured.MeanIops * (spec.WarmupDuration + duration).TotalSeconds;
+
+        return new ShapePoint
+        {
+            Workload = workload,
+            Name = name,
+            BytesPerSecond = measured.MeanBytesPerSecond,
+            Iops = measured.MeanIops,
+            P99LatencyUs = measured.MeanLatency.P99Us,
+            CpuUsPerIo = ios > 0 ? cpuTime.TotalMicroseconds / ios : 0,
+            Rounds = round,
+            MeasuredDuration = duration
+        };
+    }
+
+    private async Task PrepareAsync(string path, long fileSize, CancellationToken cancellationToken)
+    {
+        var prepared = await _engine.PrepareAsync(
+            new PrepareSpec { FilePath = path, FileSize = fileSize, ReuseIfExists = true },
+            cancellationToken: cancellationToken).ConfigureAwait(false);
+
+        foreach (var warning in prepared.Warnings ?? [])
+        {
+            _sink.OnWarning(warning);
+        }
+    }
+
+    private void TryDelete(string path)
+    {
+        try
+        {
+            File.Delete(path);
+            PrepareManifest.Delete(path);
+        }
+        catch (IOException ex)
+        {
+            _sink.OnWarning($"Failed to delete '{path}': {ex.Message}");
+        }
+        catch (UnauthorizedAccessException ex)
+        {
+            _sink.OnWarning($"Failed to delete '{path}': {ex.Message}");
+        }
+    }
+
+    private static void ValidateSpec(ShapeSearchSpec spec)
+    {
+        ArgumentNullException.ThrowIfNull(spec.Workload, nameof(spec));
+
+        foreach (var (name, values) in new[] { ("Block sizes", spec.BlockSizes), ("Queue depths", spec.QueueDepths), ("Thread counts", spec.ThreadCounts) })
+        {
+            if (values.Count == 0 || values.Any(v => v <= 0) || values.Distinct().Count() != values.Count)
+            {
+                throw new ArgumentException($"{name} must be a non-empty list of distinct positive values.", nameof(spec));
+            }
+        }
+
+        if (spec.InitialDuration <= TimeSpan.Zero || spec.WarmupDuration < TimeSpan.Zero)
+        {
+            throw new ArgumentException("Initial duration must be positive and warmup cannot be negative.", nameof(spec));
+        }
+
+        if (spec.Reduction < 2)
+        {
+            throw new ArgumentException($"Reduction must be at least 2: {spec.Reduction}", nameof(spec));
+        }
+
+        if (spec.MaxRounds < 1)
+        {
+            throw new ArgumentException($"Max rounds must be at least 1: {spec.MaxRounds}", nameof(spec));
+        }
+
+        if (!(spec.TargetFraction > 0 && spec.TargetFraction <= 1))
+        {
+            throw new ArgumentException($"Target fraction must be in (0, 1]: {spec.TargetFraction}", nameof(spec));
+        }
+    }
+}
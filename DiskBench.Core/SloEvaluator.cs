@@ -0,0 +1,134 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Evaluates service level objectives over whole trials and over each one-second interval of
+/// their time series, so short violation windows are not averaged away.
+/// </summary>
+public static class SloEvaluator
+{
+    /// <summary>
+    /// Evaluates each objective against a workload's trials.
+    /// </summary>
+    /// <param name="objectives">Objectives to evaluate.</param>
+    /// <param name="trials">The workload's trial results.</param>
+    public static IReadOnlyList<SloResult> Evaluate(IReadOnlyList<ServiceLevelObjective> objectives, IReadOnlyList<TrialResult> trials)
+    {
+        ArgumentNullException.ThrowIfNull(objectives);
+        ArgumentNullException.ThrowIfNull(trials);
+
+        return objectives.Select(o => Evaluate(o, trials)).ToList();
+    }
+
+    /// <summary>
+    /// Evaluates one objective against a workload's trials.
+    /// </summary>
+    /// <param name="objective">Objective to evaluate.</param>
+    /// <param name="trials">The workload's trial results.</param>
+    public static SloResult Evaluate(ServiceLevelObjective objective, IReadOnlyList<TrialResult> trials)
+    {
+        ArgumentNullException.ThrowIfNull(objective);
+        ArgumentNullException.ThrowIfNull(trials);
+
+        bool isLatency = objective.Metric == SloMetric.Latency;
+        double worstTrial = isLatency ? 0 : double.MaxValue;
+        int trialsFailed = 0;
+        int evaluated = 0;
+        int violated = 0;
+        var windows = new List<SloViolationWindow>();
+
+        foreach (var trial in trials)
+        {
+            double value = objective.Metric switch
+            {
+                SloMetric.Latency => trial.Latency.GetPercentile(objective.Percentile),
+                SloMetric.Iops => trial.Iops,
+                _ => trial.BytesPerSecond
+            };
+
+            worstTrial = Worse(objective, worstTrial, value);
+            if (!objective.IsMet(value))
+            {
+                trialsFailed++;
+            }
+
+            if (trial.TimeSeries == null)
+            {
+                continue;
+            }
+
+            // Throughput over the final, partial second is not comparable to a full second's
+            int fullSeconds = (int)trial.Duration.TotalSeconds;
+            SloViolationWindow? open = null;
+
+            foreach (var sample in trial.TimeSeries)
+            {
+                double? interval = objective.Metric switch
+                {
+                    SloMetric.Latency => sample.Latency?.GetPercentile(objective.Percentile),
+                    SloMetric.Iops => sample.SecondOffset < fullSeconds ? sample.Iops : null,
+                    _ => sample.SecondOffset < fullSeconds ? sample.BytesPerSecond : null
+                };
+
+                if (!interval.HasValue)
+                {
+                    continue;
+                }
+
+                evaluated++;
+                if (objective.IsMet(interval.Value))
+                {
+                    open = null;
+                    continue;
+                }
+
+                violated++;
+                if (open != null && open.StartSecond + open.Seconds == sample.SecondOffset)
+                {
+                    open = new SloViolationWindow
+                    {
+                        TrialNumber = trial.TrialNumber,
+                        StartSecond = open.StartSecond,
+                        Seconds = open.Seconds + 1,
+                        WorstValue = Worse(objective, open.WorstValue, interval.Value)
+                    };
+                    windows[^1] = open;
+                }
+                else
+                {
+                    open = new SloViolationWindow
+                    {
+                        TrialNumber = trial.TrialNumber,
+                        StartSecond = sample.SecondOffset,
+                        Seconds = 1,
+                        WorstValue = interval.Value
+                    };
+                    windows.Add(open);
+                }
+            }
+        }
+
+        double? budgetConsumed = null;
+        bool intervalsPass = true;
+        if (objective.IntervalCompliance.HasValue && evaluated > 0)
+        {
+            double allowed = (1.0 - objective.IntervalCompliance.Value) * evaluated;
+            budgetConsumed = allowed > 0 ? violated / allowed : violated > 0 ? 1.0 : 0.0;
+            intervalsPass = violated <= allowed;
+        }
+
+        return new SloResult
+        {
+            Objective = objective,
+            Passed = trials.Count > 0 && trialsFailed == 0 && intervalsPass,
+            WorstTrialValue = trials.Count > 0 ? worstTrial : 0,
+            TrialsFailed = trialsFailed,
+            IntervalsEvaluated = evaluated,
+            IntervalsViolated = violated,
+            ErrorBudgetConsumed = budgetConsumed,
+            Violations = windows
+        };
+    }
+
+    private static double Worse(ServiceLevelObjective objective, double a, double b) =>
+        objective.Metric == SloMetric.Latency ? Math.Max(a, b) : Math.Min(a, b);
+}
@@ -0,0 +1,106 @@
+using DiskBench.Metrics;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Finds anomalous regions in a surface scan. Throughput and latency are compared with the
+/// neighbouring regions rather than the whole surface, so a drive's gradual outer-to-inner
+/// slowdown is reported once as a zone drop-off instead of flagging every inner region.
+/// </summary>
+public static class SurfaceScanAnalysis
+{
+    /// <summary>
+    /// Finds the anomalies of each pass of a scan (all read or all write passes, in offset order).
+    /// </summary>
+    /// <param name="passes">Passes in offset order.</param>
+    /// <param name="spec">Scan specification with the anomaly thresholds.</param>
+    public static IReadOnlyList<SurfaceAnomaly> FindAnomalies(IReadOnlyList<SurfacePass> passes, SurfaceScanSpec spec)
+    {
+        ArgumentNullException.ThrowIfNull(passes);
+        ArgumentNullException.ThrowIfNull(spec);
+
+        var anomalies = new SurfaceAnomaly[passes.Count];
+
+        for (int i = 0; i < passes.Count; i++)
+        {
+            var pass = passes[i];
+            var flags = SurfaceAnomaly.None;
+
+            if (!pass.Complete)
+            {
+                flags |= SurfaceAnomaly.Incomplete;
+            }
+
+            if (pass.Errors is { Failed: > 0 })
+            {
+                flags |= SurfaceAnomaly.Errors;
+            }
+
+            if (pass.Errors is { Retries: > 0 })
+            {
+                flags |= SurfaceAnomaly.Retries;
+            }
+
+            // Incomplete neighbours have unreliable throughput; the last region may be short, which is fine
+            var neighbours = new List<SurfacePass>();
+            int first = Math.Max(0, i - spec.NeighbourRegions);
+            int last = Math.Min(passes.Count - 1, i + spec.NeighbourRegions);
+            for (int n = first; n <= last; n++)
+            {
+                if (n != i && passes[n].Complete)
+                {
+                    neighbours.Add(passes[n]);
+                }
+            }
+
+            if (neighbours.Count >= 2)
+            {
+                double medianThroughput = StatisticalAggregation.Median(neighbours.Select(p => p.BytesPerSecond).ToArray());
+                if (pass.BytesPerSecond < spec.SlowRegionFactor * medianThroughput)
+                {
+                    flags |= SurfaceAnomaly.SlowZone;
+                }
+
+                double medianP99 = StatisticalAggregation.Median(neighbours.Select(p => p.Latency.P99Us).ToArray());
+                if (medianP99 > 0 && pass.Latency.P99Us > spec.HighLatencyFactor * medianP99)
+                {
+                    flags |= SurfaceAnomaly.HighLatency;
+                }
+            }
+
+            anomalies[i] = flags;
+        }
+
+        return anomalies;
+    }
+
+    /// <summary>
+    /// Fits a line to throughput over the complete passes and returns the relative drop from the
+    /// first to the last region (0.3 = 30% slower at the end; negative if it speeds up).
+    /// </summary>
+    /// <param name="passes">Passes in offset order.</param>
+    public static double ZoneDropOff(IReadOnlyList<SurfacePass> passes)
+    {
+        ArgumentNullException.ThrowIfNull(passes);
+
+        var points = passes
+            .Select((p, i) => (X: (double)i, Y: p.BytesPerSecond, p.Complete))
+            .Where(p => p.Complete)
+            .ToList();
+
+        if (points.Count < 2)
+        {
+            return 0;
+        }
+
+        double meanX = points.Average(p => p.X);
+        double meanY = points.Average(p => p.Y);
+        double covariance = points.Sum(p => (p.X - meanX) * (p.Y - meanY));
+        double variance = points.Sum(p => (p.X - meanX) * (p.X - meanX));
+        double slope = covariance / variance;
+
+        double start = meanY + slope * (points[0].X - meanX);
+        double end = meanY + slope * (points[^1].X - meanX);
+        return start > 0 ? 1 - end / start : 0;
+    }
+}
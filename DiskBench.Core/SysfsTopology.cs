@@ -0,0 +1,279 @@
+using System.Globalization;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Reads CPU and block device topology from Linux sysfs and procfs.
+/// </summary>
+public static class SysfsTopology
+{
+    /// <summary>
+    /// Default sysfs mount point.
+    /// </summary>
+    public const string DefaultSysfsRoot = "/sys";
+
+    /// <summary>
+    /// Default procfs mount point.
+    /// </summary>
+    public const string DefaultProcRoot = "/proc";
+
+    /// <summary>
+    /// Reads the topology of the online processors.
+    /// Returns null on platforms other than Linux or when sysfs has no CPU topology.
+    /// </summary>
+    /// <param name="sysfsRoot">sysfs root (for tests).</param>
+    public static CpuTopology? ReadCpus(string sysfsRoot = DefaultSysfsRoot)
+    {
+        if (sysfsRoot == DefaultSysfsRoot && !OperatingSystem.IsLinux())
+        {
+            return null;
+        }
+
+        var cpuRoot = Path.Combine(sysfsRoot, "devices", "system", "cpu");
+        var online = TryReadText(Path.Combine(cpuRoot, "online"));
+        if (online == null)
+        {
+            return null;
+        }
+
+        var nodeOf = new Dictionary<int, int>();
+        var nodeRoot = Path.Combine(sysfsRoot, "devices", "system", "node");
+        if (Directory.Exists(nodeRoot))
+        {
+            foreach (var dir in Directory.GetDirectories(nodeRoot, "node*"))
+            {
+                if (!int.TryParse(Path.GetFileName(dir).AsSpan(4), NumberStyles.None, CultureInfo.InvariantCulture, out int node))
+                {
+                    continue;
+                }
+
+                foreach (var cpu in ParseCpuList(TryReadText(Path.Combine(dir, "cpulist")) ?? string.Empty))
+                {
+                    nodeOf[cpu] = node;
+                }
+            }
+        }
+
+        var processors = new List<LogicalProcessor>();
+        foreach (var cpu in ParseCpuList(online))
+        {
+            var dir = Path.Combine(cpuRoot, string.Create(CultureInfo.InvariantCulture, $"cpu{cpu}"));
+            var topology = Path.Combine(dir, "topology");
+
+            var siblings = ParseCpuList(TryReadText(Path.Combine(topology, "thread_siblings_list")) ?? string.Empty);
+            var package = TryReadText(Path.Combine(topology, "physical_package_id"));
+
+            processors.Add(new LogicalProcessor
+            {
+                Id = cpu,
+                Package = package != null ? int.Parse(package, CultureInfo.InvariantCulture) : 0,
+                Core = siblings.Count > 0 ? siblings.Min() : cpu,
+                NumaNode = nodeOf.GetValueOrDefault(cpu),
+                L3Domain = ReadL3Domain(dir)
+            });
+        }
+
+        return processors.Count > 0 ? new CpuTopology { Processors = [.. processors.OrderBy(p => p.Id)] } : null;
+    }
+
+    /// <summary>
+    /// Finds the block device holding <paramref name="path"/> and reads its NUMA node and the
+    /// processors its interrupts are routed to. Returns null when the path is not on a block device
+    /// (tmpfs, overlay, network filesystems) or on platforms other than Linux.
+    /// </summary>
+    /// <param name="path">File or directory on the device.</param>
+    /// <param name="sysfsRoot">sysfs root (for tests).</param>
+    /// <param name="procRoot">procfs root (for tests).</param>
+    /// <param name="mountsPath">Mount table (for tests).</param>
+    public static DeviceTopology? ReadDevice(
+        string path,
+        string sysfsRoot = DefaultSysfsRoot,
+        string procRoot = DefaultProcRoot,
+        string mountsPath = MountTable.DefaultMountsPath)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(path);
+
+        var blockDir = FindDiskDirectory(path, sysfsRoot, mountsPath);
+        if (blockDir == null)
+        {
+            return null;
+        }
+
+        var deviceDir = ResolveLink(Path.Combine(blockDir, "device"));
+        var numaNode = -1;
+        var interruptCpus = new SortedSet<int>();
+
+        // Walk up from the device towards the bus: the controller (PCI function) has numa_node and msi_irqs
+        var stop = Path.GetFullPath(sysfsRoot);
+        for (var dir = deviceDir; dir != null && Directory.Exists(dir) && dir.Length > stop.Length; dir = Path.GetDirectoryName(dir))
+        {
+            if (numaNode < 0 && TryReadText(Path.Combine(dir, "numa_node")) is { } nodeText)
+            {
+                numaNode = int.Parse(nodeText, CultureInfo.InvariantCulture);
+            }
+
+            var msiDir = Path.Combine(dir, "msi_irqs");
+            if (interruptCpus.Count == 0 && Directory.Exists(msiDir))
+            {
+                foreach (var irq in Directory.GetFiles(msiDir).Select(Path.GetFileName))
+                {
+                    interruptCpus.UnionWith(ReadIrqAffinity(procRoot, irq!));
+                }
+            }
+
+            if (numaNode >= 0 && interruptCpus.Count > 0)
+            {
+                break;
+            }
+        }
+
+        return new DeviceTopology
+        {
+            Device = Path.GetFileName(blockDir),
+            NumaNode = numaNode,
+            InterruptCpus = [.. interruptCpus]
+        };
+    }
+
+    /// <summary>
+    /// Finds the sysfs directory of the disk holding <paramref name="path"/> (the whole disk for a partition).
+    /// Returns null when the path is not on a block device or on platforms other than Linux.
+    /// </summary>
+    /// <param name="path">File or directory on the device.</param>
+    /// <param name="sysfsRoot">sysfs root (for tests).</param>
+    /// <param name="mountsPath">Mount table (for tests).</param>
+    public static string? FindDiskDirectory(
+        string path,
+        string sysfsRoot = DefaultSysfsRoot,
+        string mountsPath = MountTable.DefaultMountsPath)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(path);
+
+        if (sysfsRoot == DefaultSysfsRoot && !OperatingSystem.IsLinux())
+        {
+            return null;
+        }
+
+        var mount = MountTable.Find(path, mountsPath);
+        if (mount == null || !mount.Device.StartsWith("/dev/", StringComparison.Ordinal))
+        {
+            return null;
+        }
+
+        // /dev/mapper/* and /dev/disk/by-* entries are links to the kernel device node
+        var devicePath = mount.Device;
+        if (sysfsRoot == DefaultSysfsRoot)
+        {
+            devicePath = ResolveLink(devicePath);
+        }
+
+        var blockDir = ResolveLink(Path.Combine(sysfsRoot, "class", "block", Path.GetFileName(devicePath)));
+        if (!Directory.Exists(blockDir))
+        {
+            return null;
+        }
+
+        // A partition's parent directory is its disk
+        if (File.Exists(Path.Combine(blockDir, "partition")))
+        {
+            blockDir = Path.GetDirectoryName(blockDir)!;
+        }
+
+        return blockDir;
+    }
+
+    /// <summary>
+    /// Parses a kernel CPU list such as "0-3,8,10-11".
+    /// </summary>
+    /// <param name="list">CPU list text.</param>
+    public static IReadOnlyList<int> ParseCpuList(string list)
+    {
+        ArgumentNullException.ThrowIfNull(list);
+
+        var cpus = new List<int>();
+        foreach (var part in list.Split(',', StringSplitOptions.RemoveEmptyEntries | StringSplitOptions.TrimEntries))
+        {
+            int dash = part.IndexOf('-', StringComparison.Ordinal);
+            if (dash < 0)
+            {
+                cpus.Add(int.Parse(part, CultureInfo.InvariantCulture));
+                continue;
+            }
+
+            int first = int.Parse(part.AsSpan(0, dash), CultureInfo.InvariantCulture);
+            int last = int.Parse(part.AsSpan(dash + 1), CultureInfo.InvariantCulture);
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                cpus.Add(cpu);
+            }
+        }
+
+        return cpus;
+    }
+
+    private static int ReadL3Domain(string cpuDir)
+    {
+        var cacheRoot = Path.Combine(cpuDir, "cache");
+        if (!Directory.Exists(cacheRoot))
+        {
+            return -1;
+        }
+
+        foreach (var index in Directory.GetDirectories(cacheRoot, "index*"))
+        {
+            if (TryReadText(Path.Combine(index, "level")) == "3" &&
+                TryReadText(Path.Combine(index, "shared_cpu_list")) is { } shared)
+            {
+                var cpus = ParseCpuList(shared);
+                return cpus.Count > 0 ? cpus.Min() : -1;
+            }
+        }
+
+        return -1;
+    }
+
+    private static IEnumerable<int> ReadIrqAffinity(string procRoot, string irq)
+    {
+        var irqDir = Path.Combine(procRoot, "irq", irq);
+
+        // effective_affinity_list is where the interrupt actually lands; smp_affinity_list is only the allowed set
+        var list = TryReadText(Path.Combine(irqDir, "effective_affinity_list")) ??
+            TryReadText(Path.Combine(irqDir, "smp_affinity_list"));
+
+        return list != null ? ParseCpuList(list) : [];
+    }
+
+    private static string ResolveLink(string path)
+    {
+        try
+        {
+            FileSystemInfo info = Directory.Exists(path) ? new DirectoryInfo(path) : new FileInfo(path);
+            var target = info.ResolveLinkTarget(returnFinalTarget: true);
+            return target?.FullName ?? path;
+        }
+        catch (IOException)
+        {
+            return path;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return path;
+        }
+    }
+
+    private static string? TryReadText(string path)
+    {
+        try
+        {
+            return File.Exists(path) ? File.ReadAllText(path).Trim() : null;
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+        catch (UnauthorizedAccessException)
+        {
+            return null;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+namespace DiskBench.Core;
+
+/// <summary>
+/// Chooses processors for IO worker threads from the CPU and device topology.
+/// Workers go on the device's NUMA node, one per physical core, away from the cores that service
+/// the device's interrupts and from CPU 0's core (where most housekeeping runs). When there are not
+/// enough such processors the planner relaxes those rules in reverse order and records each compromise.
+/// </summary>
+public static class WorkerPlacementPlanner
+{
+    /// <summary>
+    /// Plans a placement for <paramref name="workers"/> IO threads.
+    /// </summary>
+    /// <param name="topology">CPU topology.</param>
+    /// <param name="workers">Number of worker threads.</param>
+    /// <param name="device">Device topology, if known.</param>
+    public static WorkerPlacement Plan(CpuTopology topology, int workers, DeviceTopology? device = null)
+    {
+        ArgumentNullException.ThrowIfNull(topology);
+        ArgumentOutOfRangeException.ThrowIfLessThan(workers, 1);
+
+        if (topology.Processors.Count == 0)
+        {
+            throw new ArgumentException("Topology has no processors.", nameof(topology));
+        }
+
+        var notes = new List<string>();
+
+        int node = device?.NumaNode ?? -1;
+        if (node >= 0 && !topology.Processors.Any(p => p.NumaNode == node))
+        {
+            notes.Add($"Device NUMA node {node} has no online processors; ignoring it");
+            node = -1;
+        }
+
+        // Cores (not just threads) that take the device's interrupts are avoided entirely
+        var interruptCpus = device?.InterruptCpus ?? [];
+        var interruptCores = topology.Processors
+            .Where(p => interruptCpus.Contains(p.Id))
+            .Select(p => p.Core)
+            .ToHashSet();
+
+        // With per-CPU completion queues (NVMe) every core takes some of the device's interrupts
+        if (interruptCores.Count > 0 && topology.Processors.All(p => interruptCores.Contains(p.Core)))
+        {
+            notes.Add("Device interrupts are spread over every core; none avoided");
+            interruptCores.Clear();
+        }
+
+        int housekeepingCore = topology.Processors[0].Core;
+
+        var ranked = topology.Processors
+            .OrderBy(p => node >= 0 && p.NumaNode != node)
+            .ThenBy(p => !p.IsPrimaryThread)
+            .ThenBy(p => interruptCores.Contains(p.Core))
+            .ThenBy(p => p.Core == housekeepingCore)
+            .ThenBy(p => p.NumaNode)
+            .ThenBy(p => p.L3Domain)
+            .ThenBy(p => p.Id)
+            .ToList();
+
+        var chosen = new List<LogicalProcessor>(workers);
+        for (int i = 0; i < workers; i++)
+        {
+            chosen.Add(ranked[i % ranked.Count]);
+        }
+
+        if (node >= 0)
+        {
+            notes.Add($"Device {device!.Device} is on NUMA node {node}");
+            int offNode = chosen.Count(p => p.NumaNode != node);
+            if (offNode > 0)
+            {
+                notes.Add($"{offNode} worker(s) placed off the device's NUMA node");
+            }
+        }
+
+        int siblings = chosen.Count(p => !p.IsPrimaryThread);
+        if (siblings > 0)
+        {
+            notes.Add($"{siblings} worker(s) share a core with another worker (SMT sibling)");
+        }
+
+        int onInterruptCores = chosen.Count(p => interruptCores.Contains(p.Core));
+        if (onInterruptCores > 0)
+        {
+            notes.Add($"{onInterruptCores} worker(s) placed on a core that services device interrupts");
+        }
+
+        if (workers > ranked.Count)
+        {
+            notes.Add($"{workers} workers exceed {ranked.Count} processors; processors are shared");
+        }
+
+        int domains = chosen.Select(p => p.L3Domain).Distinct().Count();
+        if (domains > 1 && chosen.All(p => p.L3Domain >= 0))
+        {
+            notes.Add($"Workers span {domains} L3 cache domains");
+        }
+
+        return new WorkerPlacement
+        {
+            Cpus = chosen.Select(p => p.Id).ToList(),
+            NumaNode = node,
+            Device = device?.Device,
+            InterruptCpus = interruptCpus,
+            Notes = notes
+        };
+    }
+}
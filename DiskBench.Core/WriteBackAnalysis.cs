@@ -0,0 +1,182 @@
+using System.Diagnostics;
+
+namespace DiskBench.Core;
+
+/// <summary>
+/// Compares what a buffered write trial's application saw with what the device absorbed, using page cache
+/// counters sampled while the trial ran. Data written but not yet on the device shows up as growth of the
+/// dirty and writeback totals, so the device rate is the application rate minus that growth. Write calls
+/// blocked by dirty page throttling are taken from the slow IO log and merged into stall episodes.
+/// </summary>
+public static class WriteBackAnalysis
+{
+    /// <summary>
+    /// Analyses one trial.
+    /// </summary>
+    /// <param name="trial">Trial result, with time series and slow IO log when available.</param>
+    /// <param name="samples">Counter samples in time order, covering the trial.</param>
+    /// <param name="measuredStartTimestamp">Stopwatch timestamp of the measured window start.</param>
+    /// <param name="source">Counter source description.</param>
+    /// <param name="stallThreshold">Write latency at or above which a write counts as stalled.</param>
+    public static WriteBackResult Analyze(
+        TrialResult trial,
+        IReadOnlyList<WriteBackSample> samples,
+        long measuredStartTimestamp,
+        string source,
+        TimeSpan stallThreshold)
+    {
+        ArgumentNullException.ThrowIfNull(trial);
+        ArgumentNullException.ThrowIfNull(samples);
+        ArgumentNullException.ThrowIfNull(source);
+
+        if (samples.Count == 0)
+        {
+            throw new ArgumentException("At least one write-back sample is required", nameof(samples));
+        }
+
+        double ticksPerMicrosecond = Stopwatch.Frequency / 1_000_000.0;
+        long start = measuredStartTimestamp;
+        long end = start + (long)(trial.Duration.TotalSeconds * Stopwatch.Frequency);
+        double seconds = trial.Duration.TotalSeconds;
+        bool hasWriteback = samples.All(s => s.WritebackBytes.HasValue);
+
+        // Time series and totals include reads; mixed workloads use the same block size for both
+        double writeShare = trial.TotalOperations > 0 ? (double)trial.WriteOperations / trial.TotalOperations : 0;
+        double applicationBytes = trial.TotalBytes * writeShare;
+        double pendingGrowth = PendingAt(samples, end) - PendingAt(samples, start);
+
+        long peakDirty = (long)Math.Max(ValueAt(samples, start, s => s.DirtyBytes), ValueAt(samples, end, s => s.DirtyBytes));
+        long? peakWriteback = null;
+        foreach (var sample in samples)
+        {
+            if (sample.Timestamp >= start && sample.Timestamp <= end)
+            {
+                peakDirty = Math.Max(peakDirty, sample.DirtyBytes);
+                if (hasWriteback)
+                {
+                    peakWriteback = Math.Max(peakWriteback ?? 0, sample.WritebackBytes!.Value);
+                }
+            }
+        }
+
+        var intervals = new List<WriteBackInterval>();
+        foreach (var second in trial.TimeSeries ?? [])
+        {
+            long from = start + second.SecondOffset * Stopwatch.Frequency;
+            long to = Math.Min(from + Stopwatch.Frequency, Math.Max(end, from));
+            double written = second.Bytes * writeShare;
+            double growth = PendingAt(samples, to) - PendingAt(samples, from);
+
+            intervals.Add(new WriteBackInterval
+            {
+                SecondOffset = second.SecondOffset,
+                ApplicationBytes = (long)written,
+                DeviceBytes = (long)Math.Max(0, written - growth),
+                DirtyBytes = (long)ValueAt(samples, to, s => s.DirtyBytes),
+                WritebackBytes = hasWriteback ? (long)ValueAt(samples, to, s => s.WritebackBytes!.Value) : null,
+                MaxLatencyUs = second.Latency?.MaxUs
+            });
+        }
+
+        var stalls = FindStalls(trial.SlowIos, samples, start, ticksPerMicrosecond, stallThreshold.TotalMicroseconds, hasWriteback);
+        double durationUs = trial.Duration.TotalMicroseconds;
+        double stalledUs = stalls.Sum(s => Math.Max(0, Math.Min(s.EndUs, durationUs) - Math.Max(s.StartUs, 0)));
+
+        return new WriteBackResult
+        {
+            TrialNumber = trial.TrialNumber,
+            Source = source,
+            ApplicationBytesPerSecond = seconds > 0 ? applicationBytes / seconds : 0,
+            DeviceBytesPerSecond = seconds > 0 ? Math.Max(0, applicationBytes - pendingGrowth) / seconds : 0,
+            StartPendingBytes = (long)PendingAt(samples, start),
+            EndPendingBytes = (long)PendingAt(samples, end),
+            PeakDirtyBytes = peakDirty,
+            PeakWritebackBytes = peakWriteback,
+            Intervals = intervals,
+            Stalls = stalls,
+            StallsTruncated = trial.SlowIos != null && trial.SlowIos.OverThresholdCount > trial.SlowIos.OverThreshold.Count,
+            StallFraction = durationUs > 0 ? Math.Min(1, stalledUs / durationUs) : 0
+        };
+    }
+
+    private static List<WriteStall> FindStalls(
+        SlowIoReport? slowIos,
+        IReadOnlyList<WriteBackSample> samples,
+        long start,
+        double ticksPerMicrosecond,
+        double thresholdUs,
+        bool hasWriteback)
+    {
+        var stalls = new List<WriteStall>();
+        if (slowIos == null)
+        {
+            return stalls;
+        }
+
+        // Writes blocked at the same time belong to one episode: merge overlapping [submit, complete] spans
+        var writes = slowIos.OverThreshold
+            .Where(io => io.IsWrite && io.LatencyUs >= thresholdUs)
+            .OrderBy(io => io.SubmitUs)
+            .ToList();
+
+        int i = 0;
+        while (i < writes.Count)
+        {
+            double startUs = writes[i].SubmitUs;
+            double endUs = writes[i].CompleteUs;
+            double maxLatencyUs = writes[i].LatencyUs;
+            int count = 1;
+
+            while (++i < writes.Count && writes[i].SubmitUs <= endUs)
+            {
+                endUs = Math.Max(endUs, writes[i].CompleteUs);
+                maxLatencyUs = Math.Max(maxLatencyUs, writes[i].LatencyUs);
+                count++;
+            }
+
+            long at = start + (long)(startUs * ticksPerMicrosecond);
+            stalls.Add(new WriteStall
+            {
+                StartUs = startUs,
+                EndUs = endUs,
+                Writes = count,
+                MaxLatencyUs = maxLatencyUs,
+                DirtyBytes = (long)ValueAt(samples, at, s => s.DirtyBytes),
+                WritebackBytes = hasWriteback ? (long)ValueAt(samples, at, s => s.WritebackBytes!.Value) : null
+            });
+        }
+
+        return stalls;
+    }
+
+    private static double PendingAt(IReadOnlyList<WriteBackSample> samples, long timestamp)
+    {
+        return ValueAt(samples, timestamp, s => s.PendingBytes);
+    }
+
+    /// <summary>
+    /// Linearly interpolates a counter between the samples either side of a timestamp,
+    /// holding the first or last value outside the sampled range.
+    /// </summary>
+    private static double ValueAt(IReadOnlyList<WriteBackSample> samples, long timestamp, Func<WriteBackSample, double> value)
+    {
+        if (timestamp <= samples[0].Timestamp)
+        {
+            return value(samples[0]);
+        }
+
+        for (int i = 1; i < samples.Count; i++)
+        {
+            if (timestamp <= samples[i].Timestamp)
+            {
+                var before = samples[i - 1];
+                var after = samples[i];
+                long span = after.Timestamp - before.Timestamp;
+                double fraction = span > 0 ? (double)(timestamp - before.Timestamp) / span : 1;
+                return value(before) + (value(after) - value(before)) * fraction;
+            }
+        }
+
+        return value(samples[^1]);
+    }
+}
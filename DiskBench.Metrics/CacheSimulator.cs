@@ -0,0 +1,419 @@
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// Cache replacement policy simulated by a <see cref="CacheSimulator"/>.
+/// </summary>
+public enum CachePolicy
+{
+    /// <summary>
+    /// Least recently used.
+    /// </summary>
+    Lru,
+
+    /// <summary>
+    /// CLOCK (second chance): an approximation of LRU with one reference bit per block.
+    /// </summary>
+    Clock,
+
+    /// <summary>
+    /// 2Q: new blocks enter a small FIFO and are promoted to an LRU only when re-referenced
+    /// after leaving it, so one-time scans do not flush the hot set.
+    /// </summary>
+    TwoQueue,
+
+    /// <summary>
+    /// Adaptive Replacement Cache: balances recency and frequency lists using ghost hits.
+    /// </summary>
+    Arc
+}
+
+/// <summary>
+/// Simulates a block cache of fixed capacity. Blocks are identified by number (offset / block size).
+/// Hits and evictions reuse list nodes, so a simulator only allocates while it fills up.
+/// </summary>
+public abstract class CacheSimulator
+{
+    /// <summary>
+    /// Creates a simulator.
+    /// </summary>
+    /// <param name="capacity">Capacity in blocks.</param>
+    protected CacheSimulator(long capacity)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(capacity);
+        Capacity = capacity;
+    }
+
+    /// <summary>
+    /// Capacity in blocks.
+    /// </summary>
+    public long Capacity { get; }
+
+    /// <summary>
+    /// Number of blocks currently cached.
+    /// </summary>
+    public abstract long Count { get; }
+
+    /// <summary>
+    /// References a block, caching it on a miss.
+    /// </summary>
+    /// <param name="block">Block number.</param>
+    /// <returns>True on a hit.</returns>
+    public abstract bool Access(long block);
+
+    /// <summary>
+    /// Gets a list node for a block, reusing a released node when one is available.
+    /// </summary>
+    /// <param name="free">Released nodes.</param>
+    /// <param name="block">Block number.</param>
+    protected static LinkedListNode<long> RentNode(Stack<LinkedListNode<long>> free, long block)
+    {
+        ArgumentNullException.ThrowIfNull(free);
+
+        if (free.TryPop(out var node))
+        {
+            node.Value = block;
+            return node;
+        }
+
+        return new LinkedListNode<long>(block);
+    }
+
+    /// <summary>
+    /// Creates a simulator for a policy.
+    /// </summary>
+    /// <param name="policy">Replacement policy.</param>
+    /// <param name="capacity">Capacity in blocks.</param>
+    public static CacheSimulator Create(CachePolicy policy, long capacity) => policy switch
+    {
+        CachePolicy.Lru => new LruCacheSimulator(capacity),
+        CachePolicy.Clock => new ClockCacheSimulator(capacity),
+        CachePolicy.TwoQueue => new TwoQueueCacheSimulator(capacity),
+        CachePolicy.Arc => new ArcCacheSimulator(capacity),
+        _ => throw new ArgumentOutOfRangeException(nameof(policy), policy, "Unknown cache policy.")
+    };
+}
+
+/// <summary>
+/// Least recently used cache.
+/// </summary>
+public sealed class LruCacheSimulator : CacheSimulator
+{
+    private readonly LinkedList<long> _lru = new();
+    private readonly Dictionary<long, LinkedListNode<long>> _map = [];
+
+    /// <summary>
+    /// Creates an LRU cache.
+    /// </summary>
+    /// <param name="capacity">Capacity in blocks.</param>
+    public LruCacheSimulator(long capacity) : base(capacity)
+    {
+    }
+
+    /// <inheritdoc />
+    public override long Count => _map.Count;
+
+    /// <inheritdoc />
+    public override bool Access(long block)
+    {
+        if (_map.TryGetValue(block, out var node))
+        {
+            _lru.Remove(node);
+            _lru.AddFirst(node);
+            return true;
+        }
+
+        if (_map.Count < Capacity)
+        {
+            _map[block] = _lru.AddFirst(block);
+            return false;
+        }
+
+        // Reuse the evicted node for the new block
+        node = _lru.Last!;
+        _lru.RemoveLast();
+        _map.Remove(node.Value);
+        node.Value = block;
+        _lru.AddFirst(node);
+        _map[block] = node;
+        return false;
+    }
+}
+
+/// <summary>
+/// CLOCK (second chance) cache. New blocks start unreferenced, so a block must be hit
+/// before it survives a pass of the hand.
+/// </summary>
+public sealed class ClockCacheSimulator : CacheSimulator
+{
+    private const int InitialSlots = 4096;
+
+    private readonly Dictionary<long, int> _map = [];
+    private long[] _blocks;
+    private bool[] _referenced;
+    private int _count;
+    private int _hand;
+
+    /// <summary>
+    /// Creates a CLOCK cache.
+    /// </summary>
+    /// <param name="capacity">Capacity in blocks.</param>
+    public ClockCacheSimulator(long capacity) : base(capacity)
+    {
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(capacity, Array.MaxLength);
+
+        // Slots grow with the cache, so a large simulated cache that never fills stays small
+        int initial = (int)Math.Min(capacity, InitialSlots);
+        _blocks = new long[initial];
+        _referenced = new bool[initial];
+    }
+
+    /// <inheritdoc />
+    public override long Count => _count;
+
+    /// <inheritdoc />
+    public override bool Access(long block)
+    {
+        if (_map.TryGetValue(block, out int slot))
+        {
+            _referenced[slot] = true;
+            return true;
+        }
+
+        if (_count < Capacity)
+        {
+            if (_count == _blocks.Length)
+            {
+                int size = (int)Math.Min(Capacity, (long)_blocks.Length * 2);
+                Array.Resize(ref _blocks, size);
+                Array.Resize(ref _referenced, size);
+            }
+
+            slot = _count++;
+        }
+        else
+        {
+            while (_referenced[_hand])
+            {
+                _referenced[_hand] = false;
+                _hand = _hand + 1 == _count ? 0 : _hand + 1;
+            }
+
+            slot = _hand;
+            _hand = _hand + 1 == _count ? 0 : _hand + 1;
+            _map.Remove(_blocks[slot]);
+        }
+
+        _blocks[slot] = block;
+        _referenced[slot] = false;
+        _map[block] = slot;
+        return false;
+    }
+}
+
+/// <summary>
+/// Full 2Q cache (Johnson and Shasha): a FIFO of new blocks (A1in, 25% of capacity), a ghost FIFO
+/// of block numbers recently evicted from it (A1out, 50% of capacity), and an LRU of blocks
+/// re-referenced after leaving A1in (Am).
+/// </summary>
+public sealed class TwoQueueCacheSimulator : CacheSimulator
+{
+    private readonly LinkedList<long> _in = new();
+    private readonly LinkedList<long> _out = new();
+    private readonly LinkedList<long> _main = new();
+    private readonly Dictionary<long, LinkedListNode<long>> _map = [];
+    private readonly Stack<LinkedListNode<long>> _free = new();
+    private readonly long _inCapacity;
+    private readonly long _outCapacity;
+
+    /// <summary>
+    /// Creates a 2Q cache.
+    /// </summary>
+    /// <param name="capacity">Capacity in blocks.</param>
+    public TwoQueueCacheSimulator(long capacity) : base(capacity)
+    {
+        _inCapacity = Math.Max(1, capacity / 4);
+        _outCapacity = Math.Max(1, capacity / 2);
+    }
+
+    /// <inheritdoc />
+    public override long Count => _in.Count + _main.Count;
+
+    /// <inheritdoc />
+    public override bool Access(long block)
+    {
+        if (_map.TryGetValue(block, out var node))
+        {
+            if (node.List == _main)
+            {
+                _main.Remove(node);
+                _main.AddFirst(node);
+                return true;
+            }
+
+            if (node.List == _in)
+            {
+                // Correlated references while in A1in do not promote
+                return true;
+            }
+
+            // Ghost hit: the block was seen recently enough to belong in the main LRU
+            _out.Remove(node);
+            Reclaim();
+            _main.AddFirst(node);
+            return false;
+        }
+
+        Reclaim();
+        node = RentNode(_free, block);
+        _map[block] = node;
+        _in.AddFirst(node);
+        return false;
+    }
+
+    private void Reclaim()
+    {
+        if (Count < Capacity)
+        {
+            return;
+        }
+
+        if (_in.Count > _inCapacity || _main.Count == 0)
+        {
+            // Demote the oldest A1in block to a ghost entry
+            var victim = _in.Last!;
+            _in.RemoveLast();
+            _out.AddFirst(victim);
+
+            if (_out.Count > _outCapacity)
+            {
+                var ghost = _out.Last!;
+                _out.RemoveLast();
+                _map.Remove(ghost.Value);
+                _free.Push(ghost);
+            }
+
+            return;
+        }
+
+        var evicted = _main.Last!;
+        _main.RemoveLast();
+        _map.Remove(evicted.Value);
+        _free.Push(evicted);
+    }
+}
+
+/// <summary>
+/// Adaptive Replacement Cache (Megiddo and Modha). T1 holds blocks seen once recently and T2 blocks
+/// seen at least twice; ghost lists B1 and B2 remember recent evictions from each and steer the
+/// target size of T1.
+/// </summary>
+public sealed class ArcCacheSimulator : CacheSimulator
+{
+    private readonly LinkedList<long> _t1 = new();
+    private readonly LinkedList<long> _t2 = new();
+    private readonly LinkedList<long> _b1 = new();
+    private readonly LinkedList<long> _b2 = new();
+    private readonly Dictionary<long, LinkedListNode<long>> _map = [];
+    private readonly Stack<LinkedListNode<long>> _free = new();
+    private double _target;
+
+    /// <summary>
+    /// Creates an ARC cache.
+    /// </summary>
+    /// <param name="capacity">Capacity in blocks.</param>
+    public ArcCacheSimulator(long capacity) : base(capacity)
+    {
+    }
+
+    /// <inheritdoc />
+    public override long Count => _t1.Count + _t2.Count;
+
+    /// <summary>
+    /// Current target size of T1 in blocks (the adaptation parameter p).
+    /// </summary>
+    public double Target => _target;
+
+    /// <inheritdoc />
+    public override bool Access(long block)
+    {
+        if (_map.TryGetValue(block, out var node))
+        {
+            var list = node.List;
+            if (list == _t1 || list == _t2)
+            {
+                list.Remove(node);
+                _t2.AddFirst(node);
+                return true;
+            }
+
+            if (list == _b1)
+            {
+                _target = Math.Min(Capacity, _target + Math.Max((double)_b2.Count / _b1.Count, 1));
+                Replace(false);
+            }
+            else
+            {
+                _target = Math.Max(0, _target - Math.Max((double)_b1.Count / _b2.Count, 1));
+                Replace(true);
+            }
+
+            list!.Remove(node);
+            _t2.AddFirst(node);
+            return false;
+        }
+
+        long l1 = _t1.Count + _b1.Count;
+        long total = l1 + _t2.Count + _b2.Count;
+
+        if (l1 == Capacity)
+        {
+            if (_t1.Count < Capacity)
+            {
+                RemoveLast(_b1);
+                Replace(false);
+            }
+            else
+            {
+                RemoveLast(_t1);
+            }
+        }
+        else if (total >= Capacity)
+        {
+            if (total >= 2 * Capacity)
+            {
+                RemoveLast(_b2);
+            }
+
+            Replace(false);
+        }
+
+        node = RentNode(_free, block);
+        _t1.AddFirst(node);
+        _map[block] = node;
+        return false;
+    }
+
+    private void Replace(bool inB2)
+    {
+        if (_t1.Count > 0 && (_t1.Count > _target || (inB2 && _t1.Count == (long)_target)))
+        {
+            var node = _t1.Last!;
+            _t1.RemoveLast();
+            _b1.AddFirst(node);
+        }
+        else if (_t2.Count > 0)
+        {
+            var node = _t2.Last!;
+            _t2.RemoveLast();
+            _b2.AddFirst(node);
+        }
+    }
+
+    private void RemoveLast(LinkedList<long> list)
+    {
+        var node = list.Last!;
+        list.RemoveLast();
+        _map.Remove(node.Value);
+        _free.Push(node);
+    }
+}
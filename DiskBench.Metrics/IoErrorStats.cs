@@ -0,0 +1,122 @@
+using System.Runtime.CompilerServices;
+
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// Error and retry counters for a trial, with a latency histogram for IOs that needed retries.
+/// Allocation-free after construction.
+/// </summary>
+public sealed class IoErrorStats
+{
+    private readonly LatencyHistogram _retryLatency = new();
+
+    private long _errors;
+    private long _retries;
+    private long _recovered;
+    private long _failed;
+    private long _shortTransfers;
+    private long _injectedFaults;
+    private int _firstErrorCode;
+
+    /// <summary>
+    /// Gets the number of failed IO attempts (including ones later recovered by a retry).
+    /// </summary>
+    public long Errors => this._errors;
+
+    /// <summary>
+    /// Gets the number of retries issued.
+    /// </summary>
+    public long Retries => this._retries;
+
+    /// <summary>
+    /// Gets the number of IOs that failed at least once and then succeeded on retry.
+    /// </summary>
+    public long Recovered => this._recovered;
+
+    /// <summary>
+    /// Gets the number of IOs that still failed after all retries.
+    /// </summary>
+    public long Failed => this._failed;
+
+    /// <summary>
+    /// Gets the number of IOs that transferred fewer bytes than requested.
+    /// </summary>
+    public long ShortTransfers => this._shortTransfers;
+
+    /// <summary>
+    /// Gets the number of injected faults applied.
+    /// </summary>
+    public long InjectedFaults => this._injectedFaults;
+
+    /// <summary>
+    /// Gets the error code of the first failure (0 if none).
+    /// </summary>
+    public int FirstErrorCode => this._firstErrorCode;
+
+    /// <summary>
+    /// Gets the latency histogram of recovered IOs, measured from first submit to final completion.
+    /// </summary>
+    public LatencyHistogram RetryLatency => this._retryLatency;
+
+    /// <summary>
+    /// Records a failed IO attempt.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordError(int errorCode)
+    {
+        if (this._errors++ == 0)
+        {
+            this._firstErrorCode = errorCode;
+        }
+    }
+
+    /// <summary>
+    /// Records a retry being issued.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordRetry() => this._retries++;
+
+    /// <summary>
+    /// Records an IO that succeeded after one or more retries.
+    /// </summary>
+    /// <param name="totalLatencyTicks">Latency from first submit to final completion.</param>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordRecovered(long totalLatencyTicks)
+    {
+        this._recovered++;
+        this._retryLatency.RecordLatencyTicks(totalLatencyTicks);
+    }
+
+    /// <summary>
+    /// Records an IO that exhausted its retries.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordFailed() => this._failed++;
+
+    /// <summary>
+    /// Records a short transfer.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordShortTransfer() => this._shortTransfers++;
+
+    /// <summary>
+    /// Records an injected fault.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordInjectedFault() => this._injectedFaults++;
+
+    /// <summary>
+    /// Resets all counters.
+    /// </summary>
+    public void Reset()
+    {
+        this._retryLatency.Reset();
+        this._errors = 0;
+        this._retries = 0;
+        this._recovered = 0;
+        this._failed = 0;
+        this._shortTransfers = 0;
+        this._injectedFaults = 0;
+        this._firstErrorCode = 0;
+    }
+}
@@ -0,0 +1,182 @@
+using System.Buffers.Binary;
+using System.IO.Compression;
+using System.Runtime.CompilerServices;
+
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// Layout and column encodings of the columnar IO trace format.
+/// </summary>
+/// <remarks>
+/// File layout (little-endian):
+/// <code>
+/// header   "DBTRACE1"
+/// blocks   per block, the six columns back to back, each compressed separately
+/// index    per block: record count, write count, file offset, compressed and raw length of each column,
+///          min/max submit time, offset and latency
+/// trailer  start timestamp, Stopwatch frequency, index offset, block count, "DBTRIDX1"
+/// </code>
+/// Submit times, offsets, sizes and thread ids are delta-encoded (consecutive IOs are close in time and,
+/// for sequential workloads, in offset), latencies are stored as they are, and all are zigzag varints.
+/// Read/write flags are packed eight to a byte. Each column is then deflated on its own, so a query
+/// inflates only the columns it filters or aggregates on, and only in blocks whose min/max overlap the filter.
+/// </remarks>
+internal static class IoTraceFormat
+{
+    public const int ColumnCount = 6;
+
+    public const int HeaderSize = 8;
+
+    public const int TrailerSize = 40;
+
+    public const int IndexEntrySize = 4 + 4 + 8 + (ColumnCount * 8) + (6 * 8);
+
+    public static ReadOnlySpan<byte> HeaderMagic => "DBTRACE1"u8;
+
+    public static ReadOnlySpan<byte> TrailerMagic => "DBTRIDX1"u8;
+
+    /// <summary>
+    /// Appends a zigzag varint.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static int WriteVarint(Span<byte> destination, long value)
+    {
+        ulong v = (ulong)((value << 1) ^ (value >> 63));
+        int written = 0;
+        while (v >= 0x80)
+        {
+            destination[written++] = (byte)(v | 0x80);
+            v >>= 7;
+        }
+
+        destination[written++] = (byte)v;
+        return written;
+    }
+
+    /// <summary>
+    /// Reads a zigzag varint, advancing <paramref name="position"/>.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static long ReadVarint(ReadOnlySpan<byte> source, ref int position)
+    {
+        ulong v = 0;
+        int shift = 0;
+        byte b;
+        do
+        {
+            if (shift > 63 || position >= source.Length)
+            {
+                throw new InvalidDataException("Corrupt varint in IO trace column.");
+            }
+
+            b = source[position++];
+            v |= (ulong)(b & 0x7F) << shift;
+            shift += 7;
+        }
+        while (b >= 0x80);
+
+        return (long)(v >> 1) ^ -(long)(v & 1);
+    }
+
+    /// <summary>
+    /// Delta-encodes values into zigzag varints.
+    /// </summary>
+    public static int EncodeDeltas(ReadOnlySpan<long> values, Span<byte> destination)
+    {
+        int written = 0;
+        long previous = 0;
+        foreach (long value in values)
+        {
+            written += WriteVarint(destination[written..], value - previous);
+            previous = value;
+        }
+
+        return written;
+    }
+
+    /// <summary>
+    /// Encodes values as zigzag varints.
+    /// </summary>
+    public static int EncodeValues(ReadOnlySpan<long> values, Span<byte> destination)
+    {
+        int written = 0;
+        foreach (long value in values)
+        {
+            written += WriteVarint(destination[written..], value);
+        }
+
+        return written;
+    }
+
+    /// <summary>
+    /// Decodes delta-encoded zigzag varints.
+    /// </summary>
+    public static void DecodeDeltas(ReadOnlySpan<byte> source, Span<long> values)
+    {
+        int position = 0;
+        long previous = 0;
+        for (int i = 0; i < values.Length; i++)
+        {
+            previous += ReadVarint(source, ref position);
+            values[i] = previous;
+        }
+    }
+
+    /// <summary>
+    /// Decodes zigzag varints.
+    /// </summary>
+    public static void DecodeValues(ReadOnlySpan<byte> source, Span<long> values)
+    {
+        int position = 0;
+        for (int i = 0; i < values.Length; i++)
+        {
+            values[i] = ReadVarint(source, ref position);
+        }
+    }
+
+    /// <summary>
+    /// Deflates <paramref name="raw"/> into <paramref name="output"/>, replacing its contents.
+    /// </summary>
+    public static void Compress(ReadOnlySpan<byte> raw, MemoryStream output)
+    {
+        output.SetLength(0);
+        using var deflate = new DeflateStream(output, CompressionLevel.Fastest, leaveOpen: true);
+        deflate.Write(raw);
+    }
+
+    /// <summary>
+    /// Inflates a column into <paramref name="raw"/>, which must be exactly the raw column length.
+    /// </summary>
+    public static void Decompress(byte[] compressed, int compressedLength, Span<byte> raw)
+    {
+        using var input = new MemoryStream(compressed, 0, compressedLength, writable: false);
+        using var deflate = new DeflateStream(input, CompressionMode.Decompress);
+        deflate.ReadExactly(raw);
+    }
+
+    public static void WriteInt64(Span<byte> destination, ref int position, long value)
+    {
+        BinaryPrimitives.WriteInt64LittleEndian(destination[position..], value);
+        position += 8;
+    }
+
+    public static void WriteInt32(Span<byte> destination, ref int position, int value)
+    {
+        BinaryPrimitives.WriteInt32LittleEndian(destination[position..], value);
+        position += 4;
+    }
+
+    public static long ReadInt64(ReadOnlySpan<byte> source, ref int position)
+    {
+        long value = BinaryPrimitives.ReadInt64LittleEndian(source[position..]);
+        position += 8;
+        return value;
+    }
+
+    public static int ReadInt32(ReadOnlySpan<byte> source, ref int position)
+    {
+        int value = BinaryPrimitives.ReadInt32LittleEndian(source[position..]);
+        position += 4;
+        return value;
+    }
+}
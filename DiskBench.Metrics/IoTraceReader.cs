@@ -0,0 +1,518 @@
+using System.Diagnostics;
+using Microsoft.Win32.SafeHandles;
+
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// Selects traced IOs. Unset bounds do not filter.
+/// </summary>
+public sealed record IoTraceFilter
+{
+    /// <summary>
+    /// Earliest submit time, relative to the start of the trace (inclusive).
+    /// </summary>
+    public TimeSpan? From { get; init; }
+
+    /// <summary>
+    /// Latest submit time, relative to the start of the trace (exclusive).
+    /// </summary>
+    public TimeSpan? To { get; init; }
+
+    /// <summary>
+    /// Lowest file offset (inclusive).
+    /// </summary>
+    public long? MinOffset { get; init; }
+
+    /// <summary>
+    /// Highest file offset (exclusive).
+    /// </summary>
+    public long? MaxOffset { get; init; }
+
+    /// <summary>
+    /// Only IOs at or above this latency.
+    /// </summary>
+    public TimeSpan? MinLatency { get; init; }
+
+    /// <summary>
+    /// Only writes (true) or only reads (false).
+    /// </summary>
+    public bool? IsWrite { get; init; }
+}
+
+/// <summary>
+/// Index entry for one block of a trace: record count and the min/max of the indexed columns.
+/// </summary>
+public sealed class IoTraceBlock
+{
+    internal IoTraceBlock(long fileOffset, int[] compressedLengths, int[] rawLengths)
+    {
+        this.ColumnOffsets = new long[compressedLengths.Length];
+        long offset = fileOffset;
+        for (int c = 0; c < compressedLengths.Length; c++)
+        {
+            this.ColumnOffsets[c] = offset;
+            offset += compressedLengths[c];
+        }
+
+        this.CompressedLengths = compressedLengths;
+        this.RawLengths = rawLengths;
+        this.EndOffset = offset;
+    }
+
+    /// <summary>
+    /// Number of IOs in the block.
+    /// </summary>
+    public required int Count { get; init; }
+
+    /// <summary>
+    /// Number of writes in the block.
+    /// </summary>
+    public required int WriteCount { get; init; }
+
+    /// <summary>
+    /// Earliest submit time in ticks from the start of the trace.
+    /// </summary>
+    public required long MinSubmitTicks { get; init; }
+
+    /// <summary>
+    /// Latest submit time in ticks from the start of the trace.
+    /// </summary>
+    public required long MaxSubmitTicks { get; init; }
+
+    /// <summary>
+    /// Lowest file offset.
+    /// </summary>
+    public required long MinOffset { get; init; }
+
+    /// <summary>
+    /// Highest file offset.
+    /// </summary>
+    public required long MaxOffset { get; init; }
+
+    /// <summary>
+    /// Lowest latency in ticks.
+    /// </summary>
+    public required long MinLatencyTicks { get; init; }
+
+    /// <summary>
+    /// Highest latency in ticks.
+    /// </summary>
+    public required long MaxLatencyTicks { get; init; }
+
+    internal long[] ColumnOffsets { get; }
+
+    internal int[] CompressedLengths { get; }
+
+    internal int[] RawLengths { get; }
+
+    internal long EndOffset { get; }
+}
+
+/// <summary>
+/// Latency histogram of the IOs matching a filter, and how much of the trace had to be decoded for it.
+/// </summary>
+public sealed class IoTraceAggregate
+{
+    /// <summary>
+    /// Latency histogram of matching IOs, in local Stopwatch ticks.
+    /// </summary>
+    public required HistogramSnapshot Latency { get; init; }
+
+    /// <summary>
+    /// Number of matching IOs.
+    /// </summary>
+    public long Count => this.Latency.Count;
+
+    /// <summary>
+    /// Blocks decoded.
+    /// </summary>
+    public required int BlocksScanned { get; init; }
+
+    /// <summary>
+    /// Blocks ruled out by the index without decoding.
+    /// </summary>
+    public required int BlocksSkipped { get; init; }
+}
+
+/// <summary>
+/// Reads and queries a columnar IO trace written by <see cref="IoTraceWriter"/>.
+/// </summary>
+/// <remarks>
+/// Queries consult each block's min/max index first: blocks outside the filter are skipped unread, and for
+/// blocks entirely inside a bound that column is not decoded. Aggregation inflates only the latency column
+/// plus the columns a filter actually has to test, and decodes blocks in parallel.
+/// </remarks>
+public sealed class IoTraceReader : IDisposable
+{
+    private readonly SafeFileHandle _handle;
+    private readonly IoTraceBlock[] _blocks;
+
+    /// <summary>
+    /// Opens a trace file.
+    /// </summary>
+    /// <param name="path">Trace file path.</param>
+    /// <exception cref="InvalidDataException">The file is not a complete IO trace.</exception>
+    public IoTraceReader(string path)
+    {
+        ArgumentException.ThrowIfNullOrEmpty(path);
+
+        this._handle = File.OpenHandle(path, FileMode.Open, FileAccess.Read, FileShare.Read, FileOptions.RandomAccess);
+        try
+        {
+            this._blocks = this.ReadIndex(path);
+        }
+        catch
+        {
+            this._handle.Dispose();
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Gets the Stopwatch timestamp submit times are measured from.
+    /// </summary>
+    public long StartTimestamp { get; private set; }
+
+    /// <summary>
+    /// Gets the tick frequency of recorded times.
+    /// </summary>
+    public long Frequency { get; private set; }
+
+    /// <summary>
+    /// Gets the number of traced IOs.
+    /// </summary>
+    public long Count { get; private set; }
+
+    /// <summary>
+    /// Gets the block index.
+    /// </summary>
+    public IReadOnlyList<IoTraceBlock> Blocks => this._blocks;
+
+    /// <summary>
+    /// Converts trace ticks to a time span.
+    /// </summary>
+    /// <param name="ticks">Ticks at the trace's <see cref="Frequency"/>.</param>
+    public TimeSpan ToTimeSpan(long ticks) => TimeSpan.FromSeconds((double)ticks / this.Frequency);
+
+    /// <summary>
+    /// Reads the IOs matching a filter, in trace order.
+    /// </summary>
+    /// <param name="filter">Filter (null = all IOs).</param>
+    public IEnumerable<IoTraceRecord> Read(IoTraceFilter? filter = null)
+    {
+        var bounds = this.Resolve(filter);
+        var decoder = new BlockDecoder(this._handle);
+        foreach (var block in this._blocks)
+        {
+            if (bounds.Classify(block) == Coverage.None)
+            {
+                continue;
+            }
+
+            var submit = decoder.Decode(block, Column.Submit);
+            var offset = decoder.Decode(block, Column.Offset);
+            var size = decoder.Decode(block, Column.Size);
+            var op = decoder.Decode(block, Column.Op);
+            var latency = decoder.Decode(block, Column.Latency);
+            var thread = decoder.Decode(block, Column.Thread);
+            for (int i = 0; i < block.Count; i++)
+            {
+                if (bounds.Matches(submit[i], offset[i], latency[i], op[i] != 0))
+                {
+                    yield return new IoTraceRecord(offset[i], (int)size[i], op[i] != 0, submit[i], latency[i], (int)thread[i]);
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Builds the latency histogram of the IOs matching a filter.
+    /// </summary>
+    /// <param name="filter">Filter (null = all IOs).</param>
+    /// <param name="maxDegreeOfParallelism">Maximum blocks decoded at once (-1 = one per processor).</param>
+    public IoTraceAggregate Aggregate(IoTraceFilter? filter = null, int maxDegreeOfParallelism = -1)
+    {
+        var bounds = this.Resolve(filter);
+        var candidates = new List<(IoTraceBlock Block, Coverage Coverage)>();
+        foreach (var block in this._blocks)
+        {
+            var coverage = bounds.Classify(block);
+            if (coverage != Coverage.None)
+            {
+                candidates.Add((block, coverage));
+            }
+        }
+
+        // Latencies go into a histogram at the local Stopwatch frequency
+        double scale = (double)Stopwatch.Frequency / this.Frequency;
+        var total = new LatencyHistogram();
+        Parallel.ForEach(
+            candidates,
+            new ParallelOptions { MaxDegreeOfParallelism = maxDegreeOfParallelism },
+            () => (Decoder: new BlockDecoder(this._handle), Histogram: new LatencyHistogram()),
+            (candidate, _, local) =>
+            {
+                var (block, coverage) = candidate;
+                var latency = local.Decoder.Decode(block, Column.Latency);
+                var submit = coverage.HasFlag(Coverage.PartialTime) ? local.Decoder.Decode(block, Column.Submit) : null;
+                var offset = coverage.HasFlag(Coverage.PartialOffset) ? local.Decoder.Decode(block, Column.Offset) : null;
+                var op = coverage.HasFlag(Coverage.PartialOp) ? local.Decoder.Decode(block, Column.Op) : null;
+                for (int i = 0; i < block.Count; i++)
+                {
+                    if (latency[i] < bounds.MinLatency
+                        || (submit != null && (submit[i] < bounds.From || submit[i] >= bounds.To))
+                        || (offset != null && (offset[i] < bounds.MinOffset || offset[i] >= bounds.MaxOffset))
+                        || (op != null && (op[i] != 0) != bounds.IsWrite))
+                    {
+                        continue;
+                    }
+
+                    local.Histogram.RecordLatencyTicks(scale == 1.0 ? latency[i] : (long)(latency[i] * scale));
+                }
+
+                return local;
+            },
+            local =>
+            {
+                lock (total)
+                {
+                    total.Merge(local.Histogram);
+                }
+            });
+
+        return new IoTraceAggregate
+        {
+            Latency = total.CreateSnapshot(),
+            BlocksScanned = candidates.Count,
+            BlocksSkipped = this._blocks.Length - candidates.Count
+        };
+    }
+
+    /// <summary>
+    /// Closes the trace file.
+    /// </summary>
+    public void Dispose()
+    {
+        this._handle.Dispose();
+    }
+
+    private IoTraceBlock[] ReadIndex(string path)
+    {
+        long length = RandomAccess.GetLength(this._handle);
+        if (length < IoTraceFormat.HeaderSize + IoTraceFormat.TrailerSize)
+        {
+            throw new InvalidDataException($"Not an IO trace (too short): {path}");
+        }
+
+        Span<byte> header = stackalloc byte[IoTraceFormat.HeaderSize];
+        ReadExactly(this._handle, header, 0);
+        Span<byte> trailer = stackalloc byte[IoTraceFormat.TrailerSize];
+        ReadExactly(this._handle, trailer, length - IoTraceFormat.TrailerSize);
+        if (!header.SequenceEqual(IoTraceFormat.HeaderMagic))
+        {
+            throw new InvalidDataException($"Not an IO trace: {path}");
+        }
+
+        if (!trailer[^8..].SequenceEqual(IoTraceFormat.TrailerMagic))
+        {
+            throw new InvalidDataException($"IO trace is incomplete (the writer was not closed): {path}");
+        }
+
+        int position = 0;
+        this.StartTimestamp = IoTraceFormat.ReadInt64(trailer, ref position);
+        this.Frequency = IoTraceFormat.ReadInt64(trailer, ref position);
+        long indexOffset = IoTraceFormat.ReadInt64(trailer, ref position);
+        long blockCount = IoTraceFormat.ReadInt64(trailer, ref position);
+        if (this.Frequency <= 0 || blockCount < 0 || indexOffset < IoTraceFormat.HeaderSize
+            || indexOffset + (blockCount * IoTraceFormat.IndexEntrySize) != length - IoTraceFormat.TrailerSize)
+        {
+            throw new InvalidDataException($"IO trace index is corrupt: {path}");
+        }
+
+        var index = new byte[blockCount * IoTraceFormat.IndexEntrySize];
+        ReadExactly(this._handle, index, indexOffset);
+
+        var blocks = new IoTraceBlock[blockCount];
+        position = 0;
+        for (int b = 0; b < blocks.Length; b++)
+        {
+            int count = IoTraceFormat.ReadInt32(index, ref position);
+            int writes = IoTraceFormat.ReadInt32(index, ref position);
+            long fileOffset = IoTraceFormat.ReadInt64(index, ref position);
+            var compressed = new int[IoTraceFormat.ColumnCount];
+            var raw = new int[IoTraceFormat.ColumnCount];
+            for (int c = 0; c < IoTraceFormat.ColumnCount; c++)
+            {
+                compressed[c] = IoTraceFormat.ReadInt32(index, ref position);
+                raw[c] = IoTraceFormat.ReadInt32(index, ref position);
+            }
+
+            blocks[b] = new IoTraceBlock(fileOffset, compressed, raw)
+            {
+                Count = count,
+                WriteCount = writes,
+                MinSubmitTicks = IoTraceFormat.ReadInt64(index, ref position),
+                MaxSubmitTicks = IoTraceFormat.ReadInt64(index, ref position),
+                MinOffset = IoTraceFormat.ReadInt64(index, ref position),
+                MaxOffset = IoTraceFormat.ReadInt64(index, ref position),
+                MinLatencyTicks = IoTraceFormat.ReadInt64(index, ref position),
+                MaxLatencyTicks = IoTraceFormat.ReadInt64(index, ref position)
+            };
+
+            if (count <= 0 || fileOffset < IoTraceFormat.HeaderSize || blocks[b].EndOffset > indexOffset)
+            {
+                throw new InvalidDataException($"IO trace block {b} is corrupt: {path}");
+            }
+
+            this.Count += count;
+        }
+
+        return blocks;
+    }
+
+    private Bounds Resolve(IoTraceFilter? filter)
+    {
+        long ToTicks(TimeSpan? time, long unset) =>
+            time.HasValue ? (long)(time.Value.TotalSeconds * this.Frequency) : unset;
+
+        return new Bounds(
+            ToTicks(filter?.From, long.MinValue),
+            ToTicks(filter?.To, long.MaxValue),
+            filter?.MinOffset ?? long.MinValue,
+            filter?.MaxOffset ?? long.MaxValue,
+            ToTicks(filter?.MinLatency, long.MinValue),
+            filter?.IsWrite);
+    }
+
+    private static void ReadExactly(SafeFileHandle handle, Span<byte> buffer, long offset)
+    {
+        while (buffer.Length > 0)
+        {
+            int read = RandomAccess.Read(handle, buffer, offset);
+            if (read == 0)
+            {
+                throw new EndOfStreamException("IO trace ends inside a block.");
+            }
+
+            buffer = buffer[read..];
+            offset += read;
+        }
+    }
+
+    private enum Column
+    {
+        Submit,
+        Offset,
+        Size,
+        Op,
+        Latency,
+        Thread
+    }
+
+    /// <summary>
+    /// How a block relates to a filter: not at all, or which columns must be tested per IO.
+    /// </summary>
+    [Flags]
+    private enum Coverage
+    {
+        None = 0,
+        All = 1,
+        PartialTime = 2,
+        PartialOffset = 4,
+        PartialOp = 8
+    }
+
+    private readonly record struct Bounds(long From, long To, long MinOffset, long MaxOffset, long MinLatency, bool? IsWrite)
+    {
+        public Coverage Classify(IoTraceBlock block)
+        {
+            if (block.MaxSubmitTicks < this.From || block.MinSubmitTicks >= this.To
+                || block.MaxOffset < this.MinOffset || block.MinOffset >= this.MaxOffset
+                || block.MaxLatencyTicks < this.MinLatency
+                || (this.IsWrite == true && block.WriteCount == 0)
+                || (this.IsWrite == false && block.WriteCount == block.Count))
+            {
+                return Coverage.None;
+            }
+
+            var coverage = Coverage.All;
+            if (block.MinSubmitTicks < this.From || block.MaxSubmitTicks >= this.To)
+            {
+                coverage |= Coverage.PartialTime;
+            }
+
+            if (block.MinOffset < this.MinOffset || block.MaxOffset >= this.MaxOffset)
+            {
+                coverage |= Coverage.PartialOffset;
+            }
+
+            if (this.IsWrite.HasValue && block.WriteCount != 0 && block.WriteCount != block.Count)
+            {
+                coverage |= Coverage.PartialOp;
+            }
+
+            return coverage;
+        }
+
+        public bool Matches(long submit, long offset, long latency, bool isWrite) =>
+            submit >= this.From && submit < this.To
+            && offset >= this.MinOffset && offset < this.MaxOffset
+            && latency >= this.MinLatency
+            && (this.IsWrite == null || this.IsWrite == isWrite);
+    }
+
+    /// <summary>
+    /// Per-thread buffers for inflating and decoding columns.
+    /// </summary>
+    private sealed class BlockDecoder(SafeFileHandle handle)
+    {
+        private readonly long[][] _columns = new long[IoTraceFormat.ColumnCount][];
+        private byte[] _compressed = [];
+        private byte[] _raw = [];
+
+        public long[] Decode(IoTraceBlock block, Column column)
+        {
+            int c = (int)column;
+            int compressedLength = block.CompressedLengths[c];
+            int rawLength = block.RawLengths[c];
+            if (this._compressed.Length < compressedLength)
+            {
+                this._compressed = new byte[compressedLength];
+            }
+
+            if (this._raw.Length < rawLength)
+            {
+                this._raw = new byte[rawLength];
+            }
+
+            if (this._columns[c] == null || this._columns[c].Length < block.Count)
+            {
+                this._columns[c] = new long[block.Count];
+            }
+
+            ReadExactly(handle, this._compressed.AsSpan(0, compressedLength), block.ColumnOffsets[c]);
+            var raw = this._raw.AsSpan(0, rawLength);
+            IoTraceFormat.Decompress(this._compressed, compressedLength, raw);
+
+            var values = this._columns[c].AsSpan(0, block.Count);
+            switch (column)
+            {
+                case Column.Op:
+                    for (int i = 0; i < values.Length; i++)
+                    {
+                        values[i] = (raw[i >> 3] >> (i & 7)) & 1;
+                    }
+
+                    break;
+                case Column.Latency:
+                    IoTraceFormat.DecodeValues(raw, values);
+                    break;
+                default:
+                    IoTraceFormat.DecodeDeltas(raw, values);
+                    break;
+            }
+
+            return this._columns[c];
+        }
+    }
+}
@@ -0,0 +1,293 @@
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// A single traced IO. Times are in Stopwatch ticks of the tracing machine.
+/// </summary>
+/// <param name="Offset">File offset of the IO.</param>
+/// <param name="Size">Bytes transferred.</param>
+/// <param name="IsWrite">Whether the IO was a write.</param>
+/// <param name="SubmitTicks">When the IO was first submitted, relative to the start of the trace (negative if before it).</param>
+/// <param name="LatencyTicks">Time from first submission to completion.</param>
+/// <param name="Thread">Id of the thread that completed the IO.</param>
+[StructLayout(LayoutKind.Auto)]
+public readonly record struct IoTraceRecord(
+    long Offset,
+    int Size,
+    bool IsWrite,
+    long SubmitTicks,
+    long LatencyTicks,
+    int Thread);
+
+/// <summary>
+/// Writes a per-IO trace in a columnar, block-compressed format (see <see cref="IoTraceReader"/>).
+/// Records are buffered per column and a block is encoded and written every <see cref="BlockSize"/> IOs,
+/// so appending is allocation-free and the file costs a few bytes per IO.
+/// </summary>
+/// <remarks>
+/// The columns are double-buffered: a full block is compressed and written on a thread-pool thread while
+/// <see cref="Append"/> fills the other one, so the IO completion path only stores values into arrays.
+/// Append waits only if a block fills before the previous one has been written.
+/// </remarks>
+public sealed class IoTraceWriter : IDisposable
+{
+    /// <summary>
+    /// Default number of IOs per block.
+    /// </summary>
+    public const int DefaultBlockSize = 64 * 1024;
+
+    private const int MaxVarintBytes = 10;
+
+    private readonly FileStream _file;
+    private readonly long _frequency;
+    private readonly byte[] _raw;
+    private readonly MemoryStream _compressed = new();
+    private readonly MemoryStream _index = new();
+
+    private ColumnBlock _filling;
+    private ColumnBlock _spare;
+    private Task _flush = Task.CompletedTask;
+    private long _startTimestamp;
+    private bool _started;
+    private long _blockCount;
+    private long _totalCount;
+    private bool _disposed;
+
+    /// <summary>
+    /// Gets the number of IOs per block.
+    /// </summary>
+    public int BlockSize => this._filling.Submit.Length;
+
+    /// <summary>
+    /// Gets the number of IOs appended.
+    /// </summary>
+    public long Count => this._totalCount;
+
+    /// <summary>
+    /// Creates a trace file, replacing any existing file.
+    /// </summary>
+    /// <param name="path">Trace file path.</param>
+    /// <param name="blockSize">IOs per block: larger blocks compress better, smaller ones skip more precisely.</param>
+    /// <param name="frequency">Tick frequency of recorded times (defaults to <see cref="Stopwatch.Frequency"/>).</param>
+    public IoTraceWriter(string path, int blockSize = DefaultBlockSize, long frequency = 0)
+    {
+        ArgumentException.ThrowIfNullOrEmpty(path);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(blockSize);
+        ArgumentOutOfRangeException.ThrowIfNegative(frequency);
+
+        this._frequency = frequency > 0 ? frequency : Stopwatch.Frequency;
+        this._filling = new ColumnBlock(blockSize);
+        this._spare = new ColumnBlock(blockSize);
+        this._raw = new byte[blockSize * MaxVarintBytes];
+
+        this._file = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.Read, 1 << 20);
+        this._file.Write(IoTraceFormat.HeaderMagic);
+    }
+
+    /// <summary>
+    /// Sets the timestamp submit times are measured from, typically the start of the measured window.
+    /// Must be called before the first <see cref="Append"/>.
+    /// </summary>
+    /// <param name="startTimestamp">Stopwatch timestamp of time zero.</param>
+    public void Start(long startTimestamp)
+    {
+        if (this._totalCount > 0)
+        {
+            throw new InvalidOperationException("The trace start cannot change after IOs are recorded.");
+        }
+
+        this._startTimestamp = startTimestamp;
+        this._started = true;
+    }
+
+    /// <summary>
+    /// Records a completed IO.
+    /// </summary>
+    /// <param name="offset">File offset of the IO.</param>
+    /// <param name="size">Bytes transferred.</param>
+    /// <param name="isWrite">Whether the IO was a write.</param>
+    /// <param name="submitTimestamp">Stopwatch timestamp of the first submission.</param>
+    /// <param name="completeTimestamp">Stopwatch timestamp of the completion.</param>
+    /// <param name="thread">Id of the completing thread.</param>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void Append(long offset, int size, bool isWrite, long submitTimestamp, long completeTimestamp, int thread)
+    {
+        if (!this._started)
+        {
+            throw new InvalidOperationException("Call Start before appending IOs.");
+        }
+
+        var block = this._filling;
+        int i = block.Count;
+        block.Submit[i] = submitTimestamp - this._startTimestamp;
+        block.Offset[i] = offset;
+        block.Size[i] = size;
+        block.IsWrite[i] = isWrite;
+        block.Latency[i] = completeTimestamp - submitTimestamp;
+        block.Thread[i] = thread;
+        this._totalCount++;
+
+        if (++block.Count == block.Submit.Length)
+        {
+            this.HandOff();
+        }
+    }
+
+    /// <summary>
+    /// Writes any buffered IOs and the block index, and closes the file.
+    /// </summary>
+    public void Dispose()
+    {
+        if (this._disposed)
+        {
+            return;
+        }
+
+        this._disposed = true;
+        try
+        {
+            this._flush.GetAwaiter().GetResult();
+            this.FlushBlock(this._filling);
+
+            long indexOffset = this._file.Position;
+            this._index.Position = 0;
+            this._index.CopyTo(this._file);
+
+            Span<byte> trailer = stackalloc byte[IoTraceFormat.TrailerSize];
+            int position = 0;
+            IoTraceFormat.WriteInt64(trailer, ref position, this._startTimestamp);
+            IoTraceFormat.WriteInt64(trailer, ref position, this._frequency);
+            IoTraceFormat.WriteInt64(trailer, ref position, indexOffset);
+            IoTraceFormat.WriteInt64(trailer, ref position, this._blockCount);
+            IoTraceFormat.TrailerMagic.CopyTo(trailer[position..]);
+            this._file.Write(trailer);
+        }
+        finally
+        {
+            this._file.Dispose();
+            this._compressed.Dispose();
+            this._index.Dispose();
+        }
+    }
+
+    /// <summary>
+    /// Starts writing the full block in the background and continues into the spare one, waiting for
+    /// the previous write first if it is still running.
+    /// </summary>
+    private void HandOff()
+    {
+        this._flush.GetAwaiter().GetResult();
+
+        var full = this._filling;
+        this._filling = this._spare;
+        this._spare = full;
+        this._flush = Task.Run(() => this.FlushBlock(full));
+    }
+
+    private void FlushBlock(ColumnBlock block)
+    {
+        int count = block.Count;
+        if (count == 0)
+        {
+            return;
+        }
+
+        Span<byte> entry = stackalloc byte[IoTraceFormat.IndexEntrySize];
+        int position = 0;
+        int writes = 0;
+        for (int i = 0; i < count; i++)
+        {
+            writes += block.IsWrite[i] ? 1 : 0;
+        }
+
+        IoTraceFormat.WriteInt32(entry, ref position, count);
+        IoTraceFormat.WriteInt32(entry, ref position, writes);
+        IoTraceFormat.WriteInt64(entry, ref position, this._file.Position);
+
+        // Column order matches IoTraceReader.Column
+        this.WriteColumn(IoTraceFormat.EncodeDeltas(block.Submit.AsSpan(0, count), this._raw), entry, ref position);
+        this.WriteColumn(IoTraceFormat.EncodeDeltas(block.Offset.AsSpan(0, count), this._raw), entry, ref position);
+        this.WriteColumn(IoTraceFormat.EncodeDeltas(block.Size.AsSpan(0, count), this._raw), entry, ref position);
+        this.WriteColumn(this.PackWriteFlags(block.IsWrite, count), entry, ref position);
+        this.WriteColumn(IoTraceFormat.EncodeValues(block.Latency.AsSpan(0, count), this._raw), entry, ref position);
+        this.WriteColumn(IoTraceFormat.EncodeDeltas(block.Thread.AsSpan(0, count), this._raw), entry, ref position);
+
+        WriteRange(entry, ref position, block.Submit.AsSpan(0, count));
+        WriteRange(entry, ref position, block.Offset.AsSpan(0, count));
+        WriteRange(entry, ref position, block.Latency.AsSpan(0, count));
+        this._index.Write(entry);
+
+        this._blockCount++;
+        block.Count = 0;
+    }
+
+    private void WriteColumn(int rawLength, Span<byte> entry, ref int position)
+    {
+        IoTraceFormat.Compress(this._raw.AsSpan(0, rawLength), this._compressed);
+        this._file.Write(this._compressed.GetBuffer(), 0, (int)this._compressed.Length);
+        IoTraceFormat.WriteInt32(entry, ref position, (int)this._compressed.Length);
+        IoTraceFormat.WriteInt32(entry, ref position, rawLength);
+    }
+
+    private int PackWriteFlags(bool[] isWrite, int count)
+    {
+        int bytes = (count + 7) / 8;
+        this._raw.AsSpan(0, bytes).Clear();
+        for (int i = 0; i < count; i++)
+        {
+            if (isWrite[i])
+            {
+                this._raw[i >> 3] |= (byte)(1 << (i & 7));
+            }
+        }
+
+        return bytes;
+    }
+
+    private static void WriteRange(Span<byte> entry, ref int position, ReadOnlySpan<long> values)
+    {
+        long min = long.MaxValue;
+        long max = long.MinValue;
+        foreach (long value in values)
+        {
+            min = Math.Min(min, value);
+            max = Math.Max(max, value);
+        }
+
+        IoTraceFormat.WriteInt64(entry, ref position, min);
+        IoTraceFormat.WriteInt64(entry, ref position, max);
+    }
+
+    /// <summary>
+    /// Column arrays for one block of records.
+    /// </summary>
+    private sealed class ColumnBlock
+    {
+        public ColumnBlock(int size)
+        {
+            this.Submit = new long[size];
+            this.Offset = new long[size];
+            this.Size = new long[size];
+            this.Latency = new long[size];
+            this.Thread = new long[size];
+            this.IsWrite = new bool[size];
+        }
+
+        public long[] Submit { get; }
+
+        public long[] Offset { get; }
+
+        public long[] Size { get; }
+
+        public long[] Latency { get; }
+
+        public long[] Thread { get; }
+
+        public bool[] IsWrite { get; }
+
+        public int Count { get; set; }
+    }
+}
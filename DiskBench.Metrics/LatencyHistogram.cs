@@ -134,7 +134,7 @@ public sealed class LatencyHistogram
     /// <summary>
     /// Gets the approximate tick value for a bucket index.
     /// </summary>
-    private static long GetBucketValue(int bucketIndex)
+    internal static long GetBucketValue(int bucketIndex)
     {
         if (bucketIndex < LinearBuckets)
         {
@@ -159,25 +159,103 @@ public sealed class LatencyHistogram
     /// <returns>Latency in ticks at the given percentile.</returns>
     public long GetPercentileTicks(double percentile)
     {
-        if (this._count == 0)
+        return GetPercentileTicks(this._buckets, this._count, this._maxTicks, percentile);
+    }
+
+    /// <summary>
+    /// Gets the percentile value in ticks from bucket counts.
+    /// </summary>
+    internal static long GetPercentileTicks(ReadOnlySpan<long> buckets, long count, long maxTicks, double percentile)
+    {
+        if (count == 0)
         {
             return 0;
         }
 
         percentile = Math.Clamp(percentile, 0.0, 1.0);
-        long targetCount = (long)(percentile * this._count);
+        long targetCount = (long)(percentile * count);
 
         long runningCount = 0;
-        for (int i = 0; i < TotalBuckets; i++)
+        for (int i = 0; i < buckets.Length; i++)
         {
-            runningCount += this._buckets[i];
+            runningCount += buckets[i];
             if (runningCount >= targetCount)
             {
                 return GetBucketValue(i);
             }
         }
 
-        return this._maxTicks;
+        return maxTicks;
+    }
+
+    /// <summary>
+    /// Gets the value of the rank-th smallest sample (1-based) in ticks from bucket counts.
+    /// </summary>
+    internal static long GetRankTicks(ReadOnlySpan<long> buckets, long rank, long maxTicks)
+    {
+        long runningCount = 0;
+        for (int i = 0; i < buckets.Length; i++)
+        {
+            runningCount += buckets[i];
+            if (runningCount >= rank)
+            {
+                return GetBucketValue(i);
+            }
+        }
+
+        return maxTicks;
+    }
+
+    /// <summary>
+    /// Creates a baseline for <see cref="GetIntervalPercentileTicks"/>.
+    /// </summary>
+    public static long[] CreateIntervalBaseline() => new long[TotalBuckets];
+
+    /// <summary>
+    /// Gets a percentile of only the samples recorded since the baseline was last updated, then
+    /// updates the baseline to the current counts. Allocation-free, so it can run on the IO thread
+    /// alongside progress snapshots. A reset since the last call restarts the interval.
+    /// </summary>
+    /// <param name="percentile">Percentile (0.0 to 1.0).</param>
+    /// <param name="baseline">Bucket counts at the start of the interval, from <see cref="CreateIntervalBaseline"/>.</param>
+    /// <returns>Latency in ticks at the given percentile, or 0 if nothing was recorded in the interval.</returns>
+    public long GetIntervalPercentileTicks(double percentile, long[] baseline)
+    {
+        ArgumentNullException.ThrowIfNull(baseline);
+        ArgumentOutOfRangeException.ThrowIfNotEqual(baseline.Length, TotalBuckets, nameof(baseline));
+
+        long count = 0;
+        bool wasReset = false;
+        for (int i = 0; i < TotalBuckets; i++)
+        {
+            long delta = this._buckets[i] - baseline[i];
+            wasReset |= delta < 0;
+            count += delta;
+        }
+
+        if (wasReset)
+        {
+            Array.Clear(baseline);
+            count = this._count;
+        }
+
+        long targetCount = (long)(Math.Clamp(percentile, 0.0, 1.0) * count);
+        long result = 0;
+        long runningCount = 0;
+        bool found = count == 0;
+        for (int i = 0; i < TotalBuckets; i++)
+        {
+            runningCount += this._buckets[i] - baseline[i];
+            if (!found && runningCount > 0 && runningCount >= targetCount)
+            {
+                result = GetBucketValue(i);
+                found = true;
+            }
+
+            baseline[i] = this._buckets[i];
+        }
+
+        return result;
     }
 
     /// <summary>
@@ -267,6 +345,62 @@ public sealed class HistogramSnapshot
     /// <summary>Copy of bucket counts.</summary>
     public IReadOnlyList<long> Buckets { get; }
 
+    /// <summary>
+    /// Gets the percentile value in ticks, as <see cref="LatencyHistogram.GetPercentileTicks(double)"/> would have.
+    /// </summary>
+    /// <param name="percentile">Percentile (0.0 to 1.0).</param>
+    public long GetPercentileTicks(double percentile)
+    {
+        return LatencyHistogram.GetPercentileTicks(BucketCounts(), Count, MaxTicks, percentile);
+    }
+
+    /// <summary>
+    /// Gets the value of the rank-th smallest sample (1-based) in ticks, to bucket resolution.
+    /// </summary>
+    /// <param name="rank">Rank from 1 to <see cref="Count"/>.</param>
+    public long GetRankTicks(long rank)
+    {
+        return LatencyHistogram.GetRankTicks(BucketCounts(), rank, MaxTicks);
+    }
+
+    /// <summary>
+    /// Combines snapshots into one covering all of their samples.
+    /// </summary>
+    /// <param name="snapshots">Snapshots to combine (at least one).</param>
+    public static HistogramSnapshot Combine(IReadOnlyList<HistogramSnapshot> snapshots)
+    {
+        ArgumentNullException.ThrowIfNull(snapshots);
+        if (snapshots.Count == 0)
+        {
+            throw new ArgumentException("At least one snapshot is required.", nameof(snapshots));
+        }
+
+        var buckets = new long[snapshots[0].Buckets.Count];
+        long count = 0;
+        long sum = 0;
+        long min = long.MaxValue;
+        long max = 0;
+        foreach (var snapshot in snapshots)
+        {
+            for (int i = 0; i < buckets.Length; i++)
+            {
+                buckets[i] += snapshot.Buckets[i];
+            }
+
+            count += snapshot.Count;
+            sum += snapshot.SumTicks;
+            max = Math.Max(max, snapshot.MaxTicks);
+            if (snapshot.Count > 0)
+            {
+                min = Math.Min(min, snapshot.MinTicks);
+            }
+        }
+
+        return new HistogramSnapshot(count, sum, count > 0 ? min : 0, max, count > 0 ? (double)sum / count : 0, buckets);
+    }
+
+    private long[] BucketCounts() => Buckets as long[] ?? [.. Buckets];
+
     /// <summary>
     /// Creates a new histogram snapshot.
     /// </summary>
@@ -0,0 +1,437 @@
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// Options for building miss ratio curves.
+/// </summary>
+public sealed class MissRatioCurveOptions
+{
+    /// <summary>
+    /// Cache block size in bytes. IOs are split into the blocks they touch.
+    /// </summary>
+    public int BlockSize { get; init; } = 4096;
+
+    /// <summary>
+    /// Initial fraction of blocks sampled (1 = every block). The miniature simulations of the
+    /// non-LRU policies keep this rate; the LRU analysis lowers it as needed to stay within
+    /// <see cref="MaxSampledBlocks"/>.
+    /// </summary>
+    public double SamplingRate { get; init; } = 0.01;
+
+    /// <summary>
+    /// Most distinct sampled blocks tracked by the LRU stack-distance analysis, which bounds its memory
+    /// regardless of the footprint of the stream.
+    /// </summary>
+    public int MaxSampledBlocks { get; init; } = 64 * 1024;
+
+    /// <summary>
+    /// Policies to build curves for.
+    /// </summary>
+    public IReadOnlyList<CachePolicy> Policies { get; init; } = [CachePolicy.Lru, CachePolicy.Clock, CachePolicy.TwoQueue, CachePolicy.Arc];
+
+    /// <summary>
+    /// Cache sizes in bytes to evaluate (null = 16 MiB to 64 GiB, two sizes per doubling).
+    /// </summary>
+    public IReadOnlyList<long>? CacheSizes { get; init; }
+
+    /// <summary>
+    /// Gets the default cache sizes: each power of two from 16 MiB to 64 GiB and 1.5 times it.
+    /// </summary>
+    public static IReadOnlyList<long> DefaultCacheSizes()
+    {
+        var sizes = new List<long>();
+        for (long size = 16L * 1024 * 1024; size <= 64L * 1024 * 1024 * 1024; size *= 2)
+        {
+            sizes.Add(size);
+            sizes.Add(size + size / 2);
+        }
+
+        sizes.RemoveAt(sizes.Count - 1);
+        return sizes;
+    }
+}
+
+/// <summary>
+/// Hit or miss ratio of a cache of a given size.
+/// </summary>
+/// <param name="CacheBytes">Cache size in bytes.</param>
+/// <param name="MissRatio">Fraction of block references that miss (0-1).</param>
+public readonly record struct MissRatioPoint(long CacheBytes, double MissRatio)
+{
+    /// <summary>
+    /// Fraction of block references that hit (0-1).
+    /// </summary>
+    public double HitRatio => 1 - MissRatio;
+}
+
+/// <summary>
+/// Miss ratio as a function of cache size for one replacement policy.
+/// </summary>
+public sealed class MissRatioCurve
+{
+    /// <summary>
+    /// Replacement policy.
+    /// </summary>
+    public required CachePolicy Policy { get; init; }
+
+    /// <summary>
+    /// Points in increasing cache size.
+    /// </summary>
+    public required IReadOnlyList<MissRatioPoint> Points { get; init; }
+
+    /// <summary>
+    /// Gets the smallest cache size in bytes that reaches a hit ratio, interpolating linearly between
+    /// points, or null if no evaluated size reaches it.
+    /// </summary>
+    /// <param name="hitRatio">Target hit ratio (0-1).</param>
+    public long? CacheSizeForHitRatio(double hitRatio)
+    {
+        for (int i = 0; i < Points.Count; i++)
+        {
+            var point = Points[i];
+            if (point.HitRatio < hitRatio)
+            {
+                continue;
+            }
+
+            if (i == 0 || point.HitRatio <= Points[i - 1].HitRatio)
+            {
+                return point.CacheBytes;
+            }
+
+            var previous = Points[i - 1];
+            double fraction = (hitRatio - previous.HitRatio) / (point.HitRatio - previous.HitRatio);
+            return previous.CacheBytes + (long)(fraction * (point.CacheBytes - previous.CacheBytes));
+        }
+
+        return null;
+    }
+}
+
+/// <summary>
+/// Miss ratio curves of a block reference stream.
+/// </summary>
+public sealed class MissRatioAnalysis
+{
+    /// <summary>
+    /// Cache block size in bytes.
+    /// </summary>
+    public required int BlockSize { get; init; }
+
+    /// <summary>
+    /// Block references processed.
+    /// </summary>
+    public required long References { get; init; }
+
+    /// <summary>
+    /// Block references that were sampled by the LRU analysis.
+    /// </summary>
+    public required long SampledReferences { get; init; }
+
+    /// <summary>
+    /// Final sampling rate of the LRU analysis.
+    /// </summary>
+    public required double SamplingRate { get; init; }
+
+    /// <summary>
+    /// Estimated number of distinct bytes referenced (distinct blocks times the block size).
+    /// </summary>
+    public required long EstimatedFootprintBytes { get; init; }
+
+    /// <summary>
+    /// One curve per requested policy.
+    /// </summary>
+    public required IReadOnlyList<MissRatioCurve> Curves { get; init; }
+}
+
+/// <summary>
+/// Builds miss ratio curves from a stream of block references using spatially hashed sampling (SHARDS).
+/// A block is sampled when a hash of its number falls below a threshold, so every reference to a
+/// sampled block is seen and reuse behaviour is preserved in miniature.
+/// </summary>
+/// <remarks>
+/// The LRU curve comes from stack distances over the sampled blocks, scaled up by the sampling rate, so
+/// one pass gives every cache size. When the number of tracked blocks exceeds
+/// <see cref="MissRatioCurveOptions.MaxSampledBlocks"/> the block with the largest hash is dropped and
+/// the threshold lowered to it, rescaling the counts gathered so far. CLOCK, 2Q and ARC have no stack
+/// property, so they are simulated per cache size on caches shrunk by the initial sampling rate.
+/// Not thread safe.
+/// </remarks>
+public sealed class MissRatioCurveBuilder
+{
+    private const int HashBits = 24;
+    private const long HashModulus = 1L << HashBits;
+
+    private readonly MissRatioCurveOptions _options;
+    private readonly long[] _cacheBytes;
+    private readonly long[] _cacheBlocks;
+    private readonly long _initialThreshold;
+
+    // LRU stack-distance analysis over the adaptively sampled blocks
+    private readonly Dictionary<long, (int Time, int Hash)> _tracked = [];
+    private readonly PriorityQueue<long, int> _byHash = new(Comparer<int>.Create((a, b) => b.CompareTo(a)));
+    private readonly double[] _distanceCounts;
+    private readonly int[] _tree;
+    private int _time;
+    private long _threshold;
+    private double _cold;
+    private double _sampledWeight;
+    private long _sampledReferences;
+    private long _references;
+
+    // Fixed-rate miniature simulations, one per policy and cache size
+    private readonly List<(CachePolicy Policy, CacheSimulator[] Caches, long[] Misses)> _simulations = [];
+    private long _simulatedReferences;
+
+    /// <summary>
+    /// Creates a builder.
+    /// </summary>
+    /// <param name="options">Options (null = defaults).</param>
+    public MissRatioCurveBuilder(MissRatioCurveOptions? options = null)
+    {
+        _options = options ?? new MissRatioCurveOptions();
+
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(_options.BlockSize, nameof(options));
+        ArgumentOutOfRangeException.ThrowIfLessThan(_options.MaxSampledBlocks, 16, nameof(options));
+        if (!(_options.SamplingRate > 0 && _options.SamplingRate <= 1))
+        {
+            throw new ArgumentException("Sampling rate must be greater than 0 and at most 1.", nameof(options));
+        }
+
+        var sizes = (_options.CacheSizes ?? MissRatioCurveOptions.DefaultCacheSizes()).Distinct().Order().ToArray();
+        if (sizes.Length == 0 || sizes[0] < _options.BlockSize)
+        {
+            throw new ArgumentException("At least one cache size is required and each must hold at least one block.", nameof(options));
+        }
+
+        _cacheBytes = sizes;
+        _cacheBlocks = sizes.Select(s => s / _options.BlockSize).ToArray();
+        _initialThreshold = Math.Max(1, (long)Math.Round(_options.SamplingRate * HashModulus));
+        _threshold = _initialThreshold;
+        _distanceCounts = new double[sizes.Length + 1];
+        _tree = new int[_options.MaxSampledBlocks * 4 + 1];
+
+        double rate = (double)_initialThreshold / HashModulus;
+        foreach (var policy in _options.Policies.Distinct())
+        {
+            if (policy == CachePolicy.Lru)
+            {
+                continue;
+            }
+
+            var caches = _cacheBlocks
+                .Select(blocks => CacheSimulator.Create(policy, Math.Max(1, (long)Math.Round(blocks * rate))))
+                .ToArray();
+            _simulations.Add((policy, caches, new long[caches.Length]));
+        }
+    }
+
+    /// <summary>
+    /// Current sampling rate of the LRU analysis.
+    /// </summary>
+    public double SamplingRate => (double)_threshold / HashModulus;
+
+    /// <summary>
+    /// Number of distinct blocks currently tracked by the LRU analysis.
+    /// </summary>
+    public int TrackedBlocks => _tracked.Count;
+
+    /// <summary>
+    /// References every block touched by an IO.
+    /// </summary>
+    /// <param name="offset">Byte offset.</param>
+    /// <param name="size">Size in bytes.</param>
+    public void Access(long offset, int size)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(offset);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(size);
+
+        long first = offset / _options.BlockSize;
+        long last = (offset + size - 1) / _options.BlockSize;
+        for (long block = first; block <= last; block++)
+        {
+            AccessBlock(block);
+        }
+    }
+
+    /// <summary>
+    /// References one block.
+    /// </summary>
+    /// <param name="block">Block number.</param>
+    public void AccessBlock(long block)
+    {
+        _references++;
+
+        int hash = Hash(block);
+        if (hash >= _initialThreshold)
+        {
+            return;
+        }
+
+        _simulatedReferences++;
+        foreach (var (_, caches, misses) in _simulations)
+        {
+            for (int i = 0; i < caches.Length; i++)
+            {
+                if (!caches[i].Access(block))
+                {
+                    misses[i]++;
+                }
+            }
+        }
+
+        if (hash < _threshold)
+        {
+            AccessSampled(block, hash);
+        }
+    }
+
+    /// <summary>
+    /// Builds the curves for the references so far.
+    /// </summary>
+    public MissRatioAnalysis Build()
+    {
+        var curves = new List<MissRatioCurve>();
+        foreach (var policy in _options.Policies.Distinct())
+        {
+            var points = new MissRatioPoint[_cacheBytes.Length];
+
+            if (policy == CachePolicy.Lru)
+            {
+                // A reference hits every cache at least as large as its stack distance
+                double misses = _cold + _distanceCounts[^1];
+                for (int i = _cacheBytes.Length - 1; i >= 0; i--)
+                {
+                    points[i] = new MissRatioPoint(_cacheBytes[i], _sampledWeight > 0 ? misses / _sampledWeight : 0);
+                    misses += _distanceCounts[i];
+                }
+            }
+            else
+            {
+                var (_, _, missCounts) = _simulations.First(s => s.Policy == policy);
+                for (int i = 0; i < points.Length; i++)
+                {
+                    points[i] = new MissRatioPoint(
+                        _cacheBytes[i],
+                        _simulatedReferences > 0 ? (double)missCounts[i] / _simulatedReferences : 0);
+                }
+            }
+
+            curves.Add(new MissRatioCurve { Policy = policy, Points = points });
+        }
+
+        return new MissRatioAnalysis
+        {
+            BlockSize = _options.BlockSize,
+            References = _references,
+            SampledReferences = _sampledReferences,
+            SamplingRate = SamplingRate,
+            EstimatedFootprintBytes = (long)(_cold / SamplingRate) * _options.BlockSize,
+            Curves = curves
+        };
+    }
+
+    private void AccessSampled(long block, int hash)
+    {
+        _sampledReferences++;
+        _sampledWeight++;
+
+        if (_time == _tree.Length - 1)
+        {
+            Compact();
+        }
+
+        int now = ++_time;
+
+        if (_tracked.TryGetValue(block, out var entry))
+        {
+            // Distinct sampled blocks referenced since the last reference, plus the block itself
+            int distinct = Sum(now - 1) - Sum(entry.Time) + 1;
+            double distance = distinct / SamplingRate;
+
+            int bucket = Array.BinarySearch(_cacheBlocks, (long)Math.Ceiling(distance));
+            _distanceCounts[bucket >= 0 ? bucket : ~bucket]++;
+
+            Add(entry.Time, -1);
+            Add(now, 1);
+            _tracked[block] = (now, hash);
+            return;
+        }
+
+        _cold++;
+        Add(now, 1);
+        _tracked[block] = (now, hash);
+        _byHash.Enqueue(block, hash);
+
+        if (_tracked.Count > _options.MaxSampledBlocks)
+        {
+            LowerThreshold();
+        }
+    }
+
+    private void LowerThreshold()
+    {
+        // Drop every block with the largest hash and sample only below it from now on
+        _byHash.TryPeek(out _, out int largest);
+        while (_byHash.TryPeek(out long block, out int hash) && hash == largest)
+        {
+            _byHash.Dequeue();
+            Add(_tracked[block].Time, -1);
+            _tracked.Remove(block);
+        }
+
+        double scale = (double)largest / _threshold;
+        _threshold = largest;
+
+        _cold *= scale;
+        _sampledWeight *= scale;
+        for (int i = 0; i < _distanceCounts.Length; i++)
+        {
+            _distanceCounts[i] *= scale;
+        }
+    }
+
+    private void Compact()
+    {
+        // Renumber the tracked blocks' last references 1..n in order, keeping their relative recency.
+        // At most MaxSampledBlocks are tracked, so at least three quarters of the timestamps are free again.
+        var order = _tracked.OrderBy(kv => kv.Value.Time).ToArray();
+        Array.Clear(_tree);
+        _time = 0;
+
+        foreach (var (block, entry) in order)
+        {
+            int time = ++_time;
+            _tracked[block] = (time, entry.Hash);
+            Add(time, 1);
+        }
+    }
+
+    private void Add(int index, int delta)
+    {
+        for (; index < _tree.Length; index += index & -index)
+        {
+            _tree[index] += delta;
+        }
+    }
+
+    private int Sum(int index)
+    {
+        int sum = 0;
+        for (; index > 0; index -= index & -index)
+        {
+            sum += _tree[index];
+        }
+
+        return sum;
+    }
+
+    private static int Hash(long block)
+    {
+        // SplitMix64 finalizer
+        ulong x = (ulong)block;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9UL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBUL;
+        x ^= x >> 31;
+        return (int)(x & (HashModulus - 1));
+    }
+}
@@ -0,0 +1,221 @@
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// 95% confidence intervals for latency percentiles.
+/// </summary>
+/// <remarks>
+/// A percentile estimated from n samples is only as good as the number of samples beyond it: a p99.9 from
+/// 20,000 IOs rests on about 20 of them. Two intervals are provided. Order-statistic bounds are distribution-free:
+/// the number of samples at or below the true percentile is binomial, so its 2.5% and 97.5% quantiles give the
+/// ranks of the samples bracketing it. The bucket bootstrap resamples each trial's histogram (Poisson weights per
+/// bucket) and the trials themselves, capturing trial-to-trial variation as well as sampling noise.
+/// Both are limited to the histogram's bucket resolution.
+/// </remarks>
+public static class PercentileConfidence
+{
+    private const double Z975 = 1.959963984540054;
+
+    // Above this binomial variance the normal approximation is accurate to well under one rank
+    private const double NormalApproximationVariance = 100;
+
+    /// <summary>
+    /// Gets the 1-based ranks of the order statistics bracketing a percentile with 95% confidence.
+    /// </summary>
+    /// <param name="count">Number of samples.</param>
+    /// <param name="percentile">Percentile (0.0 to 1.0, exclusive).</param>
+    /// <returns>Lower and upper ranks, clamped to [1, count].</returns>
+    public static (long Lower, long Upper) OrderStatisticRanks(long count, double percentile)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(count);
+        if (percentile is <= 0 or >= 1)
+        {
+            throw new ArgumentOutOfRangeException(nameof(percentile), percentile, "Percentile must be between 0 and 1 exclusive.");
+        }
+
+        long lower = BinomialQuantile(count, percentile, 0.025);
+        long upper = BinomialQuantile(count, percentile, 0.975) + 1;
+        return (Math.Clamp(lower, 1, count), Math.Clamp(upper, 1, count));
+    }
+
+    /// <summary>
+    /// Gets distribution-free 95% bounds for a percentile of a histogram, in ticks.
+    /// </summary>
+    /// <param name="histogram">Histogram of the samples.</param>
+    /// <param name="percentile">Percentile (0.0 to 1.0, exclusive).</param>
+    public static (long LowerTicks, long UpperTicks) OrderStatisticInterval(HistogramSnapshot histogram, double percentile)
+    {
+        ArgumentNullException.ThrowIfNull(histogram);
+        if (histogram.Count == 0)
+        {
+            return (0, 0);
+        }
+
+        var (lower, upper) = OrderStatisticRanks(histogram.Count, percentile);
+        return (histogram.GetRankTicks(lower), histogram.GetRankTicks(upper));
+    }
+
+    /// <summary>
+    /// Gets the number of samples above a percentile: how many IOs the tail estimate rests on.
+    /// </summary>
+    /// <param name="count">Number of samples.</param>
+    /// <param name="percentile">Percentile (0.0 to 1.0).</param>
+    public static long TailSamples(long count, double percentile)
+    {
+        return Math.Max(0, count - (long)Math.Ceiling(Math.Clamp(percentile, 0.0, 1.0) * count));
+    }
+
+    /// <summary>
+    /// Computes bootstrap 95% intervals, in ticks, for the mean across trials of each percentile.
+    /// Each replicate draws the trials with replacement and resamples every bucket of each drawn trial.
+    /// </summary>
+    /// <param name="trials">Histogram of each trial.</param>
+    /// <param name="percentiles">Percentiles (0.0 to 1.0).</param>
+    /// <param name="iterations">Number of bootstrap replicates.</param>
+    /// <param name="seed">Random seed for reproducibility.</param>
+    /// <returns>Lower and upper bounds for each percentile, in order.</returns>
+#pragma warning disable CA5394 // Random is appropriate for statistical bootstrapping, not security
+    public static IReadOnlyList<(double Lower, double Upper)> BucketBootstrapIntervals(
+        IReadOnlyList<HistogramSnapshot> trials,
+        IReadOnlyList<double> percentiles,
+        int iterations = 10000,
+        int seed = 42)
+    {
+        ArgumentNullException.ThrowIfNull(trials);
+        ArgumentNullException.ThrowIfNull(percentiles);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(iterations);
+        if (trials.Count == 0)
+        {
+            throw new ArgumentException("At least one trial histogram is required.", nameof(trials));
+        }
+
+        var random = new Random(seed);
+        var buckets = trials.Select(t => t.Buckets.ToArray()).ToArray();
+        var resampled = new long[buckets[0].Length];
+        var replicates = new double[percentiles.Count][];
+        for (int p = 0; p < percentiles.Count; p++)
+        {
+            replicates[p] = new double[iterations];
+        }
+
+        for (int i = 0; i < iterations; i++)
+        {
+            for (int t = 0; t < trials.Count; t++)
+            {
+                int drawn = random.Next(trials.Count);
+                long count = 0;
+                for (int b = 0; b < resampled.Length; b++)
+                {
+                    resampled[b] = Poisson(random, buckets[drawn][b]);
+                    count += resampled[b];
+                }
+
+                for (int p = 0; p < percentiles.Count; p++)
+                {
+                    replicates[p][i] += LatencyHistogram.GetPercentileTicks(resampled, count, trials[drawn].MaxTicks, percentiles[p]);
+                }
+            }
+        }
+
+        var intervals = new (double Lower, double Upper)[percentiles.Count];
+        for (int p = 0; p < percentiles.Count; p++)
+        {
+            var values = replicates[p];
+            Array.Sort(values);
+            intervals[p] = (values[(int)(iterations * 0.025)] / trials.Count, values[(int)(iterations * 0.975)] / trials.Count);
+        }
+
+        return intervals;
+    }
+
+    /// <summary>
+    /// Draws from a Poisson distribution: exact for small means, normal approximation above 30.
+    /// </summary>
+    private static long Poisson(Random random, long mean)
+    {
+        if (mean == 0)
+        {
+            return 0;
+        }
+
+        if (mean < 30)
+        {
+            double limit = Math.Exp(-mean);
+            long k = 0;
+            double product = random.NextDouble();
+            while (product > limit)
+            {
+                k++;
+                product *= random.NextDouble();
+            }
+
+            return k;
+        }
+
+        double z = Math.Sqrt(-2 * Math.Log(1 - random.NextDouble())) * Math.Cos(2 * Math.PI * random.NextDouble());
+        return Math.Max(0, (long)Math.Round(mean + z * Math.Sqrt(mean)));
+    }
+#pragma warning restore CA5394
+
+    /// <summary>
+    /// Gets the smallest k with P(B &lt;= k) &gt;= probability for B ~ Binomial(n, p).
+    /// </summary>
+    private static long BinomialQuantile(long n, double p, double probability)
+    {
+        double variance = n * p * (1 - p);
+        if (variance > NormalApproximationVariance)
+        {
+            double z = probability < 0.5 ? -Z975 : Z975;
+            return (long)Math.Round(n * p + z * Math.Sqrt(variance));
+        }
+
+        // Small variance means few expected successes (or failures): sum the exact mass from the near end
+        if (p <= 0.5)
+        {
+            return SmallestWithCdfAtLeast(n, p, probability);
+        }
+
+        // B <= k  <=>  n - B >= n - k, where n - B ~ Binomial(n, 1 - p)
+        return n - 1 - LargestWithCdfBelow(n, 1 - p, 1 - probability);
+    }
+
+    private static long SmallestWithCdfAtLeast(long n, double p, double probability)
+    {
+        double logPmf = n * Math.Log(1 - p);
+        double logOdds = Math.Log(p / (1 - p));
+        double cdf = 0;
+        for (long k = 0; k < n; k++)
+        {
+            cdf += Math.Exp(logPmf);
+            if (cdf >= probability)
+            {
+                return k;
+            }
+
+            logPmf += Math.Log((double)(n - k) / (k + 1)) + logOdds;
+        }
+
+        return n;
+    }
+
+    /// <summary>
+    /// Gets the largest j with P(B &lt;= j) &lt;= probability, or -1 if none.
+    /// </summary>
+    private static long LargestWithCdfBelow(long n, double p, double probability)
+    {
+        double logPmf = n * Math.Log(1 - p);
+        double logOdds = Math.Log(p / (1 - p));
+        double cdf = 0;
+        for (long k = 0; k <= n; k++)
+        {
+            cdf += Math.Exp(logPmf);
+            if (cdf > probability)
+            {
+                return k - 1;
+            }
+
+            logPmf += Math.Log((double)(n - k) / (k + 1)) + logOdds;
+        }
+
+        return n;
+    }
+}
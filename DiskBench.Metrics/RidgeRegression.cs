@@ -0,0 +1,311 @@
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// Linear ridge regression with the penalty chosen by leave-one-out cross-validation.
+/// </summary>
+/// <remarks>
+/// Features are standardized and the target centered, so the penalty treats every feature alike and the
+/// intercept is not shrunk. For ridge, the leave-one-out residual of sample i is its in-sample residual
+/// divided by 1 - h_i, where h_i is its leverage, so every penalty is cross-validated from a single fit.
+/// The smallest of those errors is biased low, because it picked the penalty, so the reported error comes
+/// from nested cross-validation instead: each sample is predicted by a model fitted, penalty selection
+/// included, without it.
+/// </remarks>
+public sealed class RidgeRegression
+{
+    private static readonly double[] DefaultPenalties = [1e-4, 1e-3, 1e-2, 0.1, 1, 10, 100, 1000];
+
+    private readonly Solution _solution;
+
+    private RidgeRegression(Solution solution, double error, int samples)
+    {
+        this._solution = solution;
+        this.CrossValidatedError = error;
+        this.SampleCount = samples;
+    }
+
+    /// <summary>
+    /// Gets the penalty chosen by cross-validation.
+    /// </summary>
+    public double Penalty => this._solution.Penalty;
+
+    /// <summary>
+    /// Gets the nested leave-one-out RMS prediction error, in target units: the error on samples the model,
+    /// including its choice of penalty, has not seen.
+    /// </summary>
+    public double CrossValidatedError { get; }
+
+    /// <summary>
+    /// Gets the effective number of fitted parameters (trace of the hat matrix, intercept included).
+    /// Shrinkage makes it smaller than the feature count plus one.
+    /// </summary>
+    public double EffectiveParameters => this._solution.EffectiveParameters;
+
+    /// <summary>
+    /// Gets the number of training samples.
+    /// </summary>
+    public int SampleCount { get; }
+
+    /// <summary>
+    /// Gets the number of features.
+    /// </summary>
+    public int FeatureCount => this._solution.Weights.Length;
+
+    /// <summary>
+    /// Fits a model, choosing the penalty with the lowest leave-one-out error.
+    /// </summary>
+    /// <param name="features">Feature vector of each sample (all the same length).</param>
+    /// <param name="targets">Target of each sample.</param>
+    /// <param name="penalties">Penalties to try (default: 1e-4 to 1000 in decades).</param>
+    /// <exception cref="ArgumentException">Fewer than four samples, or ragged or non-finite features.</exception>
+    public static RidgeRegression Fit(IReadOnlyList<double[]> features, IReadOnlyList<double> targets, IReadOnlyList<double>? penalties = null)
+    {
+        ArgumentNullException.ThrowIfNull(features);
+        ArgumentNullException.ThrowIfNull(targets);
+        penalties ??= DefaultPenalties;
+
+        int n = features.Count;
+        if (n < 4)
+        {
+            throw new ArgumentException($"Ridge regression needs at least four samples, got {n}.", nameof(features));
+        }
+
+        if (targets.Count != n)
+        {
+            throw new ArgumentException($"Got {targets.Count} targets for {n} samples.", nameof(targets));
+        }
+
+        if (penalties.Count == 0 || penalties.Any(p => !(p > 0) || double.IsInfinity(p)))
+        {
+            throw new ArgumentException("Penalties must be positive.", nameof(penalties));
+        }
+
+        int p = features[0].Length;
+        if (features.Any(f => f.Length != p || f.Any(v => !double.IsFinite(v))) || targets.Any(t => !double.IsFinite(t)))
+        {
+            throw new ArgumentException("Every sample needs the same number of finite features and a finite target.", nameof(features));
+        }
+
+        var solution = Solve(features, targets, penalties);
+
+        // Nested cross-validation: every held-out sample's model picks its own penalty without it
+        var trainFeatures = new List<double[]>(n - 1);
+        var trainTargets = new List<double>(n - 1);
+        double sumSquares = 0;
+        for (int i = 0; i < n; i++)
+        {
+            trainFeatures.Clear();
+            trainTargets.Clear();
+            for (int k = 0; k < n; k++)
+            {
+                if (k != i)
+                {
+                    trainFeatures.Add(features[k]);
+                    trainTargets.Add(targets[k]);
+                }
+            }
+
+            double residual = targets[i] - Solve(trainFeatures, trainTargets, penalties).Predict(features[i]);
+            sumSquares += residual * residual;
+        }
+
+        return new RidgeRegression(solution, Math.Sqrt(sumSquares / n), n);
+    }
+
+    /// <summary>
+    /// Predicts the target of a sample.
+    /// </summary>
+    /// <param name="features">Feature vector, in the order used to fit.</param>
+    public double Predict(ReadOnlySpan<double> features)
+    {
+        if (features.Length != this._solution.Weights.Length)
+        {
+            throw new ArgumentException($"Expected {this._solution.Weights.Length} features, got {features.Length}.", nameof(features));
+        }
+
+        return this._solution.Predict(features);
+    }
+
+    /// <summary>
+    /// Fits every penalty and keeps the one with the lowest leave-one-out error.
+    /// </summary>
+    private static Solution Solve(IReadOnlyList<double[]> features, IReadOnlyList<double> targets, IReadOnlyList<double> penalties)
+    {
+        int n = features.Count;
+        int p = features[0].Length;
+
+        // Standardize features; a constant feature carries no information and stays zero
+        var means = new double[p];
+        var scales = new double[p];
+        for (int j = 0; j < p; j++)
+        {
+            means[j] = features.Average(f => f[j]);
+            double sd = Math.Sqrt(features.Sum(f => (f[j] - means[j]) * (f[j] - means[j])) / n);
+            scales[j] = sd > 0 ? sd : 0;
+        }
+
+        var x = new double[n][];
+        for (int i = 0; i < n; i++)
+        {
+            x[i] = new double[p];
+            for (int j = 0; j < p; j++)
+            {
+                x[i][j] = scales[j] > 0 ? (features[i][j] - means[j]) / scales[j] : 0;
+            }
+        }
+
+        double yMean = targets.Average();
+        var y = targets.Select(t => t - yMean).ToArray();
+
+        var gram = new double[p][];
+        for (int j = 0; j < p; j++)
+        {
+            gram[j] = new double[p];
+        }
+
+        var xty = new double[p];
+        for (int i = 0; i < n; i++)
+        {
+            for (int j = 0; j < p; j++)
+            {
+                xty[j] += x[i][j] * y[i];
+                for (int k = 0; k < p; k++)
+                {
+                    gram[j][k] += x[i][j] * x[i][k];
+                }
+            }
+        }
+
+        double[]? bestWeights = null;
+        double bestPenalty = 0;
+        double bestError = double.PositiveInfinity;
+        double bestTrace = 0;
+        foreach (double penalty in penalties)
+        {
+            var inverse = InvertRegularized(gram, penalty);
+            var weights = Multiply(inverse, xty);
+
+            double sumSquares = 0;
+            double trace = 0;
+            for (int i = 0; i < n; i++)
+            {
+                double residual = y[i] - Dot(weights, x[i]);
+                double leverage = (1.0 / n) + Dot(x[i], Multiply(inverse, x[i]));
+                double loo = residual / Math.Max(1 - leverage, 1e-9);
+                sumSquares += loo * loo;
+                trace += leverage;
+            }
+
+            double error = Math.Sqrt(sumSquares / n);
+            if (error < bestError)
+            {
+                bestError = error;
+                bestPenalty = penalty;
+                bestWeights = weights;
+                bestTrace = trace;
+            }
+        }
+
+        return new Solution(means, scales, bestWeights!, yMean, bestPenalty, bestTrace);
+    }
+
+    /// <summary>
+    /// Inverts gram + penalty * I by Gauss-Jordan elimination (the matrix is symmetric positive definite).
+    /// </summary>
+    private static double[][] InvertRegularized(double[][] gram, double penalty)
+    {
+        int p = gram.Length;
+        var a = new double[p][];
+        for (int j = 0; j < p; j++)
+        {
+            a[j] = new double[2 * p];
+            for (int k = 0; k < p; k++)
+            {
+                a[j][k] = gram[j][k] + (j == k ? penalty : 0);
+            }
+
+            a[j][p + j] = 1;
+        }
+
+        for (int col = 0; col < p; col++)
+        {
+            int pivot = col;
+            for (int r = col + 1; r < p; r++)
+            {
+                if (Math.Abs(a[r][col]) > Math.Abs(a[pivot][col]))
+                {
+                    pivot = r;
+                }
+            }
+
+            (a[col], a[pivot]) = (a[pivot], a[col]);
+
+            double scale = a[col][col];
+            for (int k = 0; k < 2 * p; k++)
+            {
+                a[col][k] /= scale;
+            }
+
+            for (int r = 0; r < p; r++)
+            {
+                double factor = a[r][col];
+                if (r == col || factor == 0)
+                {
+                    continue;
+                }
+
+                for (int k = 0; k < 2 * p; k++)
+                {
+                    a[r][k] -= factor * a[col][k];
+                }
+            }
+        }
+
+        return [.. a.Select(row => row[p..])];
+    }
+
+    private static double[] Multiply(double[][] matrix, double[] vector)
+    {
+        var result = new double[vector.Length];
+        for (int j = 0; j < vector.Length; j++)
+        {
+            for (int k = 0; k < vector.Length; k++)
+            {
+                result[j] += matrix[j][k] * vector[k];
+            }
+        }
+
+        return result;
+    }
+
+    private static double Dot(double[] a, double[] b)
+    {
+        double sum = 0;
+        for (int j = 0; j < a.Length; j++)
+        {
+            sum += a[j] * b[j];
+        }
+
+        return sum;
+    }
+
+    /// <summary>
+    /// A fitted model in standardized coordinates.
+    /// </summary>
+    private sealed record Solution(double[] Means, double[] Scales, double[] Weights, double Intercept, double Penalty, double EffectiveParameters)
+    {
+        public double Predict(ReadOnlySpan<double> features)
+        {
+            double prediction = this.Intercept;
+            for (int j = 0; j < features.Length; j++)
+            {
+                if (this.Scales[j] > 0)
+                {
+                    prediction += this.Weights[j] * (features[j] - this.Means[j]) / this.Scales[j];
+                }
+            }
+
+            return prediction;
+        }
+    }
+}
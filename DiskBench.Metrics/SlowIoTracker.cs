@@ -0,0 +1,232 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace DiskBench.Metrics;
+
+/// <summary>
+/// A single slow or stuck IO. Timestamps are in Stopwatch ticks.
+/// </summary>
+/// <param name="Offset">File offset of the IO.</param>
+/// <param name="Size">IO size in bytes.</param>
+/// <param name="IsWrite">Whether the IO was a write.</param>
+/// <param name="Slot">Engine slot (queue position) that issued the IO.</param>
+/// <param name="SubmitTimestamp">When the IO was submitted.</param>
+/// <param name="CompleteTimestamp">When the IO completed, or when it was observed still in flight for stuck IOs.</param>
+[StructLayout(LayoutKind.Auto)]
+public readonly record struct SlowIoRecord(
+    long Offset,
+    int Size,
+    bool IsWrite,
+    int Slot,
+    long SubmitTimestamp,
+    long CompleteTimestamp)
+{
+    /// <summary>
+    /// Latency (or age, for stuck IOs) in Stopwatch ticks.
+    /// </summary>
+    public long LatencyTicks => this.CompleteTimestamp - this.SubmitTimestamp;
+}
+
+/// <summary>
+/// Captures the slowest IOs of a trial without full tracing.
+/// Keeps a fixed-size min-heap of the top-K slowest completions, a bounded log of completions
+/// over a latency threshold, and a bounded log of IOs found in flight longer than a timeout.
+/// All storage is allocated up front, so recording is allocation-free.
+/// </summary>
+public sealed class SlowIoTracker
+{
+    /// <summary>
+    /// Default number of records kept for threshold and stuck logs.
+    /// </summary>
+    public const int DefaultLogCapacity = 256;
+
+    private readonly SlowIoRecord[] _heap;
+    private readonly SlowIoRecord[] _overThreshold;
+    private readonly SlowIoRecord[] _stuck;
+    private readonly long _thresholdTicks;
+    private readonly long _stuckTimeoutTicks;
+
+    private int _heapCount;
+    private int _overThresholdCount;
+    private long _overThresholdTotal;
+    private int _stuckCount;
+    private long _stuckTotal;
+
+    /// <summary>
+    /// Creates a new slow IO tracker.
+    /// </summary>
+    /// <param name="topK">Number of slowest IOs to keep (0 = disabled).</param>
+    /// <param name="thresholdTicks">Record every completion at or above this latency (0 = disabled).</param>
+    /// <param name="stuckTimeoutTicks">In-flight age at which an IO is reported as stuck (0 = disabled).</param>
+    /// <param name="logCapacity">Maximum records kept for each of the threshold and stuck logs.</param>
+    public SlowIoTracker(int topK, long thresholdTicks, long stuckTimeoutTicks, int logCapacity = DefaultLogCapacity)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(topK);
+        ArgumentOutOfRangeException.ThrowIfNegative(thresholdTicks);
+        ArgumentOutOfRangeException.ThrowIfNegative(stuckTimeoutTicks);
+        ArgumentOutOfRangeException.ThrowIfNegative(logCapacity);
+
+        this._heap = new SlowIoRecord[topK];
+        this._thresholdTicks = thresholdTicks > 0 ? thresholdTicks : long.MaxValue;
+        this._stuckTimeoutTicks = stuckTimeoutTicks > 0 ? stuckTimeoutTicks : long.MaxValue;
+        this._overThreshold = new SlowIoRecord[thresholdTicks > 0 ? logCapacity : 0];
+        this._stuck = new SlowIoRecord[stuckTimeoutTicks > 0 ? logCapacity : 0];
+    }
+
+    /// <summary>
+    /// Gets the number of slowest IOs kept.
+    /// </summary>
+    public int TopK => this._heap.Length;
+
+    /// <summary>
+    /// Gets whether in-flight IOs are checked for being stuck.
+    /// </summary>
+    public bool TracksStuck => this._stuckTimeoutTicks != long.MaxValue;
+
+    /// <summary>
+    /// Gets the total number of completions over the threshold (including any not kept in the log).
+    /// </summary>
+    public long OverThresholdCount => this._overThresholdTotal;
+
+    /// <summary>
+    /// Gets the total number of stuck IOs detected (including any not kept in the log).
+    /// </summary>
+    public long StuckCount => this._stuckTotal;
+
+    /// <summary>
+    /// Records a completed IO. Cheap when the IO is neither over the threshold nor among the slowest.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordCompletion(long offset, int size, bool isWrite, int slot, long submitTimestamp, long completeTimestamp)
+    {
+        long latency = completeTimestamp - submitTimestamp;
+
+        bool topCandidate = this._heap.Length > 0 &&
+            (this._heapCount < this._heap.Length || latency > this._heap[0].LatencyTicks);
+
+        if (!topCandidate && latency < this._thresholdTicks)
+        {
+            return;
+        }
+
+        var record = new SlowIoRecord(offset, size, isWrite, slot, submitTimestamp, completeTimestamp);
+
+        if (topCandidate)
+        {
+            this.PushTopK(record);
+        }
+
+        if (latency >= this._thresholdTicks)
+        {
+            this._overThresholdTotal++;
+            if (this._overThresholdCount < this._overThreshold.Length)
+            {
+                this._overThreshold[this._overThresholdCount++] = record;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Returns whether an IO submitted at <paramref name="submitTimestamp"/> has been in flight past the stuck timeout.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public bool IsStuck(long submitTimestamp, long now)
+    {
+        return now - submitTimestamp >= this._stuckTimeoutTicks;
+    }
+
+    /// <summary>
+    /// Records an IO observed in flight past the stuck timeout. Callers report each IO once.
+    /// </summary>
+    public void RecordStuck(long offset, int size, bool isWrite, int slot, long submitTimestamp, long observedTimestamp)
+    {
+        this._stuckTotal++;
+        if (this._stuckCount < this._stuck.Length)
+        {
+            this._stuck[this._stuckCount++] = new SlowIoRecord(offset, size, isWrite, slot, submitTimestamp, observedTimestamp);
+        }
+    }
+
+    /// <summary>
+    /// Gets the slowest IOs, slowest first.
+    /// </summary>
+    public SlowIoRecord[] GetTopSlowest()
+    {
+        var result = this._heap.AsSpan(0, this._heapCount).ToArray();
+        Array.Sort(result, static (a, b) => b.LatencyTicks.CompareTo(a.LatencyTicks));
+        return result;
+    }
+
+    /// <summary>
+    /// Gets the logged completions over the threshold, in completion order.
+    /// </summary>
+    public SlowIoRecord[] GetOverThreshold() => this._overThreshold.AsSpan(0, this._overThresholdCount).ToArray();
+
+    /// <summary>
+    /// Gets the logged stuck IOs, in detection order.
+    /// </summary>
+    public SlowIoRecord[] GetStuck() => this._stuck.AsSpan(0, this._stuckCount).ToArray();
+
+    /// <summary>
+    /// Clears the top-K heap and threshold log (e.g., at the end of warmup).
+    /// Stuck IOs are kept: an IO stuck during warmup is still a device health signal.
+    /// </summary>
+    public void ResetCompletions()
+    {
+        this._heapCount = 0;
+        this._overThresholdCount = 0;
+        this._overThresholdTotal = 0;
+    }
+
+    private void PushTopK(SlowIoRecord record)
+    {
+        var heap = this._heap;
+
+        if (this._heapCount < heap.Length)
+        {
+            // Sift up
+            int i = this._heapCount++;
+            while (i > 0)
+            {
+                int parent = (i - 1) / 2;
+                if (heap[parent].LatencyTicks <= record.LatencyTicks)
+                {
+                    break;
+                }
+
+                heap[i] = heap[parent];
+                i = parent;
+            }
+
+            heap[i] = record;
+            return;
+        }
+
+        // Replace the fastest of the kept IOs (the root) and sift down
+        int index = 0;
+        int count = this._heapCount;
+        while (true)
+        {
+            int child = 2 * index + 1;
+            if (child >= count)
+            {
+                break;
+            }
+
+            if (child + 1 < count && heap[child + 1].LatencyTicks < heap[child].LatencyTicks)
+            {
+                child++;
+            }
+
+            if (heap[child].LatencyTicks >= record.LatencyTicks)
+            {
+                break;
+            }
+
+            heap[index] = heap[child];
+            index = child;
+        }
+
+        heap[index] = record;
+    }
+}
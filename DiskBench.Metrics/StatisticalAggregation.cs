@@ -22,6 +22,22 @@ public static class StatisticalAggregation
         return sum / values.Length;
     }
 
+    /// <summary>
+    /// Computes the median of a set of values (0 if empty).
+    /// </summary>
+    public static double Median(ReadOnlySpan<double> values)
+    {
+        if (values.Length == 0)
+        {
+            return 0;
+        }
+
+        var sorted = values.ToArray();
+        Array.Sort(sorted);
+        int mid = sorted.Length / 2;
+        return sorted.Length % 2 == 1 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2;
+    }
+
     /// <summary>
     /// Computes the sample standard deviation.
     /// </summary>
@@ -42,6 +58,44 @@ public static class StatisticalAggregation
         return Math.Sqrt(sumSquares / (values.Length - 1));
     }
 
+    /// <summary>
+    /// Computes a Student-t 95% confidence interval for the mean.
+    /// Cheap enough to re-evaluate after every sample, which makes it suitable for early stopping.
+    /// </summary>
+    /// <param name="values">Sample values.</param>
+    /// <returns>Tuple of (lower bound, upper bound).</returns>
+    public static (double Lower, double Upper) StudentTConfidenceInterval(ReadOnlySpan<double> values)
+    {
+        if (values.Length < 2)
+        {
+            double val = values.Length > 0 ? values[0] : 0;
+            return (val, val);
+        }
+
+        double mean = Mean(values);
+        double halfWidth = TCritical95(values.Length - 1) * StandardDeviation(values) / Math.Sqrt(values.Length);
+        return (mean - halfWidth, mean + halfWidth);
+    }
+
+    /// <summary>
+    /// Gets the two-sided 95% critical value of Student's t distribution.
+    /// </summary>
+    /// <param name="degreesOfFreedom">Degrees of freedom (sample count minus one).</param>
+    public static double TCritical95(int degreesOfFreedom)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(degreesOfFreedom);
+        return degreesOfFreedom <= TCritical95Table.Length
+            ? TCritical95Table[degreesOfFreedom - 1]
+            : 1.96;
+    }
+
+    private static readonly double[] TCritical95Table =
+    [
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    ];
+
     /// <summary>
     /// Computes a bootstrap 95% confidence interval for the mean.
     /// </summary>
@@ -10,6 +10,7 @@ public sealed class ThroughputTimeSeries
 {
     private readonly long[] _bytes;
     private readonly long[] _operations;
+    private readonly LatencyHistogram[]? _latency;
     private readonly int _maxSeconds;
     private int _currentSecond;
 
@@ -23,16 +24,31 @@ public sealed class ThroughputTimeSeries
     /// </summary>
     public int CurrentSecond => this._currentSecond;
 
+    /// <summary>
+    /// Gets whether a latency histogram is kept for every second.
+    /// </summary>
+    public bool TracksLatency => this._latency != null;
+
     /// <summary>
     /// Creates a new throughput time series.
     /// </summary>
     /// <param name="maxSeconds">Maximum duration in seconds.</param>
-    public ThroughputTimeSeries(int maxSeconds)
+    /// <param name="trackLatency">Whether to keep a latency histogram per second (allocated up front).</param>
+    public ThroughputTimeSeries(int maxSeconds, bool trackLatency = false)
     {
         ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxSeconds);
         _maxSeconds = maxSeconds;
         _bytes = new long[maxSeconds];
         _operations = new long[maxSeconds];
+
+        if (trackLatency)
+        {
+            _latency = new LatencyHistogram[maxSeconds];
+            for (int i = 0; i < maxSeconds; i++)
+            {
+                _latency[i] = new LatencyHistogram();
+            }
+        }
     }
 
     /// <summary>
@@ -52,6 +68,26 @@ public sealed class ThroughputTimeSeries
         }
     }
 
+    /// <summary>
+    /// Records the latency of an IO that completed in a specific second (ignored unless latency is tracked).
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public void RecordLatency(int second, long latencyTicks)
+    {
+        if (this._latency != null && (uint)second < (uint)this._maxSeconds)
+        {
+            this._latency[second].RecordLatencyTicks(latencyTicks);
+        }
+    }
+
+    /// <summary>
+    /// Gets the latency histogram for a specific second, or null if latency is not tracked.
+    /// </summary>
+    public LatencyHistogram? GetLatencyHistogram(int second)
+    {
+        return this._latency != null && (uint)second < (uint)this._maxSeconds ? this._latency[second] : null;
+    }
+
     /// <summary>
     /// Gets the bytes transferred in a specific second.
     /// </summary>
@@ -107,6 +143,17 @@ public sealed class ThroughputTimeSeries
     {
         Array.Clear(this._bytes, 0, this._currentSecond);
         Array.Clear(this._operations, 0, this._currentSecond);
+        if (this._latency != null)
+        {
+            foreach (var histogram in this._latency)
+            {
+                if (histogram.Count > 0)
+                {
+                    histogram.Reset();
+                }
+            }
+        }
+
         this._currentSecond = 0;
     }
 
@@ -11,7 +11,7 @@ public sealed class TrialMetricsCollector
 {
     private readonly LatencyHistogram _histogram;
     private readonly ThroughputTimeSeries? _timeSeries;
-    private readonly long _startTimestamp;
+    private long _startTimestamp;
     private readonly double _ticksPerSecond;
 
     private long _totalBytes;
@@ -57,10 +57,11 @@ public sealed class TrialMetricsCollector
     /// </summary>
     /// <param name="maxDurationSeconds">Maximum duration for time series.</param>
     /// <param name="collectTimeSeries">Whether to collect time series data.</param>
-    public TrialMetricsCollector(int maxDurationSeconds, bool collectTimeSeries = true)
+    /// <param name="collectIntervalLatency">Whether to keep a latency histogram per second of the time series.</param>
+    public TrialMetricsCollector(int maxDurationSeconds, bool collectTimeSeries = true, bool collectIntervalLatency = false)
     {
         _histogram = new LatencyHistogram();
-        _timeSeries = collectTimeSeries ? new ThroughputTimeSeries(maxDurationSeconds + 10) : null;
+        _timeSeries = collectTimeSeries ? new ThroughputTimeSeries(maxDurationSeconds + 10, collectIntervalLatency) : null;
         _startTimestamp = Stopwatch.GetTimestamp();
         _ticksPerSecond = Stopwatch.Frequency;
     }
@@ -96,6 +97,7 @@ public sealed class TrialMetricsCollector
         if (this._timeSeries != null)
         {
             int second = (int)((completionTimestamp - this._startTimestamp) / this._ticksPerSecond);
+            this._timeSeries.RecordLatency(second, latencyTicks);
 
             if (second == this._currentSecond)
             {
@@ -131,10 +133,11 @@ public sealed class TrialMetricsCollector
     }
 
     /// <summary>
-    /// Resets all metrics.
+    /// Resets all metrics and restarts the time series clock, so second 0 is the moment of the reset.
     /// </summary>
     public void Reset()
     {
+        this._startTimestamp = Stopwatch.GetTimestamp();
         this._histogram.Reset();
         this._timeSeries?.Reset();
         this._totalBytes = 0;
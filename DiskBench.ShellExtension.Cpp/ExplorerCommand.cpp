@@ -18,13 +18,13 @@ const wchar_t* CONFIG_REG_PATH = L"SOFTWARE\\DiskBench\\ShellExtension";
 ExplorerCommand::ExplorerCommand() : m_refCount(1)
 {
     OutputDebugString(L"ExplorerCommand constructed\n");
-    LogMessage(L"ExplorerCommand ctor");
+    LOG_DEBUG(L"ExplorerCommand ctor");
 }
 
 ExplorerCommand::~ExplorerCommand()
 {
     OutputDebugString(L"ExplorerCommand destructed\n");
-    LogMessage(L"ExplorerCommand dtor");
+    LOG_DEBUG(L"ExplorerCommand dtor");
 }
 
 // IUnknown implementation
@@ -63,7 +63,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::GetTitle(IShellItemArray* psiItemArra
     OutputDebugString(L"GetTitle\n");
 
     UNREFERENCED_PARAMETER(psiItemArray);
-    LogMessage(L"GetTitle");
+    LOG_DEBUG(L"GetTitle");
 
     if (ppszName == nullptr)
         return E_POINTER;
@@ -82,7 +82,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::GetIcon(IShellItemArray* psiItemArray
     OutputDebugString(L"GetIcon\n");
 
     UNREFERENCED_PARAMETER(psiItemArray);
-    LogMessage(L"GetIcon");
+    LOG_DEBUG(L"GetIcon");
 
     if (ppszIcon == nullptr)
         return E_POINTER;
@@ -107,7 +107,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::GetIcon(IShellItemArray* psiItemArray
             return E_OUTOFMEMORY;
 
         StringCchPrintf(*ppszIcon, len, L"%s,0", iconPath);
-        LogMessage(L"GetIcon: %s", *ppszIcon);
+        LOG_DEBUG(L"GetIcon: %s", *ppszIcon);
         return S_OK;
     }
 
@@ -121,7 +121,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::GetToolTip(IShellItemArray* psiItemAr
     OutputDebugString(L"GetToolTip\n");
 
     UNREFERENCED_PARAMETER(psiItemArray);
-    LogMessage(L"GetToolTip");
+    LOG_DEBUG(L"GetToolTip");
 
     if (ppszInfotip == nullptr)
         return E_POINTER;
@@ -139,7 +139,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::GetCanonicalName(GUID* pguidCommandNa
 {
     OutputDebugString(L"GetCanonicalName\n");
 
-    LogMessage(L"GetCanonicalName");
+    LOG_DEBUG(L"GetCanonicalName");
     if (pguidCommandName == nullptr)
         return E_POINTER;
 
@@ -152,7 +152,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::GetState(IShellItemArray* psiItemArra
     OutputDebugString(L"GetState\n");
 
     UNREFERENCED_PARAMETER(fOkToBeSlow);
-    LogMessage(L"GetState");
+    LOG_DEBUG(L"GetState");
 
     if (pCmdState == nullptr)
         return E_POINTER;
@@ -227,7 +227,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::GetFlags(EXPCMDFLAGS* pFlags)
 {
     OutputDebugString(L"GetFlags\n");
 
-    LogMessage(L"GetFlags");
+    LOG_DEBUG(L"GetFlags");
     if (pFlags == nullptr)
         return E_POINTER;
 
@@ -239,7 +239,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::EnumSubCommands(IEnumExplorerCommand*
 {
     OutputDebugString(L"EnumSubCommands\n");
 
-    LogMessage(L"EnumSubCommands");
+    LOG_DEBUG(L"EnumSubCommands");
     if (ppEnum == nullptr)
         return E_POINTER;
 
@@ -250,7 +250,7 @@ HRESULT STDMETHODCALLTYPE ExplorerCommand::EnumSubCommands(IEnumExplorerCommand*
 // Helper methods
 HRESULT ExplorerCommand::GetSelectedDrivePath(IShellItemArray* psiItemArray, LPWSTR pszPath, UINT cchPath)
 {
-    LogMessage(L"GetSelectedDrivePath");
+    LOG_DEBUG(L"GetSelectedDrivePath");
     if (psiItemArray == nullptr || pszPath == nullptr || cchPath == 0)
         return E_INVALIDARG;
 
@@ -282,7 +282,7 @@ HRESULT ExplorerCommand::GetSelectedDrivePath(IShellItemArray* psiItemArray, LPW
                 StringCchCopy(pszPath, cchPath, drivePath);
                 CoTaskMemFree(pszName);
                 psi->Release();
-                LogMessage(L"GetSelectedDrivePath: %s", pszPath);
+                LOG_DEBUG(L"GetSelectedDrivePath: %s", pszPath);
                 return S_OK;
             }
         }
@@ -291,7 +291,7 @@ HRESULT ExplorerCommand::GetSelectedDrivePath(IShellItemArray* psiItemArray, LPW
     }
 
     psi->Release();
-    LogMessage(L"GetSelectedDrivePath: no drive");
+    LOG_DEBUG(L"GetSelectedDrivePath: no drive");
     return S_FALSE;
 }
 
@@ -311,13 +311,13 @@ HRESULT ExplorerCommand::ReadExePathFromRegistry(LPWSTR pszExePath, UINT cchExeP
     if (result != ERROR_SUCCESS)
     {
         OutputDebugString(L"ReadExePathFromRegistry: RegOpenKeyEx HKLM failed\n");
-        LogMessage(L"ReadExePathFromRegistry: RegOpenKeyEx HKLM failed (%ld)", result);
+        LOG_DEBUG(L"ReadExePathFromRegistry: RegOpenKeyEx HKLM failed (%ld)", result);
 
         result = RegOpenKeyEx(HKEY_CURRENT_USER, CONFIG_REG_PATH, 0, KEY_READ, &hKey);
         if (result != ERROR_SUCCESS)
         {
             OutputDebugString(L"ReadExePathFromRegistry: RegOpenKeyEx HKCU failed\n");
-            LogMessage(L"ReadExePathFromRegistry: RegOpenKeyEx HKCU failed (%ld)", result);
+            LOG_WARN(L"ReadExePathFromRegistry: RegOpenKeyEx HKCU failed (%ld)", result);
             return E_FAIL;
         }
     }
@@ -330,7 +330,7 @@ HRESULT ExplorerCommand::ReadExePathFromRegistry(LPWSTR pszExePath, UINT cchExeP
     if (result != ERROR_SUCCESS)
     {
         OutputDebugString(L"ReadExePathFromRegistry: RegQueryValueEx failed\n");
-        LogMessage(L"ReadExePathFromRegistry: RegQueryValueEx failed (%ld)", result);
+        LOG_WARN(L"ReadExePathFromRegistry: RegQueryValueEx failed (%ld)", result);
         return E_FAIL;
     }
 
@@ -1,34 +1,43 @@
 // Logger.cpp
+// Win32 glue for RingLogger: producers format and enqueue, a lazily started flusher
+// thread owns the log file and writes queued lines in batches.
 #include "stdafx.h"
 #include "Logger.h"
 
-static void AppendLineUtf8(const wchar_t* line)
-{
-    if (line == nullptr)
-        return;
+extern const wchar_t* CONFIG_REG_PATH;
+
+RingLogger g_logRing;
+
+static const unsigned FLUSH_INTERVAL_MS = 50;
+static const unsigned FLUSHER_IDLE_EXIT_MS = 5000;
 
+static INIT_ONCE s_initOnce = INIT_ONCE_STATIC_INIT;
+static volatile LONG s_flusherRunning = 0;
+
+static HANDLE OpenLogFile()
+{
     wchar_t path[MAX_PATH] = {};
     DWORD len = GetEnvironmentVariableW(L"LOCALAPPDATA", path, ARRAYSIZE(path));
     if (len == 0 || len >= ARRAYSIZE(path))
     {
         DWORD tmpLen = GetTempPathW(ARRAYSIZE(path), path);
         if (tmpLen == 0 || tmpLen >= ARRAYSIZE(path))
-            return;
+            return INVALID_HANDLE_VALUE;
     }
 
     wchar_t filePath[MAX_PATH] = {};
     HRESULT hr = StringCchPrintfW(filePath, ARRAYSIZE(filePath), L"%s\\DiskBench\\ShellExtension.log", path);
     if (FAILED(hr))
-        return;
+        return INVALID_HANDLE_VALUE;
 
     wchar_t dirPath[MAX_PATH] = {};
     hr = StringCchPrintfW(dirPath, ARRAYSIZE(dirPath), L"%s\\DiskBench", path);
     if (FAILED(hr))
-        return;
+        return INVALID_HANDLE_VALUE;
 
     CreateDirectoryW(dirPath, nullptr);
 
-    HANDLE hFile = CreateFileW(
+    return CreateFileW(
         filePath,
         FILE_APPEND_DATA,
         FILE_SHARE_READ | FILE_SHARE_WRITE,
@@ -36,50 +45,126 @@ static void AppendLineUtf8(const wchar_t* line)
         OPEN_ALWAYS,
         FILE_ATTRIBUTE_NORMAL,
         nullptr);
+}
+
+static bool WriteBatch(const char* data, size_t length, void* context)
+{
+    HANDLE hFile = static_cast<HANDLE>(context);
     if (hFile == INVALID_HANDLE_VALUE)
-        return;
+        return false;
+
+    DWORD bytesWritten = 0;
+    return WriteFile(hFile, data, static_cast<DWORD>(length), &bytesWritten, nullptr) != FALSE;
+}
 
-    char utf8[2048] = {};
-    int utf8Len = WideCharToMultiByte(CP_UTF8, 0, line, -1, utf8, ARRAYSIZE(utf8) - 3, nullptr, nullptr);
-    if (utf8Len <= 0)
+static DWORD WINAPI FlusherThreadProc(LPVOID param)
+{
+    HMODULE hSelf = static_cast<HMODULE>(param);
+    HANDLE hFile = OpenLogFile();
+
+    for (;;)
     {
+        g_logRing.RunFlusher(WriteBatch, hFile, FLUSH_INTERVAL_MS, FLUSHER_IDLE_EXIT_MS);
+
+        // A producer that enqueues after this store sees the flag clear and starts a new
+        // flusher; one that enqueued before it is caught by the emptiness check below.
+        InterlockedExchange(&s_flusherRunning, 0);
+        if (g_logRing.IsEmpty() || InterlockedCompareExchange(&s_flusherRunning, 1, 0) != 0)
+            break;
+    }
+
+    if (hFile != INVALID_HANDLE_VALUE)
         CloseHandle(hFile);
+
+    // Drop the reference taken in EnsureFlusher so the DLL can unload while idle
+    FreeLibraryAndExitThread(hSelf, 0);
+}
+
+static void EnsureFlusher()
+{
+    // Order the enqueue before reading the flag (pairs with the exchange in FlusherThreadProc)
+    MemoryBarrier();
+    if (s_flusherRunning != 0 || InterlockedCompareExchange(&s_flusherRunning, 1, 0) != 0)
+        return;
+
+    // Pin the module for the lifetime of the thread
+    HMODULE hSelf = nullptr;
+    if (!GetModuleHandleExW(
+            GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS,
+            reinterpret_cast<LPCWSTR>(&FlusherThreadProc),
+            &hSelf))
+    {
+        InterlockedExchange(&s_flusherRunning, 0);
         return;
     }
 
-    utf8[utf8Len - 1] = '\r';
-    utf8[utf8Len] = '\n';
-    utf8[utf8Len + 1] = '\0';
+    HANDLE hThread = CreateThread(nullptr, 0, FlusherThreadProc, hSelf, 0, nullptr);
+    if (hThread == nullptr)
+    {
+        FreeLibrary(hSelf);
+        InterlockedExchange(&s_flusherRunning, 0);
+        return;
+    }
 
-    DWORD bytesWritten = 0;
-    WriteFile(hFile, utf8, (DWORD)(utf8Len + 1), &bytesWritten, nullptr);
-    CloseHandle(hFile);
+    CloseHandle(hThread);
 }
 
-void LogMessage(const wchar_t* format, ...)
+static BOOL CALLBACK ReadLogLevel(PINIT_ONCE, PVOID, PVOID*)
+{
+    // DWORD 0=Debug, 1=Info, 2=Warning, 3=Error, 4=Off under HKLM or HKCU
+    DWORD level = 0;
+    DWORD size = sizeof(level);
+    LONG result = RegGetValueW(HKEY_LOCAL_MACHINE, CONFIG_REG_PATH, L"LogLevel", RRF_RT_REG_DWORD, nullptr, &level, &size);
+    if (result != ERROR_SUCCESS)
+    {
+        size = sizeof(level);
+        result = RegGetValueW(HKEY_CURRENT_USER, CONFIG_REG_PATH, L"LogLevel", RRF_RT_REG_DWORD, nullptr, &level, &size);
+    }
+
+    if (result == ERROR_SUCCESS && level <= static_cast<DWORD>(LogLevel::Off))
+        g_logRing.SetLevel(static_cast<LogLevel>(level));
+
+    return TRUE;
+}
+
+void LogInitialize()
+{
+    InitOnceExecuteOnce(&s_initOnce, ReadLogLevel, nullptr, nullptr);
+}
+
+static void LogWriteV(LogLevel level, const wchar_t* format, va_list args)
+{
+    wchar_t buffer[RingLogger::MaxMessageLength] = {};
+    _vsnwprintf_s(buffer, ARRAYSIZE(buffer), _TRUNCATE, format, args);
+
+    // Up to three UTF-8 bytes per UTF-16 unit; TryPush truncates to the slot size
+    char utf8[RingLogger::MaxMessageLength * 3] = {};
+    int utf8Len = WideCharToMultiByte(CP_UTF8, 0, buffer, -1, utf8, ARRAYSIZE(utf8), nullptr, nullptr);
+    if (utf8Len <= 1)
+        return;
+
+    g_logRing.TryPush(level, utf8, static_cast<size_t>(utf8Len - 1));
+    EnsureFlusher();
+}
+
+void LogWrite(LogLevel level, const wchar_t* format, ...)
 {
-    if (format == nullptr)
+    if (format == nullptr || !g_logRing.IsEnabled(level))
         return;
 
-    wchar_t buffer[1024] = {};
     va_list args;
     va_start(args, format);
-    _vsnwprintf_s(buffer, ARRAYSIZE(buffer), _TRUNCATE, format, args);
+    LogWriteV(level, format, args);
     va_end(args);
+}
 
-    SYSTEMTIME st = {};
-    GetLocalTime(&st);
-
-    wchar_t line[1200] = {};
-    HRESULT hr = StringCchPrintfW(
-        line,
-        ARRAYSIZE(line),
-        L"%04u-%02u-%02u %02u:%02u:%02u.%03u [DiskBench.ShellExtension.Cpp] %s",
-        st.wYear, st.wMonth, st.wDay,
-        st.wHour, st.wMinute, st.wSecond, st.wMilliseconds,
-        buffer);
-    if (FAILED(hr))
+void LogMessage(const wchar_t* format, ...)
+{
+    if (format == nullptr || !g_logRing.IsEnabled(LogLevel::Info))
         return;
 
-    AppendLineUtf8(line);
+    va_list args;
+    va_start(args, format);
+    LogWriteV(LogLevel::Info, format, args);
+    va_end(args);
 }
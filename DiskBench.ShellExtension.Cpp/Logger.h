@@ -1,4 +1,30 @@
 // Logger.h
 #pragma once
 
+#include "RingLogger.h"
+
+// Messages are queued in a lock-free ring and written to the log file by a background
+// flusher thread, so callers on Explorer's UI thread never touch the file system.
+extern RingLogger g_logRing;
+
+// Reads the LogLevel registry value (once). Call from the DLL entry points.
+void LogInitialize();
+
+inline bool LogIsEnabled(LogLevel level)
+{
+    return g_logRing.IsEnabled(level);
+}
+
+void LogWrite(LogLevel level, const wchar_t* format, ...);
+
+// Info-level message
 void LogMessage(const wchar_t* format, ...);
+
+// Level check happens before the arguments are evaluated or formatted
+#define LOG_AT(level, ...) \
+    do { if (LogIsEnabled(level)) LogWrite((level), __VA_ARGS__); } while (0)
+
+#define LOG_DEBUG(...) LOG_AT(LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...) LOG_AT(LogLevel::Info, __VA_ARGS__)
+#define LOG_WARN(...) LOG_AT(LogLevel::Warning, __VA_ARGS__)
+#define LOG_ERROR(...) LOG_AT(LogLevel::Error, __VA_ARGS__)
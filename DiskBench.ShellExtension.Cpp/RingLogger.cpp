@@ -0,0 +1,240 @@
+// RingLogger.cpp
+// Bounded MPSC ring (sequence number per slot) drained by a single flusher.
+// Producers only copy into a slot; timestamp formatting and file IO happen on the flusher.
+#include "RingLogger.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <new>
+#include <thread>
+
+static_assert((RingLogger::Capacity & (RingLogger::Capacity - 1)) == 0, "Capacity must be a power of two");
+
+static const char* LevelName(LogLevel level)
+{
+    switch (level)
+    {
+    case LogLevel::Debug: return "DEBUG";
+    case LogLevel::Info: return "INFO";
+    case LogLevel::Warning: return "WARN";
+    case LogLevel::Error: return "ERROR";
+    default: return "?";
+    }
+}
+
+static int64_t NowMilliseconds()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static size_t FormatHeader(char* out, size_t capacity, int64_t timestampMs, const char* levelName)
+{
+    time_t seconds = static_cast<time_t>(timestampMs / 1000);
+    unsigned millis = static_cast<unsigned>(timestampMs % 1000);
+
+    struct tm local = {};
+#ifdef _WIN32
+    localtime_s(&local, &seconds);
+#else
+    localtime_r(&seconds, &local);
+#endif
+
+    int written = snprintf(
+        out,
+        capacity,
+        "%04d-%02d-%02d %02d:%02d:%02d.%03u [DiskBench.ShellExtension.Cpp] [%s] ",
+        local.tm_year + 1900, local.tm_mon + 1, local.tm_mday,
+        local.tm_hour, local.tm_min, local.tm_sec, millis,
+        levelName);
+    if (written < 0)
+        return 0;
+    return static_cast<size_t>(written) < capacity ? static_cast<size_t>(written) : capacity - 1;
+}
+
+RingLogger::RingLogger()
+    : m_slots(new Slot[Capacity])
+    , m_enqueuePos(0)
+    , m_dequeuePos(0)
+    , m_dropped(0)
+    , m_reportedDropped(0)
+    , m_level(static_cast<int>(LogLevel::Info))
+    , m_stopRequested(false)
+    , m_batch(new char[BatchBufferSize])
+{
+    for (size_t i = 0; i < Capacity; i++)
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+RingLogger::~RingLogger()
+{
+    delete[] m_batch;
+    delete[] m_slots;
+}
+
+bool RingLogger::TryPush(LogLevel level, const char* message, size_t length)
+{
+    if (message == nullptr)
+        return false;
+
+    Slot* slot = nullptr;
+    uint64_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        slot = &m_slots[pos & (Capacity - 1)];
+        uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+        if (diff == 0)
+        {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            // Slot still holds an undrained message from the previous lap: ring is full
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (length > MaxMessageLength)
+        length = MaxMessageLength;
+
+    slot->timestampMs = NowMilliseconds();
+    slot->level = level;
+    slot->length = static_cast<uint32_t>(length);
+    memcpy(slot->text, message, length);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool RingLogger::Format(LogLevel level, const char* format, ...)
+{
+    if (format == nullptr || !IsEnabled(level))
+        return false;
+
+    char buffer[MaxMessageLength + 1];
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (written < 0)
+        return false;
+
+    size_t length = static_cast<size_t>(written) < sizeof(buffer) ? static_cast<size_t>(written) : MaxMessageLength;
+    return TryPush(level, buffer, length);
+}
+
+size_t RingLogger::AppendLine(char* out, size_t capacity, const Slot& slot) const
+{
+    size_t used = FormatHeader(out, capacity, slot.timestampMs, LevelName(slot.level));
+    size_t length = slot.length;
+    if (used + length + 2 > capacity)
+        length = capacity - used - 2;
+
+    memcpy(out + used, slot.text, length);
+    used += length;
+    out[used++] = '\r';
+    out[used++] = '\n';
+    return used;
+}
+
+size_t RingLogger::Drain(LogBatchWriter writer, void* context)
+{
+    // Worst case for a single line: header + message + CRLF
+    const size_t lineReserve = MaxMessageLength + 96;
+    size_t used = 0;
+    size_t drained = 0;
+
+    for (;;)
+    {
+        Slot& slot = m_slots[m_dequeuePos & (Capacity - 1)];
+        uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq != m_dequeuePos + 1)
+            break;
+
+        if (BatchBufferSize - used < lineReserve)
+        {
+            if (writer != nullptr)
+                writer(m_batch, used, context);
+            used = 0;
+        }
+
+        used += AppendLine(m_batch + used, BatchBufferSize - used, slot);
+        slot.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+        m_dequeuePos++;
+        drained++;
+    }
+
+    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped != m_reportedDropped)
+    {
+        if (BatchBufferSize - used < lineReserve)
+        {
+            if (writer != nullptr)
+                writer(m_batch, used, context);
+            used = 0;
+        }
+
+        char message[64];
+        int length = snprintf(
+            message,
+            sizeof(message),
+            "%llu message(s) dropped, log ring full",
+            static_cast<unsigned long long>(dropped - m_reportedDropped));
+        m_reportedDropped = dropped;
+
+        Slot notice;
+        notice.timestampMs = NowMilliseconds();
+        notice.level = LogLevel::Warning;
+        notice.length = length > 0 ? static_cast<uint32_t>(length) : 0;
+        memcpy(notice.text, message, notice.length);
+        used += AppendLine(m_batch + used, BatchBufferSize - used, notice);
+    }
+
+    if (used > 0 && writer != nullptr)
+        writer(m_batch, used, context);
+
+    return drained;
+}
+
+void RingLogger::RunFlusher(LogBatchWriter writer, void* context, unsigned intervalMs, unsigned idleExitMs)
+{
+    unsigned idleMs = 0;
+    for (;;)
+    {
+        size_t drained = Drain(writer, context);
+
+        if (m_stopRequested.load(std::memory_order_acquire))
+        {
+            Drain(writer, context);
+            return;
+        }
+
+        if (drained > 0)
+        {
+            idleMs = 0;
+        }
+        else
+        {
+            idleMs += intervalMs;
+            if (idleExitMs != 0 && idleMs >= idleExitMs && IsEmpty())
+                return;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+    }
+}
+
+bool RingLogger::IsEmpty() const
+{
+    // Consumer-side check: also reports non-empty while a producer is mid-push
+    return m_enqueuePos.load(std::memory_order_seq_cst) == m_dequeuePos;
+}
@@ -0,0 +1,85 @@
+// RingLogger.h
+// Portable lock-free log ring with a batching flusher. No Windows dependencies so the
+// core can be unit-tested on Linux; Logger.cpp provides the Win32 file sink and thread.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+enum class LogLevel : int
+{
+    Debug = 0,
+    Info = 1,
+    Warning = 2,
+    Error = 3,
+    Off = 4
+};
+
+// Receives a batch of formatted UTF-8 lines. Returns false if the write failed.
+typedef bool (*LogBatchWriter)(const char* data, size_t length, void* context);
+
+class RingLogger
+{
+public:
+    static constexpr size_t Capacity = 256;        // Slots, must be a power of two
+    static constexpr size_t MaxMessageLength = 480; // Bytes per message, longer messages are truncated
+    static constexpr size_t BatchBufferSize = 64 * 1024;
+
+    RingLogger();
+    ~RingLogger();
+
+    RingLogger(const RingLogger&) = delete;
+    RingLogger& operator=(const RingLogger&) = delete;
+
+    // Level filtering: a single relaxed load, so disabled levels cost nothing but a branch.
+    bool IsEnabled(LogLevel level) const
+    {
+        return static_cast<int>(level) >= m_level.load(std::memory_order_relaxed);
+    }
+
+    void SetLevel(LogLevel level) { m_level.store(static_cast<int>(level), std::memory_order_relaxed); }
+    LogLevel GetLevel() const { return static_cast<LogLevel>(m_level.load(std::memory_order_relaxed)); }
+
+    // Lock-free multi-producer enqueue. Never blocks: if the ring is full the message is
+    // dropped and counted. Returns false when the message was dropped.
+    bool TryPush(LogLevel level, const char* message, size_t length);
+
+    // printf-style convenience over TryPush. Formats only if the level is enabled.
+    bool Format(LogLevel level, const char* format, ...);
+
+    // Single consumer: formats queued messages as lines into the batch buffer and hands
+    // them to the writer in as few calls as possible. Returns the number of messages drained.
+    size_t Drain(LogBatchWriter writer, void* context);
+
+    // Flusher loop for a dedicated thread. Drains every intervalMs until RequestStop is
+    // called (then drains what is left) or no message arrives for idleExitMs (0 = never).
+    void RunFlusher(LogBatchWriter writer, void* context, unsigned intervalMs, unsigned idleExitMs);
+
+    void RequestStop() { m_stopRequested.store(true, std::memory_order_release); }
+    void ResetStop() { m_stopRequested.store(false, std::memory_order_release); }
+
+    bool IsEmpty() const;
+    uint64_t DroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence;
+        int64_t timestampMs;
+        LogLevel level;
+        uint32_t length;
+        char text[MaxMessageLength];
+    };
+
+    size_t AppendLine(char* out, size_t capacity, const Slot& slot) const;
+
+    Slot* m_slots;
+    alignas(64) std::atomic<uint64_t> m_enqueuePos;
+    alignas(64) uint64_t m_dequeuePos;
+    alignas(64) std::atomic<uint64_t> m_dropped;
+    uint64_t m_reportedDropped;
+    std::atomic<int> m_level;
+    std::atomic<bool> m_stopRequested;
+    char* m_batch;
+};
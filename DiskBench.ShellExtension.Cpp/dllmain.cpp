@@ -74,6 +74,8 @@ HMODULE g_hModule = nullptr;
 
 STDAPI DllGetClassObject(REFCLSID rclsid, REFIID riid, LPVOID* ppv)
 {
+    LogInitialize();
+    if (LogIsEnabled(LogLevel::Info))
     {
         wchar_t exePath[MAX_PATH] = {};
         GetModuleFileNameW(nullptr, exePath, ARRAYSIZE(exePath));
@@ -99,7 +101,7 @@ STDAPI DllGetClassObject(REFCLSID rclsid, REFIID riid, LPVOID* ppv)
 
 STDAPI DllCanUnloadNow()
 {
-    LogMessage(L"DllCanUnloadNow called");
+    LOG_DEBUG(L"DllCanUnloadNow called");
     return S_OK;
 }
 
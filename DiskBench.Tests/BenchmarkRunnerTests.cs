@@ -146,6 +146,18 @@ public class BenchmarkRunnerTests
 
         Assert.NotNull(result.Workloads[0].ThroughputCI);
         Assert.NotNull(result.Workloads[0].IopsCI);
+
+        Assert.NotNull(result.Workloads[0].LatencyCI);
+        var latencyCI = result.Workloads[0].LatencyCI!;
+        Assert.Equal([50, 90, 95, 99, 99.9], latencyCI.Select(ci => ci.Percentile));
+        Assert.All(latencyCI, ci =>
+        {
+            Assert.True(ci.LowerUs <= ci.UpperUs);
+            Assert.True(ci.OrderStatisticLowerUs <= ci.OrderStatisticUpperUs);
+        });
+
+        // A 50 ms trial has nowhere near 10 IOs beyond its p99.9
+        Assert.True(latencyCI[^1].InsufficientSamples);
     }
 
     [Fact]
@@ -257,6 +269,226 @@ public class BenchmarkRunnerTests
         Assert.Equal(2, sink.TrialCompleteCount);
     }
 
+    [Fact]
+    public async Task ProbeAsync_ReturnsBandedEstimatesWithinBudget()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        var spec = new ProbeSpec
+        {
+            FilePath = "probe.dat",
+            TimeBudget = TimeSpan.FromMilliseconds(800),
+            SliceDuration = TimeSpan.FromMilliseconds(40),
+            WarmupDuration = TimeSpan.Zero,
+            DeleteOnComplete = false
+        };
+
+        var result = await runner.ProbeAsync(spec);
+
+        Assert.Equal(4, result.Measurements.Count);
+        Assert.All(result.Measurements, m =>
+        {
+            Assert.True(m.Slices >= 2);
+            Assert.True(m.MeanIops > 0);
+            Assert.True(m.IopsBand.Lower <= m.MeanIops);
+            Assert.True(m.IopsBand.Upper >= m.MeanIops);
+        });
+        Assert.True(result.Duration < TimeSpan.FromSeconds(5));
+    }
+
+    [Fact]
+    public async Task ProbeAsync_FileSmallerThanBlock_ThrowsArgumentException()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        var spec = new ProbeSpec
+        {
+            FilePath = "probe.dat",
+            FileSize = 4096
+        };
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.ProbeAsync(spec));
+    }
+
+    [Fact]
+    public async Task RunAsync_WithEnergyMeter_ReportsEfficiency()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine, null, new ConstantPowerMeter(packageWatts: 20, dramWatts: 5));
+
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                new WorkloadSpec
+                {
+                    FilePath = "test.dat",
+                    FileSize = 1024 * 1024,
+                    BlockSize = 4096,
+                    Pattern = AccessPattern.Random,
+                    WritePercent = 0,
+                    QueueDepth = 1
+                }
+            ],
+            Trials = 2,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(100)
+        };
+
+        var result = await runner.RunAsync(plan);
+        var energy = result.Workloads[0].Energy;
+
+        Assert.NotNull(energy);
+        Assert.InRange(energy!.AverageWatts, 24.9, 25.1);
+
+        var expectedIopsPerWatt = result.Workloads[0].MeanIops / 25;
+        Assert.InRange(energy.IopsPerWatt, expectedIopsPerWatt * 0.99, expectedIopsPerWatt * 1.01);
+
+        var expectedJoulesPerGigabyte = 25 / (result.Workloads[0].MeanBytesPerSecond / 1e9);
+        Assert.InRange(energy.JoulesPerGigabyte, expectedJoulesPerGigabyte * 0.99, expectedJoulesPerGigabyte * 1.01);
+    }
+
+    [Fact]
+    public async Task RunAsync_EnergyMeterUnavailable_WarnsAndOmitsEnergy()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var sink = new TestBenchmarkSink();
+        var runner = new BenchmarkRunner(engine, sink, new RaplEnergyMeter(Path.Combine(Path.GetTempPath(), "diskbench-no-powercap")));
+
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                new WorkloadSpec
+                {
+                    FilePath = "test.dat",
+                    FileSize = 1024 * 1024,
+                    BlockSize = 4096,
+                    Pattern = AccessPattern.Random,
+                    WritePercent = 0,
+                    QueueDepth = 1,
+                    NoBuffering = true
+                }
+            ],
+            Trials = 1,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(50)
+        };
+
+        var result = await runner.RunAsync(plan);
+
+        Assert.Null(result.Workloads[0].Energy);
+        Assert.Equal(1, sink.WarningCount);
+    }
+
+    [Fact]
+    public async Task RunAsync_EnergyReadFailsMidRun_WarnsOnceAndDropsEnergy()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var sink = new TestBenchmarkSink();
+        var runner = new BenchmarkRunner(engine, sink, new FailingPowerMeter(failAfterReads: 3));
+
+        var workload = new WorkloadSpec
+        {
+            FilePath = "test.dat",
+            FileSize = 1024 * 1024,
+            BlockSize = 4096,
+            Pattern = AccessPattern.Random,
+            QueueDepth = 1
+        };
+        var plan = new BenchmarkPlan
+        {
+            Workloads = [workload, workload with { QueueDepth = 4 }],
+            Trials = 2,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(20)
+        };
+
+        var result = await runner.RunAsync(plan);
+
+        Assert.Equal(2, result.Workloads.Count);
+        Assert.All(result.Workloads, w => Assert.Equal(2, w.Trials.Count));
+        Assert.All(result.Workloads, w => Assert.Null(w.Energy));
+        Assert.Equal(1, sink.WarningCount);
+    }
+
+    [Fact]
+    public async Task RunAsync_SlowIoTopK_ReportsSlowestPerTrial()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                new WorkloadSpec
+                {
+                    FilePath = "test.dat",
+                    FileSize = 1024 * 1024,
+                    BlockSize = 4096,
+                    Pattern = AccessPattern.Random,
+                    WritePercent = 0,
+                    QueueDepth = 4
+                }
+            ],
+            Trials = 1,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(50),
+            SlowIoTopK = 5,
+            SlowIoThreshold = TimeSpan.FromMilliseconds(10)
+        };
+
+        var result = await runner.RunAsync(plan);
+        var slowIos = result.Workloads[0].Trials[0].SlowIos;
+
+        Assert.NotNull(slowIos);
+        Assert.Equal(5, slowIos!.Slowest.Count);
+        for (int i = 1; i < slowIos.Slowest.Count; i++)
+        {
+            Assert.True(slowIos.Slowest[i - 1].LatencyUs >= slowIos.Slowest[i].LatencyUs);
+        }
+
+        Assert.All(slowIos.Slowest, e => Assert.Equal(0, e.Offset % 4096));
+        Assert.Equal(0, slowIos.OverThresholdCount);
+        Assert.Empty(slowIos.Stuck);
+    }
+
+    private sealed class ConstantPowerMeter(double packageWatts, double dramWatts) : IEnergyMeter
+    {
+        private readonly long _start = System.Diagnostics.Stopwatch.GetTimestamp();
+
+        public bool IsAvailable => true;
+        public string Description => "constant";
+
+        public EnergySample Read()
+        {
+            var now = System.Diagnostics.Stopwatch.GetTimestamp();
+            var seconds = System.Diagnostics.Stopwatch.GetElapsedTime(_start, now).TotalSeconds;
+            return new EnergySample(now, packageWatts * seconds, dramWatts * seconds);
+        }
+    }
+
+    private sealed class FailingPowerMeter(int failAfterReads) : IEnergyMeter
+    {
+        private int _reads;
+
+        public bool IsAvailable => true;
+        public string Description => "failing";
+
+        public EnergySample Read()
+        {
+            if (++_reads > failAfterReads)
+            {
+                throw new IOException("energy_uj vanished");
+            }
+
+            return new EnergySample(System.Diagnostics.Stopwatch.GetTimestamp(), _reads, null);
+        }
+    }
+
     private sealed class TestBenchmarkSink : IBenchmarkSink
     {
         public bool BenchmarkStarted { get; private set; }
@@ -0,0 +1,200 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for Linux block queue settings and the queue configuration matrix against a fake sysfs,
+/// with nvme0n1 mounted at /data.
+/// </summary>
+public sealed class BlockQueueMatrixTests : IDisposable
+{
+    private readonly string _root = Path.Combine(Path.GetTempPath(), "diskbench-queue-" + Guid.NewGuid().ToString("N"));
+
+    public BlockQueueMatrixTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void ParseScheduler_FindsActiveAndAvailable()
+    {
+        var (active, available) = BlockQueueSettings.ParseScheduler("mq-deadline kyber [bfq] none\n");
+
+        Assert.Equal("bfq", active);
+        string[] expected = ["mq-deadline", "kyber", "bfq", "none"];
+        Assert.Equal(expected, available.ToArray());
+
+        Assert.Equal("none", BlockQueueSettings.ParseScheduler("none").Active);
+        Assert.Null(BlockQueueSettings.ParseScheduler("mq-deadline none").Active);
+        Assert.Empty(BlockQueueSettings.ParseScheduler("").Available);
+    }
+
+    [Fact]
+    public void Read_FindsQueueOfMountedDisk()
+    {
+        var mounts = WriteDevice();
+
+        var state = BlockQueueSettings.Read("/data/bench.dat", Sys, mounts);
+
+        Assert.NotNull(state);
+        Assert.Equal("nvme0n1", state!.Device);
+        Assert.Equal("none", state.Scheduler);
+        Assert.Equal(4, state.AvailableSchedulers.Count);
+        Assert.Equal(1023, state.NrRequests);
+        Assert.Equal(1, state.RqAffinity);
+        Assert.Equal("none nr_requests=1023 rq_affinity=1", state.ToConfig().GetDisplayName());
+        Assert.Null(BlockQueueSettings.Read("/run/x", Sys, mounts));
+    }
+
+    [Fact]
+    public void Write_WritesOnlyGivenSettings()
+    {
+        WriteDevice();
+
+        BlockQueueSettings.Write("nvme0n1", new BlockQueueConfig { Scheduler = "kyber", RqAffinity = 2 }, Sys);
+
+        Assert.Equal("kyber", File.ReadAllText(Path.Combine(QueueDir, "scheduler")));
+        Assert.Equal("1023", File.ReadAllText(Path.Combine(QueueDir, "nr_requests")).Trim());
+        Assert.Equal("2", File.ReadAllText(Path.Combine(QueueDir, "rq_affinity")));
+    }
+
+    [Fact]
+    public void CreateMatrix_BuildsCrossProduct()
+    {
+        var matrix = BlockQueueMatrixRunner.CreateMatrix(["none", "kyber"], [64, 256]);
+
+        string[] names = ["none nr_requests=64", "none nr_requests=256", "kyber nr_requests=64", "kyber nr_requests=256"];
+        Assert.Equal(names, matrix.Select(c => c.GetDisplayName()).ToArray());
+        Assert.Equal("current rq_affinity=2", Assert.Single(BlockQueueMatrixRunner.CreateMatrix(null, null, [2])).GetDisplayName());
+    }
+
+    [Fact]
+    public async Task RunAsync_AppliesEachConfigurationAndRestores()
+    {
+        var mounts = WriteDevice();
+        var warnings = new List<string>();
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BlockQueueMatrixRunner(engine, new WarningSink(warnings), Sys, mounts);
+
+        var result = await runner.RunAsync(CreatePlan(), BlockQueueMatrixRunner.CreateMatrix(["kyber", "bfq", "cfq"], [64]));
+
+        string[] names = ["current", "kyber nr_requests=64", "bfq nr_requests=64", "cfq nr_requests=64"];
+        Assert.Equal(names, result.Configurations.Select(c => c.Name).ToArray());
+        Assert.Null(result.Configurations[0].Config);
+        Assert.Equal("none", result.Configurations[0].Applied![0].Scheduler);
+        Assert.Equal("kyber", result.Configurations[1].Applied![0].Scheduler);
+        Assert.Equal(64, result.Configurations[2].Applied![0].NrRequests);
+
+        // cfq is not offered by the device
+        Assert.Null(result.Configurations[3].Result);
+        Assert.Contains("cfq not available", result.Configurations[3].SkipReason!);
+        Assert.Single(warnings);
+
+        Assert.Single(result.Original);
+        Assert.Equal(3, result.Workloads[0].Scores.Count);
+        Assert.Equal("bfq nr_requests=64", result.Workloads[0].Scores[2].TargetName);
+
+        Assert.Equal("none", File.ReadAllText(Path.Combine(QueueDir, "scheduler")));
+        Assert.Equal("1023", File.ReadAllText(Path.Combine(QueueDir, "nr_requests")).Trim());
+    }
+
+    [Fact]
+    public async Task RunAsync_UnexposedSetting_IsSkipped()
+    {
+        var mounts = WriteDevice();
+        File.Delete(Path.Combine(QueueDir, "rq_affinity"));
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BlockQueueMatrixRunner(engine, null, Sys, mounts);
+
+        var result = await runner.RunAsync(CreatePlan(), [new BlockQueueConfig { RqAffinity = 2 }]);
+
+        Assert.Equal("nvme0n1 does not expose the queue setting", result.Configurations[1].SkipReason);
+        Assert.False(File.Exists(Path.Combine(QueueDir, "rq_affinity")));
+    }
+
+    [Fact]
+    public async Task RunAsync_RejectsInvalidInput()
+    {
+        var mounts = WriteDevice();
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BlockQueueMatrixRunner(engine, null, Sys, mounts);
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(CreatePlan(), []));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(CreatePlan(), [new BlockQueueConfig { NrRequests = 0 }]));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(CreatePlan(), [new BlockQueueConfig { RqAffinity = 3 }]));
+        await Assert.ThrowsAsync<InvalidOperationException>(() => runner.RunAsync(
+            CreatePlan() with { Workloads = [CreatePlan().Workloads[0] with { FilePath = "/run/bench.dat" }] },
+            [new BlockQueueConfig { Scheduler = "kyber" }]));
+    }
+
+    private string Sys => Path.Combine(_root, "sys");
+
+    private string QueueDir => Path.Combine(Sys, "class", "block", "nvme0n1", "queue");
+
+    private static BenchmarkPlan CreatePlan() => new()
+    {
+        Workloads =
+        [
+            new WorkloadSpec
+            {
+                FilePath = "/data/bench.dat",
+                FileSize = 1024 * 1024,
+                BlockSize = 4096,
+                QueueDepth = 4
+            }
+        ],
+        Trials = 1,
+        WarmupDuration = TimeSpan.Zero,
+        MeasuredDuration = TimeSpan.FromMilliseconds(50),
+        DeleteOnComplete = false
+    };
+
+    private string WriteDevice()
+    {
+        Write(Path.Combine(QueueDir, "scheduler"), "[none] mq-deadline kyber bfq\n");
+        Write(Path.Combine(QueueDir, "nr_requests"), "1023\n");
+        Write(Path.Combine(QueueDir, "rq_affinity"), "1\n");
+
+        var mounts = Path.Combine(_root, "mounts");
+        File.WriteAllLines(mounts,
+        [
+            "/dev/sda1 / ext4 rw 0 0",
+            "/dev/nvme0n1 /data xfs rw,noatime 0 0",
+            "tmpfs /run tmpfs rw 0 0"
+        ]);
+        return mounts;
+    }
+
+    private static void Write(string path, string text)
+    {
+        Directory.CreateDirectory(Path.GetDirectoryName(path)!);
+        File.WriteAllText(path, text);
+    }
+
+    private sealed class WarningSink(List<string> warnings) : IBenchmarkSink
+    {
+        public void OnBenchmarkStart(BenchmarkPlan plan) { }
+
+        public void OnWorkloadStart(WorkloadSpec workload, int workloadIndex, int totalWorkloads) { }
+
+        public void OnTrialStart(WorkloadSpec workload, int trialNumber, int totalTrials) { }
+
+        public void OnTrialProgress(WorkloadSpec workload, int trialNumber, TrialProgress progress) { }
+
+        public void OnTrialComplete(WorkloadSpec workload, int trialNumber, TrialResult result) { }
+
+        public void OnWorkloadComplete(WorkloadSpec workload, WorkloadResult result) { }
+
+        public void OnBenchmarkComplete(BenchmarkResult result) { }
+
+        public void OnError(string message, Exception? exception = null) { }
+
+        public void OnWarning(string message) => warnings.Add(message);
+    }
+}
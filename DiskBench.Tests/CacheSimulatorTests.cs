@@ -0,0 +1,215 @@
+using DiskBench.Core;
+using DiskBench.Metrics;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for the cache replacement simulators and SHARDS miss ratio curves.
+/// </summary>
+public class CacheSimulatorTests
+{
+    private const int BlockSize = 4096;
+
+    [Theory]
+    [InlineData(CachePolicy.Lru)]
+    [InlineData(CachePolicy.Clock)]
+    [InlineData(CachePolicy.TwoQueue)]
+    [InlineData(CachePolicy.Arc)]
+    public void Access_RepeatedBlockHits_AndCountStaysWithinCapacity(CachePolicy policy)
+    {
+        var cache = CacheSimulator.Create(policy, 8);
+
+        Assert.False(cache.Access(1));
+        Assert.True(cache.Access(1));
+
+        var random = new Random(42);
+        for (int i = 0; i < 10_000; i++)
+        {
+            cache.Access(random.Next(100));
+            Assert.True(cache.Count <= cache.Capacity);
+        }
+
+        Assert.Equal(8, cache.Count);
+    }
+
+    [Theory]
+    [InlineData(CachePolicy.TwoQueue)]
+    [InlineData(CachePolicy.Arc)]
+    public void ScanResistantPolicies_KeepHotSetThroughScan(CachePolicy policy)
+    {
+        // A hot set of 20 blocks re-referenced among single-use blocks, then a one-time scan of 1000 blocks
+        var lru = CacheSimulator.Create(CachePolicy.Lru, 100);
+        var cache = CacheSimulator.Create(policy, 100);
+        long next = 1000;
+        for (int round = 0; round < 30; round++)
+        {
+            for (long block = 0; block < 20; block++)
+            {
+                lru.Access(block);
+                cache.Access(block);
+            }
+
+            for (int i = 0; i < 30; i++, next++)
+            {
+                lru.Access(next);
+                cache.Access(next);
+            }
+        }
+
+        for (int i = 0; i < 1000; i++, next++)
+        {
+            lru.Access(next);
+            cache.Access(next);
+        }
+
+        int lruHits = 0;
+        int hits = 0;
+        for (long block = 0; block < 20; block++)
+        {
+            lruHits += lru.Access(block) ? 1 : 0;
+            hits += cache.Access(block) ? 1 : 0;
+        }
+
+        Assert.Equal(0, lruHits);
+        Assert.Equal(20, hits);
+    }
+
+    [Fact]
+    public void FullSampling_LruCurveMatchesSimulation()
+    {
+        long[] cacheBlocks = [1, 10, 100, 400, 1000];
+        var builder = new MissRatioCurveBuilder(new MissRatioCurveOptions
+        {
+            SamplingRate = 1,
+            MaxSampledBlocks = 1 << 20,
+            Policies = [CachePolicy.Lru],
+            CacheSizes = [.. cacheBlocks.Select(b => b * BlockSize)]
+        });
+        var caches = cacheBlocks.Select(b => new LruCacheSimulator(b)).ToArray();
+        var misses = new long[caches.Length];
+
+        // Skewed references: mostly a small hot range with a long tail
+        var random = new Random(7);
+        const int references = 200_000;
+        for (int i = 0; i < references; i++)
+        {
+            long block = random.Next(10) < 8 ? random.Next(200) : random.Next(5000);
+            builder.AccessBlock(block);
+            for (int c = 0; c < caches.Length; c++)
+            {
+                misses[c] += caches[c].Access(block) ? 0 : 1;
+            }
+        }
+
+        var analysis = builder.Build();
+        var points = analysis.Curves.Single().Points;
+
+        Assert.Equal(1.0, analysis.SamplingRate);
+        Assert.Equal(references, analysis.SampledReferences);
+        for (int c = 0; c < caches.Length; c++)
+        {
+            Assert.Equal((double)misses[c] / references, points[c].MissRatio, 9);
+        }
+    }
+
+    [Fact]
+    public void SampledCurves_UniformRandom_ApproximateAnalyticMissRatio()
+    {
+        // Uniform references over N blocks miss with probability 1 - c/N in a cache of c blocks
+        const long footprintBlocks = 1 << 18;
+        var builder = new MissRatioCurveBuilder(new MissRatioCurveOptions
+        {
+            SamplingRate = 0.05,
+            CacheSizes = [footprintBlocks / 4 * BlockSize, footprintBlocks / 2 * BlockSize, footprintBlocks * 3 / 4 * BlockSize]
+        });
+
+        var random = new Random(11);
+        for (int i = 0; i < 4_000_000; i++)
+        {
+            builder.Access(random.NextInt64(footprintBlocks) * BlockSize, BlockSize);
+        }
+
+        var analysis = builder.Build();
+        Assert.Equal(footprintBlocks * BlockSize, (double)analysis.EstimatedFootprintBytes, footprintBlocks * BlockSize * 0.1);
+
+        // Cold misses inflate every policy's miss ratio by roughly footprint / references
+        double[] expected = [0.75, 0.5, 0.25];
+        foreach (var curve in analysis.Curves)
+        {
+            for (int i = 0; i < expected.Length; i++)
+            {
+                Assert.InRange(curve.Points[i].MissRatio, expected[i] - 0.05, expected[i] + 0.1);
+            }
+        }
+
+        var lru = analysis.Curves.Single(c => c.Policy == CachePolicy.Lru);
+        Assert.Equal(footprintBlocks / 2 * BlockSize, (double)lru.CacheSizeForHitRatio(0.5)!.Value, footprintBlocks * BlockSize * 0.1);
+        Assert.Null(lru.CacheSizeForHitRatio(0.99));
+    }
+
+    [Fact]
+    public void FixedSizeSampling_BoundsTrackedBlocks()
+    {
+        var builder = new MissRatioCurveBuilder(new MissRatioCurveOptions
+        {
+            SamplingRate = 1,
+            MaxSampledBlocks = 1000,
+            Policies = [CachePolicy.Lru]
+        });
+
+        for (long block = 0; block < 100_000; block++)
+        {
+            builder.AccessBlock(block);
+            builder.AccessBlock(block / 2);
+        }
+
+        Assert.True(builder.TrackedBlocks <= 1000);
+        Assert.True(builder.SamplingRate < 0.05);
+        Assert.Equal(100_000 * BlockSize, (double)builder.Build().EstimatedFootprintBytes, 100_000 * BlockSize * 0.25);
+    }
+
+    [Fact]
+    public async Task Observer_AnalysesIssuedIos()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var observer = new MissRatioCurveObserver(new MissRatioCurveOptions
+        {
+            SamplingRate = 1,
+            CacheSizes = [1024 * 1024, 64L * 1024 * 1024]
+        });
+
+        await engine.RunTrialAsync(new TrialSpec
+        {
+            Workload = new WorkloadSpec
+            {
+                FilePath = "cache.dat",
+                FileSize = 4 * 1024 * 1024,
+                BlockSize = 16 * 1024,
+                Pattern = AccessPattern.Sequential,
+                QueueDepth = 4
+            },
+            MeasuredDuration = TimeSpan.FromSeconds(30),
+            IoLimit = 512,
+            IoObserver = observer
+        });
+
+        // Two sequential passes over 4 MiB: the second pass hits only when the cache holds the file
+        var analysis = observer.Builder.Build();
+        Assert.Equal(512 * 4, analysis.References);
+        Assert.Equal(4 * 1024 * 1024, analysis.EstimatedFootprintBytes);
+        foreach (var curve in analysis.Curves)
+        {
+            Assert.Equal(1.0, curve.Points[0].MissRatio);
+            Assert.Equal(0.5, curve.Points[1].MissRatio);
+        }
+    }
+
+    [Fact]
+    public void Builder_InvalidOptions_Throw()
+    {
+        Assert.Throws<ArgumentException>(() => new MissRatioCurveBuilder(new MissRatioCurveOptions { SamplingRate = 0 }));
+        Assert.Throws<ArgumentException>(() => new MissRatioCurveBuilder(new MissRatioCurveOptions { CacheSizes = [] }));
+        Assert.Throws<ArgumentOutOfRangeException>(() => new MissRatioCurveBuilder(new MissRatioCurveOptions { BlockSize = 0 }));
+    }
+}
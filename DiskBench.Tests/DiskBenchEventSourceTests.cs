@@ -0,0 +1,81 @@
+using System.Collections.Concurrent;
+using System.Diagnostics.Tracing;
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for the DiskBench EventSource counters and events.
+/// </summary>
+public class DiskBenchEventSourceTests
+{
+    [Fact]
+    public async Task RunAsync_EmitsTrialEventsAndCounters()
+    {
+        using var listener = new DiskBenchListener();
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        await runner.RunAsync(new BenchmarkPlan
+        {
+            Workloads =
+            [
+                new WorkloadSpec
+                {
+                    Name = "EventSource Test",
+                    FilePath = "events.dat",
+                    FileSize = 1024 * 1024,
+                    BlockSize = 4096,
+                    Pattern = AccessPattern.Random,
+                    QueueDepth = 8
+                }
+            ],
+            Trials = 1,
+            WarmupDuration = TimeSpan.FromMilliseconds(500),
+            MeasuredDuration = TimeSpan.FromMilliseconds(1500)
+        });
+
+        var events = listener.Events.Where(e => e.Payload?.Count > 0 && Equals(e.Payload[0], "EventSource Test")).ToList();
+        Assert.Contains(events, e => e.EventName == nameof(DiskBenchEventSource.TrialStart));
+        Assert.Contains(events, e => e.EventName == nameof(DiskBenchEventSource.PhaseTransition) && Equals(e.Payload![2], "Warmup"));
+        Assert.Contains(events, e => e.EventName == nameof(DiskBenchEventSource.PhaseTransition) && Equals(e.Payload![2], "Measured"));
+
+        var stop = events.Single(e => e.EventName == nameof(DiskBenchEventSource.TrialStop));
+        Assert.True((double)stop.Payload![2]! > 0);
+
+        Assert.Contains(listener.Counters, c => c.Name == "iops" && c.Value > 0);
+        Assert.Contains(listener.Counters, c => c.Name == "in-flight-ios" && c.Value == 8);
+        Assert.Contains(listener.Counters, c => c.Name == "gc-pause-time");
+    }
+
+    private sealed class DiskBenchListener : EventListener
+    {
+        public ConcurrentQueue<EventWrittenEventArgs> Events { get; } = new();
+
+        public ConcurrentQueue<(string Name, double Value)> Counters { get; } = new();
+
+        protected override void OnEventSourceCreated(EventSource eventSource)
+        {
+            if (eventSource.Name == "DiskBench")
+            {
+                EnableEvents(eventSource, EventLevel.Verbose, EventKeywords.All, new Dictionary<string, string?>
+                {
+                    ["EventCounterIntervalSec"] = "0.2"
+                });
+            }
+        }
+
+        protected override void OnEventWritten(EventWrittenEventArgs eventData)
+        {
+            if (eventData.EventName == "EventCounters" && eventData.Payload?[0] is IDictionary<string, object> counter)
+            {
+                var value = counter.TryGetValue("Increment", out var increment) ? increment : counter["Mean"];
+                Counters.Enqueue(((string)counter["Name"], Convert.ToDouble(value, System.Globalization.CultureInfo.InvariantCulture)));
+                return;
+            }
+
+            Events.Enqueue(eventData);
+        }
+    }
+}
@@ -0,0 +1,335 @@
+using System.Diagnostics;
+using DiskBench.Core;
+using DiskBench.Win32;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Conformance suite every <see cref="IBenchmarkEngine"/> should pass, so numbers from different
+/// engines measure the same thing. Derive from this class and supply the engine under test.
+/// </summary>
+public abstract class EngineConformanceTests
+{
+    /// <summary>
+    /// Size of the test file.
+    /// </summary>
+    protected const long FileSize = 4 * 1024 * 1024;
+
+    private const int BlockSize = 4096;
+
+    /// <summary>
+    /// Creates the engine under test.
+    /// </summary>
+    protected abstract IBenchmarkEngine CreateEngine();
+
+    /// <summary>
+    /// Path of the test file.
+    /// </summary>
+    protected abstract string FilePath { get; }
+
+    /// <summary>
+    /// Whether the engine can run on this machine (unsupported engines pass trivially).
+    /// </summary>
+    protected virtual bool IsSupported => true;
+
+    /// <summary>
+    /// Whether the engine hands real data to <see cref="IIoObserver.OnCompleted"/>.
+    /// </summary>
+    protected virtual bool MovesData => true;
+
+    /// <summary>
+    /// Minimum IOPS for 4K random reads at QD8 from a cached file (the engine's overhead floor).
+    /// </summary>
+    protected virtual double MinimumIops => 1000;
+
+    /// <summary>
+    /// Longest acceptable time from cancellation to the trial returning.
+    /// </summary>
+    protected virtual TimeSpan MaxCancellationLatency => TimeSpan.FromSeconds(1);
+
+    [Fact]
+    public async Task SameSeed_IssuesIdenticalIoStream()
+    {
+        if (!IsSupported)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var workload = CreateWorkload(AccessPattern.Random, writePercent: 30, queueDepth: 4);
+
+        var first = await RunObservedAsync(engine, workload, seed: 42);
+        var second = await RunObservedAsync(engine, workload, seed: 42);
+
+        int count = Math.Min(first.Issued.Count, second.Issued.Count);
+        Assert.True(count >= 64, $"Only {count} IOs issued");
+        Assert.Equal(first.HashStream(count), second.HashStream(count));
+
+        // And it is the canonical stream for the spec, as every engine must issue
+        Assert.Equal(ReferenceHash(workload, seed: 42, count), first.HashStream(count));
+    }
+
+    [Fact]
+    public async Task DifferentSeed_IssuesDifferentIoStream()
+    {
+        if (!IsSupported)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var workload = CreateWorkload(AccessPattern.Random, writePercent: 30, queueDepth: 4);
+
+        var first = await RunObservedAsync(engine, workload, seed: 1);
+        var second = await RunObservedAsync(engine, workload, seed: 2);
+
+        int count = Math.Min(first.Issued.Count, second.Issued.Count);
+        Assert.NotEqual(first.HashStream(count), second.HashStream(count));
+    }
+
+    [Theory]
+    [InlineData(AccessPattern.Sequential)]
+    [InlineData(AccessPattern.Random)]
+    public async Task Ios_StayInsideRegionAndAligned(AccessPattern pattern)
+    {
+        if (!IsSupported)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var region = new FileRegion(1024 * 1024, 256 * 1024);
+        var workload = CreateWorkload(pattern, writePercent: 50, queueDepth: 8, region);
+        int sectorSize = engine.GetSectorSize(FilePath);
+
+        var observer = await RunObservedAsync(engine, workload, seed: 7);
+
+        Assert.NotEmpty(observer.Issued);
+        Assert.All(observer.Issued, io =>
+        {
+            Assert.InRange(io.Offset, region.Offset, region.Offset + region.Length - io.Size);
+            Assert.Equal(0, io.Offset % sectorSize);
+            Assert.Equal(BlockSize, io.Size);
+        });
+    }
+
+    [Fact]
+    public async Task WrittenData_ReadsBack()
+    {
+        if (!IsSupported || !MovesData)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var region = new FileRegion(0, 64 * BlockSize);
+        var expected = new Dictionary<long, ulong>();
+
+        var write = CreateWorkload(AccessPattern.Sequential, writePercent: 100, queueDepth: 1, region);
+        var writer = await RunObservedAsync(engine, write, seed: 3, expected);
+        Assert.Equal(0, writer.MismatchedReads);
+        Assert.NotEmpty(expected);
+
+        var read = CreateWorkload(AccessPattern.Sequential, writePercent: 0, queueDepth: 1, region);
+        var reader = await RunObservedAsync(engine, read, seed: 4, expected);
+
+        Assert.True(reader.VerifiedReads > 0, "No reads covered written blocks");
+        Assert.Equal(0, reader.MismatchedReads);
+    }
+
+    [Fact]
+    public async Task Cancellation_ReturnsPromptlyWithAllIosRetired()
+    {
+        if (!IsSupported)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var observer = new RecordingIoObserver();
+        var spec = CreateTrial(CreateWorkload(AccessPattern.Random, writePercent: 0, queueDepth: 16), seed: 5, observer)
+            with { MeasuredDuration = TimeSpan.FromSeconds(30) };
+
+        using var cts = new CancellationTokenSource();
+        var trial = engine.RunTrialAsync(spec, null, cts.Token);
+        await Task.Delay(200);
+
+        var cancelled = Stopwatch.GetTimestamp();
+        await cts.CancelAsync();
+        try
+        {
+            await trial;
+        }
+        catch (OperationCanceledException)
+        {
+            // Either returning a partial result or throwing is acceptable
+        }
+
+        var latency = Stopwatch.GetElapsedTime(cancelled);
+        observer.Seal();
+
+        Assert.True(latency <= MaxCancellationLatency, $"Cancellation took {latency.TotalMilliseconds:F0}ms");
+        Assert.Equal(0, observer.Outstanding);
+    }
+
+    [Fact]
+    public async Task EveryIssuedIo_IsRetiredBeforeTrialReturns()
+    {
+        if (!IsSupported)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var workload = CreateWorkload(AccessPattern.Random, writePercent: 30, queueDepth: 32);
+
+        var observer = await RunObservedAsync(engine, workload, seed: 9);
+        Assert.True(observer.IssuedCount > 0);
+        Assert.Equal(0, observer.Outstanding);
+
+        // Nothing still in flight may call back once the trial has returned
+        await Task.Delay(100);
+        Assert.Equal(0, observer.LateCallbacks);
+    }
+
+    [Fact]
+    public async Task HighQueueDepth_RetiresEveryIo()
+    {
+        if (!IsSupported)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var workload = CreateWorkload(AccessPattern.Random, writePercent: 30, queueDepth: 4096) with { Threads = 2 };
+
+        var observer = await RunObservedAsync(engine, workload, seed: 13);
+        Assert.True(observer.IssuedCount >= 2 * 4096, $"Only {observer.IssuedCount} IOs issued");
+        Assert.Equal(0, observer.Outstanding);
+    }
+
+    [Fact]
+    public async Task CachedReads_MeetPerformanceFloor()
+    {
+        if (!IsSupported)
+        {
+            return;
+        }
+
+        await using var engine = await CreatePreparedEngineAsync();
+        var workload = CreateWorkload(AccessPattern.Random, writePercent: 0, queueDepth: 8, noBuffering: false);
+        var spec = CreateTrial(workload, seed: 11, observer: null) with
+        {
+            WarmupDuration = TimeSpan.FromMilliseconds(100),
+            MeasuredDuration = TimeSpan.FromMilliseconds(500)
+        };
+
+        var result = await engine.RunTrialAsync(spec);
+
+        Assert.True(result.Iops >= MinimumIops, $"{result.Iops:F0} IOPS is below the {MinimumIops:F0} floor");
+    }
+
+    /// <summary>
+    /// Creates a 4K workload over the test file.
+    /// </summary>
+    protected WorkloadSpec CreateWorkload(
+        AccessPattern pattern,
+        int writePercent,
+        int queueDepth,
+        FileRegion region = default,
+        bool noBuffering = true) => new()
+    {
+        FilePath = FilePath,
+        FileSize = FileSize,
+        BlockSize = BlockSize,
+        Pattern = pattern,
+        WritePercent = writePercent,
+        QueueDepth = queueDepth,
+        Region = region,
+        NoBuffering = noBuffering
+    };
+
+    private static TrialSpec CreateTrial(WorkloadSpec workload, int seed, IIoObserver? observer) => new()
+    {
+        Workload = workload,
+        WarmupDuration = TimeSpan.Zero,
+        MeasuredDuration = TimeSpan.FromMilliseconds(150),
+        Seed = seed,
+        TrialNumber = 1,
+        IoObserver = observer
+    };
+
+    private static ulong ReferenceHash(WorkloadSpec workload, int seed, int count)
+    {
+        var stream = new IoStreamGenerator(workload, seed);
+        var ios = new List<(long, int, bool)>(count);
+        for (int i = 0; i < count; i++)
+        {
+            var io = stream.NextIo();
+            ios.Add((io.Offset, io.Size, io.IsWrite));
+        }
+
+        return RecordingIoObserver.HashStream(ios);
+    }
+
+    private async Task<IBenchmarkEngine> CreatePreparedEngineAsync()
+    {
+        var engine = CreateEngine();
+        await engine.PrepareAsync(new PrepareSpec { FilePath = FilePath, FileSize = FileSize });
+        return engine;
+    }
+
+    private static async Task<RecordingIoObserver> RunObservedAsync(
+        IBenchmarkEngine engine,
+        WorkloadSpec workload,
+        int seed,
+        Dictionary<long, ulong>? expectedData = null)
+    {
+        var observer = new RecordingIoObserver(expectedData: expectedData);
+        await engine.RunTrialAsync(CreateTrial(workload, seed, observer));
+        observer.Seal();
+        return observer;
+    }
+}
+
+/// <summary>
+/// Runs the engine conformance suite against the fake engine.
+/// </summary>
+public class FakeEngineConformanceTests : EngineConformanceTests
+{
+    /// <inheritdoc />
+    protected override string FilePath => "conformance.dat";
+
+    /// <inheritdoc />
+    protected override double MinimumIops => 100;
+
+    /// <inheritdoc />
+    protected override IBenchmarkEngine CreateEngine() => new FakeBenchmarkEngine(new FakeEngineOptions { StoreData = true });
+}
+
+/// <summary>
+/// Runs the engine conformance suite against the Windows IOCP engine on a temporary file.
+/// </summary>
+public sealed class WindowsIoEngineConformanceTests : EngineConformanceTests, IDisposable
+{
+    private readonly string _filePath = Path.Combine(Path.GetTempPath(), $"diskbench_conformance_{Guid.NewGuid():N}.dat");
+
+    /// <inheritdoc />
+    protected override string FilePath => _filePath;
+
+    /// <inheritdoc />
+    protected override bool IsSupported => OperatingSystem.IsWindows();
+
+    /// <inheritdoc />
+    protected override IBenchmarkEngine CreateEngine() => new WindowsIoEngine();
+
+    /// <inheritdoc />
+    public void Dispose()
+    {
+        if (File.Exists(_filePath))
+        {
+            File.Delete(_filePath);
+        }
+    }
+}
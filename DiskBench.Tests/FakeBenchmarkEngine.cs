@@ -1,7 +1,10 @@
+using System.ComponentModel;
 using System.Diagnostics;
 using DiskBench.Core;
 using DiskBench.Metrics;
+using DiskBench.Win32;
 using CoreTimeSeriesSample = DiskBench.Core.TimeSeriesSample;
+using StorageBusType = DiskBench.Core.StorageBusType;
 
 namespace DiskBench.Tests;
 
@@ -11,7 +14,16 @@ namespace DiskBench.Tests;
 /// </summary>
 public sealed class FakeBenchmarkEngine : IBenchmarkEngine
 {
+    /// <summary>
+    /// Error code reported for injected IO errors (ERROR_CRC, as the Windows engine uses).
+    /// </summary>
+    public const int InjectedErrorCode = 23;
+
     private readonly FakeEngineOptions _options;
+    private readonly Dictionary<string, byte[]> _files = new(StringComparer.OrdinalIgnoreCase);
+    private readonly Dictionary<string, long> _fileIoCounts = new(StringComparer.OrdinalIgnoreCase);
+    private readonly HashSet<string> _preparedFiles = new(StringComparer.OrdinalIgnoreCase);
+    private readonly Dictionary<string, PreparedContent?> _preparedContent = new(StringComparer.OrdinalIgnoreCase);
 
     /// <summary>
     /// Creates a fake engine with default options.
@@ -28,6 +40,21 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
         _options = options ?? throw new ArgumentNullException(nameof(options));
     }
 
+    /// <summary>
+    /// Gets the paths of every file prepared.
+    /// </summary>
+    public IReadOnlyCollection<string> PreparedFiles => _preparedFiles;
+
+    /// <summary>
+    /// Gets the content each file was last prepared with.
+    /// </summary>
+    public IReadOnlyDictionary<string, PreparedContent?> PreparedContents => _preparedContent;
+
+    /// <summary>
+    /// Gets the number of measured IOs issued to each file.
+    /// </summary>
+    public IReadOnlyDictionary<string, long> FileIoCounts => _fileIoCounts;
+
     /// <inheritdoc />
     public Task<PrepareResult> PrepareAsync(
         PrepareSpec spec,
@@ -35,6 +62,8 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
         CancellationToken cancellationToken = default)
     {
         progress?.Report(1.0);
+        _preparedFiles.Add(spec.FilePath);
+        _preparedContent[spec.FilePath] = spec.Content;
 
         return Task.FromResult(new PrepareResult
         {
@@ -43,7 +72,8 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
             PhysicalSectorSize = _options.SectorSize,
             LogicalSectorSize = _options.SectorSize,
             WasReused = true,
-            UsedSetValidData = false
+            UsedSetValidData = false,
+            Content = spec.Content
         });
     }
 
@@ -56,35 +86,67 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
         var workload = spec.Workload;
         var random = new Random(spec.Seed);
 
+        // Same IO stream as the Windows engine issues for this spec
+        var stream = new IoStreamGenerator(workload, spec.Seed, workload.NoBuffering ? spec.SectorSize : 1);
+
         // Simulate warmup
         if (spec.WarmupDuration > TimeSpan.Zero)
         {
-            await SimulatePhaseAsync(spec, isWarmup: true, progress, random, cancellationToken)
+            await SimulatePhaseAsync(spec, isWarmup: true, progress, random, stream, cancellationToken)
                 .ConfigureAwait(false);
         }
 
         // Simulate measured phase
-        return await SimulatePhaseAsync(spec, isWarmup: false, progress, random, cancellationToken)
+        return await SimulatePhaseAsync(spec, isWarmup: false, progress, random, stream, cancellationToken)
             .ConfigureAwait(false);
     }
 
+    private byte[]? GetFileData(string filePath, long fileSize)
+    {
+        if (!_options.StoreData)
+        {
+            return null;
+        }
+
+        if (!_files.TryGetValue(filePath, out var data) || data.Length < fileSize)
+        {
+            var grown = new byte[fileSize];
+            data?.CopyTo(grown, 0);
+            _files[filePath] = data = grown;
+        }
+
+        return data;
+    }
+
     private async Task<TrialResult> SimulatePhaseAsync(
         TrialSpec spec,
         bool isWarmup,
         IProgress<TrialProgress>? progress,
         Random random,
+        IoStreamGenerator stream,
         CancellationToken cancellationToken)
     {
         var workload = spec.Workload;
         var duration = isWarmup ? spec.WarmupDuration : spec.MeasuredDuration;
         var ticksPerUs = LatencyHistogram.TicksPerMicrosecond;
 
-        var metrics = new TrialMetricsCollector((int)duration.TotalSeconds + 5, spec.CollectTimeSeries);
+        var metrics = new TrialMetricsCollector((int)duration.TotalSeconds + 5, spec.CollectTimeSeries, spec.CollectIntervalLatency);
+        var slowIos = isWarmup ? null : spec.CreateSlowIoTracker();
+        var errorPolicy = spec.ErrorPolicy ?? IoErrorPolicy.Abort;
+        var faults = spec.FaultInjector;
+        var errorStats = !isWarmup && (errorPolicy.ContinueOnError || faults != null) ? new IoErrorStats() : null;
+        var observer = spec.IoObserver;
+        var filePaths = workload.GetFilePaths();
+        var fileData = filePaths.Select(path => GetFileData(path, workload.FileSize)).ToArray();
+        var dataRandom = new Random(spec.Seed + 2);
 
         var startTime = Stopwatch.GetTimestamp();
         var endTime = startTime + (long)(duration.TotalSeconds * Stopwatch.Frequency);
+        using var trace = !isWarmup && spec.TracePath != null ? new IoTraceWriter(spec.TracePath) : null;
+        trace?.Start(startTime);
         var lastProgressReport = startTime;
         var progressInterval = Stopwatch.Frequency / 4; // 4Hz
+        var progressLatencyBaseline = LatencyHistogram.CreateIntervalBaseline();
 
         // Calculate simulated IOPS based on options
         double targetIops = CalculateTargetIops(workload);
@@ -93,15 +155,15 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
         long simulatedOps = 0;
         long simulatedBytes = 0;
 
-        while (Stopwatch.GetTimestamp() < endTime && !cancellationToken.IsCancellationRequested)
+        while (Stopwatch.GetTimestamp() < endTime && !cancellationToken.IsCancellationRequested && !IoLimitReached())
         {
             // Simulate a batch of IOs
             int batchSize = workload.QueueDepth;
             
-            for (int i = 0; i < batchSize; i++)
+            for (int i = 0; i < batchSize && !IoLimitReached(); i++)
             {
                 // Generate latency with some variance
-                double baseLatencyUs = _options.BaseLatencyUs;
+                double baseLatencyUs = _options.BaseLatencyUs + (_options.OpenFileLatencyUs * filePaths.Count);
                 if (_options.LatencyVariancePercent > 0)
                 {
                     double variance = baseLatencyUs * _options.LatencyVariancePercent / 100.0;
@@ -109,15 +171,93 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
                 }
 
                 long latencyTicks = (long)(baseLatencyUs * ticksPerUs);
-                bool isWrite = random.Next(100) < workload.WritePercent;
+                var io = stream.NextIo();
+                long offset = io.Offset;
+                bool isWrite = io.IsWrite;
+                int bytes = io.Size;
+                observer?.OnIssued(offset, bytes, isWrite);
+                int attempt = 0;
+                bool failed = false;
+
+                if (faults != null)
+                {
+                    var fault = faults.NextFault(offset, bytes, isWrite);
+
+                    // Failed attempts are retried at the same offset, each costing a retry delay and another IO
+                    while (fault.Kind == IoFaultKind.Error)
+                    {
+                        errorStats?.RecordInjectedFault();
+                        if (!errorPolicy.ContinueOnError)
+                        {
+                            observer?.OnAbandoned(offset, isWrite);
+                            throw new Win32Exception(InjectedErrorCode, isWrite ? "WriteFile failed" : "ReadFile failed");
+                        }
+
+                        errorStats?.RecordError(InjectedErrorCode);
+                        if (attempt >= errorPolicy.MaxRetries)
+                        {
+                            errorStats?.RecordFailed();
+                            failed = true;
+                            break;
+                        }
+
+                        attempt++;
+                        errorStats?.RecordRetry();
+                        latencyTicks += (long)(errorPolicy.DelayBeforeRetry(attempt).TotalMicroseconds * ticksPerUs) +
+                            (long)(_options.BaseLatencyUs * ticksPerUs);
+                        fault = faults.NextFault(offset, bytes, isWrite);
+                    }
+
+                    if (fault.Kind is IoFaultKind.LatencySpike or IoFaultKind.Stall)
+                    {
+                        errorStats?.RecordInjectedFault();
+                        latencyTicks += (long)(fault.Delay.TotalMicroseconds * ticksPerUs);
+                    }
+                    else if (fault.Kind == IoFaultKind.ShortTransfer)
+                    {
+                        errorStats?.RecordInjectedFault();
+                        bytes = Math.Min(bytes, fault.BytesTransferred);
+                    }
+                }
+
+                if (failed)
+                {
+                    observer?.OnAbandoned(offset, isWrite);
+                    continue;
+                }
+
+                TransferData(fileData[io.FileIndex], offset, bytes, isWrite, dataRandom, observer);
 
                 if (!isWarmup)
                 {
-                    metrics.RecordCompletion(Stopwatch.GetTimestamp(), latencyTicks, workload.BlockSize, isWrite);
+                    _fileIoCounts[filePaths[io.FileIndex]] = _fileIoCounts.GetValueOrDefault(filePaths[io.FileIndex]) + 1;
+                    var completed = Stopwatch.GetTimestamp();
+                    metrics.RecordCompletion(completed, latencyTicks, bytes, isWrite);
+                    slowIos?.RecordCompletion(
+                        offset,
+                        bytes,
+                        isWrite,
+                        i,
+                        completed - latencyTicks,
+                        completed);
+                    trace?.Append(offset, bytes, isWrite, completed - latencyTicks, completed, Environment.CurrentManagedThreadId);
+
+                    if (errorStats != null)
+                    {
+                        if (attempt > 0)
+                        {
+                            errorStats.RecordRecovered(latencyTicks);
+                        }
+
+                        if (bytes < io.Size)
+                        {
+                            errorStats.RecordShortTransfer();
+                        }
+                    }
                 }
 
                 simulatedOps++;
-                simulatedBytes += workload.BlockSize;
+                simulatedBytes += io.Size;
             }
 
             // Report progress periodically
@@ -136,7 +276,9 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
                     CurrentBytesPerSecond = elapsedSeconds > 0 ? simulatedBytes / elapsedSeconds : 0,
                     CurrentIops = elapsedSeconds > 0 ? simulatedOps / elapsedSeconds : 0,
                     TotalBytes = simulatedBytes,
-                    TotalOperations = simulatedOps
+                    TotalOperations = simulatedOps,
+                    InFlightIos = workload.QueueDepth,
+                    IntervalP99Us = metrics.Histogram.GetIntervalPercentileTicks(0.99, progressLatencyBaseline) / ticksPerUs
                 });
             }
 
@@ -151,22 +293,16 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
 
         metrics.Flush();
         var actualDuration = TimeSpan.FromSeconds((double)(Stopwatch.GetTimestamp() - startTime) / Stopwatch.Frequency);
+        if (_options.BytesPerSecond != null && metrics.TotalBytes > 0)
+        {
+            actualDuration = TimeSpan.FromSeconds(metrics.TotalBytes / _options.BytesPerSecond(workload));
+        }
 
         // Build time series
-        List<CoreTimeSeriesSample>? timeSeries = null;
+        IReadOnlyList<CoreTimeSeriesSample>? timeSeries = null;
         if (spec.CollectTimeSeries && metrics.TimeSeries != null)
         {
-            var snapshot = metrics.TimeSeries.CreateSnapshot();
-            timeSeries = [];
-            foreach (var sample in snapshot.Samples)
-            {
-                timeSeries.Add(new CoreTimeSeriesSample
-                {
-                    SecondOffset = sample.SecondOffset,
-                    Bytes = sample.Bytes,
-                    Operations = sample.Operations
-                });
-            }
+            timeSeries = CoreTimeSeriesSample.FromTimeSeries(metrics.TimeSeries, ticksPerUs);
         }
 
         return new TrialResult
@@ -177,8 +313,27 @@ public sealed class FakeBenchmarkEngine : IBenchmarkEngine
             ReadOperations = metrics.ReadOperations,
             WriteOperations = metrics.WriteOperations,
             Duration = actualDuration,
-            Latency = LatencyPercentiles.FromHistogram(metrics.Histogram, LatencyHistogram.TicksPerMicrosecond)
+            MeasuredStartTimestamp = startTime,
+            Latency = LatencyPercentiles.FromHistogram(metrics.Histogram, LatencyHistogram.TicksPerMicrosecond),
+            Histogram = metrics.Histogram.CreateSnapshot(),
+            TimeSeries = timeSeries,
+            SlowIos = slowIos != null ? SlowIoReport.FromTracker(slowIos, startTime, ticksPerUs) : null,
+            TracePath = spec.TracePath,
+            Errors = errorStats != null ? IoErrorSummary.FromStats(errorStats, ticksPerUs) : null
         };
+
+        bool IoLimitReached() => spec.IoLimit > 0 && stream.Issued >= spec.IoLimit;
+    }
+
+    private static void TransferData(byte[]? fileData, long offset, int bytes, bool isWrite, Random dataRandom, IIoObserver? observer)
+    {
+        var data = fileData != null ? fileData.AsSpan((int)offset, bytes) : [];
+        if (isWrite)
+        {
+            dataRandom.NextBytes(data);
+        }
+
+        observer?.OnCompleted(offset, isWrite, data);
     }
 
     private double CalculateTargetIops(WorkloadSpec workload)
@@ -254,4 +409,20 @@ public sealed class FakeEngineOptions
     /// Base IOPS (for 4K random QD1).
     /// </summary>
     public double BaseIops { get; init; } = 10000;
+
+    /// <summary>
+    /// Keep file contents in memory so writes can be read back (for data verification).
+    /// </summary>
+    public bool StoreData { get; init; }
+
+    /// <summary>
+    /// Extra latency per open file of the workload, in microseconds (simulates per-handle costs).
+    /// </summary>
+    public double OpenFileLatencyUs { get; init; }
+
+    /// <summary>
+    /// Throughput to report for a workload instead of the rate the simulation reached (the trial's
+    /// duration is scaled to match), for tests that need exact, machine-independent throughput.
+    /// </summary>
+    public Func<WorkloadSpec, double>? BytesPerSecond { get; init; }
 }
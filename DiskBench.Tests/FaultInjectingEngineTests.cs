@@ -0,0 +1,155 @@
+using System.ComponentModel;
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for fault injection and IO error handling using the fake engine.
+/// </summary>
+public class FaultInjectingEngineTests
+{
+    private static BenchmarkPlan CreatePlan(IoErrorPolicy? errorPolicy) => new()
+    {
+        Workloads =
+        [
+            new WorkloadSpec
+            {
+                FilePath = "test.dat",
+                FileSize = 1024 * 1024,
+                BlockSize = 4096,
+                Pattern = AccessPattern.Random,
+                WritePercent = 0,
+                QueueDepth = 4
+            }
+        ],
+        Trials = 1,
+        WarmupDuration = TimeSpan.Zero,
+        MeasuredDuration = TimeSpan.FromMilliseconds(100),
+        ErrorPolicy = errorPolicy
+    };
+
+    [Fact]
+    public async Task ContinueOnError_CountsErrorsAndRetries()
+    {
+        await using var engine = new FaultInjectingEngine(
+            new FakeBenchmarkEngine(),
+            new FaultInjectionOptions { ErrorRate = 0.1, Seed = 7 });
+        var runner = new BenchmarkRunner(engine);
+
+        var result = await runner.RunAsync(CreatePlan(new IoErrorPolicy { ContinueOnError = true, MaxRetries = 2 }));
+
+        var errors = result.Workloads[0].Trials[0].Errors;
+        Assert.NotNull(errors);
+        Assert.True(errors!.Errors > 0);
+        Assert.True(errors.Retries > 0);
+        Assert.True(errors.Recovered > 0);
+        Assert.Equal(FakeBenchmarkEngine.InjectedErrorCode, errors.FirstErrorCode);
+
+        // Every error is either retried or ends the IO as failed
+        Assert.Equal(errors.Errors, errors.Retries + errors.Failed);
+        Assert.True(result.Workloads[0].Trials[0].TotalOperations > 0);
+    }
+
+    [Fact]
+    public async Task Retries_ReportRetryLatencyIncludingBackoff()
+    {
+        await using var engine = new FaultInjectingEngine(
+            new FakeBenchmarkEngine(new FakeEngineOptions { LatencyVariancePercent = 0 }),
+            new FaultInjectionOptions { ErrorRate = 0.2, Seed = 3 });
+        var runner = new BenchmarkRunner(engine);
+
+        var policy = new IoErrorPolicy
+        {
+            ContinueOnError = true,
+            MaxRetries = 1,
+            RetryDelay = TimeSpan.FromMilliseconds(2)
+        };
+        var result = await runner.RunAsync(CreatePlan(policy));
+
+        var errors = result.Workloads[0].Trials[0].Errors;
+        Assert.NotNull(errors);
+        Assert.NotNull(errors!.RetryLatency);
+
+        // Base latency 50us + 2ms backoff + another 50us attempt
+        Assert.True(errors.RetryLatency!.MinUs >= 2000);
+        Assert.True(result.Workloads[0].Trials[0].Latency.MaxUs >= errors.RetryLatency.MinUs);
+    }
+
+    [Fact]
+    public async Task WithoutContinueOnError_FirstErrorAbortsTrial()
+    {
+        await using var engine = new FaultInjectingEngine(
+            new FakeBenchmarkEngine(),
+            new FaultInjectionOptions { ErrorRate = 0.5 });
+        var runner = new BenchmarkRunner(engine);
+
+        var ex = await Assert.ThrowsAsync<Win32Exception>(() => runner.RunAsync(CreatePlan(null)));
+        Assert.Equal(FakeBenchmarkEngine.InjectedErrorCode, ex.NativeErrorCode);
+    }
+
+    [Fact]
+    public async Task LatencySpikesAndShortTransfers_AreApplied()
+    {
+        await using var engine = new FaultInjectingEngine(
+            new FakeBenchmarkEngine(new FakeEngineOptions { LatencyVariancePercent = 0 }),
+            new FaultInjectionOptions
+            {
+                LatencySpikeRate = 0.05,
+                LatencySpike = TimeSpan.FromMilliseconds(20),
+                ShortTransferRate = 0.05
+            });
+        var runner = new BenchmarkRunner(engine);
+
+        var result = await runner.RunAsync(CreatePlan(null));
+
+        var trial = result.Workloads[0].Trials[0];
+        Assert.NotNull(trial.Errors);
+        Assert.Equal(0, trial.Errors!.Errors);
+        Assert.True(trial.Errors.ShortTransfers > 0);
+        Assert.True(trial.Errors.InjectedFaults >= trial.Errors.ShortTransfers);
+        Assert.True(trial.Latency.MaxUs >= 20_000);
+        Assert.True(trial.TotalBytes < trial.TotalOperations * 4096);
+    }
+
+    [Fact]
+    public async Task NoFaults_LeavesTrialErrorsUnset()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        var result = await runner.RunAsync(CreatePlan(null));
+
+        Assert.Null(result.Workloads[0].Trials[0].Errors);
+    }
+
+    [Theory]
+    [InlineData(-0.1, 0)]
+    [InlineData(1.5, 0)]
+    [InlineData(0.6, 0.6)]
+    public void Constructor_InvalidRates_Throws(double errorRate, double spikeRate)
+    {
+        var options = new FaultInjectionOptions { ErrorRate = errorRate, LatencySpikeRate = spikeRate };
+        Assert.Throws<ArgumentException>(() => new FaultInjectingEngine(new FakeBenchmarkEngine(), options));
+    }
+
+    [Fact]
+    public async Task RunAsync_NegativeMaxRetries_Throws()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        var plan = CreatePlan(new IoErrorPolicy { ContinueOnError = true, MaxRetries = -1 });
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan));
+    }
+
+    [Fact]
+    public void RetryDelay_BacksOffExponentially()
+    {
+        var policy = new IoErrorPolicy { RetryDelay = TimeSpan.FromMilliseconds(10), BackoffMultiplier = 2 };
+
+        Assert.Equal(TimeSpan.FromMilliseconds(10), policy.DelayBeforeRetry(1));
+        Assert.Equal(TimeSpan.FromMilliseconds(20), policy.DelayBeforeRetry(2));
+        Assert.Equal(TimeSpan.FromMilliseconds(40), policy.DelayBeforeRetry(3));
+    }
+}
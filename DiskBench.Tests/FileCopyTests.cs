@@ -0,0 +1,207 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for the file copy strategy benchmark.
+/// </summary>
+public sealed class FileCopyTests : IDisposable
+{
+    private const long MiB = 1024 * 1024;
+
+    private readonly string _root = Path.Combine(Path.GetTempPath(), $"diskbench_copy_{Guid.NewGuid():N}");
+
+    public FileCopyTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public async Task RunAsync_CopiesWithEachStrategy()
+    {
+        await using var engine = new CopyingEngine();
+        var runner = new FileCopyRunner(engine, cachedBytes: () => 0);
+
+        var result = await runner.RunAsync(CreatePlan(
+        [
+            new CopyCase { Strategy = CopyStrategy.Buffered, BlockSize = 64 * 1024 },
+            new CopyCase { Strategy = CopyStrategy.SystemCopy },
+            new CopyCase { Strategy = CopyStrategy.Unbuffered, QueueDepth = 8 }
+        ]));
+
+        string[] names = ["Buffered 64K", "SystemCopy", "Unbuffered 1M x8"];
+        Assert.Equal(names, result.Cases.Select(c => c.Name).ToArray());
+        Assert.All(result.Cases, c =>
+        {
+            Assert.Null(c.SkipReason);
+            Assert.Equal(2, c.Trials.Count);
+            Assert.All(c.Trials, t => Assert.Equal(3 * MiB, t.Bytes));
+            Assert.True(c.MeanBytesPerSecond > 0);
+            Assert.Equal(0, c.MeanPageCacheGrowthBytes);
+        });
+        Assert.Equal(2, engine.Copies);
+        Assert.True(result.SourceCacheEvicted);
+
+        // The source is kept, the destination is not
+        Assert.Equal(3 * MiB, new FileInfo(result.SourcePath).Length);
+        Assert.False(File.Exists(result.SourcePath + ".copy"));
+    }
+
+    [Fact]
+    public async Task RunAsync_UnsupportedStrategies_AreSkippedWithReason()
+    {
+        var warnings = new List<string>();
+        await using var copying = new CopyingEngine();
+        await using var plain = new FakeBenchmarkEngine();
+        var cases = new[]
+        {
+            new CopyCase { Strategy = CopyStrategy.Clone },
+            new CopyCase { Strategy = CopyStrategy.Unbuffered }
+        };
+
+        var cloned = await new FileCopyRunner(copying, new WarningSink(warnings)).RunAsync(CreatePlan(cases));
+        var engineless = await new FileCopyRunner(plain).RunAsync(CreatePlan(cases));
+
+        Assert.Equal("Block cloning unsupported", cloned.Cases[0].SkipReason);
+        Assert.Empty(cloned.Cases[0].Trials);
+        Assert.Null(cloned.Cases[1].SkipReason);
+        Assert.Single(warnings);
+
+        Assert.False(engineless.SourceCacheEvicted);
+        Assert.Equal("Clone copies need engine support", engineless.Cases[0].SkipReason);
+        Assert.Equal("Unbuffered copies need engine support", engineless.Cases[1].SkipReason);
+    }
+
+    [Fact]
+    public async Task RunAsync_EvictsSourceBeforeEveryTrial()
+    {
+        await using var engine = new CopyingEngine();
+        var runner = new FileCopyRunner(engine, cachedBytes: () => 0);
+
+        var result = await runner.RunAsync(CreatePlan(
+        [
+            new CopyCase { Strategy = CopyStrategy.Buffered },
+            new CopyCase { Strategy = CopyStrategy.Unbuffered }
+        ]));
+
+        // Buffered copies do not go through the engine, so only their evictions show
+        string[] expected = ["evict", "evict", "evict", "copy", "evict", "copy"];
+        Assert.Equal(expected, engine.Log.ToArray());
+        Assert.True(result.SourceCacheEvicted);
+    }
+
+    [Fact]
+    public async Task RunAsync_RejectsInvalidPlans()
+    {
+        await using var engine = new CopyingEngine();
+        var runner = new FileCopyRunner(engine);
+        var plan = CreatePlan([new CopyCase { Strategy = CopyStrategy.Buffered }]);
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(new FileCopyPlan { SourcePath = plan.SourcePath, FileSize = MiB, Cases = [] }));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(new FileCopyPlan
+        {
+            SourcePath = plan.SourcePath,
+            DestinationPath = plan.SourcePath,
+            FileSize = MiB,
+            Cases = plan.Cases
+        }));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(new FileCopyPlan
+        {
+            SourcePath = plan.SourcePath,
+            FileSize = MiB,
+            Cases = [new CopyCase { Strategy = CopyStrategy.Buffered, BlockSize = 0 }]
+        }));
+    }
+
+    [Fact]
+    public void CopyCase_DisplayNames()
+    {
+        Assert.Equal("Buffered 4K", new CopyCase { Strategy = CopyStrategy.Buffered, BlockSize = 4096 }.GetDisplayName());
+        Assert.Equal("Unbuffered 8M x2", new CopyCase { Strategy = CopyStrategy.Unbuffered, BlockSize = 8 * 1024 * 1024 }.GetDisplayName());
+        Assert.Equal("Clone", new CopyCase { Strategy = CopyStrategy.Clone }.GetDisplayName());
+    }
+
+    private FileCopyPlan CreatePlan(IReadOnlyList<CopyCase> cases) => new()
+    {
+        SourcePath = Path.Combine(_root, "source.dat"),
+        FileSize = 3 * MiB,
+        Cases = cases,
+        Trials = 2,
+        FlushDestination = false,
+        DeleteOnComplete = false
+    };
+
+    /// <summary>
+    /// Writes the prepared file for real and copies "unbuffered" with a plain stream copy; clones are unsupported.
+    /// </summary>
+    private sealed class CopyingEngine() : BenchmarkEngineDecorator(new FakeBenchmarkEngine()), IFileCopyEngine
+    {
+        public int Copies { get; private set; }
+
+        public List<string> Log { get; } = [];
+
+        public override async Task<PrepareResult> PrepareAsync(
+            PrepareSpec spec,
+            IProgress<double>? progress = null,
+            CancellationToken cancellationToken = default)
+        {
+            var data = new byte[spec.FileSize];
+            for (long i = 0; i < data.Length; i++)
+            {
+                data[i] = spec.FillPattern![(int)(i % spec.FillPattern.Count)];
+            }
+
+            await File.WriteAllBytesAsync(spec.FilePath, data, cancellationToken);
+            return await base.PrepareAsync(spec, progress, cancellationToken);
+        }
+
+        public async Task<long> CopyFileAsync(CopyCase copyCase, string sourcePath, string destinationPath, CancellationToken cancellationToken = default)
+        {
+            if (copyCase.Strategy == CopyStrategy.Clone)
+            {
+                throw new NotSupportedException("Block cloning unsupported");
+            }
+
+            Copies++;
+            Log.Add("copy");
+            await using var input = File.OpenRead(sourcePath);
+            await using var output = File.Create(destinationPath);
+            await input.CopyToAsync(output, copyCase.BlockSize, cancellationToken);
+            return output.Length;
+        }
+
+        public Task EvictFromCacheAsync(string path, CancellationToken cancellationToken = default)
+        {
+            Assert.True(File.Exists(path));
+            Log.Add("evict");
+            return Task.CompletedTask;
+        }
+    }
+
+    private sealed class WarningSink(List<string> warnings) : IBenchmarkSink
+    {
+        public void OnBenchmarkStart(BenchmarkPlan plan) { }
+
+        public void OnWorkloadStart(WorkloadSpec workload, int workloadIndex, int totalWorkloads) { }
+
+        public void OnTrialStart(WorkloadSpec workload, int trialNumber, int totalTrials) { }
+
+        public void OnTrialProgress(WorkloadSpec workload, int trialNumber, TrialProgress progress) { }
+
+        public void OnTrialComplete(WorkloadSpec workload, int trialNumber, TrialResult result) { }
+
+        public void OnWorkloadComplete(WorkloadSpec workload, WorkloadResult result) { }
+
+        public void OnBenchmarkComplete(BenchmarkResult result) { }
+
+        public void OnError(string message, Exception? exception = null) { }
+
+        public void OnWarning(string message) => warnings.Add(message);
+    }
+}
@@ -0,0 +1,174 @@
+using DiskBench.Core;
+using DiskBench.Win32;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for file-set workloads and open-handle scaling.
+/// </summary>
+public sealed class FileSetTests : IDisposable
+{
+    private readonly string _root = Path.Combine(Path.GetTempPath(), "diskbench-files-" + Guid.NewGuid().ToString("N"));
+
+    public FileSetTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void GetFilePaths_NamesEveryFileOfTheSet()
+    {
+        var workload = CreateWorkload(fileSet: new FileSetSpec { FileCount = 3, Distribution = FileDistribution.Zipf });
+
+        string[] expected = [workload.FilePath + ".00000", workload.FilePath + ".00001", workload.FilePath + ".00002"];
+        Assert.Equal(expected, workload.GetFilePaths().ToArray());
+        Assert.Equal("RandRead_4K_Q4T1 (3 files zipf)", workload.GetDisplayName());
+        Assert.Equal(workload.FilePath, Assert.Single(CreateWorkload().GetFilePaths()));
+        Assert.Equal("1 file", new FileSetSpec { FileCount = 1 }.GetDisplayName());
+    }
+
+    [Fact]
+    public void FileSelector_UniformSpreadsEvenly()
+    {
+        var counts = CountFiles(new FileSetSpec { FileCount = 8 }, 80_000);
+
+        Assert.All(counts, c => Assert.InRange(c, 9_000, 11_000));
+    }
+
+    [Fact]
+    public void FileSelector_KeepsDrawingPastThePrecomputedTable()
+    {
+        // Cycling one 64K table would leave about 27% of 50K files without IO however long the run
+        var counts = CountFiles(new FileSetSpec { FileCount = 50_000 }, 8 * 65536);
+        Assert.True(counts.Count(c => c == 0) < 500, $"{counts.Count(c => c == 0)} files never chosen");
+
+        var selector = new FileSelector(new FileSetSpec { FileCount = 100, Distribution = FileDistribution.Zipf }, seed: 42);
+        var first = new IoDescriptor[65536];
+        var second = new IoDescriptor[65536];
+        selector.Fill(first);
+        selector.Fill(second);
+        Assert.NotEqual(first.Select(io => io.FileIndex).ToArray(), second.Select(io => io.FileIndex).ToArray());
+    }
+
+    [Fact]
+    public void FileSelector_ZipfFavoursFewHotFiles()
+    {
+        var fileSet = new FileSetSpec { FileCount = 100, Distribution = FileDistribution.Zipf, ZipfExponent = 1.2 };
+        var counts = CountFiles(fileSet, 100_000);
+        var sorted = counts.OrderDescending().ToArray();
+
+        // With s = 1.2 the hottest file takes about a quarter of the IO and the top ten most of it
+        Assert.InRange(sorted[0], 20_000, 30_000);
+        Assert.True(sorted[..10].Sum() > 60_000, $"top ten: {sorted[..10].Sum()}");
+        Assert.True(sorted[0] > 20 * sorted[50], $"{sorted[0]} vs {sorted[50]}");
+
+        // Popularity is shuffled over the files rather than following creation order
+        Assert.NotEqual(0, Array.IndexOf(counts, sorted[0]));
+        Assert.Equal(counts, CountFiles(fileSet, 100_000));
+    }
+
+    [Fact]
+    public async Task RunAsync_InvalidFileSet_Throws()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(CreatePlan(CreateWorkload(new FileSetSpec { FileCount = 0 }))));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(CreatePlan(CreateWorkload(
+            new FileSetSpec { FileCount = 4, Distribution = FileDistribution.Zipf, ZipfExponent = 0 }))));
+    }
+
+    [Fact]
+    public async Task RunAsync_FileSet_PreparesAndSpreadsIoOverEveryFile()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+        var workload = CreateWorkload(new FileSetSpec { FileCount = 16 });
+
+        var result = await runner.RunAsync(CreatePlan(workload));
+
+        var paths = workload.GetFilePaths();
+        Assert.Equal(16, engine.PreparedFiles.Count);
+        Assert.All(paths, path => Assert.Contains(path, engine.PreparedFiles));
+        Assert.All(paths, path => Assert.True(engine.FileIoCounts.GetValueOrDefault(path) > 0, path));
+        Assert.Equal(result.Workloads[0].Trials.Sum(t => t.TotalOperations), engine.FileIoCounts.Values.Sum());
+    }
+
+    [Fact]
+    public async Task FileSetScalingRunner_SplitsDataAndComparesLevels()
+    {
+        await using var engine = new FakeBenchmarkEngine(new FakeEngineOptions { OpenFileLatencyUs = 1, LatencyVariancePercent = 0 });
+        var runner = new FileSetScalingRunner(engine);
+        int[] counts = [1, 32, 256];
+
+        var result = await runner.RunAsync(CreatePlan(CreateWorkload()), counts);
+
+        string[] names = ["1 file", "32 files", "256 files"];
+        Assert.Equal(names, result.Levels.Select(l => l.Name).ToArray());
+        Assert.Equal(counts, result.Levels.Select(l => l.Result.Workloads[0].Workload.FileSet!.FileCount).ToArray());
+        long[] sizes = [4 << 20, 128 << 10, 16 << 10];
+        Assert.Equal(sizes, result.Levels.Select(l => l.Result.Workloads[0].Workload.FileSize).ToArray());
+
+        // Levels reuse the names of the smaller sets' files
+        Assert.Equal(256, engine.PreparedFiles.Count);
+
+        // Simulated per-handle cost makes latency grow with the file count
+        var scores = Assert.Single(result.Workloads).Scores;
+        Assert.True(scores[0].P99LatencyUs < scores[1].P99LatencyUs && scores[1].P99LatencyUs < scores[2].P99LatencyUs);
+    }
+
+    [Fact]
+    public async Task FileSetScalingRunner_InvalidCounts_Throw()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new FileSetScalingRunner(engine);
+        var plan = CreatePlan(CreateWorkload());
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan, []));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan, [1, 0]));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan, [4, 4]));
+
+        // 4 MiB of 4K blocks cannot be split over more than 1024 files
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan, [2048]));
+    }
+
+    private static int[] CountFiles(FileSetSpec fileSet, int ios)
+    {
+        var selector = new FileSelector(fileSet, seed: 42);
+        var batch = new IoDescriptor[ios];
+        selector.Fill(batch);
+
+        var counts = new int[fileSet.FileCount];
+        foreach (var io in batch)
+        {
+            counts[io.FileIndex]++;
+        }
+
+        return counts;
+    }
+
+    private WorkloadSpec CreateWorkload(FileSetSpec? fileSet = null) => new()
+    {
+        FilePath = Path.Combine(_root, "bench.dat"),
+        FileSize = 4 << 20,
+        BlockSize = 4096,
+        Pattern = AccessPattern.Random,
+        QueueDepth = 4,
+        FileSet = fileSet
+    };
+
+    private static BenchmarkPlan CreatePlan(WorkloadSpec workload) => new()
+    {
+        Workloads = [workload],
+        Trials = 1,
+        WarmupDuration = TimeSpan.Zero,
+        MeasuredDuration = TimeSpan.FromMilliseconds(100),
+        DeleteOnComplete = false
+    };
+}
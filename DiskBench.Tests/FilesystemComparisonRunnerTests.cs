@@ -0,0 +1,172 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for cross-target comparison runs and mount table lookup.
+/// </summary>
+public sealed class FilesystemComparisonRunnerTests : IDisposable
+{
+    private readonly string _root = Path.Combine(Path.GetTempPath(), $"diskbench_compare_{Guid.NewGuid():N}");
+
+    public FilesystemComparisonRunnerTests()
+    {
+        Directory.CreateDirectory(Path.Combine(_root, "a"));
+        Directory.CreateDirectory(Path.Combine(_root, "b"));
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    private static BenchmarkPlan CreatePlan() => new()
+    {
+        Name = "Compare",
+        Workloads =
+        [
+            new WorkloadSpec
+            {
+                Name = "Rand Read 4K",
+                FilePath = "bench.dat",
+                FileSize = 1024 * 1024,
+                BlockSize = 4096,
+                Pattern = AccessPattern.Random,
+                QueueDepth = 1
+            },
+            new WorkloadSpec
+            {
+                Name = "Seq Write 64K",
+                FilePath = "bench.dat",
+                FileSize = 1024 * 1024,
+                BlockSize = 65536,
+                Pattern = AccessPattern.Sequential,
+                WritePercent = 100,
+                QueueDepth = 1
+            }
+        ],
+        Trials = 1,
+        WarmupDuration = TimeSpan.Zero,
+        MeasuredDuration = TimeSpan.FromMilliseconds(50),
+        DeleteOnComplete = false
+    };
+
+    [Fact]
+    public async Task RunAsync_RunsPlanInEveryTargetDirectory()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new FilesystemComparisonRunner(engine);
+
+        var result = await runner.RunAsync(
+            CreatePlan(),
+            [
+                new ComparisonTarget { Directory = Path.Combine(_root, "a"), Name = "first" },
+                new ComparisonTarget { Directory = Path.Combine(_root, "b"), Name = "second" }
+            ]);
+
+        Assert.Equal(2, result.Targets.Count);
+        Assert.Equal("first", result.Targets[0].Name);
+        Assert.All(result.Targets[0].Result.Workloads, w => Assert.StartsWith(Path.Combine(_root, "a"), w.Workload.FilePath));
+        Assert.All(result.Targets[1].Result.Workloads, w => Assert.StartsWith(Path.Combine(_root, "b"), w.Workload.FilePath));
+
+        Assert.Equal(2, result.Workloads.Count);
+        Assert.Equal("Rand Read 4K", result.Workloads[0].WorkloadName);
+        Assert.All(result.Workloads, w =>
+        {
+            Assert.Equal(2, w.Scores.Count);
+            Assert.Contains(w.Scores, s => s.RelativeIops == 1.0);
+        });
+        Assert.All(result.Targets, t => Assert.InRange(t.Score, 0.0, 1.0));
+    }
+
+    [Fact]
+    public async Task RunAsync_SameFileNameInDifferentDirectories_StaysSeparateFiles()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new FilesystemComparisonRunner(engine);
+        var plan = CreatePlan();
+        plan = plan with
+        {
+            Workloads = [plan.Workloads[0] with { FilePath = Path.Combine("x", "bench.dat") }, .. plan.Workloads, plan.Workloads[1] with { FilePath = "other.dat" }]
+        };
+
+        var result = await runner.RunAsync(
+            plan,
+            [
+                new ComparisonTarget { Directory = Path.Combine(_root, "a") },
+                new ComparisonTarget { Directory = Path.Combine(_root, "b") }
+            ]);
+
+        var files = Path.Combine(_root, "a", FilesystemComparisonRunner.TestFileDirectoryName);
+        Assert.Equal(
+            [Path.Combine(files, "1-bench.dat"), Path.Combine(files, "2-bench.dat"), Path.Combine(files, "2-bench.dat"), Path.Combine(files, "other.dat")],
+            result.Targets[0].Result.Workloads.Select(w => w.Workload.FilePath));
+    }
+
+    [Fact]
+    public async Task Compare_NormalizesToFastestTarget()
+    {
+        var plan = CreatePlan();
+
+        await using var fast = new FakeBenchmarkEngine(new FakeEngineOptions { BaseIops = 20000, LatencyVariancePercent = 0 });
+        await using var slow = new FakeBenchmarkEngine(new FakeEngineOptions { BaseIops = 2000, BaseLatencyUs = 500, LatencyVariancePercent = 0 });
+        var fastResult = await new BenchmarkRunner(fast).RunAsync(plan);
+        var slowResult = await new BenchmarkRunner(slow).RunAsync(plan);
+
+        var comparison = FilesystemComparisonRunner.Compare([("slow", slowResult), ("fast", fastResult)]);
+
+        // The fake engine's IOPS follow wall-clock pacing, so derive the expected winner from the results
+        var workload = comparison[0];
+        double slowIops = slowResult.Workloads[0].MeanIops;
+        double fastIops = fastResult.Workloads[0].MeanIops;
+        int winner = fastIops >= slowIops ? 1 : 0;
+        Assert.Equal(winner == 1 ? "fast" : "slow", workload.FastestTarget);
+        Assert.Equal(1.0, workload.Scores[winner].RelativeIops);
+        Assert.Equal(Math.Min(slowIops, fastIops) / Math.Max(slowIops, fastIops), workload.Scores[1 - winner].RelativeIops, 6);
+
+        // Latency is deterministic with no variance: the slow target's p99 is ~10x the fast one's
+        Assert.Equal(1.0, workload.Scores[1].RelativeP99Latency, 6);
+        Assert.InRange(workload.Scores[0].RelativeP99Latency, 9.0, 11.0);
+    }
+
+    [Fact]
+    public async Task RunAsync_InvalidTargets_Throws()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new FilesystemComparisonRunner(engine);
+        var a = new ComparisonTarget { Directory = Path.Combine(_root, "a") };
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(CreatePlan(), [a]));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(CreatePlan(), [a, a]));
+        await Assert.ThrowsAsync<ArgumentException>(() =>
+            runner.RunAsync(CreatePlan(), [a, new ComparisonTarget { Directory = Path.Combine(_root, "missing") }]));
+    }
+
+    [Fact]
+    public void MountTable_FindsLongestMatchingMount()
+    {
+        var mounts = Path.Combine(_root, "mounts");
+        File.WriteAllLines(mounts,
+        [
+            "/dev/nvme0n1p2 / ext4 rw,relatime 0 0",
+            "/dev/nvme1n1 /data xfs rw,noatime,logbufs=8 0 0",
+            "/dev/loop3 /data/img\\040btrfs btrfs rw,compress=zstd 0 0",
+            "tmpfs /datastore tmpfs rw 0 0"
+        ]);
+
+        var xfs = MountTable.Find("/data/bench/file.dat", mounts);
+        Assert.NotNull(xfs);
+        Assert.Equal("xfs", xfs!.FileSystem);
+        Assert.Equal("rw,noatime,logbufs=8", xfs.Options);
+
+        var loop = MountTable.Find("/data/img btrfs/x", mounts);
+        Assert.Equal("btrfs", loop!.FileSystem);
+        Assert.Equal("/dev/loop3", loop.Device);
+        Assert.Equal("/data/img btrfs", loop.MountPoint);
+
+        Assert.Equal("ext4", MountTable.Find("/home/user", mounts)!.FileSystem);
+        Assert.Equal("tmpfs", MountTable.Find("/datastore", mounts)!.FileSystem);
+        Assert.Null(MountTable.Find("/data", Path.Combine(_root, "no-such-file")));
+    }
+}
@@ -0,0 +1,162 @@
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using DiskBench.Core;
+using DiskBench.Win32;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for interference stressors and the interference scenario runner.
+/// </summary>
+public partial class InterferenceTests
+{
+    [Theory]
+    [InlineData(StressorKind.IntegerBurn, "ops")]
+    [InlineData(StressorKind.VectorBurn, "ops")]
+    [InlineData(StressorKind.MemoryStream, "bytes")]
+    [InlineData(StressorKind.CacheThrash, "lines")]
+    public async Task Stressor_DoesWorkUntilDisposed(StressorKind kind, string unit)
+    {
+        var stressor = new InterferenceStressor(new StressorSpec { Kind = kind, Threads = 2, Intensity = 0.5, BufferBytes = 1024 * 1024 });
+        await Task.Delay(100);
+        stressor.Dispose();
+
+        long work = stressor.Work;
+        await Task.Delay(30);
+
+        Assert.True(work > 0);
+        Assert.Equal(work, stressor.Work);
+        Assert.Equal(unit, stressor.Unit);
+        Assert.True(stressor.WorkPerSecond > 0);
+    }
+
+    [Fact]
+    public async Task Stressor_ReportsAchievedDutyCycle()
+    {
+        var stressor = new InterferenceStressor(new StressorSpec { Kind = StressorKind.IntegerBurn, Threads = 1, Intensity = 0.5 });
+        await Task.Delay(500);
+        stressor.Dispose();
+
+        // Half of every period busy, not a third as a sleep rounded up to a timer tick would give
+        Assert.InRange(stressor.BusyFraction, 0.4, 0.6);
+    }
+
+    [Fact]
+    public async Task Stressor_ThreadUsesItsIntensityOfCpuTime()
+    {
+        // The pin callback runs on the stressor thread, which is how the test learns its OS thread id
+        int threadId = 0;
+        bool Capture(int cpu)
+        {
+            Volatile.Write(ref threadId, OperatingSystem.IsWindows() ? (int)GetCurrentThreadId() : GetTid());
+            return true;
+        }
+
+        var stressor = new InterferenceStressor(
+            new StressorSpec { Kind = StressorKind.IntegerBurn, Threads = 1, Intensity = 0.25, Cpus = [0] },
+            Capture,
+            HighResolutionWaiter.TryCreate);
+        try
+        {
+            await Task.Delay(200);
+            var before = ThreadCpuTime(Volatile.Read(ref threadId));
+            long start = Stopwatch.GetTimestamp();
+            await Task.Delay(1000);
+            var cpu = ThreadCpuTime(Volatile.Read(ref threadId)) - before;
+            double share = cpu / Stopwatch.GetElapsedTime(start);
+
+            // A thread spinning through its idle time would use the whole core
+            Assert.InRange(share, 0.1, 0.45);
+            Assert.InRange(stressor.BusyFraction, 0.15, 0.45);
+        }
+        finally
+        {
+            stressor.Dispose();
+        }
+    }
+
+    [Fact]
+    public async Task Stressor_PinsThreadsRoundRobin()
+    {
+        var pinned = new List<int>();
+        bool Pin(int cpu)
+        {
+            lock (pinned)
+            {
+                pinned.Add(cpu);
+            }
+
+            return cpu != 5;
+        }
+
+        var stressor = new InterferenceStressor(
+            new StressorSpec { Kind = StressorKind.IntegerBurn, Threads = 3, Intensity = 0.1, Cpus = [4, 5] },
+            Pin);
+        await Task.Delay(50);
+        stressor.Dispose();
+
+        Assert.Equal([4, 4, 5], pinned.Order().ToArray());
+        Assert.Equal(1, stressor.UnpinnedThreads);
+    }
+
+    [Fact]
+    public async Task RunAsync_ReportsSensitivityAgainstIdleBaseline()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new InterferenceRunner(engine);
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                new WorkloadSpec { FilePath = "test.dat", FileSize = 1024 * 1024, BlockSize = 4096, Pattern = AccessPattern.Random, QueueDepth = 1 }
+            ],
+            Trials = 1,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(50)
+        };
+
+        var result = await runner.RunAsync(
+            plan,
+            [
+                new StressorLevel { Stressors = [new StressorSpec { Kind = StressorKind.IntegerBurn, Intensity = 0.5 }] },
+                new StressorLevel { Name = "both", Stressors = [new StressorSpec { Kind = StressorKind.CacheThrash, BufferBytes = 65536 }, new StressorSpec { Kind = StressorKind.VectorBurn }] }
+            ]);
+
+        Assert.Equal(["idle", "1x IntegerBurn 50%", "both"], result.Levels.Select(l => l.Name).ToArray());
+        Assert.Empty(result.Levels[0].StressorThroughput);
+        Assert.Equal(1.0, result.Levels[0].Sensitivity[0].P99Ratio);
+        Assert.Equal(1.0, result.Levels[0].Sensitivity[0].IopsRatio);
+        Assert.Equal(2, result.Levels[2].StressorThroughput.Count);
+        Assert.All(result.Levels.Skip(1).SelectMany(l => l.StressorThroughput), s => Assert.True(s.PerSecond > 0));
+        Assert.All(result.Levels, l => Assert.True(l.Sensitivity[0].P99Ratio > 0));
+        Assert.Single(result.Workloads);
+        Assert.Equal(3, result.Workloads[0].Scores.Count);
+    }
+
+    [Fact]
+    public async Task RunAsync_RejectsInvalidStressors()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new InterferenceRunner(engine);
+        var plan = new BenchmarkPlan { Workloads = [] };
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan, []));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(
+            plan, [new StressorLevel { Stressors = [new StressorSpec { Kind = StressorKind.IntegerBurn, Intensity = 1.5 }] }]));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(
+            plan, [new StressorLevel { Stressors = [new StressorSpec { Kind = StressorKind.MemoryStream, Cpus = [] }] }]));
+    }
+
+    private static TimeSpan ThreadCpuTime(int threadId)
+    {
+        using var process = Process.GetCurrentProcess();
+        return process.Threads.Cast<ProcessThread>().Single(t => t.Id == threadId).TotalProcessorTime;
+    }
+
+    [LibraryImport("kernel32.dll")]
+    private static partial uint GetCurrentThreadId();
+
+    [LibraryImport("libc", EntryPoint = "gettid")]
+    private static partial int GetTid();
+}
@@ -0,0 +1,195 @@
+using DiskBench.Core;
+using DiskBench.Win32;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for custom IO generator plugins and batched IO streams.
+/// </summary>
+public class IoGeneratorPluginTests
+{
+    private const long FileSize = 1024 * 1024;
+    private const int BlockSize = 4096;
+
+    [Fact]
+    public void Stream_UsesPluginSourcesAndBuiltInsForTheRest()
+    {
+        var workload = CreateWorkload(Reference<StrideGenerator>(("stride", "3")), writePercent: 0);
+        var stream = new IoStreamGenerator(workload, seed: 7);
+
+        for (int i = 0; i < 600; i++)
+        {
+            var io = stream.NextIo();
+            Assert.Equal(i * 3L * BlockSize % FileSize, io.Offset);
+            Assert.Equal(i % 2 == 0 ? BlockSize : BlockSize / 2, io.Size);
+            Assert.False(io.IsWrite);
+            Assert.Equal(0, io.ThinkTimeTicks);
+        }
+
+        Assert.Equal(600, stream.Issued);
+        Assert.Equal("StrideGenerator", workload.Generator!.GetDisplayName());
+        Assert.StartsWith("StrideGenerator", workload.GetDisplayName());
+    }
+
+    [Fact]
+    public void Stream_WithoutGenerator_MatchesOffsetGenerator()
+    {
+        var workload = CreateWorkload(null, writePercent: 50) with { Pattern = AccessPattern.Random };
+        var stream = new IoStreamGenerator(workload, seed: 11);
+        var offsets = new OffsetGenerator(AccessPattern.Random, FileSize, BlockSize, 0, FileSize, 11);
+
+        int writes = 0;
+        for (int i = 0; i < 1000; i++)
+        {
+            var io = stream.NextIo();
+            Assert.Equal(offsets.GetNextOffset(), io.Offset);
+            Assert.Equal(BlockSize, io.Size);
+            writes += io.IsWrite ? 1 : 0;
+        }
+
+        Assert.InRange(writes, 400, 600);
+    }
+
+    [Fact]
+    public void Stream_InvalidPluginIo_Throws()
+    {
+        var workload = CreateWorkload(Reference<StrideGenerator>(("stride", "1"), ("size", "8192")), writePercent: 0);
+
+        var ex = Assert.Throws<InvalidOperationException>(() => new IoStreamGenerator(workload, seed: 1).NextIo());
+        Assert.Contains("StrideGenerator", ex.Message);
+    }
+
+    [Fact]
+    public async Task Engine_UnalignedPluginIo_FailsOnlyForUnbufferedIo()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var workload = CreateWorkload(Reference<StrideGenerator>(("stride", "1"), ("size", "1000")), writePercent: 0);
+        TrialSpec Spec(bool noBuffering) => new()
+        {
+            Workload = workload with { NoBuffering = noBuffering },
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(50),
+            Seed = 1,
+            TrialNumber = 1
+        };
+
+        var ex = await Assert.ThrowsAsync<InvalidOperationException>(() => engine.RunTrialAsync(Spec(noBuffering: true)));
+        Assert.Contains("512-byte sector", ex.Message);
+
+        var buffered = await engine.RunTrialAsync(Spec(noBuffering: false));
+        Assert.Equal(buffered.TotalOperations * 1000, buffered.TotalBytes);
+    }
+
+    [Fact]
+    public void Loader_SharesFactoryAndRejectsBadTypes()
+    {
+        var reference = Reference<StrideGenerator>();
+
+        Assert.Same(IoGeneratorLoader.Load(reference), IoGeneratorLoader.Load(reference with { Parameters = null }));
+        Assert.Throws<InvalidOperationException>(() => IoGeneratorLoader.Load(new IoGeneratorReference { TypeName = "No.Such.Type" }));
+        Assert.Throws<InvalidOperationException>(() => IoGeneratorLoader.Load(new IoGeneratorReference
+        {
+            TypeName = typeof(IoGeneratorPluginTests).AssemblyQualifiedName!
+        }));
+        Assert.Throws<FileNotFoundException>(() => IoGeneratorLoader.Load(new IoGeneratorReference
+        {
+            TypeName = "Plugin.Offsets",
+            AssemblyPath = Path.Combine(Path.GetTempPath(), $"missing_{Guid.NewGuid():N}.dll")
+        }));
+    }
+
+    [Fact]
+    public async Task Engine_IssuesPluginStream()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var observer = new RecordingIoObserver();
+
+        var result = await engine.RunTrialAsync(new TrialSpec
+        {
+            Workload = CreateWorkload(Reference<StrideGenerator>(("stride", "5")), writePercent: 0),
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(100),
+            Seed = 1,
+            TrialNumber = 1,
+            IoObserver = observer
+        });
+
+        Assert.NotEmpty(observer.Issued);
+        Assert.All(observer.Issued.Select((io, i) => (io, i)), x => Assert.Equal(x.i * 5L * BlockSize % FileSize, x.io.Offset));
+        Assert.Equal(BlockSize / 2, observer.Issued[1].Size);
+        Assert.True(result.TotalBytes < result.TotalOperations * BlockSize);
+    }
+
+    [Fact]
+    public async Task RunAsync_UnknownGenerator_FailsBeforeRunning()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+        var plan = new BenchmarkPlan { Workloads = [CreateWorkload(new IoGeneratorReference { TypeName = "No.Such.Type" }, 0)] };
+
+        await Assert.ThrowsAsync<InvalidOperationException>(() => runner.RunAsync(plan));
+    }
+
+    private static WorkloadSpec CreateWorkload(IoGeneratorReference? generator, int writePercent) => new()
+    {
+        FilePath = "plugin.dat",
+        FileSize = FileSize,
+        BlockSize = BlockSize,
+        WritePercent = writePercent,
+        QueueDepth = 4,
+        Generator = generator
+    };
+
+    private static IoGeneratorReference Reference<T>(params (string Key, string Value)[] parameters) => new()
+    {
+        TypeName = typeof(T).AssemblyQualifiedName!,
+        Parameters = parameters.ToDictionary(p => p.Key, p => p.Value)
+    };
+
+    /// <summary>
+    /// Strides through the file a configurable number of blocks at a time, alternating full and half blocks
+    /// (or a fixed "size"). Read/write decisions and think time stay built-in.
+    /// </summary>
+    public sealed class StrideGenerator : IIoGeneratorFactory
+    {
+        public IOffsetSource? CreateOffsetSource(IoGeneratorContext context) =>
+            new StrideOffsets(context.Workload, int.Parse(context.Parameters["stride"], System.Globalization.CultureInfo.InvariantCulture));
+
+        public IOperationSource? CreateOperationSource(IoGeneratorContext context) => null;
+
+        public ISizeSource? CreateSizeSource(IoGeneratorContext context) =>
+            new AlternatingSizes(context.Parameters.TryGetValue("size", out var size)
+                ? int.Parse(size, System.Globalization.CultureInfo.InvariantCulture)
+                : null, context.Workload.BlockSize);
+
+        public IThinkTimeSource? CreateThinkTimeSource(IoGeneratorContext context) => null;
+    }
+
+    private sealed class StrideOffsets(WorkloadSpec workload, int stride) : IOffsetSource
+    {
+        private long _next;
+
+        public void Fill(Span<IoDescriptor> batch)
+        {
+            for (int i = 0; i < batch.Length; i++)
+            {
+                batch[i].Offset = _next;
+                _next = (_next + (long)stride * workload.BlockSize) % workload.FileSize;
+            }
+        }
+    }
+
+    private sealed class AlternatingSizes(int? size, int blockSize) : ISizeSource
+    {
+        private long _count;
+
+        public void Fill(Span<IoDescriptor> batch)
+        {
+            for (int i = 0; i < batch.Length; i++)
+            {
+                batch[i].Size = size ?? (_count++ % 2 == 0 ? blockSize : blockSize / 2);
+            }
+        }
+    }
+}
@@ -0,0 +1,190 @@
+using System.Diagnostics;
+using System.Globalization;
+using System.Text;
+using DiskBench.Win32;
+using Xunit;
+using Xunit.Abstractions;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for the IO slot table, including a microbenchmark of the completion path that prints its
+/// per-queue-depth cost so the numbers can be reproduced.
+/// </summary>
+public sealed class IoSlotTableTests
+{
+    private static readonly int[] QueueDepths = [1, 16, 256, 1024, 4096, 16384];
+
+    private readonly ITestOutputHelper _output;
+
+    public IoSlotTableTests(ITestOutputHelper output)
+    {
+        _output = output;
+    }
+
+    [Fact]
+    public void TryGetSlot_MapsEveryOverlappedBackToItsSlot()
+    {
+        using var table = new IoSlotTable(300, 4096, 4096);
+
+        for (int i = 0; i < table.Count; i++)
+        {
+            Assert.True(table.TryGetSlot(table[i].OverlappedPtr, out var slot));
+            Assert.Equal(i, slot.Index);
+            Assert.Equal(0, table[i].OverlappedPtr % IoSlotTable.OverlappedStride);
+            Assert.Equal(0, table[i].Buffer % 4096);
+        }
+    }
+
+    [Fact]
+    public void TryGetSlot_RejectsForeignAndMisalignedPointers()
+    {
+        using var table = new IoSlotTable(8, 512, 512);
+        using var other = new IoSlotTable(8, 512, 512);
+
+        Assert.False(table.TryGetSlot(IntPtr.Zero, out _));
+        Assert.False(table.TryGetSlot(other[0].OverlappedPtr, out _));
+        Assert.False(table.TryGetSlot(table[3].OverlappedPtr + 8, out _));
+        Assert.False(table.TryGetSlot(table[7].OverlappedPtr + IoSlotTable.OverlappedStride, out _));
+        Assert.False(table.TryGetSlot(table[0].OverlappedPtr - IoSlotTable.OverlappedStride, out _));
+    }
+
+    [Fact]
+    public void Pending_CountAndEnumerationFollowTheBits()
+    {
+        using var table = new IoSlotTable(200, 512, 512);
+        int[] pending = [0, 63, 64, 65, 130, 199];
+
+        foreach (int index in pending)
+        {
+            var slot = table[index];
+            slot.IsPending = true;
+            slot.IsPending = true;
+        }
+
+        Assert.Equal(pending.Length, table.PendingCount);
+        Assert.Equal(pending, Collect(table.GetPendingSlots()));
+
+        var cleared = table[64];
+        cleared.IsPending = false;
+        cleared.IsPending = false;
+
+        Assert.Equal(pending.Length - 1, table.PendingCount);
+        Assert.Equal([0, 63, 65, 130, 199], Collect(table.GetPendingSlots()));
+        Assert.Equal(0, table.DeferredCount);
+
+        table.ResetAll();
+        Assert.Equal(0, table.PendingCount);
+        Assert.Empty(Collect(table.GetPendingSlots()));
+    }
+
+    [Fact]
+    public void Deferred_CountAndEnumerationFollowTheAction()
+    {
+        using var table = new IoSlotTable(100, 512, 512);
+
+        var first = table[5];
+        first.DeferredAction = DeferredIoAction.Retry;
+        var second = table[70];
+        second.DeferredAction = DeferredIoAction.Complete;
+        second.DeferredAction = DeferredIoAction.Submit;
+
+        Assert.Equal(2, table.DeferredCount);
+        Assert.Equal([5, 70], Collect(table.GetDeferredSlots()));
+
+        first.DeferredAction = DeferredIoAction.None;
+
+        Assert.Equal(1, table.DeferredCount);
+        Assert.Equal([70], Collect(table.GetDeferredSlots()));
+    }
+
+    [Fact]
+    public void CompletionError_ComesFromTheSlotsOverlapped()
+    {
+        using var table = new IoSlotTable(4, 512, 512);
+        var slot = table[2];
+
+        Assert.Equal(0, slot.CompletionError);
+
+        if (OperatingSystem.IsWindows())
+        {
+            // STATUS_END_OF_FILE
+            slot.Overlapped.InternalLow = unchecked((nint)0xC0000011u);
+            Assert.Equal(38, slot.CompletionError);
+        }
+    }
+
+    [Fact]
+    public void CompletionDispatch_CostDoesNotGrowWithQueueDepth()
+    {
+        // The completion path's table work: map the OVERLAPPED to its slot, retire it, read the
+        // in-flight count and resubmit. A linear slot search would make QD 16384 ~1000x QD 16.
+        var costs = new double[QueueDepths.Length];
+        var report = new StringBuilder("Completion dispatch (TryGetSlot, pending toggle, PendingCount):");
+        for (int i = 0; i < QueueDepths.Length; i++)
+        {
+            costs[i] = MeasureDispatchNanoseconds(QueueDepths[i], out long bytesPerSlot);
+            report.Append(CultureInfo.InvariantCulture, $"\n  QD {QueueDepths[i],5}: {costs[i],6:F1} ns  ({bytesPerSlot} B/slot)");
+        }
+
+        _output.WriteLine(report.ToString());
+
+        double atSixteen = costs[Array.IndexOf(QueueDepths, 16)];
+        Assert.True(costs[^1] <= (8 * atSixteen) + 50, report.ToString());
+    }
+
+    private static double MeasureDispatchNanoseconds(int queueDepth, out long bytesPerSlot)
+    {
+        const int Operations = 1 << 20;
+
+        using var table = new IoSlotTable(queueDepth, 512, 512);
+        bytesPerSlot = table.BytesPerSlot;
+
+        // Completions arrive in no particular order
+        var random = new Random(queueDepth);
+        var overlapped = new IntPtr[queueDepth];
+        for (int i = 0; i < queueDepth; i++)
+        {
+            var slot = table[i];
+            slot.IsPending = true;
+            overlapped[i] = slot.OverlappedPtr;
+        }
+
+        random.Shuffle(overlapped);
+
+        double best = double.MaxValue;
+        for (int run = 0; run < 5; run++)
+        {
+            long checksum = 0;
+            long start = Stopwatch.GetTimestamp();
+            for (int op = 0; op < Operations; op++)
+            {
+                if (!table.TryGetSlot(overlapped[op & (queueDepth - 1)], out var slot))
+                {
+                    throw new InvalidOperationException("Completion did not map to a slot.");
+                }
+
+                slot.IsPending = false;
+                checksum += table.PendingCount;
+                slot.IsPending = true;
+            }
+
+            double nanoseconds = Stopwatch.GetElapsedTime(start).TotalNanoseconds / Operations;
+            Assert.Equal((long)Operations * (queueDepth - 1), checksum);
+            best = Math.Min(best, nanoseconds);
+        }
+
+        return best;
+    }
+
+    private static int[] Collect(IoSlotTable.SlotEnumerator slots)
+    {
+        var indices = new List<int>();
+        foreach (var slot in slots)
+        {
+            indices.Add(slot.Index);
+        }
+
+        return [.. indices];
+    }
+}
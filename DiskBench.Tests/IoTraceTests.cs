@@ -0,0 +1,207 @@
+using DiskBench.Core;
+using DiskBench.Metrics;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for the columnar IO trace format and its queries.
+/// </summary>
+public sealed class IoTraceTests : IDisposable
+{
+    // Microsecond ticks keep the expected values readable
+    private const long Frequency = 1_000_000;
+    private const int BlockSize = 1000;
+
+    private readonly string _root = Path.Combine(Path.GetTempPath(), "diskbench-trace-" + Guid.NewGuid().ToString("N"));
+
+    public IoTraceTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void Read_RoundTripsEveryColumn()
+    {
+        var records = CreateRecords(10_500);
+        var path = WriteTrace(records);
+
+        using var reader = new IoTraceReader(path);
+
+        Assert.Equal(records.Length, reader.Count);
+        Assert.Equal(11, reader.Blocks.Count);
+        Assert.Equal(Frequency, reader.Frequency);
+        Assert.Equal(records, reader.Read().ToArray());
+        Assert.Equal(500, reader.Blocks[^1].Count);
+        Assert.Equal(records[..1000].Max(r => r.LatencyTicks), reader.Blocks[0].MaxLatencyTicks);
+    }
+
+    [Fact]
+    public void Queries_MatchBruteForceAndSkipBlocks()
+    {
+        var records = CreateRecords(20_000);
+        using var reader = new IoTraceReader(WriteTrace(records));
+        var filters = new[]
+        {
+            new IoTraceFilter { From = TimeSpan.FromMilliseconds(50), To = TimeSpan.FromMilliseconds(80) },
+            new IoTraceFilter { MinOffset = 1 << 20, MaxOffset = 3 << 20, IsWrite = true },
+            new IoTraceFilter { MinLatency = TimeSpan.FromMicroseconds(900), IsWrite = false },
+            new IoTraceFilter()
+        };
+
+        foreach (var filter in filters)
+        {
+            var expected = records.Where(r => Matches(filter, r)).ToArray();
+
+            Assert.Equal(expected, reader.Read(filter).ToArray());
+            Assert.Equal(expected.Length, reader.Aggregate(filter).Count);
+            Assert.Equal(expected.Length, reader.Aggregate(filter, maxDegreeOfParallelism: 1).Count);
+        }
+
+        // Submit times grow 5 us per IO, so a 30 ms window touches 6 or 7 of the 20 blocks
+        var window = reader.Aggregate(filters[0]);
+        Assert.InRange(window.BlocksScanned, 6, 7);
+        Assert.Equal(20, window.BlocksScanned + window.BlocksSkipped);
+        Assert.Equal(0, reader.Aggregate(new IoTraceFilter { MinLatency = TimeSpan.FromSeconds(1) }).BlocksScanned);
+    }
+
+    [Fact]
+    public void Aggregate_HistogramMatchesLatencies()
+    {
+        var records = CreateRecords(5000);
+        using var reader = new IoTraceReader(WriteTrace(records));
+
+        var latency = reader.Aggregate().Latency;
+        double scale = (double)System.Diagnostics.Stopwatch.Frequency / Frequency;
+
+        Assert.Equal(records.Length, latency.Count);
+        Assert.Equal(records.Max(r => r.LatencyTicks) * scale, latency.MaxTicks, 0);
+        Assert.Equal(records.Average(r => r.LatencyTicks) * scale, latency.MeanTicks, 0);
+    }
+
+    [Fact]
+    public void Writer_SequentialTraceIsCompact()
+    {
+        var path = Path.Combine(_root, "sequential.iotrace");
+        using (var writer = new IoTraceWriter(path, frequency: Frequency))
+        {
+            writer.Start(0);
+            for (int i = 0; i < 200_000; i++)
+            {
+                writer.Append(i * 4096L, 4096, false, i * 10L, (i * 10L) + 80 + (i % 7), 1);
+            }
+        }
+
+        Assert.True(new FileInfo(path).Length < 200_000 * 2, $"{new FileInfo(path).Length} bytes");
+    }
+
+    [Fact]
+    public void Writer_RequiresStart_AndReaderRejectsBadFiles()
+    {
+        var path = Path.Combine(_root, "bad.iotrace");
+        using (var writer = new IoTraceWriter(path))
+        {
+            Assert.Throws<InvalidOperationException>(() => writer.Append(0, 4096, false, 0, 10, 1));
+        }
+
+        using (var empty = new IoTraceReader(path))
+        {
+            Assert.Equal(0, empty.Count);
+            Assert.Equal(0, empty.Aggregate().Count);
+        }
+
+        // Cut off the trailer, as a crash before the writer is closed would
+        var bytes = File.ReadAllBytes(WriteTrace(CreateRecords(100)));
+        File.WriteAllBytes(path, bytes[..^8]);
+        Assert.Throws<InvalidDataException>(() => new IoTraceReader(path));
+
+        File.WriteAllText(path, "definitely not a trace file, just text");
+        Assert.Throws<InvalidDataException>(() => new IoTraceReader(path));
+    }
+
+    [Fact]
+    public async Task RunAsync_WithTraceDirectory_TracesEveryMeasuredIo()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                new WorkloadSpec
+                {
+                    FilePath = Path.Combine(_root, "bench.dat"),
+                    FileSize = 1024 * 1024,
+                    BlockSize = 4096,
+                    Pattern = AccessPattern.Random,
+                    WritePercent = 30,
+                    QueueDepth = 4
+                }
+            ],
+            Trials = 2,
+            WarmupDuration = TimeSpan.FromMilliseconds(20),
+            MeasuredDuration = TimeSpan.FromMilliseconds(100),
+            DeleteOnComplete = false,
+            TraceDirectory = Path.Combine(_root, "traces")
+        };
+
+        var result = await runner.RunAsync(plan);
+
+        Assert.All(result.Workloads[0].Trials, trial =>
+        {
+            Assert.Equal(Path.Combine(_root, "traces", $"workload1-trial{trial.TrialNumber}.iotrace"), trial.TracePath);
+            using var reader = new IoTraceReader(trial.TracePath!);
+            var ios = reader.Read().ToList();
+
+            Assert.Equal(trial.TotalOperations, ios.Count);
+            Assert.Equal(trial.WriteOperations, ios.Count(io => io.IsWrite));
+            Assert.Equal(trial.TotalBytes, ios.Sum(io => (long)io.Size));
+            Assert.All(ios, io => Assert.Equal(0, io.Offset % 4096));
+        });
+    }
+
+    private string WriteTrace(IoTraceRecord[] records)
+    {
+        var path = Path.Combine(_root, $"{Guid.NewGuid():N}.iotrace");
+        using var writer = new IoTraceWriter(path, BlockSize, Frequency);
+        writer.Start(1_000_000);
+        foreach (var r in records)
+        {
+            writer.Append(r.Offset, r.Size, r.IsWrite, 1_000_000 + r.SubmitTicks, 1_000_000 + r.SubmitTicks + r.LatencyTicks, r.Thread);
+        }
+
+        return path;
+    }
+
+    private static IoTraceRecord[] CreateRecords(int count)
+    {
+        // Completion order jitters submit times a little; offsets are random 4K blocks in 4 MiB
+        var random = new Random(17);
+        var records = new IoTraceRecord[count];
+        for (int i = 0; i < count; i++)
+        {
+            records[i] = new IoTraceRecord(
+                random.Next(1024) * 4096L,
+                random.Next(4) == 0 ? 65536 : 4096,
+                random.Next(3) == 0,
+                (i * 5L) - random.Next(20),
+                50 + random.Next(1000),
+                1 + (i % 3));
+        }
+
+        return records;
+    }
+
+    private static bool Matches(IoTraceFilter filter, IoTraceRecord r) =>
+        (filter.From == null || r.SubmitTicks >= filter.From.Value.TotalMicroseconds)
+        && (filter.To == null || r.SubmitTicks < filter.To.Value.TotalMicroseconds)
+        && (filter.MinOffset == null || r.Offset >= filter.MinOffset)
+        && (filter.MaxOffset == null || r.Offset < filter.MaxOffset)
+        && (filter.MinLatency == null || r.LatencyTicks >= filter.MinLatency.Value.TotalMicroseconds)
+        && (filter.IsWrite == null || r.IsWrite == filter.IsWrite);
+}
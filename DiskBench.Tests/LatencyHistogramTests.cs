@@ -170,4 +170,30 @@ public class LatencyHistogramTests
         Assert.Equal(1, histogram.Count);
         Assert.Equal(0, histogram.MinTicks);
     }
+
+    [Fact]
+    public void GetIntervalPercentileTicks_OnlyCountsSamplesSinceLastCall()
+    {
+        var histogram = new LatencyHistogram();
+        var baseline = LatencyHistogram.CreateIntervalBaseline();
+
+        for (int i = 0; i < 1000; i++)
+        {
+            histogram.RecordLatencyTicks(10);
+        }
+
+        Assert.Equal(10, histogram.GetIntervalPercentileTicks(0.99, baseline));
+
+        for (int i = 0; i < 100; i++)
+        {
+            histogram.RecordLatencyTicks(50);
+        }
+
+        Assert.Equal(50, histogram.GetIntervalPercentileTicks(0.99, baseline));
+        Assert.Equal(0, histogram.GetIntervalPercentileTicks(0.99, baseline));
+
+        histogram.Reset();
+        histogram.RecordLatencyTicks(20);
+        Assert.Equal(20, histogram.GetIntervalPercentileTicks(0.99, baseline));
+    }
 }
@@ -0,0 +1,194 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for page cache pressure: the balloon, cgroup limits and the scenario runner.
+/// </summary>
+public sealed class MemoryPressureTests : IDisposable
+{
+    private const long MiB = 1024 * 1024;
+
+    private readonly string _root = Path.Combine(Path.GetTempPath(), $"diskbench_pressure_{Guid.NewGuid():N}");
+
+    public MemoryPressureTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void ParseCounters_SumsReclaimReasonsAndPrefersFileRefaults()
+    {
+        var vmstat = PageCacheStats.ParseCounters("""
+            nr_free_pages 12345
+            pgsteal_kswapd 100
+            pgsteal_direct 20
+            pgsteal_khugepaged 3
+            workingset_refault_anon 7
+            workingset_refault_file 40
+            """);
+        var memoryStat = PageCacheStats.ParseCounters("anon 4096\npgsteal 55\nworkingset_refault 9\n");
+
+        Assert.Equal(new PageCacheCounters(123, 40), vmstat);
+        Assert.Equal(new PageCacheCounters(55, 9), memoryStat);
+        Assert.Null(PageCacheStats.ParseCounters("anon 4096\nfile 8192\n"));
+        Assert.Equal(4096, PageCacheStats.GetValue("anon 4096\nfile 8192\n", "anon"));
+        Assert.Equal(1024, PageCacheStats.GetMeminfoKilobytes("MemTotal: 4096 kB\nMemAvailable:   1024 kB\n", "MemAvailable"));
+    }
+
+    [Fact]
+    public void Balloon_InflatesUntilBudgetIsLeft()
+    {
+        // Each chunk allocated lowers available memory by one chunk, as reclaim would
+        long available = 10 * MiB;
+        int calls = 0;
+        var balloon = new MemoryBalloon(() => available - Math.Max(0, calls++ - 1) * MiB, chunkBytes: (int)MiB);
+
+        using (balloon.Apply(6 * MiB))
+        {
+            // One call sets the target, then one per chunk: four chunks leave 6 MiB
+            Assert.Equal(5, calls);
+        }
+
+        Assert.True(balloon.IsAvailable);
+        Assert.Null(balloon.ReadCounters());
+    }
+
+    [Fact]
+    public void Balloon_StaleSource_StopsAtInitialSurplus()
+    {
+        int calls = 0;
+        var balloon = new MemoryBalloon(() => { calls++; return 8 * MiB; }, chunkBytes: (int)MiB);
+
+        using (balloon.Apply(5 * MiB))
+        {
+            Assert.Equal(4, calls);
+        }
+    }
+
+    [Fact]
+    public void Cgroup_AppliesBudgetPlusAnonymousMemoryAndRestores()
+    {
+        File.WriteAllText(Path.Combine(_root, "memory.max"), "max\n");
+        File.WriteAllText(Path.Combine(_root, "memory.stat"), "anon 1048576\nfile 409600\npgsteal 10\nworkingset_refault_file 3\n");
+        var dropCaches = Path.Combine(_root, "drop_caches");
+
+        var limit = new CgroupMemoryLimit(_root, dropCaches);
+        Assert.True(limit.IsAvailable);
+
+        using (limit.Apply(64 * MiB))
+        {
+            Assert.Equal((64 * MiB + MiB + CgroupMemoryLimit.HeadroomBytes).ToString(System.Globalization.CultureInfo.InvariantCulture), File.ReadAllText(Path.Combine(_root, "memory.max")));
+            Assert.Equal("1", File.ReadAllText(dropCaches));
+            Assert.Equal(new PageCacheCounters(10, 3), limit.ReadCounters());
+        }
+
+        Assert.Equal("max", File.ReadAllText(Path.Combine(_root, "memory.max")));
+    }
+
+    [Fact]
+    public void Cgroup_FindsUnifiedHierarchyEntry()
+    {
+        Assert.Equal(
+            Path.Combine("/sys/fs/cgroup", "user.slice/session-2.scope"),
+            CgroupMemoryLimit.FindCgroupDirectory("0::/user.slice/session-2.scope\n", "/sys/fs/cgroup"));
+        Assert.Null(CgroupMemoryLimit.FindCgroupDirectory("12:memory:/user.slice\n", "/sys/fs/cgroup"));
+        Assert.False(new CgroupMemoryLimit(_root).IsAvailable);
+    }
+
+    [Fact]
+    public async Task RunAsync_RunsBaselineThenEachBudget()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var pressure = new RecordingPressure();
+        var runner = new MemoryPressureRunner(engine, pressure);
+
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                CreateWorkload("a.dat", noBuffering: false),
+                CreateWorkload("a.dat", noBuffering: false),
+                CreateWorkload("b.dat", noBuffering: false),
+                CreateWorkload("c.dat", noBuffering: true)
+            ],
+            Trials = 1,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(50),
+            DeleteOnComplete = false
+        };
+
+        var result = await runner.RunAsync(plan, [0.5, 0.25]);
+
+        Assert.Equal(2 * MiB, result.WorkingSetBytes);
+        Assert.Equal([MiB, MiB / 2], pressure.Applied);
+        Assert.Equal(0, pressure.Active);
+
+        Assert.Equal(3, result.Levels.Count);
+        Assert.Null(result.Levels[0].CacheBytes);
+        Assert.Equal("unconstrained", result.Levels[0].Name);
+        Assert.Equal(0.25, result.Levels[2].CacheFraction);
+        Assert.All(result.Levels, l => Assert.Equal(3, l.Result.Workloads.Count));
+        Assert.All(result.Levels, l => Assert.Equal(1, l.RefaultedPages));
+        Assert.Equal(3, result.Workloads.Count);
+        Assert.All(result.Workloads, w => Assert.Equal(3, w.Scores.Count));
+    }
+
+    [Fact]
+    public async Task RunAsync_RejectsPlansWithoutBufferedWorkloads()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new MemoryPressureRunner(engine, new RecordingPressure());
+        var plan = new BenchmarkPlan { Workloads = [CreateWorkload("a.dat", noBuffering: true)] };
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan, [0.5]));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(plan, [0]));
+    }
+
+    private WorkloadSpec CreateWorkload(string file, bool noBuffering) => new()
+    {
+        FilePath = Path.Combine(_root, file),
+        FileSize = MiB,
+        BlockSize = 4096,
+        Pattern = AccessPattern.Random,
+        QueueDepth = 1,
+        NoBuffering = noBuffering
+    };
+
+    private sealed class RecordingPressure : IMemoryPressure
+    {
+        private long _reads;
+
+        public List<long> Applied { get; } = [];
+
+        public int Active { get; private set; }
+
+        public bool IsAvailable => true;
+
+        public string Description => "recording";
+
+        public IDisposable Apply(long cacheBytes)
+        {
+            Applied.Add(cacheBytes);
+            Active++;
+            return new Release(this);
+        }
+
+        public PageCacheCounters? ReadCounters()
+        {
+            _reads++;
+            return new PageCacheCounters(_reads * 10, _reads);
+        }
+
+        private sealed class Release(RecordingPressure owner) : IDisposable
+        {
+            public void Dispose() => owner.Active--;
+        }
+    }
+}
@@ -131,6 +131,27 @@ public class OffsetGeneratorTests
         }
     }
 
+    [Fact]
+    public void Sequential_MoreBlocksThanPrecomputed_VisitsEveryBlock()
+    {
+        var gen = new OffsetGenerator(
+            AccessPattern.Sequential,
+            fileSize: 1000 * 4096,  // 1000 blocks, not a divisor of the table
+            blockSize: 4096,
+            regionOffset: 0,
+            regionLength: 0,
+            seed: 42,
+            precomputeCount: 256);
+
+        for (int i = 0; i < 2500; i++)
+        {
+            Assert.Equal((i % 1000) * 4096L, gen.GetNextOffset());
+        }
+
+        gen.Reset();
+        Assert.Equal(0, gen.GetNextOffset());
+    }
+
     [Fact]
     public void Region_RespectsOffset()
     {
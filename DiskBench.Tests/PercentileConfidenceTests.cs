@@ -0,0 +1,102 @@
+using DiskBench.Metrics;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for latency percentile confidence intervals.
+/// </summary>
+public class PercentileConfidenceTests
+{
+    [Fact]
+    public void OrderStatisticRanks_SmallTail_UsesExactBinomial()
+    {
+        // 1000 samples put about one sample beyond p99.9, so the upper bound is the maximum
+        var (lower, upper) = PercentileConfidence.OrderStatisticRanks(1000, 0.999);
+
+        Assert.Equal(997, lower);
+        Assert.Equal(1000, upper);
+    }
+
+    [Fact]
+    public void OrderStatisticRanks_LargeSample_IsSymmetricAroundRank()
+    {
+        var (lower, upper) = PercentileConfidence.OrderStatisticRanks(100_000, 0.5);
+
+        // 1.96 * sqrt(100000 * 0.25) = 310 ranks either side
+        Assert.Equal(49_690, lower);
+        Assert.Equal(50_311, upper);
+    }
+
+    [Fact]
+    public void OrderStatisticRanks_CoverTruePercentile()
+    {
+        // Exponential samples with rate 1: the true p99 is ln(100)
+        double truth = Math.Log(100);
+        var random = new Random(3);
+        int covered = 0;
+        const int experiments = 400;
+        for (int e = 0; e < experiments; e++)
+        {
+            var samples = new double[2000];
+            for (int i = 0; i < samples.Length; i++)
+            {
+                samples[i] = -Math.Log(1 - random.NextDouble());
+            }
+
+            Array.Sort(samples);
+            var (lower, upper) = PercentileConfidence.OrderStatisticRanks(samples.Length, 0.99);
+            covered += samples[lower - 1] <= truth && truth <= samples[upper - 1] ? 1 : 0;
+        }
+
+        Assert.InRange((double)covered / experiments, 0.92, 0.99);
+    }
+
+    [Fact]
+    public void TailSamples_CountsSamplesBeyondPercentile()
+    {
+        Assert.Equal(20, PercentileConfidence.TailSamples(20_000, 0.999));
+        Assert.Equal(0, PercentileConfidence.TailSamples(500, 0.999));
+    }
+
+    [Fact]
+    public void BucketBootstrap_FewerSamples_GiveWiderTailInterval()
+    {
+        var large = CreateHistogram(200_000, seed: 1);
+        var small = CreateHistogram(2_000, seed: 2);
+
+        var largeCI = PercentileConfidence.BucketBootstrapIntervals([large, large, large], [0.5, 0.999], iterations: 500)[1];
+        var smallCI = PercentileConfidence.BucketBootstrapIntervals([small, small, small], [0.5, 0.999], iterations: 500)[1];
+
+        Assert.True(largeCI.Lower <= largeCI.Upper);
+        Assert.True(smallCI.Upper - smallCI.Lower > largeCI.Upper - largeCI.Lower);
+        Assert.InRange(large.GetPercentileTicks(0.999), largeCI.Lower, largeCI.Upper);
+    }
+
+    [Fact]
+    public void Combine_PoolsSamples()
+    {
+        var a = CreateHistogram(1000, seed: 4);
+        var b = CreateHistogram(3000, seed: 5);
+
+        var combined = HistogramSnapshot.Combine([a, b]);
+
+        Assert.Equal(4000, combined.Count);
+        Assert.Equal(a.SumTicks + b.SumTicks, combined.SumTicks);
+        Assert.Equal(Math.Max(a.MaxTicks, b.MaxTicks), combined.MaxTicks);
+        Assert.Equal(Math.Min(a.MinTicks, b.MinTicks), combined.MinTicks);
+    }
+
+    private static HistogramSnapshot CreateHistogram(int samples, int seed)
+    {
+        // Exponential latencies with a 1000-tick mean on top of a 500-tick floor
+        var random = new Random(seed);
+        var histogram = new LatencyHistogram();
+        for (int i = 0; i < samples; i++)
+        {
+            histogram.RecordLatencyTicks(500 + (long)(-1000 * Math.Log(1 - random.NextDouble())));
+        }
+
+        return histogram.CreateSnapshot();
+    }
+}
@@ -0,0 +1,172 @@
+using System.IO.Compression;
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for generated prepared-file content and its manifest.
+/// </summary>
+public sealed class PreparedContentTests : IDisposable
+{
+    private const int FileSize = 1 << 20;
+
+    private readonly string _root = Path.Combine(Path.GetTempPath(), "diskbench-content-" + Guid.NewGuid().ToString("N"));
+
+    public PreparedContentTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void Generate_MeetsTargetCompressibility()
+    {
+        double incompressible = CompressionRatio(Generate(new PreparedContent()));
+        double compressible = CompressionRatio(Generate(new PreparedContent { Mode = ContentMode.Compressible }));
+        double text = CompressionRatio(Generate(new PreparedContent { Mode = ContentMode.Text }));
+
+        Assert.InRange(incompressible, 0.99, 1.01);
+        Assert.InRange(compressible, 1.8, 2.1);
+        Assert.True(text > 2.5, $"text compresses {text:F2}:1");
+    }
+
+    [Fact]
+    public void Generate_RepeatsBlocksToUniqueRatio()
+    {
+        var content = new PreparedContent { UniqueBlockRatio = 0.25 };
+        var data = Generate(content);
+
+        var blocks = Enumerable.Range(0, FileSize / content.BlockSize)
+            .Select(b => Convert.ToBase64String(data, b * content.BlockSize, content.BlockSize))
+            .ToList();
+
+        Assert.Equal(64, new ContentGenerator(content, FileSize).UniqueBlocks);
+        Assert.Equal(64, blocks.Distinct(StringComparer.Ordinal).Count());
+        Assert.Equal(256, Generate(new PreparedContent()).Chunk(4096).Select(Convert.ToBase64String).Distinct(StringComparer.Ordinal).Count());
+    }
+
+    [Fact]
+    public void Fill_DependsOnlyOnOffsetAndSeed()
+    {
+        var content = new PreparedContent { Mode = ContentMode.Text };
+        var whole = Generate(content);
+
+        // Filling in uneven chunks, ending in a partial block, gives the same bytes
+        var generator = new ContentGenerator(content, FileSize);
+        var pieces = new byte[FileSize - 100];
+        generator.Fill(pieces.AsSpan(0, 12288), 0);
+        generator.Fill(pieces.AsSpan(12288), 12288);
+
+        Assert.Equal(whole[..^100], pieces);
+        Assert.NotEqual(whole, Generate(content with { Seed = 2 }));
+        Assert.Throws<ArgumentException>(() => generator.Fill(pieces, 100));
+        Assert.Throws<ArgumentException>(() => new ContentGenerator(content with { UniqueBlockRatio = 0 }, FileSize));
+        Assert.Throws<ArgumentException>(() => new ContentGenerator(content with { BlockSize = 1000 }, FileSize));
+    }
+
+    [Fact]
+    public void Manifest_MatchesOnlyTheSameContent()
+    {
+        var path = Path.Combine(_root, "bench.dat");
+        var content = new PreparedContent { Mode = ContentMode.Compressible, UniqueBlockRatio = 0.5 };
+
+        Assert.False(PrepareManifest.Matches(path, FileSize, content));
+        PrepareManifest.Write(path, FileSize, content);
+
+        Assert.True(PrepareManifest.Matches(path, FileSize, content with { }));
+        Assert.False(PrepareManifest.Matches(path, FileSize * 2, content));
+        Assert.False(PrepareManifest.Matches(path, FileSize, content with { Mode = ContentMode.Text }));
+        Assert.False(PrepareManifest.Matches(path, FileSize, content with { Seed = 7 }));
+        Assert.Equal("2:1 compressible, 50% unique", content.GetDisplayName());
+
+        PrepareManifest.Delete(path);
+        Assert.False(File.Exists(PrepareManifest.GetPath(path)));
+    }
+
+    [Fact]
+    public void Manifest_InvalidatedOnlyByWorkloadsThatMayWrite()
+    {
+        var content = new PreparedContent();
+        var workload = new WorkloadSpec
+        {
+            FilePath = Path.Combine(_root, "set.dat"),
+            FileSize = FileSize,
+            BlockSize = 4096,
+            FileSet = new FileSetSpec { FileCount = 3 },
+            WritePercent = 0
+        };
+        var paths = workload.GetFilePaths();
+        foreach (var path in paths)
+        {
+            PrepareManifest.Write(path, FileSize, content);
+        }
+
+        PrepareManifest.Invalidate(workload);
+        Assert.All(paths, path => Assert.True(PrepareManifest.Matches(path, FileSize, content)));
+
+        PrepareManifest.Invalidate(workload with { WritePercent = 30 });
+        Assert.All(paths, path => Assert.False(File.Exists(PrepareManifest.GetPath(path))));
+
+        PrepareManifest.Write(paths[0], FileSize, content);
+        PrepareManifest.Invalidate(workload with { Generator = new IoGeneratorReference { TypeName = "Plugin.Operations" } });
+        Assert.False(PrepareManifest.Matches(paths[0], FileSize, content));
+    }
+
+    [Fact]
+    public async Task RunAsync_PreparesEveryFileWithPlanContent()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var content = new PreparedContent { Mode = ContentMode.Text };
+        var workload = new WorkloadSpec
+        {
+            FilePath = Path.Combine(_root, "bench.dat"),
+            FileSize = 4 << 20,
+            BlockSize = 4096,
+            Pattern = AccessPattern.Random,
+            FileSet = new FileSetSpec { FileCount = 3 }
+        };
+        var plan = new BenchmarkPlan
+        {
+            Workloads = [workload],
+            Trials = 1,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(50),
+            DeleteOnComplete = false,
+            Content = content
+        };
+
+        var result = await new BenchmarkRunner(engine).RunAsync(plan);
+
+        // Files of a set get distinct seeds so they do not dedupe against each other
+        int[] seeds = [1, 2, 3];
+        Assert.Equal(seeds, workload.GetFilePaths().Select(p => engine.PreparedContents[p]!.Seed).ToArray());
+        Assert.All(engine.PreparedContents.Values, c => Assert.Equal(ContentMode.Text, c!.Mode));
+        Assert.Same(content, result.Plan.Content);
+
+        await Assert.ThrowsAsync<ArgumentException>(() => new BenchmarkRunner(engine).RunAsync(
+            plan with { Content = content with { UniqueBlockRatio = 1.5 } }));
+    }
+
+    private static byte[] Generate(PreparedContent content)
+    {
+        var data = new byte[FileSize];
+        new ContentGenerator(content, FileSize).Fill(data, 0);
+        return data;
+    }
+
+    private static double CompressionRatio(byte[] data)
+    {
+        using var compressed = new MemoryStream();
+        using (var deflate = new DeflateStream(compressed, CompressionLevel.Optimal, leaveOpen: true))
+        {
+            deflate.Write(data);
+        }
+
+        return (double)data.Length / compressed.Length;
+    }
+}
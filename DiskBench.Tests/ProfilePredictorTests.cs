@@ -0,0 +1,164 @@
+using DiskBench.Core;
+using DiskBench.Metrics;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for predicting usage profile results from a basis of short measurements.
+/// </summary>
+public sealed class ProfilePredictorTests
+{
+    [Fact]
+    public void RidgeRegression_RecoversLinearRelation()
+    {
+        var random = new Random(5);
+        var features = new List<double[]>();
+        var targets = new List<double>();
+        for (int i = 0; i < 40; i++)
+        {
+            double a = random.NextDouble() * 10;
+            double b = random.NextDouble() * 10;
+            features.Add([a, b, 7]);
+            targets.Add((2 * a) - b + 3 + ((random.NextDouble() - 0.5) * 0.01));
+        }
+
+        var model = RidgeRegression.Fit(features, targets);
+
+        Assert.Equal(40, model.SampleCount);
+        Assert.Equal(3, model.FeatureCount);
+        Assert.Equal(2 * 4.0 - 1.0 + 3, model.Predict([4.0, 1.0, 7]), 1);
+        Assert.True(model.CrossValidatedError < 0.05, $"error {model.CrossValidatedError}");
+        Assert.Throws<ArgumentException>(() => RidgeRegression.Fit(features.Take(3).ToList(), targets.Take(3).ToList()));
+        Assert.InRange(model.EffectiveParameters, 1, 4);
+        Assert.Throws<ArgumentException>(() => model.Predict([1.0]));
+    }
+
+    [Fact]
+    public void RidgeRegression_CrossValidatedErrorReflectsNoise()
+    {
+        var random = new Random(9);
+        var features = new List<double[]>();
+        var targets = new List<double>();
+        for (int i = 0; i < 200; i++)
+        {
+            double a = random.NextDouble();
+            features.Add([a]);
+            targets.Add(a + (random.NextDouble() < 0.5 ? -0.5 : 0.5));
+        }
+
+        // Noise of ±0.5 cannot be explained, so the held-out error is about 0.5
+        Assert.InRange(RidgeRegression.Fit(features, targets).CrossValidatedError, 0.45, 0.6);
+    }
+
+    [Fact]
+    public void RidgeRegression_NestedErrorOnNoiseStaysAtNoiseLevel()
+    {
+        // Pure noise: whichever penalty wins the inner selection, held-out error stays at the noise level
+        var random = new Random(12);
+        var features = new List<double[]>();
+        var targets = new List<double>();
+        for (int i = 0; i < 15; i++)
+        {
+            features.Add([random.NextDouble(), random.NextDouble(), random.NextDouble()]);
+            targets.Add(random.NextDouble() < 0.5 ? -1 : 1);
+        }
+
+        var model = RidgeRegression.Fit(features, targets);
+        Assert.True(model.CrossValidatedError >= 0.9, $"error {model.CrossValidatedError}");
+    }
+
+    [Fact]
+    public void Fit_PredictsUnseenDriveWithinBand()
+    {
+        var random = new Random(3);
+        var drives = Enumerable.Range(0, 30).Select(_ => CreateDrive(random, noise: 0.03)).ToList();
+
+        var predictor = ProfilePredictor.Fit(drives[..^1]);
+        var unseen = drives[^1];
+        var result = predictor.Predict(unseen);
+
+        string[] fitted = [OltpReads, BackupWrite];
+        Assert.Equal(fitted, predictor.Fits.Select(f => f.Name).ToArray());
+        Assert.All(predictor.Fits, f => Assert.Equal(29, f.Samples));
+        Assert.All(predictor.Fits, f => Assert.InRange(f.IopsError, 0, 0.1));
+
+        string[] profiles = ["Database Server", "Backup"];
+        Assert.Equal(profiles, result.Profiles.Select(p => p.Name).ToArray());
+        foreach (var prediction in result.Profiles.SelectMany(p => p.Workloads))
+        {
+            var actual = unseen[prediction.Name];
+            Assert.InRange(actual.Iops, prediction.IopsBand.Lower, prediction.IopsBand.Upper);
+            Assert.InRange(actual.P99LatencyUs, prediction.P99LatencyBand.Lower, prediction.P99LatencyBand.Upper);
+            Assert.InRange(prediction.Iops / actual.Iops, 0.85, 1.15);
+        }
+
+        var backup = result.Profiles[1].Workloads[0];
+        Assert.Equal(backup.Iops * UsageProfiles.Get(UsageProfileType.Backup).Workloads[0].BlockSize, backup.BytesPerSecond, 3);
+        Assert.Equal(predictor.BasisNames.Count, result.Basis.Count);
+    }
+
+    [Fact]
+    public void Fit_And_Predict_RejectMissingData()
+    {
+        var random = new Random(4);
+        var drives = Enumerable.Range(0, ProfilePredictor.MinimumSamples + 3).Select(_ => CreateDrive(random, noise: 0.03)).ToList();
+
+        // Too few drives, or drives without the basis, train nothing
+        Assert.Throws<ArgumentException>(() => ProfilePredictor.Fit(drives[..(ProfilePredictor.MinimumSamples - 1)]));
+        var withoutBasis = drives.Select(d => (IReadOnlyDictionary<string, WorkloadScore>)d
+            .Where(kv => !kv.Key.StartsWith(ProfilePredictor.BasisPrefix, StringComparison.Ordinal))
+            .ToDictionary(kv => kv.Key, kv => kv.Value)).ToList();
+        Assert.Throws<ArgumentException>(() => ProfilePredictor.Fit(withoutBasis));
+
+        var predictor = ProfilePredictor.Fit(drives);
+        var partial = drives[0].Where(kv => kv.Key != predictor.BasisNames[0]).ToDictionary(kv => kv.Key, kv => kv.Value);
+        Assert.Throws<ArgumentException>(() => predictor.Predict(partial));
+    }
+
+    [Fact]
+    public async Task BasisPlan_ScoresMatchBasisNames()
+    {
+        var path = Path.Combine(Path.GetTempPath(), $"diskbench-predict-{Guid.NewGuid():N}.dat");
+        var plan = ProfilePredictor.CreateBasisPlan(path, 8 << 20, 1, TimeSpan.Zero, TimeSpan.FromMilliseconds(50)) with { DeleteOnComplete = false };
+        await using var engine = new FakeBenchmarkEngine();
+
+        var scores = ProfilePredictor.GetScores(await new BenchmarkRunner(engine).RunAsync(plan));
+
+        Assert.Equal(ProfilePredictor.DefaultBasis.Count, plan.Workloads.Count);
+        Assert.All(ProfilePredictor.DefaultBasis, w => Assert.True(scores[ProfilePredictor.GetBasisName(w)].Iops > 0));
+
+        var calibration = ProfilePredictor.CreateCalibrationPlan(path, 8 << 20);
+        Assert.Equal(plan.Workloads.Count + UsageProfiles.All.Sum(p => p.Workloads.Count), calibration.Workloads.Count);
+        Assert.Contains(calibration.Workloads, w => w.Name == OltpReads);
+    }
+
+    private static readonly string OltpReads = "Database Server: " + UsageProfiles.Get(UsageProfileType.Database).Workloads[0].Name;
+
+    private static readonly string BackupWrite = "Backup: " + UsageProfiles.Get(UsageProfileType.Backup).Workloads[0].Name;
+
+    /// <summary>
+    /// A drive whose OLTP reads scale with its QD1 and QD32 random reads and whose backup writes follow
+    /// its sequential writes, with multiplicative noise.
+    /// </summary>
+    private static Dictionary<string, WorkloadScore> CreateDrive(Random random, double noise)
+    {
+        double Spread(double scale) => Math.Exp((random.NextDouble() - 0.5) * scale);
+
+        double qd1 = 10_000 * Spread(2);
+        double qd32 = qd1 * 20 * Spread(2);
+        double seqWrite = 500 * Spread(2);
+        var basis = ProfilePredictor.DefaultBasis.Select(ProfilePredictor.GetBasisName).ToList();
+
+        return new Dictionary<string, WorkloadScore>(StringComparer.Ordinal)
+        {
+            [basis[0]] = new(qd1, 1e6 / qd1 * 2),
+            [basis[1]] = new(qd32, 32e6 / qd32 * 3),
+            [basis[2]] = new(qd32 * 0.5 * Spread(1), 300 * Spread(1)),
+            [basis[3]] = new(20_000 * Spread(2), 900 * Spread(1)),
+            [basis[4]] = new(seqWrite, 4e6 / seqWrite * 2),
+            [OltpReads] = new(Math.Pow(qd1, 0.3) * Math.Pow(qd32, 0.7) * Spread(noise), 8e6 / qd32 * Spread(noise)),
+            [BackupWrite] = new(seqWrite * 0.9 * Spread(noise), 1.5e6 / seqWrite * Spread(noise))
+        };
+    }
+}
@@ -0,0 +1,88 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for RaplEnergyMeter against a fake powercap directory.
+/// </summary>
+public sealed class RaplEnergyMeterTests : IDisposable
+{
+    private readonly string _root = Path.Combine(Path.GetTempPath(), "diskbench-powercap-" + Guid.NewGuid().ToString("N"));
+
+    public RaplEnergyMeterTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void Constructor_PackageAndDram_IsAvailable()
+    {
+        WriteZone("intel-rapl:0", "package-0", 1_000_000, 10_000_000);
+        WriteZone("intel-rapl:0:0", "core", 500_000, 10_000_000);
+        WriteZone("intel-rapl:0:1", "dram", 200_000, 10_000_000);
+
+        var meter = new RaplEnergyMeter(_root);
+
+        Assert.True(meter.IsAvailable);
+        Assert.Equal("RAPL: package-0, dram", meter.Description);
+    }
+
+    [Fact]
+    public void Read_ReportsEnergySinceConstruction_IgnoringCoreZone()
+    {
+        WriteZone("intel-rapl:0", "package-0", 1_000_000, 10_000_000);
+        WriteZone("intel-rapl:0:0", "core", 500_000, 10_000_000);
+        WriteZone("intel-rapl:0:1", "dram", 200_000, 10_000_000);
+        var meter = new RaplEnergyMeter(_root);
+
+        WriteCounter("intel-rapl:0", 4_000_000);
+        WriteCounter("intel-rapl:0:0", 9_000_000);
+        WriteCounter("intel-rapl:0:1", 700_000);
+        var sample = meter.Read();
+
+        Assert.Equal(3.0, sample.PackageJoules, 6);
+        Assert.Equal(0.5, sample.DramJoules ?? 0, 6);
+    }
+
+    [Fact]
+    public void Read_CounterWraps_AddsRemainingRange()
+    {
+        WriteZone("intel-rapl:0", "package-0", 9_000_000, 10_000_000);
+        var meter = new RaplEnergyMeter(_root);
+
+        WriteCounter("intel-rapl:0", 1_000_000);
+        var sample = meter.Read();
+
+        Assert.Equal(2.0, sample.PackageJoules, 6);
+        Assert.Null(sample.DramJoules);
+    }
+
+    [Fact]
+    public void Constructor_NoZones_IsUnavailable()
+    {
+        var meter = new RaplEnergyMeter(_root);
+
+        Assert.False(meter.IsAvailable);
+        Assert.Throws<InvalidOperationException>(() => meter.Read());
+    }
+
+    private void WriteZone(string zone, string name, long energy, long maxRange)
+    {
+        var dir = Path.Combine(_root, zone);
+        Directory.CreateDirectory(dir);
+        File.WriteAllText(Path.Combine(dir, "name"), name + "\n");
+        File.WriteAllText(Path.Combine(dir, "max_energy_range_uj"), maxRange + "\n");
+        WriteCounter(zone, energy);
+    }
+
+    private void WriteCounter(string zone, long energy)
+    {
+        File.WriteAllText(Path.Combine(_root, zone, "energy_uj"), energy + "\n");
+    }
+}
@@ -0,0 +1,174 @@
+using DiskBench.Core;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// IO observer that records the issued IO stream and checks every IO is retired exactly once.
+/// Optionally remembers a hash of the last data written at each offset and checks reads against it.
+/// </summary>
+public sealed class RecordingIoObserver : IIoObserver
+{
+    private const ulong FnvOffsetBasis = 14695981039346656037;
+    private const ulong FnvPrime = 1099511628211;
+
+    private readonly List<(long Offset, int Size, bool IsWrite)> _issued = [];
+    private readonly int _capacity;
+    private readonly Dictionary<long, ulong>? _expectedData;
+    private bool _sealed;
+
+    /// <summary>
+    /// Creates an observer.
+    /// </summary>
+    /// <param name="capacity">Number of issued IOs kept for hashing and inspection.</param>
+    /// <param name="expectedData">Data hashes per offset: writes update it, reads are checked against it (null = no data checks).</param>
+    public RecordingIoObserver(int capacity = 4096, Dictionary<long, ulong>? expectedData = null)
+    {
+        _capacity = capacity;
+        _expectedData = expectedData;
+    }
+
+    /// <summary>
+    /// Gets the first IOs issued, in issue order.
+    /// </summary>
+    public IReadOnlyList<(long Offset, int Size, bool IsWrite)> Issued => _issued;
+
+    /// <summary>
+    /// Gets the number of IOs issued.
+    /// </summary>
+    public long IssuedCount { get; private set; }
+
+    /// <summary>
+    /// Gets the number of IOs completed successfully.
+    /// </summary>
+    public long CompletedCount { get; private set; }
+
+    /// <summary>
+    /// Gets the number of IOs abandoned (failed, cancelled or discarded while draining).
+    /// </summary>
+    public long AbandonedCount { get; private set; }
+
+    /// <summary>
+    /// Gets the number of IOs issued but not yet retired.
+    /// </summary>
+    public long Outstanding => IssuedCount - CompletedCount - AbandonedCount;
+
+    /// <summary>
+    /// Gets the number of callbacks received after <see cref="Seal"/>.
+    /// </summary>
+    public int LateCallbacks { get; private set; }
+
+    /// <summary>
+    /// Gets the number of reads whose data matched the last write at the same offset.
+    /// </summary>
+    public int VerifiedReads { get; private set; }
+
+    /// <summary>
+    /// Gets the number of reads whose data did not match the last write at the same offset.
+    /// </summary>
+    public int MismatchedReads { get; private set; }
+
+    /// <inheritdoc />
+    public void OnIssued(long offset, int size, bool isWrite)
+    {
+        CheckSealed();
+        IssuedCount++;
+        if (_issued.Count < _capacity)
+        {
+            _issued.Add((offset, size, isWrite));
+        }
+    }
+
+    /// <inheritdoc />
+    public void OnCompleted(long offset, bool isWrite, ReadOnlySpan<byte> data)
+    {
+        CheckSealed();
+        CompletedCount++;
+
+        if (_expectedData == null || data.IsEmpty)
+        {
+            return;
+        }
+
+        var hash = HashData(data);
+        if (isWrite)
+        {
+            _expectedData[offset] = hash;
+        }
+        else if (_expectedData.TryGetValue(offset, out var expected))
+        {
+            if (expected == hash)
+            {
+                VerifiedReads++;
+            }
+            else
+            {
+                MismatchedReads++;
+            }
+        }
+    }
+
+    /// <inheritdoc />
+    public void OnAbandoned(long offset, bool isWrite)
+    {
+        CheckSealed();
+        AbandonedCount++;
+    }
+
+    /// <summary>
+    /// Marks the trial as finished; any later callback is counted in <see cref="LateCallbacks"/>.
+    /// </summary>
+    public void Seal() => _sealed = true;
+
+    /// <summary>
+    /// Hashes the first <paramref name="count"/> issued IOs (offset, size, direction).
+    /// </summary>
+    public ulong HashStream(int count) => HashStream(_issued.Take(count));
+
+    /// <summary>
+    /// Hashes an IO stream with FNV-1a so streams from different runs and engines can be compared.
+    /// </summary>
+    public static ulong HashStream(IEnumerable<(long Offset, int Size, bool IsWrite)> ios)
+    {
+        ArgumentNullException.ThrowIfNull(ios);
+
+        ulong hash = FnvOffsetBasis;
+        foreach (var (offset, size, isWrite) in ios)
+        {
+            hash = Mix(hash, (ulong)offset);
+            hash = Mix(hash, (ulong)size);
+            hash = Mix(hash, isWrite ? 1UL : 0UL);
+        }
+
+        return hash;
+    }
+
+    private static ulong HashData(ReadOnlySpan<byte> data)
+    {
+        ulong hash = FnvOffsetBasis;
+        foreach (var b in data)
+        {
+            hash = (hash ^ b) * FnvPrime;
+        }
+
+        return hash;
+    }
+
+    private static ulong Mix(ulong hash, ulong value)
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            hash = (hash ^ (value & 0xFF)) * FnvPrime;
+            value >>= 8;
+        }
+
+        return hash;
+    }
+
+    private void CheckSealed()
+    {
+        if (_sealed)
+        {
+            LateCallbacks++;
+        }
+    }
+}
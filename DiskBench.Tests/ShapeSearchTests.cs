@@ -0,0 +1,141 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for the successive-halving IO shape search.
+/// </summary>
+public sealed class ShapeSearchTests : IDisposable
+{
+    private readonly string _root = Path.Combine(Path.GetTempPath(), "diskbench-shape-" + Guid.NewGuid().ToString("N"));
+
+    public ShapeSearchTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void GetFrontier_KeepsOnlyUndominatedShapes()
+    {
+        var fast = CreatePoint(65536, 16, bytesPerSecond: 1000, p99: 500, cpu: 5);
+        var quick = CreatePoint(4096, 1, bytesPerSecond: 100, p99: 50, cpu: 5);
+        var frugal = CreatePoint(4096, 4, bytesPerSecond: 300, p99: 200, cpu: 2);
+        var dominated = CreatePoint(16384, 8, bytesPerSecond: 250, p99: 300, cpu: 6);
+
+        var frontier = ShapeSearchRunner.GetFrontier([quick, dominated, fast, frugal]);
+
+        ShapePoint[] expected = [fast, frugal, quick];
+        Assert.Equal(expected, frontier.ToArray());
+        Assert.Equal(65536L * 16, fast.OutstandingBytes);
+    }
+
+    [Fact]
+    public async Task RunAsync_HalvesShapesEachRound()
+    {
+        await using var engine = new FakeBenchmarkEngine(new FakeEngineOptions { LatencyVariancePercent = 0 });
+        var spec = CreateSpec();
+
+        var result = await new ShapeSearchRunner(engine).RunAsync(spec);
+
+        // 12 shapes -> 4 -> 2, each round three times longer
+        int[] evaluated = [12, 4, 2];
+        Assert.Equal(evaluated, result.Rounds.Select(r => r.Evaluated).ToArray());
+        Assert.Equal(TimeSpan.FromMilliseconds(180), result.Rounds[^1].MeasuredDuration);
+        Assert.Equal(TimeSpan.FromMilliseconds((12 * 20) + (4 * 60) + (2 * 180)), result.MeasuredTime);
+        Assert.Equal(TimeSpan.FromMilliseconds(12 * 180), result.ExhaustiveTime);
+
+        Assert.Equal(12, result.Points.Count);
+        Assert.Equal(evaluated.Sum(), result.Points.Sum(p => p.Rounds));
+        Assert.Equal(2, result.Points.Count(p => p.Rounds == 3));
+        Assert.All(result.Points, p => Assert.True(p.BytesPerSecond > 0 && p.CpuUsPerIo >= 0, p.Name));
+
+        // Throughput grows with block size and queue depth, so the biggest shapes are fastest
+        var peak = result.Finalists.MaxBy(p => p.BytesPerSecond)!;
+        Assert.Equal(65536, peak.Workload.BlockSize);
+        Assert.Equal(16, peak.Workload.QueueDepth);
+
+        // Peak, frontier and cheapest shape compare only shapes measured at the final duration
+        Assert.Equal(2, result.Finalists.Count);
+        Assert.All(result.Finalists, p => Assert.Equal(3, p.Rounds));
+        Assert.Contains(result.Cheapest, result.Finalists);
+        Assert.All(result.Frontier, p => Assert.Contains(p, result.Finalists));
+        Assert.True(result.Cheapest.BytesPerSecond >= spec.TargetFraction * result.PeakBytesPerSecond);
+        Assert.Contains(peak, result.Frontier);
+        Assert.Equal(peak.BytesPerSecond, result.PeakBytesPerSecond);
+        Assert.False(File.Exists(spec.Workload.FilePath));
+    }
+
+    [Fact]
+    public async Task RunAsync_CheapestShapeNearPeakSurvivesToTheEnd()
+    {
+        // Throughput saturates at 256 KB in flight at 97 MB/s; 1 MB or more reaches 100 MB/s and creeps up with
+        // every doubling after that. Each bigger shape is faster, so none dominates another and the first front
+        // holds more of them than survive, but the cheapest shape within 95% of peak is 4K x QD64 x 1 thread.
+        static double Device(WorkloadSpec w)
+        {
+            long outstanding = (long)w.BlockSize * w.QueueDepth * w.Threads;
+            return outstanding >= 1024 * 1024
+                ? 100e6 * (1 + (0.002 * Math.Log2(outstanding / (1024.0 * 1024))))
+                : 97e6 * Math.Min(1.0, outstanding / (256.0 * 1024));
+        }
+
+        await using var engine = new FakeBenchmarkEngine(new FakeEngineOptions { LatencyVariancePercent = 0, BytesPerSecond = Device });
+        var spec = CreateSpec() with { BlockSizes = [4096, 16384], QueueDepths = [1, 64, 256] };
+
+        var result = await new ShapeSearchRunner(engine).RunAsync(spec);
+
+        Assert.InRange(result.PeakBytesPerSecond, 100.5e6, 100.7e6);
+        Assert.Equal(4096, result.Cheapest.Workload.BlockSize);
+        Assert.Equal(64, result.Cheapest.Workload.QueueDepth);
+        Assert.Equal(1, result.Cheapest.Workload.Threads);
+        Assert.InRange(result.Cheapest.BytesPerSecond, 96.9e6, 97.1e6);
+    }
+
+    [Fact]
+    public async Task RunAsync_InvalidSpec_Throws()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new ShapeSearchRunner(engine);
+        var spec = CreateSpec();
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(spec with { BlockSizes = [] }));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(spec with { QueueDepths = [4, 4] }));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(spec with { ThreadCounts = [0] }));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(spec with { Reduction = 1 }));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(spec with { TargetFraction = 1.5 }));
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.RunAsync(spec with { InitialDuration = TimeSpan.Zero }));
+    }
+
+    private ShapeSearchSpec CreateSpec() => new()
+    {
+        Workload = new WorkloadSpec
+        {
+            FilePath = Path.Combine(_root, "shape.dat"),
+            FileSize = 4 << 20,
+            BlockSize = 4096
+        },
+        BlockSizes = [4096, 65536],
+        QueueDepths = [1, 4, 16],
+        ThreadCounts = [1, 2],
+        InitialDuration = TimeSpan.FromMilliseconds(20),
+        WarmupDuration = TimeSpan.Zero
+    };
+
+    private static ShapePoint CreatePoint(int blockSize, int queueDepth, double bytesPerSecond, double p99, double cpu) => new()
+    {
+        Workload = new WorkloadSpec { FilePath = "shape.dat", FileSize = 1 << 20, BlockSize = blockSize, QueueDepth = queueDepth },
+        Name = $"{blockSize}/{queueDepth}",
+        BytesPerSecond = bytesPerSecond,
+        Iops = bytesPerSecond / blockSize,
+        P99LatencyUs = p99,
+        CpuUsPerIo = cpu,
+        Rounds = 1,
+        MeasuredDuration = TimeSpan.FromSeconds(1)
+    };
+}
@@ -0,0 +1,196 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for service level objective parsing and evaluation.
+/// </summary>
+public class SloEvaluatorTests
+{
+    [Fact]
+    public void Parse_LatencyObjective_ReadsPercentileUnitAndCompliance()
+    {
+        var slo = ServiceLevelObjective.Parse("p99.9 < 2ms @ 99.5%");
+
+        Assert.Equal(SloMetric.Latency, slo.Metric);
+        Assert.Equal(99.9, slo.Percentile);
+        Assert.Equal(2000, slo.Threshold);
+        Assert.Equal(0.995, slo.IntervalCompliance!.Value, 6);
+        Assert.True(slo.IsMet(2000));
+        Assert.False(slo.IsMet(2001));
+    }
+
+    [Fact]
+    public void Parse_ThroughputObjectives_ReadSuffixes()
+    {
+        var iops = ServiceLevelObjective.Parse("iops>100k");
+        Assert.Equal(SloMetric.Iops, iops.Metric);
+        Assert.Equal(100_000, iops.Threshold);
+        Assert.Null(iops.IntervalCompliance);
+
+        var mbps = ServiceLevelObjective.Parse("mbps>=500@99%");
+        Assert.Equal(SloMetric.Throughput, mbps.Metric);
+        Assert.Equal(500.0 * 1024 * 1024, mbps.Threshold);
+    }
+
+    [Theory]
+    [InlineData("p42<1ms")]
+    [InlineData("p99>1ms")]
+    [InlineData("iops<100")]
+    [InlineData("bandwidth>1")]
+    [InlineData("p99<fast")]
+    [InlineData("p99<1ms@0%")]
+    public void Parse_Invalid_Throws(string text)
+    {
+        Assert.Throws<FormatException>(() => ServiceLevelObjective.Parse(text));
+    }
+
+    [Fact]
+    public void Evaluate_LatencyIntervals_MergesWindowsAndConsumesBudget()
+    {
+        var slo = ServiceLevelObjective.Parse("p99<500us@80%");
+        var trial = CreateTrial(1, 400, 10, second => second is 3 or 4 or 7 ? 900 : 300);
+
+        var result = SloEvaluator.Evaluate(slo, [trial]);
+
+        // The whole trial meets the objective but three of ten seconds do not, exceeding the 20% budget
+        Assert.False(result.Passed);
+        Assert.Equal(0, result.TrialsFailed);
+        Assert.Equal(400, result.WorstTrialValue);
+        Assert.Equal(10, result.IntervalsEvaluated);
+        Assert.Equal(3, result.IntervalsViolated);
+        Assert.Equal(1.5, result.ErrorBudgetConsumed!.Value, 6);
+        Assert.Equal(2, result.Violations.Count);
+        Assert.Equal(3, result.Violations[0].StartSecond);
+        Assert.Equal(2, result.Violations[0].Seconds);
+        Assert.Equal(900, result.Violations[0].WorstValue);
+        Assert.Equal(7, result.Violations[1].StartSecond);
+    }
+
+    [Fact]
+    public void Evaluate_WithinBudget_Passes()
+    {
+        var slo = ServiceLevelObjective.Parse("p99<500us@80%");
+        var trial = CreateTrial(1, 400, 10, second => second == 5 ? 900 : 300);
+
+        var result = SloEvaluator.Evaluate(slo, [trial]);
+
+        Assert.True(result.Passed);
+        Assert.Equal(0.5, result.ErrorBudgetConsumed!.Value, 6);
+        Assert.Single(result.Violations);
+    }
+
+    [Fact]
+    public void Evaluate_WithoutCompliance_GatesOnWholeTrials()
+    {
+        var slo = ServiceLevelObjective.Parse("p99<500us");
+        var good = CreateTrial(1, 400, 5, second => second == 2 ? 900 : 300);
+        var bad = CreateTrial(2, 600, 5, _ => 300);
+
+        var result = SloEvaluator.Evaluate(slo, [good, bad]);
+
+        Assert.False(result.Passed);
+        Assert.Equal(1, result.TrialsFailed);
+        Assert.Equal(600, result.WorstTrialValue);
+        Assert.Null(result.ErrorBudgetConsumed);
+        Assert.Single(result.Violations);
+        Assert.True(SloEvaluator.Evaluate(slo, [good]).Passed);
+    }
+
+    [Fact]
+    public void Evaluate_Iops_SkipsPartialFinalSecond()
+    {
+        var slo = ServiceLevelObjective.Parse("iops>1000@100%");
+        var trial = CreateTrial(1, 300, 3, _ => 300, partialSecondOps: 10);
+
+        var result = SloEvaluator.Evaluate(slo, [trial]);
+
+        Assert.True(result.Passed);
+        Assert.Equal(3, result.IntervalsEvaluated);
+        Assert.Equal(0, result.IntervalsViolated);
+    }
+
+    [Fact]
+    public async Task RunAsync_WithObjectives_CollectsIntervalsAndEvaluates()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                new WorkloadSpec
+                {
+                    FilePath = "test.dat",
+                    FileSize = 1024 * 1024,
+                    BlockSize = 4096,
+                    Pattern = AccessPattern.Random,
+                    QueueDepth = 1,
+                    Objectives = [ServiceLevelObjective.Parse("max<1000ms@100%"), ServiceLevelObjective.Parse("iops>1m")]
+                }
+            ],
+            Trials = 1,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(1200),
+            CollectTimeSeries = false
+        };
+
+        var result = await runner.RunAsync(plan);
+
+        var workload = result.Workloads[0];
+        Assert.NotNull(workload.Trials[0].TimeSeries);
+        Assert.Contains(workload.Trials[0].TimeSeries!, s => s.Latency != null);
+        Assert.Equal(2, workload.Objectives!.Count);
+        Assert.True(workload.Objectives[0].Passed);
+        Assert.True(workload.Objectives[0].IntervalsEvaluated > 0);
+        Assert.False(workload.Objectives[1].Passed);
+        Assert.Equal(false, workload.ObjectivesPassed);
+        Assert.Equal(false, result.ObjectivesPassed);
+    }
+
+    private static TrialResult CreateTrial(int number, double p99Us, int seconds, Func<int, double> intervalP99Us, long partialSecondOps = 0)
+    {
+        const long opsPerSecond = 2000;
+        var samples = Enumerable.Range(0, seconds)
+            .Select(s => new TimeSeriesSample
+            {
+                SecondOffset = s,
+                Bytes = opsPerSecond * 4096,
+                Operations = opsPerSecond,
+                Latency = CreateLatency(intervalP99Us(s))
+            })
+            .ToList();
+
+        if (partialSecondOps > 0)
+        {
+            samples.Add(new TimeSeriesSample { SecondOffset = seconds, Bytes = partialSecondOps * 4096, Operations = partialSecondOps });
+        }
+
+        long totalOps = opsPerSecond * seconds + partialSecondOps;
+        return new TrialResult
+        {
+            TrialNumber = number,
+            TotalBytes = totalOps * 4096,
+            TotalOperations = totalOps,
+            ReadOperations = totalOps,
+            WriteOperations = 0,
+            Duration = TimeSpan.FromSeconds(seconds + (partialSecondOps > 0 ? 0.1 : 0)),
+            Latency = CreateLatency(p99Us),
+            TimeSeries = samples
+        };
+    }
+
+    private static LatencyPercentiles CreateLatency(double p99Us) => new()
+    {
+        MinUs = 10,
+        P50Us = 100,
+        P90Us = p99Us / 2,
+        P95Us = p99Us / 1.5,
+        P99Us = p99Us,
+        P999Us = p99Us * 2,
+        MaxUs = p99Us * 4,
+        MeanUs = 120
+    };
+}
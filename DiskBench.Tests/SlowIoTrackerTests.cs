@@ -0,0 +1,84 @@
+using DiskBench.Metrics;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for the SlowIoTracker class.
+/// </summary>
+public class SlowIoTrackerTests
+{
+    [Fact]
+    public void RecordCompletion_KeepsSlowestK_SortedDescending()
+    {
+        var tracker = new SlowIoTracker(topK: 3, thresholdTicks: 0, stuckTimeoutTicks: 0);
+
+        long[] latencies = [50, 10, 90, 30, 70, 20, 80, 60, 40];
+        for (int i = 0; i < latencies.Length; i++)
+        {
+            tracker.RecordCompletion(i * 4096L, 4096, false, i, 1000, 1000 + latencies[i]);
+        }
+
+        var top = tracker.GetTopSlowest();
+
+        Assert.Equal(3, top.Length);
+        Assert.Equal(90, top[0].LatencyTicks);
+        Assert.Equal(80, top[1].LatencyTicks);
+        Assert.Equal(70, top[2].LatencyTicks);
+        Assert.Equal(2 * 4096L, top[0].Offset);
+        Assert.Equal(2, top[0].Slot);
+    }
+
+    [Fact]
+    public void RecordCompletion_OverThreshold_LogsAndCountsBeyondCapacity()
+    {
+        var tracker = new SlowIoTracker(topK: 0, thresholdTicks: 100, stuckTimeoutTicks: 0, logCapacity: 2);
+
+        tracker.RecordCompletion(0, 4096, false, 0, 0, 50);
+        tracker.RecordCompletion(4096, 4096, true, 1, 0, 100);
+        tracker.RecordCompletion(8192, 4096, false, 2, 0, 500);
+        tracker.RecordCompletion(12288, 4096, false, 3, 0, 900);
+
+        var logged = tracker.GetOverThreshold();
+
+        Assert.Equal(3, tracker.OverThresholdCount);
+        Assert.Equal(2, logged.Length);
+        Assert.Equal(4096, logged[0].Offset);
+        Assert.True(logged[0].IsWrite);
+        Assert.Equal(8192, logged[1].Offset);
+        Assert.Empty(tracker.GetTopSlowest());
+    }
+
+    [Fact]
+    public void IsStuck_UsesTimeout_AndRecordStuckSurvivesReset()
+    {
+        var tracker = new SlowIoTracker(topK: 2, thresholdTicks: 0, stuckTimeoutTicks: 1000);
+
+        Assert.False(tracker.IsStuck(submitTimestamp: 0, now: 999));
+        Assert.True(tracker.IsStuck(submitTimestamp: 0, now: 1000));
+
+        tracker.RecordStuck(1 << 20, 4096, false, 5, 0, 1500);
+        tracker.RecordCompletion(0, 4096, false, 0, 0, 10);
+        tracker.ResetCompletions();
+
+        var stuck = tracker.GetStuck();
+        Assert.Single(stuck);
+        Assert.Equal(1 << 20, stuck[0].Offset);
+        Assert.Equal(1500, stuck[0].LatencyTicks);
+        Assert.Equal(1, tracker.StuckCount);
+        Assert.Empty(tracker.GetTopSlowest());
+    }
+
+    [Fact]
+    public void Disabled_TracksNothing()
+    {
+        var tracker = new SlowIoTracker(topK: 0, thresholdTicks: 0, stuckTimeoutTicks: 0);
+
+        tracker.RecordCompletion(0, 4096, false, 0, 0, long.MaxValue / 2);
+
+        Assert.False(tracker.TracksStuck);
+        Assert.False(tracker.IsStuck(0, long.MaxValue / 2));
+        Assert.Equal(0, tracker.OverThresholdCount);
+        Assert.Empty(tracker.GetTopSlowest());
+    }
+}
@@ -125,4 +125,27 @@ public class StatisticalAggregationTests
         
         Assert.Null(stats.ConfidenceInterval95);
     }
+
+    [Fact]
+    public void StudentTConfidenceInterval_KnownValues_ReturnsExpectedBand()
+    {
+        // mean = 100, sample std dev = 7.906, t(4) = 2.776 -> half-width ~9.815
+        double[] values = [100.0, 110.0, 90.0, 105.0, 95.0];
+
+        var (lower, upper) = StatisticalAggregation.StudentTConfidenceInterval(values);
+
+        Assert.InRange(lower, 90.1, 90.3);
+        Assert.InRange(upper, 109.7, 109.9);
+    }
+
+    [Fact]
+    public void StudentTConfidenceInterval_SingleValue_ReturnsThatValue()
+    {
+        double[] values = [42.0];
+
+        var (lower, upper) = StatisticalAggregation.StudentTConfidenceInterval(values);
+
+        Assert.Equal(42.0, lower);
+        Assert.Equal(42.0, upper);
+    }
 }
@@ -0,0 +1,175 @@
+using System.Diagnostics;
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for full-surface scans: IO-limited trials, per-region passes and anomaly detection.
+/// </summary>
+public class SurfaceScanTests
+{
+    private const int BlockSize = 64 * 1024;
+    private const long RegionSize = 1024 * 1024;
+
+    [Fact]
+    public async Task IoLimit_IssuesExactlyOnePassAndEndsEarly()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var observer = new RecordingIoObserver();
+        var spec = new TrialSpec
+        {
+            Workload = new WorkloadSpec
+            {
+                FilePath = "scan.dat",
+                FileSize = 4 * RegionSize,
+                BlockSize = BlockSize,
+                Pattern = AccessPattern.Sequential,
+                QueueDepth = 4,
+                Region = new FileRegion(RegionSize, RegionSize)
+            },
+            MeasuredDuration = TimeSpan.FromSeconds(30),
+            IoLimit = RegionSize / BlockSize,
+            IoObserver = observer
+        };
+
+        var start = Stopwatch.GetTimestamp();
+        var result = await engine.RunTrialAsync(spec);
+
+        Assert.True(Stopwatch.GetElapsedTime(start) < TimeSpan.FromSeconds(10));
+        Assert.Equal(RegionSize / BlockSize, observer.IssuedCount);
+        Assert.Equal(RegionSize, result.TotalBytes);
+        Assert.Equal(RegionSize, observer.Issued[0].Offset);
+        Assert.Equal(2 * RegionSize - BlockSize, observer.Issued[^1].Offset);
+    }
+
+    [Fact]
+    public async Task ScanAsync_ReadsAndWritesEveryRegionOnce()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+        var passes = new List<SurfacePass>();
+
+        var result = await runner.ScanAsync(
+            new SurfaceScanSpec
+            {
+                FilePath = "scan.dat",
+                FileSize = 8 * RegionSize + 1000,
+                RegionSize = RegionSize,
+                BlockSize = BlockSize,
+                QueueDepth = 4,
+                Write = true
+            },
+            new SynchronousProgress<SurfacePass>(passes.Add));
+
+        Assert.Equal(8, result.Regions.Count);
+        Assert.Equal(16, passes.Count);
+        Assert.True(passes[0].IsWrite);
+        Assert.False(passes[1].IsWrite);
+
+        for (int i = 0; i < result.Regions.Count; i++)
+        {
+            var region = result.Regions[i];
+            Assert.Equal(i * RegionSize, region.Offset);
+            Assert.Equal(RegionSize, region.Read.BytesTransferred);
+            Assert.Equal(RegionSize, region.Write!.BytesTransferred);
+            Assert.True(region.Read.Complete);
+        }
+
+        Assert.True(result.MedianReadBytesPerSecond > 0);
+        Assert.NotNull(result.MedianWriteBytesPerSecond);
+    }
+
+    [Fact]
+    public async Task ScanAsync_RegionNotMultipleOfBlock_Throws()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var runner = new BenchmarkRunner(engine);
+
+        await Assert.ThrowsAsync<ArgumentException>(() => runner.ScanAsync(new SurfaceScanSpec
+        {
+            FilePath = "scan.dat",
+            FileSize = 8 * RegionSize,
+            RegionSize = RegionSize + 4096,
+            BlockSize = BlockSize
+        }));
+    }
+
+    [Fact]
+    public void FindAnomalies_FlagsSlowLatencyRetryAndErrorRegions()
+    {
+        var spec = new SurfaceScanSpec { FilePath = "scan.dat" };
+        var passes = Enumerable.Range(0, 10).Select(i => i switch
+        {
+            3 => CreatePass(i, 40, p99Us: 900),
+            6 => CreatePass(i, 100, p99Us: 5000),
+            7 => CreatePass(i, 100, retries: 2),
+            8 => CreatePass(i, 100, retries: 3, failed: 1),
+            _ => CreatePass(i, 100)
+        }).ToList();
+
+        var anomalies = SurfaceScanAnalysis.FindAnomalies(passes, spec);
+
+        Assert.Equal(SurfaceAnomaly.SlowZone, anomalies[3]);
+        Assert.Equal(SurfaceAnomaly.HighLatency, anomalies[6]);
+        Assert.Equal(SurfaceAnomaly.Retries, anomalies[7]);
+        Assert.Equal(SurfaceAnomaly.Retries | SurfaceAnomaly.Errors, anomalies[8]);
+        Assert.Equal(6, anomalies.Count(a => a == SurfaceAnomaly.None));
+    }
+
+    [Fact]
+    public void GradualSlowdown_IsZoneDropOffNotSlowZones()
+    {
+        var spec = new SurfaceScanSpec { FilePath = "scan.dat" };
+
+        // Outer tracks at 200 MB/s falling linearly to 100 MB/s on the inner tracks
+        var passes = Enumerable.Range(0, 20).Select(i => CreatePass(i, 200 - i * 100.0 / 19)).ToList();
+
+        Assert.All(SurfaceScanAnalysis.FindAnomalies(passes, spec), a => Assert.Equal(SurfaceAnomaly.None, a));
+        Assert.Equal(0.5, SurfaceScanAnalysis.ZoneDropOff(passes), 3);
+    }
+
+    private static SurfacePass CreatePass(int index, double megabytesPerSecond, double p99Us = 1000, long retries = 0, long failed = 0)
+    {
+        return new SurfacePass
+        {
+            Offset = index * RegionSize,
+            Length = RegionSize,
+            IsWrite = false,
+            BytesTransferred = (long)(megabytesPerSecond * 1024 * 1024),
+            Duration = TimeSpan.FromSeconds(1),
+            Latency = new LatencyPercentiles
+            {
+                MinUs = 100,
+                P50Us = 500,
+                P90Us = 700,
+                P95Us = 800,
+                P99Us = p99Us,
+                P999Us = p99Us * 2,
+                MaxUs = p99Us * 4,
+                MeanUs = 550
+            },
+            Errors = retries > 0 || failed > 0
+                ? new IoErrorSummary
+                {
+                    Errors = retries + failed,
+                    Retries = retries,
+                    Recovered = retries > 0 && failed == 0 ? 1 : 0,
+                    Failed = failed,
+                    ShortTransfers = 0,
+                    InjectedFaults = 0,
+                    FirstErrorCode = 23
+                }
+                : null,
+            Complete = true
+        };
+    }
+
+    /// <summary>
+    /// Progress reporter that calls back on the reporting thread, so results are visible immediately.
+    /// </summary>
+    private sealed class SynchronousProgress<T>(Action<T> handler) : IProgress<T>
+    {
+        public void Report(T value) => handler(value);
+    }
+}
@@ -0,0 +1,193 @@
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for sysfs topology parsing and worker placement against a fake two-socket machine:
+/// 2 packages x 2 cores x 2 threads, one NUMA node and L3 per package, CPUs 0-3 on node 0, 4-7 on node 1,
+/// and SMT siblings numbered n and n + 2 within each package.
+/// </summary>
+public sealed class WorkerPlacementTests : IDisposable
+{
+    private readonly string _root = Path.Combine(Path.GetTempPath(), "diskbench-sysfs-" + Guid.NewGuid().ToString("N"));
+
+    public WorkerPlacementTests()
+    {
+        Directory.CreateDirectory(_root);
+    }
+
+    public void Dispose()
+    {
+        Directory.Delete(_root, true);
+    }
+
+    [Fact]
+    public void ParseCpuList_ExpandsRanges()
+    {
+        AssertCpus("0,1,2,3,8,10,11", SysfsTopology.ParseCpuList("0-3,8,10-11\n"));
+        Assert.Empty(SysfsTopology.ParseCpuList(string.Empty));
+    }
+
+    [Fact]
+    public void ReadCpus_ReadsPackagesNodesSiblingsAndL3()
+    {
+        WriteMachine();
+
+        var topology = SysfsTopology.ReadCpus(Sys);
+
+        Assert.NotNull(topology);
+        Assert.Equal(8, topology!.Processors.Count);
+        Assert.Equal(2, topology.PackageCount);
+        Assert.Equal(2, topology.NumaNodeCount);
+        Assert.Equal(4, topology.CoreCount);
+        Assert.True(topology.HasSmt);
+
+        var cpu6 = topology.Processors[6];
+        Assert.Equal(1, cpu6.Package);
+        Assert.Equal(4, cpu6.Core);
+        Assert.Equal(1, cpu6.NumaNode);
+        Assert.Equal(4, cpu6.L3Domain);
+        Assert.False(cpu6.IsPrimaryThread);
+    }
+
+    [Fact]
+    public void ReadDevice_FindsNumaNodeAndInterruptAffinity()
+    {
+        WriteMachine();
+        var mounts = WriteDevice();
+
+        var device = SysfsTopology.ReadDevice("/data/bench.dat", Sys, Proc, mounts);
+
+        Assert.NotNull(device);
+        Assert.Equal("nvme0n1", device!.Device);
+        Assert.Equal(1, device.NumaNode);
+        AssertCpus("4", device.InterruptCpus);
+
+        Assert.Null(SysfsTopology.ReadDevice("/run/x", Sys, Proc, mounts));
+    }
+
+    [Fact]
+    public void Plan_PrefersDeviceNodePrimaryThreadsAwayFromInterrupts()
+    {
+        WriteMachine();
+        var mounts = WriteDevice();
+        var topology = SysfsTopology.ReadCpus(Sys)!;
+        var device = SysfsTopology.ReadDevice("/data/bench.dat", Sys, Proc, mounts);
+
+        var one = WorkerPlacementPlanner.Plan(topology, 1, device);
+        AssertCpus("5", one.Cpus);
+        Assert.Equal(1, one.NumaNode);
+        Assert.Equal("nvme0n1", one.Device);
+
+        // The second core on node 1 takes interrupts, so it is used before SMT siblings but noted
+        var two = WorkerPlacementPlanner.Plan(topology, 2, device);
+        AssertCpus("5,4", two.Cpus);
+        Assert.Contains(two.Notes, n => n.Contains("interrupts", StringComparison.Ordinal));
+
+        // Beyond node 1's cores: SMT siblings on the node come before the other socket
+        var three = WorkerPlacementPlanner.Plan(topology, 3, device);
+        AssertCpus("5,4,7", three.Cpus);
+        Assert.Contains(three.Notes, n => n.Contains("SMT", StringComparison.Ordinal));
+    }
+
+    [Fact]
+    public void Plan_WithoutDevice_SpreadsOverPrimaryThreadsAndAvoidsCpu0()
+    {
+        WriteMachine();
+        var topology = SysfsTopology.ReadCpus(Sys)!;
+
+        var placement = WorkerPlacementPlanner.Plan(topology, 4);
+
+        AssertCpus("1,4,5,0", placement.Cpus);
+        Assert.Equal(-1, placement.NumaNode);
+        Assert.DoesNotContain(placement.Notes, n => n.Contains("SMT", StringComparison.Ordinal));
+    }
+
+    [Fact]
+    public void Plan_InterruptsOnEveryCore_AvoidsNone()
+    {
+        WriteMachine();
+        var topology = SysfsTopology.ReadCpus(Sys)!;
+        var device = new DeviceTopology { Device = "nvme0n1", NumaNode = 0, InterruptCpus = [0, 1, 2, 3, 4, 5, 6, 7] };
+
+        var placement = WorkerPlacementPlanner.Plan(topology, 1, device);
+
+        AssertCpus("1", placement.Cpus);
+        Assert.Contains(placement.Notes, n => n.Contains("every core", StringComparison.Ordinal));
+    }
+
+    [Fact]
+    public void Plan_BeyondSixtyFourProcessors_UsesFullIds()
+    {
+        var topology = new CpuTopology
+        {
+            Processors = [.. Enumerable.Range(0, 128).Select(id => new LogicalProcessor
+            {
+                Id = id,
+                Package = id / 64,
+                Core = id,
+                NumaNode = id / 64
+            })]
+        };
+
+        var placement = WorkerPlacementPlanner.Plan(topology, 2, new DeviceTopology { Device = "nvme1n1", NumaNode = 1 });
+
+        AssertCpus("64,65", placement.Cpus);
+    }
+
+    private string Sys => Path.Combine(_root, "sys");
+
+    private string Proc => Path.Combine(_root, "proc");
+
+    private void WriteMachine()
+    {
+        var cpuRoot = Path.Combine(Sys, "devices", "system", "cpu");
+        Write(Path.Combine(cpuRoot, "online"), "0-7");
+
+        for (int cpu = 0; cpu < 8; cpu++)
+        {
+            int package = cpu / 4;
+            int first = package * 4 + cpu % 2;
+            var dir = Path.Combine(cpuRoot, $"cpu{cpu}");
+            Write(Path.Combine(dir, "topology", "physical_package_id"), package.ToString(System.Globalization.CultureInfo.InvariantCulture));
+            Write(Path.Combine(dir, "topology", "thread_siblings_list"), $"{first},{first + 2}");
+            Write(Path.Combine(dir, "cache", "index0", "level"), "1");
+            Write(Path.Combine(dir, "cache", "index0", "shared_cpu_list"), $"{first},{first + 2}");
+            Write(Path.Combine(dir, "cache", "index3", "level"), "3");
+            Write(Path.Combine(dir, "cache", "index3", "shared_cpu_list"), $"{package * 4}-{package * 4 + 3}");
+        }
+
+        Write(Path.Combine(Sys, "devices", "system", "node", "node0", "cpulist"), "0-3");
+        Write(Path.Combine(Sys, "devices", "system", "node", "node1", "cpulist"), "4-7");
+    }
+
+    private string WriteDevice()
+    {
+        // sysfs links are plain directories here; the reader walks up from the device for the PCI function
+        var pci = Path.Combine(Sys, "class", "block", "nvme0n1", "device");
+        Write(Path.Combine(pci, "numa_node"), "1");
+        Write(Path.Combine(pci, "msi_irqs", "40"), "msix");
+        Write(Path.Combine(Proc, "irq", "40", "effective_affinity_list"), "4");
+
+        var mounts = Path.Combine(_root, "mounts");
+        File.WriteAllLines(mounts,
+        [
+            "/dev/sda1 / ext4 rw 0 0",
+            "/dev/nvme0n1 /data xfs rw,noatime 0 0",
+            "tmpfs /run tmpfs rw 0 0"
+        ]);
+        return mounts;
+    }
+
+    private static void AssertCpus(string expected, IReadOnlyList<int> cpus)
+    {
+        Assert.Equal(expected, string.Join(",", cpus));
+    }
+
+    private static void Write(string path, string text)
+    {
+        Directory.CreateDirectory(Path.GetDirectoryName(path)!);
+        File.WriteAllText(path, text);
+    }
+}
@@ -0,0 +1,283 @@
+using System.Diagnostics;
+using DiskBench.Core;
+using Xunit;
+
+namespace DiskBench.Tests;
+
+/// <summary>
+/// Tests for buffered write-back stall analysis and the /proc/meminfo monitor.
+/// </summary>
+public sealed class WriteBackAnalysisTests : IDisposable
+{
+    private const long MiB = 1024 * 1024;
+
+    private readonly string _meminfo = Path.Combine(Path.GetTempPath(), "diskbench-meminfo-" + Guid.NewGuid().ToString("N"));
+
+    public void Dispose()
+    {
+        File.Delete(_meminfo);
+    }
+
+    [Fact]
+    public void ProcMeminfo_ReadsDirtyAndWritebackBytes()
+    {
+        File.WriteAllText(_meminfo, """
+            MemTotal:       16318084 kB
+            Dirty:              2048 kB
+            Writeback:           512 kB
+            WritebackTmp:          7 kB
+            """);
+
+        var monitor = new ProcMeminfoWriteBackMonitor(_meminfo);
+        var sample = monitor.Read();
+
+        Assert.True(monitor.IsAvailable);
+        Assert.Equal(2 * MiB, sample.DirtyBytes);
+        Assert.Equal(512 * 1024, sample.WritebackBytes);
+        Assert.Equal(2 * MiB + 512 * 1024, sample.PendingBytes);
+    }
+
+    [Fact]
+    public void ProcMeminfo_MissingFileOrDirtyLine_IsUnavailable()
+    {
+        Assert.False(new ProcMeminfoWriteBackMonitor(_meminfo).IsAvailable);
+
+        File.WriteAllText(_meminfo, "MemTotal:       16318084 kB\n");
+        var monitor = new ProcMeminfoWriteBackMonitor(_meminfo);
+
+        Assert.False(monitor.IsAvailable);
+        Assert.Throws<InvalidOperationException>(() => monitor.Read());
+    }
+
+    [Fact]
+    public void Analyze_DeviceThroughputExcludesPageCacheGrowth()
+    {
+        // 2 seconds writing 100 MiB/s while dirty pages grow by 60 MiB and writeback by 20 MiB
+        long start = 1_000_000;
+        long second = Stopwatch.Frequency;
+        var trial = CreateTrial(200 * MiB, [100 * MiB, 100 * MiB], []);
+        WriteBackSample[] samples =
+        [
+            new(start, 10 * MiB, 0),
+            new(start + second, 50 * MiB, 10 * MiB),
+            new(start + 2 * second, 70 * MiB, 20 * MiB)
+        ];
+
+        var result = WriteBackAnalysis.Analyze(trial, samples, start, "test", TimeSpan.FromMilliseconds(100));
+
+        Assert.Equal(100 * MiB, result.ApplicationBytesPerSecond, 1.0);
+        Assert.Equal(60 * MiB, result.DeviceBytesPerSecond, 1.0);
+        Assert.Equal(10 * MiB, result.StartPendingBytes);
+        Assert.Equal(90 * MiB, result.EndPendingBytes);
+        Assert.Equal(70 * MiB, result.PeakDirtyBytes);
+        Assert.Equal(20 * MiB, result.PeakWritebackBytes);
+
+        Assert.Equal(2, result.Intervals.Count);
+        Assert.Equal(50 * MiB, result.Intervals[0].DeviceBytes);
+        Assert.Equal(70 * MiB, result.Intervals[1].DeviceBytes);
+        Assert.Equal(20 * MiB, result.Intervals[1].WritebackBytes);
+        Assert.Empty(result.Stalls);
+        Assert.Equal(0, result.StallFraction);
+    }
+
+    [Fact]
+    public void Analyze_MergesOverlappingStalledWrites()
+    {
+        long start = 1_000_000;
+        var trial = CreateTrial(
+            2 * MiB,
+            [MiB, MiB],
+            [
+                Write(100_000, 400_000),
+                Write(300_000, 600_000),
+                Write(1_200_000, 1_500_000),
+                Write(1_700_000, 1_750_000),
+                Read(1_800_000, 1_950_000)
+            ]);
+        WriteBackSample[] samples = [new(start, 40 * MiB, null), new(start + 2 * Stopwatch.Frequency, 80 * MiB, null)];
+
+        var result = WriteBackAnalysis.Analyze(trial, samples, start, "test", TimeSpan.FromMilliseconds(100));
+
+        // The 50 ms write and the read are below the threshold or not writes
+        Assert.Equal(2, result.Stalls.Count);
+        Assert.Equal(100_000, result.Stalls[0].StartUs);
+        Assert.Equal(600_000, result.Stalls[0].EndUs);
+        Assert.Equal(2, result.Stalls[0].Writes);
+        Assert.Equal(300_000, result.Stalls[0].MaxLatencyUs);
+        Assert.Equal(42 * MiB, result.Stalls[0].DirtyBytes);
+        Assert.Null(result.Stalls[0].WritebackBytes);
+        Assert.Equal(1, result.Stalls[1].Writes);
+        Assert.Equal(500_000, result.LongestStallUs);
+        Assert.Equal(0.4, result.StallFraction, 6);
+        Assert.Null(result.PeakWritebackBytes);
+    }
+
+    [Fact]
+    public async Task RunAsync_WithWriteBackMonitor_AnalysesBufferedWriteWorkloads()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var monitor = new GrowingDirtyMonitor();
+        var runner = new BenchmarkRunner(engine, null, null, monitor);
+
+        var plan = new BenchmarkPlan
+        {
+            Workloads =
+            [
+                CreateWorkload(writePercent: 100, noBuffering: false),
+                CreateWorkload(writePercent: 100, noBuffering: true),
+                CreateWorkload(writePercent: 0, noBuffering: false)
+            ],
+            Trials = 2,
+            WarmupDuration = TimeSpan.FromMilliseconds(50),
+            MeasuredDuration = TimeSpan.FromMilliseconds(250)
+        };
+
+        var result = await runner.RunAsync(plan);
+        var writeBack = result.Workloads[0].WriteBack;
+
+        Assert.NotNull(writeBack);
+        Assert.All(writeBack!, w =>
+        {
+            Assert.Equal("growing", w.Source);
+            Assert.True(w.PeakDirtyBytes > 0);
+            Assert.True(w.DeviceBytesPerSecond <= w.ApplicationBytesPerSecond);
+        });
+        Assert.Equal([1, 2], writeBack!.Select(w => w.TrialNumber));
+        Assert.NotNull(result.Workloads[0].Trials[0].TimeSeries);
+        Assert.True(monitor.Reads >= 6);
+
+        Assert.Null(result.Workloads[1].WriteBack);
+        Assert.Null(result.Workloads[2].WriteBack);
+    }
+
+    [Fact]
+    public async Task RunAsync_WriteBackReadFailsMidTrial_WarnsOnceAndDropsWriteBack()
+    {
+        await using var engine = new FakeBenchmarkEngine();
+        var warnings = new List<string>();
+        var runner = new BenchmarkRunner(engine, new WarningSink(warnings), writeBackMonitor: new FailingDirtyMonitor(failAfterReads: 2));
+
+        var plan = new BenchmarkPlan
+        {
+            Workloads = [CreateWorkload(writePercent: 100, noBuffering: false), CreateWorkload(writePercent: 50, noBuffering: false)],
+            Trials = 2,
+            WarmupDuration = TimeSpan.Zero,
+            MeasuredDuration = TimeSpan.FromMilliseconds(250)
+        };
+
+        var result = await runner.RunAsync(plan);
+
+        Assert.All(result.Workloads, w =>
+        {
+            Assert.Equal(2, w.Trials.Count);
+            Assert.Null(w.WriteBack);
+        });
+        Assert.Equal(
+            "Write-back counters could not be read, stalls will not be analysed: meminfo vanished",
+            Assert.Single(warnings, w => w.StartsWith("Write-back", StringComparison.Ordinal)));
+    }
+
+    private static WorkloadSpec CreateWorkload(int writePercent, bool noBuffering) => new()
+    {
+        FilePath = "test.dat",
+        FileSize = 1024 * 1024,
+        BlockSize = 4096,
+        Pattern = AccessPattern.Sequential,
+        WritePercent = writePercent,
+        QueueDepth = 1,
+        NoBuffering = noBuffering
+    };
+
+    private static TrialResult CreateTrial(long bytes, long[] bytesPerSecond, SlowIoEntry[] overThreshold)
+    {
+        var latency = new LatencyPercentiles { MinUs = 0, P50Us = 0, P90Us = 0, P95Us = 0, P99Us = 0, P999Us = 0, MaxUs = 0, MeanUs = 0 };
+        return new TrialResult
+        {
+            TrialNumber = 1,
+            TotalBytes = bytes,
+            TotalOperations = bytes / 4096,
+            ReadOperations = 0,
+            WriteOperations = bytes / 4096,
+            Duration = TimeSpan.FromSeconds(bytesPerSecond.Length),
+            Latency = latency,
+            TimeSeries = [.. bytesPerSecond.Select((b, i) => new TimeSeriesSample { SecondOffset = i, Bytes = b, Operations = b / 4096 })],
+            SlowIos = new SlowIoReport
+            {
+                Slowest = [],
+                OverThreshold = overThreshold,
+                OverThresholdCount = overThreshold.Length,
+                Stuck = [],
+                StuckCount = 0
+            }
+        };
+    }
+
+    private static SlowIoEntry Write(double submitUs, double completeUs) => Io(submitUs, completeUs, isWrite: true);
+
+    private static SlowIoEntry Read(double submitUs, double completeUs) => Io(submitUs, completeUs, isWrite: false);
+
+    private static SlowIoEntry Io(double submitUs, double completeUs, bool isWrite) => new()
+    {
+        Offset = 0,
+        Size = 4096,
+        IsWrite = isWrite,
+        Slot = 0,
+        SubmitUs = submitUs,
+        CompleteUs = completeUs
+    };
+
+    private sealed class GrowingDirtyMonitor : IWriteBackMonitor
+    {
+        public int Reads { get; private set; }
+
+        public bool IsAvailable => true;
+
+        public string Description => "growing";
+
+        public WriteBackSample Read()
+        {
+            Reads++;
+            return new WriteBackSample(Stopwatch.GetTimestamp(), Reads * 4096, 0);
+        }
+    }
+
+    private sealed class FailingDirtyMonitor(int failAfterReads) : IWriteBackMonitor
+    {
+        private int _reads;
+
+        public bool IsAvailable => true;
+
+        public string Description => "failing";
+
+        public WriteBackSample Read()
+        {
+            if (++_reads > failAfterReads)
+            {
+                throw new IOException("meminfo vanished");
+            }
+
+            return new WriteBackSample(Stopwatch.GetTimestamp(), _reads * 4096, 0);
+        }
+    }
+
+    private sealed class WarningSink(List<string> warnings) : IBenchmarkSink
+    {
+        public void OnBenchmarkStart(BenchmarkPlan plan) { }
+
+        public void OnWorkloadStart(WorkloadSpec workload, int workloadIndex, int totalWorkloads) { }
+
+        public void OnTrialStart(WorkloadSpec workload, int trialNumber, int totalTrials) { }
+
+        public void OnTrialProgress(WorkloadSpec workload, int trialNumber, TrialProgress progress) { }
+
+        public void OnTrialComplete(WorkloadSpec workload, int trialNumber, TrialResult result) { }
+
+        public void OnWorkloadComplete(WorkloadSpec workload, WorkloadResult result) { }
+
+        public void OnBenchmarkComplete(BenchmarkResult result) { }
+
+        public void OnError(string message, Exception? exception = null) { }
+
+        public void OnWarning(string message) => warnings.Add(message);
+    }
+}
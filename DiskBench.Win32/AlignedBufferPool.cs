@@ -3,19 +3,25 @@ using System.Runtime.InteropServices;
 namespace DiskBench.Win32;
 
 /// <summary>
-/// Manages aligned native memory buffers for unbuffered IO.
+/// Manages aligned native memory buffers for unbuffered IO, carved from one slab.
 /// </summary>
-internal sealed class AlignedBufferPool : IDisposable
+/// <remarks>
+/// Buffers are spaced by their size rounded up to the alignment (and at least a cache line), so no two
+/// buffers share a cache line and the pool costs one allocation and one free however many buffers it holds.
+/// </remarks>
+internal sealed unsafe class AlignedBufferPool : IDisposable
 {
-    private readonly IntPtr[] _buffers;
+    private readonly int _count;
     private readonly int _bufferSize;
     private readonly int _alignment;
+    private readonly int _stride;
+    private byte* _slab;
     private bool _disposed;
 
     /// <summary>
     /// Gets the number of buffers in the pool.
     /// </summary>
-    public int Count => _buffers.Length;
+    public int Count => _count;
 
     /// <summary>
     /// Gets the size of each buffer.
@@ -27,6 +33,11 @@ internal sealed class AlignedBufferPool : IDisposable
     /// </summary>
     public int Alignment => _alignment;
 
+    /// <summary>
+    /// Gets the distance between consecutive buffers in the slab.
+    /// </summary>
+    public int BufferStride => _stride;
+
     /// <summary>
     /// Creates a new aligned buffer pool.
     /// </summary>
@@ -40,14 +51,21 @@ internal sealed class AlignedBufferPool : IDisposable
         if (alignment <= 0 || (alignment & (alignment - 1)) != 0)
             throw new ArgumentException("Alignment must be a power of 2.", nameof(alignment));
 
-        _buffers = new IntPtr[count];
+        int slabAlignment = Math.Max(alignment, 64);
+        _count = count;
         _bufferSize = bufferSize;
         _alignment = alignment;
+        _stride = (bufferSize + slabAlignment - 1) & ~(slabAlignment - 1);
 
-        for (int i = 0; i < count; i++)
+        nuint size = (nuint)count * (nuint)_stride;
+        _slab = (byte*)NativeMemory.AlignedAlloc(size, (nuint)slabAlignment);
+        if (_slab == null)
         {
-            _buffers[i] = AllocateAligned(bufferSize, alignment);
+            throw new InsufficientMemoryException($"Failed to allocate {count} buffers of {bufferSize} bytes with {alignment} alignment.");
         }
+
+        // Zero the buffers
+        NativeMemory.Clear(_slab, size);
     }
 
     /// <summary>
@@ -58,41 +76,29 @@ internal sealed class AlignedBufferPool : IDisposable
         get
         {
             ObjectDisposedException.ThrowIf(_disposed, this);
-            return _buffers[index];
-        }
-    }
+            if ((uint)index >= (uint)_count)
+            {
+                throw new ArgumentOutOfRangeException(nameof(index));
+            }
 
-    private static unsafe IntPtr AllocateAligned(int size, int alignment)
-    {
-        // Use NativeMemory.AlignedAlloc for proper alignment
-        void* ptr = NativeMemory.AlignedAlloc((nuint)size, (nuint)alignment);
-        if (ptr == null)
-        {
-            throw new InsufficientMemoryException($"Failed to allocate {size} bytes with {alignment} alignment.");
+            return (IntPtr)(_slab + ((nint)index * _stride));
         }
-
-        // Zero the buffer
-        NativeMemory.Clear(ptr, (nuint)size);
-
-        return (IntPtr)ptr;
     }
 
     /// <summary>
     /// Fills a buffer with a pattern.
     /// </summary>
-    public unsafe void FillBuffer(int index, byte pattern)
+    public void FillBuffer(int index, byte pattern)
     {
-        ObjectDisposedException.ThrowIf(_disposed, this);
-        NativeMemory.Fill((void*)_buffers[index], (nuint)_bufferSize, pattern);
+        NativeMemory.Fill((void*)this[index], (nuint)_bufferSize, pattern);
     }
 
     /// <summary>
     /// Fills a buffer with random data.
     /// </summary>
-    public unsafe void FillRandom(int index, Random random)
+    public void FillRandom(int index, Random random)
     {
-        ObjectDisposedException.ThrowIf(_disposed, this);
-        var span = new Span<byte>((void*)_buffers[index], _bufferSize);
+        var span = new Span<byte>((void*)this[index], _bufferSize);
         random.NextBytes(span);
     }
 
@@ -101,16 +107,7 @@ internal sealed class AlignedBufferPool : IDisposable
         if (_disposed) return;
         _disposed = true;
 
-        for (int i = 0; i < _buffers.Length; i++)
-        {
-            if (_buffers[i] != IntPtr.Zero)
-            {
-                unsafe
-                {
-                    NativeMemory.AlignedFree((void*)_buffers[i]);
-                }
-                _buffers[i] = IntPtr.Zero;
-            }
-        }
+        NativeMemory.AlignedFree(_slab);
+        _slab = null;
     }
 }
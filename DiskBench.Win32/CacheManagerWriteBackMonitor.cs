@@ -0,0 +1,88 @@
+using System.Diagnostics;
+using DiskBench.Core;
+
+namespace DiskBench.Win32;
+
+/// <summary>
+/// Reads the cache manager's dirty page count through the \Cache\Dirty Pages performance counter.
+/// The cache manager does not expose pages currently being written, so writeback is reported as unknown
+/// and the lazy writer's in-flight pages count as dirty until their writes complete.
+/// </summary>
+public sealed class CacheManagerWriteBackMonitor : IWriteBackMonitor, IDisposable
+{
+    private const string DirtyPagesCounter = @"\Cache\Dirty Pages";
+
+    private readonly IntPtr _dirtyPages;
+    private IntPtr _query;
+
+    /// <summary>
+    /// Opens the counter. Unavailable if the query cannot be created (e.g., performance counters disabled).
+    /// </summary>
+    public CacheManagerWriteBackMonitor()
+    {
+        uint status = NativeMethods.PdhOpenQueryW(null, IntPtr.Zero, out _query);
+        if (status != 0)
+        {
+            Description = $"PdhOpenQuery failed (0x{status:X8})";
+            return;
+        }
+
+        status = NativeMethods.PdhAddEnglishCounterW(_query, DirtyPagesCounter, IntPtr.Zero, out _dirtyPages);
+        if (status == 0)
+        {
+            status = NativeMethods.PdhCollectQueryData(_query);
+        }
+
+        if (status != 0)
+        {
+            Description = $"{DirtyPagesCounter} unavailable (0x{status:X8})";
+            Dispose();
+            return;
+        }
+
+        Description = DirtyPagesCounter;
+    }
+
+    /// <inheritdoc />
+    public bool IsAvailable => _query != IntPtr.Zero;
+
+    /// <inheritdoc />
+    public string Description { get; }
+
+    /// <inheritdoc />
+    public WriteBackSample Read()
+    {
+        if (!IsAvailable)
+        {
+            throw new InvalidOperationException($"Write-back counters unavailable: {Description}");
+        }
+
+        var timestamp = Stopwatch.GetTimestamp();
+        uint status = NativeMethods.PdhCollectQueryData(_query);
+        if (status == 0)
+        {
+            status = NativeMethods.PdhGetFormattedCounterValue(_dirtyPages, NativeMethods.PDH_FMT_LARGE, out _, out var value);
+            if (status == 0)
+            {
+                status = value.CStatus;
+            }
+
+            if (status == 0)
+            {
+                return new WriteBackSample(timestamp, value.LargeValue * Environment.SystemPageSize, null);
+            }
+        }
+
+        throw new InvalidOperationException($"Failed to read {DirtyPagesCounter} (0x{status:X8})");
+    }
+
+    /// <inheritdoc />
+    public void Dispose()
+    {
+        if (_query != IntPtr.Zero)
+        {
+            _ = NativeMethods.PdhCloseQuery(_query);
+            _query = IntPtr.Zero;
+        }
+    }
+}
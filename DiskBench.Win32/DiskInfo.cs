@@ -17,28 +17,10 @@ internal static class DiskInfo
     /// <returns>Tuple of (logical sector size, physical sector size).</returns>
     public static (int LogicalSectorSize, int PhysicalSectorSize) GetSectorSize(string filePath)
     {
-        // Get the volume root path
-        var volumePath = new char[260];
-        if (!NativeMethods.GetVolumePathNameW(filePath, volumePath, (uint)volumePath.Length))
+        var rootPath = GetVolumeRoot(filePath);
+        if (rootPath == null)
         {
-            // Fall back to drive letter
-            if (filePath.Length >= 2 && filePath[1] == ':')
-            {
-                volumePath[0] = filePath[0];
-                volumePath[1] = ':';
-                volumePath[2] = '\\';
-                volumePath[3] = '\0';
-            }
-            else
-            {
-                return (512, 512); // Default fallback
-            }
-        }
-
-        var rootPath = new string(volumePath).TrimEnd('\0');
-        if (!rootPath.EndsWith('\\'))
-        {
-            rootPath += '\\';
+            return (512, 512); // Default fallback
         }
 
         // Try IOCTL_STORAGE_QUERY_PROPERTY first for more accurate info
@@ -57,6 +39,48 @@ internal static class DiskInfo
         return (512, 512); // Ultimate fallback
     }
 
+    /// <summary>
+    /// Gets the cluster (allocation unit) size of the volume holding a path.
+    /// </summary>
+    /// <param name="filePath">Path to file or directory.</param>
+    /// <returns>Cluster size in bytes (4096 if it cannot be determined).</returns>
+    public static int GetClusterSize(string filePath)
+    {
+        var rootPath = GetVolumeRoot(filePath);
+        if (rootPath != null && NativeMethods.GetDiskFreeSpaceW(rootPath, out uint sectorsPerCluster, out uint bytesPerSector, out _, out _) != 0)
+        {
+            return (int)(sectorsPerCluster * bytesPerSector);
+        }
+
+        return 4096;
+    }
+
+    /// <summary>
+    /// Gets the root of the volume holding a path (e.g., "C:\"), or null if it cannot be determined.
+    /// </summary>
+    private static string? GetVolumeRoot(string filePath)
+    {
+        var volumePath = new char[260];
+        if (!NativeMethods.GetVolumePathNameW(filePath, volumePath, (uint)volumePath.Length))
+        {
+            // Fall back to drive letter
+            if (filePath.Length >= 2 && filePath[1] == ':')
+            {
+                return $"{filePath[0]}:\\";
+            }
+
+            return null;
+        }
+
+        var rootPath = new string(volumePath).TrimEnd('\0');
+        if (!rootPath.EndsWith('\\'))
+        {
+            rootPath += '\\';
+        }
+
+        return rootPath;
+    }
+
     private static (int Logical, int Physical) TryGetAlignmentDescriptor(string volumePath)
     {
         // Open the volume for querying
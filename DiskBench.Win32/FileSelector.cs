@@ -0,0 +1,103 @@
+using DiskBench.Core;
+
+namespace DiskBench.Win32;
+
+/// <summary>
+/// Picks the file of a file set each IO targets, uniformly or by Zipf popularity.
+/// Choices are precomputed, like offsets, to keep the RNG out of the hot path, and the table is refilled
+/// from the same RNG on wrap so choices never repeat in step with the offset table.
+/// </summary>
+public sealed class FileSelector
+{
+    private readonly int[] _indices;
+    private readonly Random _random;
+    private readonly int _count;
+    private readonly double[]? _cdf;
+    private readonly int[]? _files;
+    private int _current;
+
+    /// <summary>
+    /// Creates a file selector.
+    /// </summary>
+    /// <param name="fileSet">File set to choose from.</param>
+    /// <param name="seed">Random seed.</param>
+    /// <param name="precomputeCount">Number of choices to precompute.</param>
+    public FileSelector(FileSetSpec fileSet, int seed, int precomputeCount = 65536)
+    {
+        ArgumentNullException.ThrowIfNull(fileSet);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(fileSet.FileCount);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(precomputeCount);
+
+        _indices = new int[precomputeCount];
+        _random = new Random(seed);
+        _count = fileSet.FileCount;
+
+        if (fileSet.Distribution == FileDistribution.Zipf)
+        {
+            _cdf = ZipfCdf(_count, fileSet.ZipfExponent);
+
+            // Spread popularity ranks over the files, so the hot files are not simply the first ones created
+            _files = Enumerable.Range(0, _count).ToArray();
+            _random.Shuffle(_files);
+        }
+
+        Refill();
+    }
+
+    /// <summary>
+    /// Sets <see cref="IoDescriptor.FileIndex"/> of every descriptor in the batch.
+    /// </summary>
+    /// <param name="batch">Descriptors to fill.</param>
+    public void Fill(Span<IoDescriptor> batch)
+    {
+        for (int i = 0; i < batch.Length; i++)
+        {
+            batch[i].FileIndex = _indices[_current];
+            if (++_current == _indices.Length)
+            {
+                Refill();
+                _current = 0;
+            }
+        }
+    }
+
+    private void Refill()
+    {
+        if (_cdf != null)
+        {
+            for (int i = 0; i < _indices.Length; i++)
+            {
+                int rank = Array.BinarySearch(_cdf, _random.NextDouble());
+                _indices[i] = _files![rank < 0 ? Math.Min(~rank, _count - 1) : rank];
+            }
+        }
+        else
+        {
+            for (int i = 0; i < _indices.Length; i++)
+            {
+                _indices[i] = _random.Next(_count);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Cumulative Zipf probabilities: entry k is the chance of picking one of the k + 1 most popular files.
+    /// </summary>
+    private static double[] ZipfCdf(int count, double exponent)
+    {
+        var cdf = new double[count];
+        double sum = 0;
+        for (int k = 0; k < count; k++)
+        {
+            sum += 1.0 / Math.Pow(k + 1, exponent);
+            cdf[k] = sum;
+        }
+
+        for (int k = 0; k < count; k++)
+        {
+            cdf[k] /= sum;
+        }
+
+        return cdf;
+    }
+}
@@ -0,0 +1,61 @@
+using DiskBench.Core;
+
+namespace DiskBench.Win32;
+
+/// <summary>
+/// Idle waits on a high-resolution waitable timer, which wakes within about half a millisecond
+/// instead of on the next 15.6 ms scheduler tick and does not raise the system-wide timer resolution.
+/// </summary>
+public sealed class HighResolutionWaiter : IIdleWaiter
+{
+    private IntPtr _timer;
+
+    private HighResolutionWaiter(IntPtr timer)
+    {
+        _timer = timer;
+    }
+
+    /// <summary>
+    /// Creates a waiter for the calling thread.
+    /// </summary>
+    /// <returns>The waiter, or null before Windows 10 1803 or off Windows, where callers fall back to sleeping.</returns>
+    public static IIdleWaiter? TryCreate()
+    {
+        if (!OperatingSystem.IsWindowsVersionAtLeast(10, 0, 17134))
+        {
+            return null;
+        }
+
+        var timer = NativeMethods.CreateWaitableTimerExW(
+            IntPtr.Zero, null, NativeMethods.CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, NativeMethods.TIMER_ALL_ACCESS);
+        return timer == IntPtr.Zero ? null : new HighResolutionWaiter(timer);
+    }
+
+    /// <inheritdoc />
+    public void Wait(TimeSpan duration)
+    {
+        ObjectDisposedException.ThrowIf(_timer == IntPtr.Zero, this);
+        if (duration <= TimeSpan.Zero)
+        {
+            return;
+        }
+
+        // Negative due time is relative, in 100 ns units
+        long dueTime = -duration.Ticks;
+        if (!NativeMethods.SetWaitableTimer(_timer, dueTime, 0, IntPtr.Zero, IntPtr.Zero, false) ||
+            NativeMethods.WaitForSingleObject(_timer, NativeMethods.INFINITE) != NativeMethods.WAIT_OBJECT_0)
+        {
+            Thread.Sleep(duration);
+        }
+    }
+
+    /// <inheritdoc />
+    public void Dispose()
+    {
+        if (_timer != IntPtr.Zero)
+        {
+            NativeMethods.CloseHandle(_timer);
+            _timer = IntPtr.Zero;
+        }
+    }
+}
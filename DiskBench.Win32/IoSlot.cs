@@ -1,16 +1,25 @@
+using System.Numerics;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 
 namespace DiskBench.Win32;
 
 /// <summary>
-/// Represents a single IO operation slot with its OVERLAPPED structure and state.
-/// Pinned in memory to allow safe passage to unmanaged code.
+/// Handle to one IO slot of an <see cref="IoSlotTable"/>. The slot's state lives in the table's
+/// per-field arrays; the handle is just the table and an index, so it costs nothing to pass around.
 /// </summary>
-internal sealed class IoSlot : IDisposable
+internal readonly struct IoSlot
 {
-    private IntPtr _overlappedPtr;
-    private bool _disposed;
+    private readonly IoSlotTable _table;
+
+    /// <summary>
+    /// Creates a handle to a slot of a table.
+    /// </summary>
+    public IoSlot(IoSlotTable table, int index)
+    {
+        _table = table;
+        Index = index;
+    }
 
     /// <summary>
     /// Slot index for identification.
@@ -20,56 +29,145 @@ internal sealed class IoSlot : IDisposable
     /// <summary>
     /// The buffer pointer for this slot.
     /// </summary>
-    public IntPtr Buffer { get; }
+    public IntPtr Buffer => _table.GetBuffer(Index);
 
     /// <summary>
     /// Whether this slot is currently in use (IO pending).
     /// </summary>
-    public bool IsPending { get; set; }
+    public bool IsPending
+    {
+        get => _table.IsPending(Index);
+        set => _table.SetPending(Index, value);
+    }
 
     /// <summary>
     /// Timestamp when the IO was submitted.
     /// </summary>
-    public long SubmitTimestamp { get; set; }
+    public long SubmitTimestamp
+    {
+        get => _table.SubmitTimestampOf(Index);
+        set => _table.SubmitTimestampOf(Index) = value;
+    }
 
     /// <summary>
     /// File offset for the current IO.
     /// </summary>
-    public long Offset { get; set; }
+    public long Offset
+    {
+        get => _table.OffsetOf(Index);
+        set => _table.OffsetOf(Index) = value;
+    }
+
+    /// <summary>
+    /// Index of the file of the file set the current IO targets.
+    /// </summary>
+    public int FileIndex
+    {
+        get => _table.FileIndexOf(Index);
+        set => _table.FileIndexOf(Index) = value;
+    }
 
     /// <summary>
     /// Size of the current IO.
     /// </summary>
-    public int Size { get; set; }
+    public int Size
+    {
+        get => _table.SizeOf(Index);
+        set => _table.SizeOf(Index) = value;
+    }
 
     /// <summary>
     /// Whether the current IO is a write operation.
     /// </summary>
-    public bool IsWrite { get; set; }
+    public bool IsWrite
+    {
+        get => _table.IsWriteOf(Index);
+        set => _table.IsWriteOf(Index) = value;
+    }
 
     /// <summary>
-    /// Gets a pointer to the pinned OVERLAPPED structure.
+    /// Whether the current IO has already been reported as stuck.
     /// </summary>
-    public IntPtr OverlappedPtr => _overlappedPtr;
+    public bool StuckReported
+    {
+        get => _table.StuckReportedOf(Index);
+        set => _table.StuckReportedOf(Index) = value;
+    }
 
     /// <summary>
-    /// Gets a reference to the OVERLAPPED structure.
+    /// Timestamp when the first attempt of the current IO was submitted (differs from
+    /// <see cref="SubmitTimestamp"/> once the IO has been retried).
     /// </summary>
-    public unsafe ref NativeOverlapped Overlapped => ref Unsafe.AsRef<NativeOverlapped>((void*)_overlappedPtr);
+    public long FirstSubmitTimestamp
+    {
+        get => _table.FirstSubmitTimestampOf(Index);
+        set => _table.FirstSubmitTimestampOf(Index) = value;
+    }
 
     /// <summary>
-    /// Creates a new IO slot.
+    /// Number of retries issued for the current IO.
     /// </summary>
-    public IoSlot(int index, IntPtr buffer)
+    public int Attempt
     {
-        Index = index;
-        Buffer = buffer;
+        get => _table.AttemptOf(Index);
+        set => _table.AttemptOf(Index) = value;
+    }
+
+    /// <summary>
+    /// Work postponed for this slot (delayed completion or retry), if any.
+    /// </summary>
+    public DeferredIoAction DeferredAction
+    {
+        get => _table.GetDeferredAction(Index);
+        set => _table.SetDeferredAction(Index, value);
+    }
+
+    /// <summary>
+    /// Timestamp at which the deferred work is due.
+    /// </summary>
+    public long DeferredUntil
+    {
+        get => _table.DeferredUntilOf(Index);
+        set => _table.DeferredUntilOf(Index) = value;
+    }
+
+    /// <summary>
+    /// Bytes transferred by a completion that was deferred.
+    /// </summary>
+    public int DeferredBytes
+    {
+        get => _table.DeferredBytesOf(Index);
+        set => _table.DeferredBytesOf(Index) = value;
+    }
+
+    /// <summary>
+    /// Gets a pointer to the slot's OVERLAPPED structure.
+    /// </summary>
+    public IntPtr OverlappedPtr => _table.GetOverlapped(Index);
+
+    /// <summary>
+    /// Gets a reference to the OVERLAPPED structure.
+    /// </summary>
+    public unsafe ref NativeOverlapped Overlapped => ref Unsafe.AsRef<NativeOverlapped>((void*)OverlappedPtr);
 
-        // Allocate unmanaged OVERLAPPED memory to keep it stable during async IO
-        _overlappedPtr = Marshal.AllocHGlobal(Marshal.SizeOf<NativeOverlapped>());
-        Marshal.StructureToPtr(new NativeOverlapped(), _overlappedPtr, false);
+    /// <summary>
+    /// Win32 error code of the slot's completed IO (0 on success), mapped from the NTSTATUS the kernel
+    /// leaves in OVERLAPPED.Internal. The copy in OVERLAPPED_ENTRY is documented as reserved.
+    /// </summary>
+    public int CompletionError
+    {
+        get
+        {
+            nint status = Overlapped.InternalLow;
+            return status == 0 ? 0 : (int)NativeMethods.RtlNtStatusToDosError((uint)status);
+        }
     }
 
+    /// <summary>
+    /// Gets the first <paramref name="length"/> bytes of the slot buffer.
+    /// </summary>
+    public unsafe ReadOnlySpan<byte> GetData(int length) => new((void*)Buffer, length);
+
     /// <summary>
     /// Configures the OVERLAPPED for a new IO at the specified offset.
     /// </summary>
@@ -79,7 +177,11 @@ internal sealed class IoSlot : IDisposable
         Size = size;
         IsWrite = isWrite;
         SubmitTimestamp = timestamp;
+        FirstSubmitTimestamp = timestamp;
+        Attempt = 0;
+        DeferredAction = DeferredIoAction.None;
         IsPending = false;
+        StuckReported = false;
 
         // Set offset in OVERLAPPED (split into low and high parts)
         ref var overlapped = ref Overlapped;
@@ -87,33 +189,89 @@ internal sealed class IoSlot : IDisposable
         overlapped.OffsetHigh = (int)(offset >> 32);
         overlapped.EventHandle = IntPtr.Zero;
     }
+}
 
-    public void Dispose()
-    {
-        if (_disposed) return;
-        _disposed = true;
+/// <summary>
+/// Work postponed for an IO slot while it is not in flight.
+/// </summary>
+internal enum DeferredIoAction : byte
+{
+    /// <summary>
+    /// Nothing deferred.
+    /// </summary>
+    None,
 
-        if (_overlappedPtr != IntPtr.Zero)
-        {
-            Marshal.FreeHGlobal(_overlappedPtr);
-            _overlappedPtr = IntPtr.Zero;
-        }
-    }
+    /// <summary>
+    /// Deliver a completion that is being held back (injected latency spike or stall).
+    /// </summary>
+    Complete,
+
+    /// <summary>
+    /// Resubmit the failed IO at the same offset after a backoff delay.
+    /// </summary>
+    Retry,
+
+    /// <summary>
+    /// Issue a new IO after the previous one exhausted its retries.
+    /// </summary>
+    Reissue,
+
+    /// <summary>
+    /// Submit the configured IO once its think time has passed.
+    /// </summary>
+    Submit
 }
 
 /// <summary>
-/// Pool of IO slots for managing outstanding operations.
+/// Table of IO slots for managing outstanding operations, laid out to scale to many thousands of slots.
 /// </summary>
-internal sealed class IoSlotPool : IDisposable
+/// <remarks>
+/// Slot state is stored as a struct of arrays: one array per field, so the completion path touches
+/// only the fields it reads. Every OVERLAPPED lives in one native block, a cache line apart so the
+/// kernel completing one IO never writes a line another slot is using, and every buffer lives in one
+/// aligned slab. A completion maps back to its slot by pointer arithmetic on the OVERLAPPED block.
+/// In-flight and deferred slots are tracked as a count plus a bitmap, so counting them is O(1) and
+/// visiting them skips 64 idle slots per word. Disposal frees the two native blocks without visiting
+/// any slot.
+/// </remarks>
+internal sealed unsafe class IoSlotTable : IDisposable
 {
-    private readonly IoSlot[] _slots;
+    /// <summary>
+    /// Spacing of the OVERLAPPED structures: one cache line each.
+    /// </summary>
+    public const int OverlappedStride = 64;
+
+    /// <summary>
+    /// Bytes of slot state per slot besides its OVERLAPPED and buffer (the per-field arrays and bitmaps).
+    /// </summary>
+    public const int StateBytesPerSlot = (4 * sizeof(long)) + (4 * sizeof(int)) + (2 * sizeof(bool)) + sizeof(DeferredIoAction);
+
     private readonly AlignedBufferPool _buffers;
+    private readonly int _count;
+    private byte* _overlapped;
+
+    private readonly long[] _offsets;
+    private readonly long[] _submitTimestamps;
+    private readonly long[] _firstSubmitTimestamps;
+    private readonly long[] _deferredUntil;
+    private readonly int[] _sizes;
+    private readonly int[] _fileIndices;
+    private readonly int[] _attempts;
+    private readonly int[] _deferredBytes;
+    private readonly bool[] _isWrite;
+    private readonly bool[] _stuckReported;
+    private readonly DeferredIoAction[] _deferredActions;
+
+    private readonly ulong[] _pending;
+    private readonly ulong[] _deferred;
+    private int _pendingCount;
+    private int _deferredCount;
     private bool _disposed;
 
     /// <summary>
-    /// Gets the number of slots in the pool.
+    /// Gets the number of slots in the table.
     /// </summary>
-    public int Count => _slots.Length;
+    public int Count => _count;
 
     /// <summary>
     /// Gets the buffer size for each slot.
@@ -121,56 +279,105 @@ internal sealed class IoSlotPool : IDisposable
     public int BufferSize => _buffers.BufferSize;
 
     /// <summary>
-    /// Creates a new IO slot pool.
+    /// Gets the number of slots with an IO in flight.
+    /// </summary>
+    public int PendingCount => _pendingCount;
+
+    /// <summary>
+    /// Gets the number of slots with deferred work.
+    /// </summary>
+    public int DeferredCount => _deferredCount;
+
+    /// <summary>
+    /// Gets the memory each slot takes: OVERLAPPED, state and buffer.
+    /// </summary>
+    public long BytesPerSlot => OverlappedStride + StateBytesPerSlot + _buffers.BufferStride;
+
+    /// <summary>
+    /// Creates a new IO slot table.
     /// </summary>
-    public IoSlotPool(int slotCount, int bufferSize, int alignment)
+    public IoSlotTable(int slotCount, int bufferSize, int alignment)
     {
         _buffers = new AlignedBufferPool(slotCount, bufferSize, alignment);
-        _slots = new IoSlot[slotCount];
+        _count = slotCount;
 
-        for (int i = 0; i < slotCount; i++)
+        // One zeroed, cache-line aligned block holds every OVERLAPPED
+        nuint overlappedBytes = (nuint)slotCount * OverlappedStride;
+        _overlapped = (byte*)NativeMemory.AlignedAlloc(overlappedBytes, OverlappedStride);
+        if (_overlapped == null)
         {
-            _slots[i] = new IoSlot(i, _buffers[i])
-            {
-                Size = bufferSize // Initialize the slot size
-            };
+            _buffers.Dispose();
+            throw new InsufficientMemoryException($"Failed to allocate {slotCount} OVERLAPPED structures.");
         }
+
+        NativeMemory.Clear(_overlapped, overlappedBytes);
+
+        _offsets = new long[slotCount];
+        _submitTimestamps = new long[slotCount];
+        _firstSubmitTimestamps = new long[slotCount];
+        _deferredUntil = new long[slotCount];
+        _sizes = new int[slotCount];
+        _fileIndices = new int[slotCount];
+        _attempts = new int[slotCount];
+        _deferredBytes = new int[slotCount];
+        _isWrite = new bool[slotCount];
+        _stuckReported = new bool[slotCount];
+        _deferredActions = new DeferredIoAction[slotCount];
+        _pending = new ulong[(slotCount + 63) / 64];
+        _deferred = new ulong[(slotCount + 63) / 64];
+
+        Array.Fill(_sizes, bufferSize);
     }
 
     /// <summary>
     /// Gets a slot by index.
     /// </summary>
-    public IoSlot this[int index] => _slots[index];
-
-    /// <summary>
-    /// Finds a slot by its OVERLAPPED pointer.
-    /// </summary>
-    public IoSlot? FindByOverlapped(IntPtr overlappedPtr)
+    public IoSlot this[int index]
     {
-        for (int i = 0; i < _slots.Length; i++)
+        get
         {
-            if (_slots[i].OverlappedPtr == overlappedPtr)
+            if ((uint)index >= (uint)_count)
             {
-                return _slots[i];
+                throw new ArgumentOutOfRangeException(nameof(index));
             }
+
+            return new IoSlot(this, index);
         }
-        return null;
     }
 
     /// <summary>
-    /// Finds a slot by index from OVERLAPPED internal data.
+    /// Finds a slot by its OVERLAPPED pointer in constant time.
     /// </summary>
-    public IoSlot GetByIndex(int index)
+    /// <returns>False if the pointer is not one of this table's OVERLAPPEDs.</returns>
+    public bool TryGetSlot(IntPtr overlappedPtr, out IoSlot slot)
     {
-        return _slots[index];
+        long delta = (long)overlappedPtr - (long)_overlapped;
+        if (delta < 0 || delta >= (long)_count * OverlappedStride || delta % OverlappedStride != 0)
+        {
+            slot = default;
+            return false;
+        }
+
+        slot = new IoSlot(this, (int)(delta / OverlappedStride));
+        return true;
     }
 
+    /// <summary>
+    /// Gets the slots with an IO in flight, in index order.
+    /// </summary>
+    public SlotEnumerator GetPendingSlots() => new(this, _pending);
+
+    /// <summary>
+    /// Gets the slots with deferred work, in index order.
+    /// </summary>
+    public SlotEnumerator GetDeferredSlots() => new(this, _deferred);
+
     /// <summary>
     /// Fills write buffers with pattern data.
     /// </summary>
     public void FillWriteBuffers(byte pattern)
     {
-        for (int i = 0; i < _slots.Length; i++)
+        for (int i = 0; i < _count; i++)
         {
             _buffers.FillBuffer(i, pattern);
         }
@@ -182,7 +389,7 @@ internal sealed class IoSlotPool : IDisposable
     public void FillWriteBuffersRandom(int seed)
     {
         var random = new Random(seed);
-        for (int i = 0; i < _slots.Length; i++)
+        for (int i = 0; i < _count; i++)
         {
             _buffers.FillRandom(i, random);
         }
@@ -193,23 +400,74 @@ internal sealed class IoSlotPool : IDisposable
     /// </summary>
     public void ResetAll()
     {
-        for (int i = 0; i < _slots.Length; i++)
+        Array.Clear(_pending);
+        _pendingCount = 0;
+    }
+
+    internal IntPtr GetBuffer(int index) => _buffers[index];
+
+    internal IntPtr GetOverlapped(int index)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        return (IntPtr)(_overlapped + ((nint)index * OverlappedStride));
+    }
+
+    internal bool IsPending(int index) => (_pending[index >> 6] & (1UL << index)) != 0;
+
+    internal void SetPending(int index, bool pending)
+    {
+        if (Toggle(_pending, index, pending))
+        {
+            _pendingCount += pending ? 1 : -1;
+        }
+    }
+
+    internal DeferredIoAction GetDeferredAction(int index) => _deferredActions[index];
+
+    internal void SetDeferredAction(int index, DeferredIoAction action)
+    {
+        _deferredActions[index] = action;
+        bool deferred = action != DeferredIoAction.None;
+        if (Toggle(_deferred, index, deferred))
         {
-            _slots[i].IsPending = false;
+            _deferredCount += deferred ? 1 : -1;
         }
     }
 
+    internal ref long OffsetOf(int index) => ref _offsets[index];
+
+    internal ref long SubmitTimestampOf(int index) => ref _submitTimestamps[index];
+
+    internal ref long FirstSubmitTimestampOf(int index) => ref _firstSubmitTimestamps[index];
+
+    internal ref long DeferredUntilOf(int index) => ref _deferredUntil[index];
+
+    internal ref int SizeOf(int index) => ref _sizes[index];
+
+    internal ref int FileIndexOf(int index) => ref _fileIndices[index];
+
+    internal ref int AttemptOf(int index) => ref _attempts[index];
+
+    internal ref int DeferredBytesOf(int index) => ref _deferredBytes[index];
+
+    internal ref bool IsWriteOf(int index) => ref _isWrite[index];
+
+    internal ref bool StuckReportedOf(int index) => ref _stuckReported[index];
+
     /// <summary>
-    /// Gets the count of pending operations.
+    /// Sets or clears a slot's bit. Returns whether it changed.
     /// </summary>
-    public int GetPendingCount()
+    private static bool Toggle(ulong[] bitmap, int index, bool set)
     {
-        int count = 0;
-        for (int i = 0; i < _slots.Length; i++)
+        ref ulong word = ref bitmap[index >> 6];
+        ulong bit = 1UL << index;
+        if (((word & bit) != 0) == set)
         {
-            if (_slots[i].IsPending) count++;
+            return false;
         }
-        return count;
+
+        word ^= bit;
+        return true;
     }
 
     public void Dispose()
@@ -217,10 +475,60 @@ internal sealed class IoSlotPool : IDisposable
         if (_disposed) return;
         _disposed = true;
 
-        for (int i = 0; i < _slots.Length; i++)
+        NativeMemory.AlignedFree(_overlapped);
+        _overlapped = null;
+        _buffers.Dispose();
+    }
+
+    /// <summary>
+    /// Visits the slots whose bit is set, 64 slots per bitmap word. Bits cleared during the visit are
+    /// honoured for later words; the current word is read once.
+    /// </summary>
+    internal ref struct SlotEnumerator
+    {
+        private readonly IoSlotTable _table;
+        private readonly ulong[] _bitmap;
+        private int _word;
+        private ulong _bits;
+
+        public SlotEnumerator(IoSlotTable table, ulong[] bitmap)
         {
-            _slots[i].Dispose();
+            _table = table;
+            _bitmap = bitmap;
+            _word = -1;
+            _bits = 0;
+            Current = default;
+        }
+
+        /// <summary>
+        /// Gets the current slot.
+        /// </summary>
+        public IoSlot Current { get; private set; }
+
+        /// <summary>
+        /// Returns this enumerator, so it can be used in a foreach.
+        /// </summary>
+        public readonly SlotEnumerator GetEnumerator() => this;
+
+        /// <summary>
+        /// Advances to the next slot whose bit is set.
+        /// </summary>
+        public bool MoveNext()
+        {
+            while (_bits == 0)
+            {
+                if (++_word >= _bitmap.Length)
+                {
+                    return false;
+                }
+
+                _bits = _bitmap[_word];
+            }
+
+            int bit = BitOperations.TrailingZeroCount(_bits);
+            _bits &= _bits - 1;
+            Current = new IoSlot(_table, (_word << 6) + bit);
+            return true;
         }
-        _buffers.Dispose();
     }
 }
@@ -0,0 +1,183 @@
+using System.Runtime.CompilerServices;
+using DiskBench.Core;
+
+namespace DiskBench.Win32;
+
+/// <summary>
+/// Generates the sequence of IOs (offset, size, direction, think time and, for file sets, target file) a workload issues for a given seed.
+/// The sequence depends only on the workload and seed, not on completion timing, so every
+/// engine that draws its IOs from here issues an identical stream for an identical trial spec.
+/// IOs are filled in batches, so custom sources from <see cref="WorkloadSpec.Generator"/> cost one
+/// interface call per batch rather than per IO.
+/// </summary>
+public sealed class IoStreamGenerator
+{
+    private const int DecisionCount = 65536;
+    private const int BatchSize = 256;
+
+    private readonly IOffsetSource _offsets;
+    private readonly IOperationSource? _operations;
+    private readonly ISizeSource? _sizes;
+    private readonly IThinkTimeSource? _thinkTimes;
+    private readonly FileSelector? _files;
+    private readonly IoDescriptor[] _batch = new IoDescriptor[BatchSize];
+    private readonly byte[] _writeDecisions = new byte[DecisionCount];
+    private readonly int _writeThreshold;
+    private readonly int _blockSize;
+    private readonly int _alignment;
+    private readonly long _fileSize;
+    private readonly string? _generatorName;
+    private int _decisionIndex;
+    private int _batchIndex = BatchSize;
+    private long _issued;
+
+    /// <summary>
+    /// Creates the IO stream for a workload, loading its custom generator if it names one.
+    /// </summary>
+    /// <param name="workload">Workload to generate IOs for.</param>
+    /// <param name="seed">Trial seed.</param>
+    /// <param name="alignment">Offset and size alignment custom generators must keep: the sector size for unbuffered IO, otherwise 1.</param>
+    public IoStreamGenerator(WorkloadSpec workload, int seed, int alignment = 1)
+    {
+        ArgumentNullException.ThrowIfNull(workload);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(alignment);
+
+        _blockSize = workload.BlockSize;
+        _alignment = alignment;
+        _fileSize = workload.FileSize;
+
+        if (workload.Generator != null)
+        {
+            (var offsets, _operations, _sizes, _thinkTimes) = IoGeneratorLoader.CreateSources(workload.Generator, workload, seed);
+            _generatorName = workload.Generator.GetDisplayName();
+            _offsets = offsets ?? CreateOffsetGenerator(workload, seed);
+        }
+        else
+        {
+            _offsets = CreateOffsetGenerator(workload, seed);
+        }
+
+        if (workload.FileSet is { FileCount: > 1 })
+        {
+            _files = new FileSelector(workload.FileSet, seed + 2);
+        }
+
+        // Read/write decisions on a 0-256 scale so 100% writes never reads
+        _writeThreshold = workload.WritePercent * 256 / 100;
+        new Random(seed + 1).NextBytes(_writeDecisions);
+    }
+
+    /// <summary>
+    /// Number of IOs taken from the stream so far.
+    /// </summary>
+    public long Issued => _issued;
+
+    /// <summary>
+    /// Gets the next IO of the stream. Zero-allocation hot path.
+    /// The reference is valid until the next call.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public ref readonly IoDescriptor NextIo()
+    {
+        if (_batchIndex == BatchSize)
+        {
+            Refill();
+        }
+
+        _issued++;
+        return ref _batch[_batchIndex++];
+    }
+
+    /// <summary>
+    /// Gets the offset and direction of the next IO of the stream. Zero-allocation hot path.
+    /// </summary>
+    /// <param name="isWrite">Whether the IO is a write.</param>
+    /// <returns>File offset of the IO.</returns>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public long Next(out bool isWrite)
+    {
+        ref readonly var io = ref NextIo();
+        isWrite = io.IsWrite;
+        return io.Offset;
+    }
+
+    private static OffsetGenerator CreateOffsetGenerator(WorkloadSpec workload, int seed)
+    {
+        long regionLength = workload.Region.Length > 0 ? workload.Region.Length : (workload.FileSize - workload.Region.Offset);
+        return new OffsetGenerator(
+            workload.Pattern,
+            workload.FileSize,
+            workload.BlockSize,
+            workload.Region.Offset,
+            regionLength,
+            seed);
+    }
+
+    private void Refill()
+    {
+        var batch = _batch.AsSpan();
+        _offsets.Fill(batch);
+
+        if (_operations != null)
+        {
+            _operations.Fill(batch);
+        }
+        else
+        {
+            for (int i = 0; i < batch.Length; i++)
+            {
+                batch[i].IsWrite = _writeDecisions[_decisionIndex++ & (DecisionCount - 1)] < _writeThreshold;
+            }
+        }
+
+        if (_sizes != null)
+        {
+            _sizes.Fill(batch);
+        }
+        else
+        {
+            for (int i = 0; i < batch.Length; i++)
+            {
+                batch[i].Size = _blockSize;
+            }
+        }
+
+        if (_thinkTimes != null)
+        {
+            _thinkTimes.Fill(batch);
+        }
+
+        _files?.Fill(batch);
+
+        if (_generatorName != null)
+        {
+            Validate(batch);
+        }
+
+        _batchIndex = 0;
+    }
+
+    /// <summary>
+    /// Checks a batch from a custom generator: slot buffers hold one block, IOs must stay within the file
+    /// and, for unbuffered IO, offsets and sizes must be whole sectors.
+    /// </summary>
+    private void Validate(ReadOnlySpan<IoDescriptor> batch)
+    {
+        foreach (ref readonly var io in batch)
+        {
+            if (io.Size <= 0 || io.Size > _blockSize || io.Offset < 0 || io.Offset + io.Size > _fileSize || io.ThinkTimeTicks < 0)
+            {
+                throw new InvalidOperationException(
+                    $"Generator {_generatorName} produced an invalid IO: offset {io.Offset}, size {io.Size}, think time {io.ThinkTimeTicks} " +
+                    $"(sizes must be 1-{_blockSize} bytes and IOs within the {_fileSize}-byte file).");
+            }
+
+            if (io.Offset % _alignment != 0 || io.Size % _alignment != 0)
+            {
+                throw new InvalidOperationException(
+                    $"Generator {_generatorName} produced an unaligned IO: offset {io.Offset}, size {io.Size} " +
+                    $"(unbuffered IO needs offsets and sizes that are multiples of the {_alignment}-byte sector size).");
+            }
+        }
+    }
+}
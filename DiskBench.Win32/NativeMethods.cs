@@ -36,10 +36,16 @@ internal static partial class NativeMethods
     internal const int ERROR_HANDLE_EOF = 38;
     internal const int ERROR_OPERATION_ABORTED = 995;
     internal const int ERROR_SUCCESS = 0;
+    internal const int ERROR_CRC = 23;
+    internal const int ERROR_INSUFFICIENT_BUFFER = 122;
+    internal const int ERROR_INVALID_FUNCTION = 1;
+    internal const int ERROR_NOT_SAME_DEVICE = 17;
+    internal const int ERROR_NOT_SUPPORTED = 50;
 
     // IOCTL codes
     internal const uint IOCTL_DISK_GET_DRIVE_GEOMETRY_EX = 0x000700A0;
     internal const uint IOCTL_STORAGE_QUERY_PROPERTY = 0x002D1400;
+    internal const uint FSCTL_DUPLICATE_EXTENTS_TO_FILE = 0x00098344;
 
     // Invalid handle value
     internal static readonly IntPtr INVALID_HANDLE_VALUE = new(-1);
@@ -120,6 +126,9 @@ internal static partial class NativeMethods
     [return: MarshalAs(UnmanagedType.Bool)]
     internal static partial bool CancelIoEx(IntPtr hFile, IntPtr lpOverlapped);
 
+    [LibraryImport("ntdll.dll")]
+    internal static partial uint RtlNtStatusToDosError(uint status);
+
     [LibraryImport("kernel32.dll", SetLastError = true)]
     [return: MarshalAs(UnmanagedType.Bool)]
     internal static partial bool SetFilePointerEx(
@@ -159,12 +168,24 @@ internal static partial class NativeMethods
     [LibraryImport("kernel32.dll", SetLastError = true)]
     internal static partial uint GetLastError();
 
-    [LibraryImport("kernel32.dll")]
-    internal static partial nuint SetThreadAffinityMask(IntPtr hThread, nuint dwThreadAffinityMask);
-
     [LibraryImport("kernel32.dll")]
     internal static partial IntPtr GetCurrentThread();
 
+    [LibraryImport("kernel32.dll", SetLastError = true)]
+    [return: MarshalAs(UnmanagedType.Bool)]
+    internal static partial bool SetThreadGroupAffinity(IntPtr hThread, in GroupAffinity groupAffinity, out GroupAffinity previousGroupAffinity);
+
+    [LibraryImport("kernel32.dll", SetLastError = true)]
+    [return: MarshalAs(UnmanagedType.Bool)]
+    internal static partial bool GetLogicalProcessorInformationEx(int relationshipType, IntPtr buffer, ref uint returnedLength);
+
+    // LOGICAL_PROCESSOR_RELATIONSHIP
+    internal const int RelationProcessorCore = 0;
+    internal const int RelationNumaNode = 1;
+    internal const int RelationCache = 2;
+    internal const int RelationProcessorPackage = 3;
+    internal const int RelationAll = 0xffff;
+
     [LibraryImport("kernel32.dll", SetLastError = true)]
     [return: MarshalAs(UnmanagedType.Bool)]
     internal static partial bool SetThreadPriority(IntPtr hThread, int nPriority);
@@ -172,6 +193,28 @@ internal static partial class NativeMethods
     internal const int THREAD_PRIORITY_HIGHEST = 2;
     internal const int THREAD_PRIORITY_TIME_CRITICAL = 15;
 
+    // CreateWaitableTimerEx
+    internal const uint CREATE_WAITABLE_TIMER_HIGH_RESOLUTION = 0x00000002;
+    internal const uint TIMER_ALL_ACCESS = 0x001F0003;
+    internal const uint INFINITE = 0xFFFFFFFF;
+    internal const uint WAIT_OBJECT_0 = 0;
+
+    [LibraryImport("kernel32.dll", SetLastError = true, StringMarshalling = StringMarshalling.Utf16)]
+    internal static partial IntPtr CreateWaitableTimerExW(IntPtr lpTimerAttributes, string? lpTimerName, uint dwFlags, uint dwDesiredAccess);
+
+    [LibraryImport("kernel32.dll", SetLastError = true)]
+    [return: MarshalAs(UnmanagedType.Bool)]
+    internal static partial bool SetWaitableTimer(
+        IntPtr hTimer,
+        in long lpDueTime,
+        int lPeriod,
+        IntPtr pfnCompletionRoutine,
+        IntPtr lpArgToCompletionRoutine,
+        [MarshalAs(UnmanagedType.Bool)] bool fResume);
+
+    [LibraryImport("kernel32.dll", SetLastError = true)]
+    internal static partial uint WaitForSingleObject(IntPtr hHandle, uint dwMilliseconds);
+
     [LibraryImport("kernel32.dll", SetLastError = true, StringMarshalling = StringMarshalling.Utf16)]
     internal static partial uint GetDiskFreeSpaceW(
         string lpRootPathName,
@@ -187,6 +230,110 @@ internal static partial class NativeMethods
         string lpszFileName,
         [Out] char[] lpszVolumePathName,
         uint cchBufferLength);
+
+    // Performance Data Helper
+    internal const uint PDH_FMT_LARGE = 0x00000400;
+
+    [LibraryImport("pdh.dll", StringMarshalling = StringMarshalling.Utf16)]
+    internal static partial uint PdhOpenQueryW(string? szDataSource, IntPtr dwUserData, out IntPtr phQuery);
+
+    [LibraryImport("pdh.dll", StringMarshalling = StringMarshalling.Utf16)]
+    internal static partial uint PdhAddEnglishCounterW(IntPtr hQuery, string szFullCounterPath, IntPtr dwUserData, out IntPtr phCounter);
+
+    [LibraryImport("pdh.dll")]
+    internal static partial uint PdhCollectQueryData(IntPtr hQuery);
+
+    [LibraryImport("pdh.dll")]
+    internal static partial uint PdhGetFormattedCounterValue(IntPtr hCounter, uint dwFormat, out uint lpdwType, out PdhFmtCounterValue pValue);
+
+    [LibraryImport("pdh.dll")]
+    internal static partial uint PdhCloseQuery(IntPtr hQuery);
+
+    // Memory status
+    [LibraryImport("kernel32.dll", SetLastError = true)]
+    [return: MarshalAs(UnmanagedType.Bool)]
+    internal static partial bool GlobalMemoryStatusEx(ref MemoryStatusEx lpBuffer);
+
+    [LibraryImport("kernel32.dll", EntryPoint = "K32GetPerformanceInfo", SetLastError = true)]
+    [return: MarshalAs(UnmanagedType.Bool)]
+    internal static partial bool GetPerformanceInfo(out PerformanceInformation pPerformanceInformation, uint cb);
+}
+
+/// <summary>
+/// PDH_FMT_COUNTERVALUE structure with the 64-bit integer member of its value union.
+/// </summary>
+[StructLayout(LayoutKind.Explicit)]
+internal struct PdhFmtCounterValue
+{
+    [FieldOffset(0)]
+    public uint CStatus;
+
+    [FieldOffset(8)]
+    public long LargeValue;
+}
+
+/// <summary>
+/// MEMORYSTATUSEX structure. Length must be set before the call.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct MemoryStatusEx
+{
+    public uint Length;
+    public uint MemoryLoad;
+    public ulong TotalPhys;
+    public ulong AvailPhys;
+    public ulong TotalPageFile;
+    public ulong AvailPageFile;
+    public ulong TotalVirtual;
+    public ulong AvailVirtual;
+    public ulong AvailExtendedVirtual;
+}
+
+/// <summary>
+/// PERFORMANCE_INFORMATION structure. Memory figures are in pages.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct PerformanceInformation
+{
+    public uint Size;
+    public nuint CommitTotal;
+    public nuint CommitLimit;
+    public nuint CommitPeak;
+    public nuint PhysicalTotal;
+    public nuint PhysicalAvailable;
+    public nuint SystemCache;
+    public nuint KernelTotal;
+    public nuint KernelPaged;
+    public nuint KernelNonpaged;
+    public nuint PageSize;
+    public uint HandleCount;
+    public uint ProcessCount;
+    public uint ThreadCount;
+}
+
+/// <summary>
+/// DUPLICATE_EXTENTS_DATA structure for FSCTL_DUPLICATE_EXTENTS_TO_FILE (block cloning).
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct DuplicateExtentsData
+{
+    public IntPtr FileHandle;
+    public long SourceFileOffset;
+    public long TargetFileOffset;
+    public long ByteCount;
+}
+
+/// <summary>
+/// GROUP_AFFINITY structure: a processor mask within one processor group.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+internal struct GroupAffinity
+{
+    public nuint Mask;
+    public ushort Group;
+    public ushort Reserved0;
+    public ushort Reserved1;
+    public ushort Reserved2;
 }
 
 /// <summary>
@@ -197,6 +344,8 @@ internal struct OverlappedEntry
 {
     public nuint CompletionKey;
     public IntPtr Overlapped;
+
+    // Reserved: read the completion status from the OVERLAPPED (IoSlot.CompletionError)
     public nuint Internal;
     public uint NumberOfBytesTransferred;
 }
@@ -7,10 +7,15 @@ namespace DiskBench.Win32;
 /// Generates file offsets for sequential and random access patterns.
 /// Offsets are precomputed to avoid RNG in the hot path.
 /// </summary>
-public sealed class OffsetGenerator
+public sealed class OffsetGenerator : IOffsetSource
 {
     private readonly long[] _offsets;
     private readonly int _count;
+    private readonly long _regionOffset;
+    private readonly long _regionEnd;
+    private readonly int _blockSize;
+    private readonly bool _refillOnWrap;
+    private long _nextSequentialOffset;
     private int _currentIndex;
 
     /// <summary>
@@ -51,20 +56,17 @@ public sealed class OffsetGenerator
 
         _count = precomputeCount;
         _offsets = new long[_count];
+        _regionOffset = regionOffset;
+        _regionEnd = regionOffset + effectiveLength;
+        _blockSize = blockSize;
 
         if (pattern == AccessPattern.Sequential)
         {
-            // Sequential: cycle through file
-            long currentOffset = regionOffset;
-            for (int i = 0; i < _count; i++)
-            {
-                _offsets[i] = currentOffset;
-                currentOffset += blockSize;
-                if (currentOffset + blockSize > regionOffset + effectiveLength)
-                {
-                    currentOffset = regionOffset;
-                }
-            }
+            // Sequential: cycle through the region. When the table does not hold a whole number of
+            // passes, it is refilled with the continuation on wrap so every block is still visited.
+            _refillOnWrap = _count % maxBlocks != 0;
+            _nextSequentialOffset = regionOffset;
+            FillSequential();
         }
         else
         {
@@ -86,8 +88,24 @@ public sealed class OffsetGenerator
     public long GetNextOffset()
     {
         int index = _currentIndex;
+        long offset = _offsets[index];
         _currentIndex = (index + 1) & (_count - 1); // Assumes count is power of 2
-        return _offsets[index];
+
+        if (_currentIndex == 0 && _refillOnWrap)
+        {
+            FillSequential();
+        }
+
+        return offset;
+    }
+
+    /// <inheritdoc />
+    public void Fill(Span<IoDescriptor> batch)
+    {
+        for (int i = 0; i < batch.Length; i++)
+        {
+            batch[i].Offset = GetNextOffset();
+        }
     }
 
     /// <summary>
@@ -105,6 +123,28 @@ public sealed class OffsetGenerator
     public void Reset()
     {
         _currentIndex = 0;
+
+        if (_refillOnWrap)
+        {
+            _nextSequentialOffset = _regionOffset;
+            FillSequential();
+        }
+    }
+
+    private void FillSequential()
+    {
+        long offset = _nextSequentialOffset;
+        for (int i = 0; i < _count; i++)
+        {
+            _offsets[i] = offset;
+            offset += _blockSize;
+            if (offset + _blockSize > _regionEnd)
+            {
+                offset = _regionOffset;
+            }
+        }
+
+        _nextSequentialOffset = offset;
     }
 
     /// <summary>
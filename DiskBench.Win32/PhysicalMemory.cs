@@ -0,0 +1,39 @@
+using System.ComponentModel;
+using System.Runtime.InteropServices;
+
+namespace DiskBench.Win32;
+
+/// <summary>
+/// System physical memory figures.
+/// </summary>
+public static class PhysicalMemory
+{
+    /// <summary>
+    /// Gets the physical memory available without paging anything out: free, zeroed and standby
+    /// (cached) pages. A memory balloon uses this to leave a fixed amount for the standby list.
+    /// </summary>
+    public static long GetAvailableBytes()
+    {
+        var status = new MemoryStatusEx { Length = (uint)Marshal.SizeOf<MemoryStatusEx>() };
+        if (!NativeMethods.GlobalMemoryStatusEx(ref status))
+        {
+            throw new Win32Exception(Marshal.GetLastWin32Error(), "GlobalMemoryStatusEx failed.");
+        }
+
+        return (long)status.AvailPhys;
+    }
+
+    /// <summary>
+    /// Gets the size of the system file cache, including the standby list: the Windows counterpart
+    /// of Cached in /proc/meminfo.
+    /// </summary>
+    public static long GetSystemCacheBytes()
+    {
+        if (!NativeMethods.GetPerformanceInfo(out var info, (uint)Marshal.SizeOf<PerformanceInformation>()))
+        {
+            throw new Win32Exception(Marshal.GetLastWin32Error(), "GetPerformanceInfo failed.");
+        }
+
+        return (long)info.SystemCache * (long)info.PageSize;
+    }
+}
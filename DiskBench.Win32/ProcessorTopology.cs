@@ -0,0 +1,154 @@
+using System.Runtime.InteropServices;
+using DiskBench.Core;
+
+namespace DiskBench.Win32;
+
+/// <summary>
+/// Reads CPU topology with GetLogicalProcessorInformationEx and pins threads across processor groups.
+/// Processor ids are group * 64 + index within the group, so they stay unique beyond 64 processors.
+/// </summary>
+internal static class ProcessorTopology
+{
+    private const int ProcessorsPerGroup = 64;
+
+    /// <summary>
+    /// Reads the topology of the active processors, or null if it cannot be queried.
+    /// </summary>
+    public static unsafe CpuTopology? Read()
+    {
+        uint length = 0;
+        NativeMethods.GetLogicalProcessorInformationEx(NativeMethods.RelationAll, IntPtr.Zero, ref length);
+        if (Marshal.GetLastWin32Error() != NativeMethods.ERROR_INSUFFICIENT_BUFFER || length == 0)
+        {
+            return null;
+        }
+
+        var buffer = Marshal.AllocHGlobal((int)length);
+        try
+        {
+            if (!NativeMethods.GetLogicalProcessorInformationEx(NativeMethods.RelationAll, buffer, ref length))
+            {
+                return null;
+            }
+
+            var core = new Dictionary<int, int>();
+            var package = new Dictionary<int, int>();
+            var node = new Dictionary<int, int>();
+            var l3 = new Dictionary<int, int>();
+            int packageCount = 0;
+
+            byte* entry = (byte*)buffer;
+            byte* end = entry + length;
+            while (entry < end)
+            {
+                int relationship = *(int*)entry;
+                uint size = *(uint*)(entry + 4);
+                byte* body = entry + 8;
+
+                switch (relationship)
+                {
+                    case NativeMethods.RelationProcessorCore:
+                        // PROCESSOR_RELATIONSHIP: Flags, EfficiencyClass, Reserved[20], GroupCount, GroupMask[]
+                        Assign(core, ReadMasks(body + 24, *(ushort*)(body + 22)), ids => ids.Min());
+                        break;
+                    case NativeMethods.RelationProcessorPackage:
+                        int index = packageCount++;
+                        Assign(package, ReadMasks(body + 24, *(ushort*)(body + 22)), _ => index);
+                        break;
+                    case NativeMethods.RelationNumaNode:
+                        // NUMA_NODE_RELATIONSHIP: NodeNumber, Reserved[18], GroupCount, GroupMask[]
+                        int nodeNumber = *(int*)body;
+                        Assign(node, ReadMasks(body + 24, *(ushort*)(body + 22)), _ => nodeNumber);
+                        break;
+                    case NativeMethods.RelationCache when *body == 3:
+                        // CACHE_RELATIONSHIP: Level, Associativity, LineSize, CacheSize, Type, Reserved[18], GroupCount, GroupMask[]
+                        Assign(l3, ReadMasks(body + 32, *(ushort*)(body + 30)), ids => ids.Min());
+                        break;
+                }
+
+                entry += size;
+            }
+
+            if (core.Count == 0)
+            {
+                return null;
+            }
+
+            return new CpuTopology
+            {
+                Processors = [.. core.Keys.Order().Select(id => new LogicalProcessor
+                {
+                    Id = id,
+                    Package = package.GetValueOrDefault(id),
+                    Core = core[id],
+                    NumaNode = node.GetValueOrDefault(id),
+                    L3Domain = l3.GetValueOrDefault(id, -1)
+                })]
+            };
+        }
+        finally
+        {
+            Marshal.FreeHGlobal(buffer);
+        }
+    }
+
+    /// <summary>
+    /// Pins the current thread to one processor and returns its previous affinity.
+    /// </summary>
+    /// <param name="processorId">Processor id (group * 64 + index within the group).</param>
+    /// <param name="previous">The thread's affinity before pinning.</param>
+    public static bool PinCurrentThread(int processorId, out GroupAffinity previous)
+    {
+        var affinity = new GroupAffinity
+        {
+            Group = (ushort)(processorId / ProcessorsPerGroup),
+            Mask = (nuint)1 << (processorId % ProcessorsPerGroup)
+        };
+
+        return NativeMethods.SetThreadGroupAffinity(NativeMethods.GetCurrentThread(), affinity, out previous);
+    }
+
+    /// <summary>
+    /// Restores an affinity returned by <see cref="PinCurrentThread"/>.
+    /// </summary>
+    /// <param name="previous">Affinity to restore.</param>
+    public static void RestoreCurrentThread(in GroupAffinity previous)
+    {
+        NativeMethods.SetThreadGroupAffinity(NativeMethods.GetCurrentThread(), previous, out _);
+    }
+
+    private static unsafe List<int> ReadMasks(byte* masks, ushort groupCount)
+    {
+        // Older Windows versions leave GroupCount zero and report a single GroupMask
+        int count = Math.Max((int)groupCount, 1);
+        var ids = new List<int>();
+
+        for (int i = 0; i < count; i++)
+        {
+            var affinity = ((GroupAffinity*)masks)[i];
+            ulong mask = affinity.Mask;
+            while (mask != 0)
+            {
+                int bit = System.Numerics.BitOperations.TrailingZeroCount(mask);
+                ids.Add(affinity.Group * ProcessorsPerGroup + bit);
+                mask &= mask - 1;
+            }
+        }
+
+        return ids;
+    }
+
+    private static void Assign(Dictionary<int, int> map, List<int> ids, Func<List<int>, int> value)
+    {
+        if (ids.Count == 0)
+        {
+            return;
+        }
+
+        int v = value(ids);
+        foreach (var id in ids)
+        {
+            map[id] = v;
+        }
+    }
+}
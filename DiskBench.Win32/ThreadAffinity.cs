@@ -0,0 +1,17 @@
+namespace DiskBench.Win32;
+
+/// <summary>
+/// Pins threads to processors across processor groups.
+/// </summary>
+public static class ThreadAffinity
+{
+    /// <summary>
+    /// Pins the calling thread to one processor (id = group * 64 + index within the group).
+    /// </summary>
+    /// <param name="processorId">Processor id.</param>
+    /// <returns>False if the processor does not exist or the affinity could not be set.</returns>
+    public static bool PinCurrentThread(int processorId)
+    {
+        return processorId >= 0 && ProcessorTopology.PinCurrentThread(processorId, out _);
+    }
+}
@@ -0,0 +1,287 @@
+using System.ComponentModel;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+
+namespace DiskBench.Win32;
+
+/// <summary>
+/// Engine-specific copy strategies: unbuffered overlapped copies through an IO slot table,
+/// and block cloning (FSCTL_DUPLICATE_EXTENTS_TO_FILE) on volumes that support it (ReFS, Dev Drive).
+/// </summary>
+internal static class WindowsFileCopy
+{
+    // DUPLICATE_EXTENTS_DATA byte counts must stay below 4 GB per call
+    private const long MaxCloneBytes = 1L << 30;
+
+    private const uint FILE_BEGIN = 0;
+    private const int WAIT_TIMEOUT = 258;
+
+    /// <summary>
+    /// Copies with unbuffered overlapped IO. Each slot reads a block and writes it as soon as the read
+    /// completes, then moves on to the next unread block, so reads and writes overlap at any queue depth.
+    /// </summary>
+    /// <returns>Bytes copied.</returns>
+    public static long CopyUnbuffered(string source, string destination, int blockSize, int queueDepth, CancellationToken cancellationToken)
+    {
+        int alignment = Math.Max(DiskInfo.GetSectorSize(source).LogicalSectorSize, DiskInfo.GetSectorSize(destination).LogicalSectorSize);
+        if (blockSize % alignment != 0)
+        {
+            throw new ArgumentException($"Block size {blockSize} is not a multiple of the sector size ({alignment}).", nameof(blockSize));
+        }
+
+        var sourceHandle = Open(source, NativeMethods.GENERIC_READ, NativeMethods.OPEN_EXISTING,
+            NativeMethods.FILE_FLAG_OVERLAPPED | NativeMethods.FILE_FLAG_NO_BUFFERING | NativeMethods.FILE_FLAG_SEQUENTIAL_SCAN);
+        var destinationHandle = IntPtr.Zero;
+        var iocpHandle = IntPtr.Zero;
+        try
+        {
+            destinationHandle = Open(destination, NativeMethods.GENERIC_WRITE, NativeMethods.CREATE_ALWAYS,
+                NativeMethods.FILE_FLAG_OVERLAPPED | NativeMethods.FILE_FLAG_NO_BUFFERING);
+
+            if (!NativeMethods.GetFileSizeEx(sourceHandle, out long length))
+            {
+                throw new Win32Exception(Marshal.GetLastWin32Error(), "Failed to get source file size.");
+            }
+
+            // Size the destination up front so writes do not extend it one block at a time
+            long alignedLength = (length + alignment - 1) / alignment * alignment;
+            SetLength(destinationHandle, alignedLength);
+            _ = NativeMethods.SetFileValidData(destinationHandle, alignedLength);
+
+            iocpHandle = NativeMethods.CreateIoCompletionPort(sourceHandle, IntPtr.Zero, 0, 1);
+            if (iocpHandle == IntPtr.Zero ||
+                NativeMethods.CreateIoCompletionPort(destinationHandle, iocpHandle, 1, 1) == IntPtr.Zero)
+            {
+                throw new Win32Exception(Marshal.GetLastWin32Error(), "Failed to create IO completion port.");
+            }
+
+            long copied = RunCopy(sourceHandle, destinationHandle, iocpHandle, length, alignedLength, blockSize, queueDepth, alignment, cancellationToken);
+
+            if (alignedLength != length)
+            {
+                SetLength(destinationHandle, length);
+            }
+
+            return copied;
+        }
+        finally
+        {
+            if (iocpHandle != IntPtr.Zero)
+            {
+                NativeMethods.CloseHandle(iocpHandle);
+            }
+
+            if (destinationHandle != IntPtr.Zero)
+            {
+                NativeMethods.CloseHandle(destinationHandle);
+            }
+
+            NativeMethods.CloseHandle(sourceHandle);
+        }
+    }
+
+    /// <summary>
+    /// Clones the source's extents into the destination. Throws <see cref="NotSupportedException"/>
+    /// when the volume cannot clone (e.g., NTFS) or the files are on different volumes.
+    /// </summary>
+    /// <returns>Bytes cloned.</returns>
+    public static unsafe long Clone(string source, string destination, CancellationToken cancellationToken)
+    {
+        var sourceHandle = Open(source, NativeMethods.GENERIC_READ, NativeMethods.OPEN_EXISTING, 0);
+        try
+        {
+            var destinationHandle = Open(destination, NativeMethods.GENERIC_READ | NativeMethods.GENERIC_WRITE, NativeMethods.CREATE_ALWAYS, 0);
+            try
+            {
+                if (!NativeMethods.GetFileSizeEx(sourceHandle, out long length))
+                {
+                    throw new Win32Exception(Marshal.GetLastWin32Error(), "Failed to get source file size.");
+                }
+
+                SetLength(destinationHandle, length);
+                long cluster = DiskInfo.GetClusterSize(destination);
+
+                for (long offset = 0; offset < length; offset += MaxCloneBytes)
+                {
+                    cancellationToken.ThrowIfCancellationRequested();
+
+                    // Ranges must be cluster-aligned; the last one may run past end of file
+                    long count = Math.Min(MaxCloneBytes, length - offset);
+                    var data = new DuplicateExtentsData
+                    {
+                        FileHandle = sourceHandle,
+                        SourceFileOffset = offset,
+                        TargetFileOffset = offset,
+                        ByteCount = (count + cluster - 1) / cluster * cluster
+                    };
+
+                    if (!NativeMethods.DeviceIoControl(
+                        destinationHandle,
+                        NativeMethods.FSCTL_DUPLICATE_EXTENTS_TO_FILE,
+                        (IntPtr)(&data),
+                        (uint)sizeof(DuplicateExtentsData),
+                        IntPtr.Zero,
+                        0,
+                        out _,
+                        IntPtr.Zero))
+                    {
+                        int error = Marshal.GetLastWin32Error();
+                        if (error is NativeMethods.ERROR_INVALID_FUNCTION or NativeMethods.ERROR_NOT_SUPPORTED or NativeMethods.ERROR_NOT_SAME_DEVICE)
+                        {
+                            throw new NotSupportedException($"Block cloning is not available for these files (error {error}).");
+                        }
+
+                        throw new Win32Exception(error, "FSCTL_DUPLICATE_EXTENTS_TO_FILE failed.");
+                    }
+                }
+
+                return length;
+            }
+            finally
+            {
+                NativeMethods.CloseHandle(destinationHandle);
+            }
+        }
+        finally
+        {
+            NativeMethods.CloseHandle(sourceHandle);
+        }
+    }
+
+    private static long RunCopy(
+        IntPtr sourceHandle,
+        IntPtr destinationHandle,
+        IntPtr iocpHandle,
+        long length,
+        long alignedLength,
+        int blockSize,
+        int queueDepth,
+        int alignment,
+        CancellationToken cancellationToken)
+    {
+        using var slots = new IoSlotTable(queueDepth, blockSize, alignment);
+        var completionEntries = new OverlappedEntry[queueDepth];
+        long nextOffset = 0;
+        long copied = 0;
+
+        try
+        {
+            for (int i = 0; i < slots.Count; i++)
+            {
+                IssueRead(slots[i]);
+            }
+
+            while (slots.PendingCount > 0)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+
+                if (!NativeMethods.GetQueuedCompletionStatusEx(iocpHandle, completionEntries, (uint)queueDepth, out uint numCompleted, 100, false))
+                {
+                    int error = Marshal.GetLastWin32Error();
+                    if (error == WAIT_TIMEOUT)
+                    {
+                        continue;
+                    }
+
+                    throw new Win32Exception(error, "GetQueuedCompletionStatusEx failed.");
+                }
+
+                for (int i = 0; i < numCompleted; i++)
+                {
+                    ref var entry = ref completionEntries[i];
+                    if (!slots.TryGetSlot(entry.Overlapped, out var slot) || !slot.IsPending)
+                    {
+                        continue;
+                    }
+
+                    slot.IsPending = false;
+                    int errorCode = slot.CompletionError;
+                    int bytes = (int)entry.NumberOfBytesTransferred;
+
+                    if (!slot.IsWrite && errorCode == NativeMethods.ERROR_HANDLE_EOF)
+                    {
+                        continue;
+                    }
+
+                    if (errorCode != 0)
+                    {
+                        throw new Win32Exception(errorCode, $"{(slot.IsWrite ? "Write" : "Read")} at offset {slot.Offset} failed.");
+                    }
+
+                    if (slot.IsWrite)
+                    {
+                        copied += Math.Min(bytes, length - slot.Offset);
+                        IssueRead(slot);
+                    }
+                    else if (bytes > 0)
+                    {
+                        // The tail read may be short: write it rounded up to the sector size, then truncate
+                        int writeSize = (bytes + alignment - 1) / alignment * alignment;
+                        slot.Configure(slot.Offset, writeSize, isWrite: true, Stopwatch.GetTimestamp());
+                        Submit(slot, destinationHandle);
+                    }
+                }
+            }
+        }
+        finally
+        {
+            if (slots.PendingCount > 0)
+            {
+                // Buffers must outlive every IO that references them
+                WindowsIoEngine.DrainPendingIos([sourceHandle, destinationHandle], iocpHandle, slots, completionEntries, null, CancellationToken.None);
+            }
+        }
+
+        return copied;
+
+        void IssueRead(IoSlot slot)
+        {
+            if (nextOffset >= alignedLength)
+            {
+                return;
+            }
+
+            int size = (int)Math.Min(blockSize, alignedLength - nextOffset);
+            slot.Configure(nextOffset, size, isWrite: false, Stopwatch.GetTimestamp());
+            nextOffset += size;
+            Submit(slot, sourceHandle);
+        }
+    }
+
+    private static void Submit(IoSlot slot, IntPtr fileHandle)
+    {
+        int error = WindowsIoEngine.SubmitIo(slot, fileHandle);
+        if (error != 0)
+        {
+            throw new Win32Exception(error, $"{(slot.IsWrite ? "Write" : "Read")} at offset {slot.Offset} failed.");
+        }
+    }
+
+    /// <summary>
+    /// Purges a file's pages from the system cache. Opening a file without buffering makes the cache
+    /// manager flush and purge the file's cached data, provided no mapped view keeps it alive.
+    /// </summary>
+    public static void EvictFromCache(string path)
+    {
+        NativeMethods.CloseHandle(Open(path, NativeMethods.GENERIC_READ, NativeMethods.OPEN_EXISTING, NativeMethods.FILE_FLAG_NO_BUFFERING));
+    }
+
+    private static IntPtr Open(string path, uint access, uint disposition, uint flags)
+    {
+        var handle = NativeMethods.CreateFileW(path, access, NativeMethods.FILE_SHARE_READ, IntPtr.Zero, disposition, flags, IntPtr.Zero);
+        if (handle == NativeMethods.INVALID_HANDLE_VALUE)
+        {
+            throw new Win32Exception(Marshal.GetLastWin32Error(), $"Failed to open file: {path}");
+        }
+
+        return handle;
+    }
+
+    private static void SetLength(IntPtr handle, long length)
+    {
+        if (!NativeMethods.SetFilePointerEx(handle, length, out _, FILE_BEGIN) || !NativeMethods.SetEndOfFile(handle))
+        {
+            throw new Win32Exception(Marshal.GetLastWin32Error(), "Failed to set file length.");
+        }
+    }
+}
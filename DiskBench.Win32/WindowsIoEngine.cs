@@ -10,7 +10,7 @@ namespace DiskBench.Win32;
 /// Windows IO engine using overlapped I/O and IO Completion Ports (IOCP).
 /// Provides high-performance, low-overhead disk benchmarking.
 /// </summary>
-public sealed class WindowsIoEngine : IBenchmarkEngine
+public sealed class WindowsIoEngine : IBenchmarkEngine, IFileCopyEngine
 {
     private readonly WindowsIoEngineOptions _options;
     private bool _disposed;
@@ -43,11 +43,12 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
         bool wasReused = false;
         bool usedSetValidData = false;
 
-        // Check if file exists and matches size
+        // Check if file exists and matches size (and, for generated content, its manifest)
         if (spec.ReuseIfExists && File.Exists(spec.FilePath))
         {
             var existingInfo = new FileInfo(spec.FilePath);
-            if (existingInfo.Length == spec.FileSize)
+            if (existingInfo.Length == spec.FileSize &&
+                (spec.Content == null || PrepareManifest.Matches(spec.FilePath, spec.FileSize, spec.Content)))
             {
                 wasReused = true;
                 return new PrepareResult
@@ -58,6 +59,7 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
                     LogicalSectorSize = logicalSectorSize,
                     WasReused = true,
                     UsedSetValidData = false,
+                    Content = spec.Content,
                     Warnings = warnings.Count > 0 ? warnings : null
                 };
             }
@@ -70,6 +72,9 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             Directory.CreateDirectory(directory);
         }
 
+        // The file is about to be rewritten, so whatever its manifest recorded no longer holds
+        PrepareManifest.Delete(spec.FilePath);
+
         // Create/resize the file
         await Task.Run(() =>
         {
@@ -100,8 +105,8 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
                     throw new Win32Exception(Marshal.GetLastWin32Error(), "Failed to set end of file.");
                 }
 
-                // Try to use SetFileValidData for instant allocation
-                if (spec.UseSetValidData)
+                // Try to use SetFileValidData for instant allocation (pointless when content is written anyway)
+                if (spec.UseSetValidData && spec.Content == null)
                 {
                     if (NativeMethods.SetFileValidData(handle, spec.FileSize))
                     {
@@ -119,7 +124,12 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             }
         }, cancellationToken).ConfigureAwait(false);
 
-        if (!usedSetValidData)
+        if (spec.Content != null)
+        {
+            await MaterializeFileAsync(spec, progress, cancellationToken).ConfigureAwait(false);
+            PrepareManifest.Write(spec.FilePath, spec.FileSize, spec.Content);
+        }
+        else if (!usedSetValidData)
         {
             warnings.Add("SetFileValidData unavailable. Materializing file with writes to avoid sparse zero-read artifacts.");
             await MaterializeFileAsync(spec, progress, cancellationToken).ConfigureAwait(false);
@@ -133,6 +143,7 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             LogicalSectorSize = logicalSectorSize,
             WasReused = wasReused,
             UsedSetValidData = usedSetValidData,
+            Content = spec.Content,
             Warnings = warnings.Count > 0 ? warnings : null
         };
     }
@@ -143,12 +154,24 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
         CancellationToken cancellationToken)
     {
         const int chunkSize = 4 * 1024 * 1024;
-        var buffer = new byte[chunkSize];
         var pattern = spec.FillPattern;
+        var generator = spec.Content != null ? new ContentGenerator(spec.Content, spec.FileSize) : null;
 
-        if (pattern is { Count: > 0 })
+        // Generated content differs chunk to chunk, so the next chunk is generated while the last is written;
+        // chunks stay whole content blocks so every chunk starts on a block boundary
+        byte[][] buffers;
+        if (generator != null)
         {
-            FillPattern(buffer, pattern);
+            int bufferSize = Math.Max(1, chunkSize / spec.Content!.BlockSize) * spec.Content.BlockSize;
+            buffers = [new byte[bufferSize], new byte[bufferSize]];
+        }
+        else
+        {
+            buffers = [new byte[chunkSize]];
+            if (pattern is { Count: > 0 })
+            {
+                FillPattern(buffers[0], pattern);
+            }
         }
 
         await using var stream = new FileStream(
@@ -159,27 +182,24 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             chunkSize,
             FileOptions.Asynchronous | FileOptions.SequentialScan);
 
-        long remaining = spec.FileSize;
-        while (remaining > 0)
+        var pending = Task.CompletedTask;
+        long written = 0;
+        for (int chunk = 0; written < spec.FileSize; chunk++)
         {
             cancellationToken.ThrowIfCancellationRequested();
 
-            int bytesToWrite = (int)Math.Min(remaining, buffer.Length);
-            if (pattern is { Count: > 0 } && bytesToWrite != buffer.Length)
-            {
-                FillPattern(buffer.AsSpan(0, bytesToWrite), pattern);
-            }
+            var buffer = buffers[chunk % buffers.Length];
+            int bytesToWrite = (int)Math.Min(spec.FileSize - written, buffer.Length);
+            generator?.Fill(buffer.AsSpan(0, bytesToWrite), written);
 
-            await stream.WriteAsync(buffer.AsMemory(0, bytesToWrite), cancellationToken).ConfigureAwait(false);
-            remaining -= bytesToWrite;
+            await pending.ConfigureAwait(false);
+            pending = stream.WriteAsync(buffer.AsMemory(0, bytesToWrite), cancellationToken).AsTask();
+            written += bytesToWrite;
 
-            if (progress != null)
-            {
-                var written = spec.FileSize - remaining;
-                progress.Report((double)written / spec.FileSize);
-            }
+            progress?.Report((double)written / spec.FileSize);
         }
 
+        await pending.ConfigureAwait(false);
         await stream.FlushAsync(cancellationToken).ConfigureAwait(false);
     }
 
@@ -218,6 +238,9 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             }
         }
 
+        // Writes replace prepared content with write-buffer data, so the files no longer match their manifests
+        PrepareManifest.Invalidate(workload);
+
         // Warn about flush policy
         if (workload.FlushPolicy == FlushPolicy.EveryIO)
         {
@@ -245,12 +268,7 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             NativeMethods.SetThreadPriority(NativeMethods.GetCurrentThread(), NativeMethods.THREAD_PRIORITY_HIGHEST);
         }
 
-        // Set thread affinity if configured
-        if (_options.PinToCore >= 0)
-        {
-            nuint affinityMask = 1u << _options.PinToCore;
-            NativeMethods.SetThreadAffinityMask(NativeMethods.GetCurrentThread(), affinityMask);
-        }
+        var placement = PlaceIoThread(workload.FilePath, warnings);
 
         // Open file with appropriate flags
         uint flags = NativeMethods.FILE_FLAG_OVERLAPPED;
@@ -262,24 +280,45 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
         uint access = NativeMethods.GENERIC_READ;
         if (workload.WritePercent > 0) access |= NativeMethods.GENERIC_WRITE;
 
-        var fileHandle = NativeMethods.CreateFileW(
-            workload.FilePath,
-            access,
-            NativeMethods.FILE_SHARE_READ | NativeMethods.FILE_SHARE_WRITE | NativeMethods.FILE_SHARE_DELETE,
-            IntPtr.Zero,
-            NativeMethods.OPEN_EXISTING,
-            flags,
-            IntPtr.Zero);
+        // A file set is opened in full up front, so the trial measures IO with every handle open
+        var filePaths = workload.GetFilePaths();
+        var fileHandles = new IntPtr[filePaths.Count];
+        for (int i = 0; i < filePaths.Count; i++)
+        {
+            fileHandles[i] = NativeMethods.CreateFileW(
+                filePaths[i],
+                access,
+                NativeMethods.FILE_SHARE_READ | NativeMethods.FILE_SHARE_WRITE | NativeMethods.FILE_SHARE_DELETE,
+                IntPtr.Zero,
+                NativeMethods.OPEN_EXISTING,
+                flags,
+                IntPtr.Zero);
+
+            if (fileHandles[i] == NativeMethods.INVALID_HANDLE_VALUE)
+            {
+                int error = Marshal.GetLastWin32Error();
+                for (int j = 0; j < i; j++)
+                {
+                    NativeMethods.CloseHandle(fileHandles[j]);
+                }
+
+                throw new Win32Exception(error, $"Failed to open file: {filePaths[i]}");
+            }
+        }
 
-        if (fileHandle == NativeMethods.INVALID_HANDLE_VALUE)
+        // Pin the IO thread if placed (this is a pool thread, so its affinity is restored afterwards)
+        GroupAffinity previousAffinity = default;
+        bool pinned = placement != null && ProcessorTopology.PinCurrentThread(placement.Cpus[0], out previousAffinity);
+        if (placement != null && !pinned)
         {
-            throw new Win32Exception(Marshal.GetLastWin32Error(), $"Failed to open file: {workload.FilePath}");
+            warnings.Add($"Failed to pin IO thread to CPU {placement.Cpus[0]} (error {Marshal.GetLastWin32Error()}).");
+            placement = null;
         }
 
         try
         {
             // Create IOCP
-            var iocpHandle = NativeMethods.CreateIoCompletionPort(fileHandle, IntPtr.Zero, 0, 1);
+            var iocpHandle = NativeMethods.CreateIoCompletionPort(fileHandles[0], IntPtr.Zero, 0, 1);
             if (iocpHandle == IntPtr.Zero)
             {
                 throw new Win32Exception(Marshal.GetLastWin32Error(), "Failed to create IO completion port.");
@@ -287,7 +326,15 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
 
             try
             {
-                return RunWithIocp(spec, fileHandle, iocpHandle, totalSlots, alignment, progress, warnings, cancellationToken);
+                for (int i = 1; i < fileHandles.Length; i++)
+                {
+                    if (NativeMethods.CreateIoCompletionPort(fileHandles[i], iocpHandle, (nuint)i, 0) == IntPtr.Zero)
+                    {
+                        throw new Win32Exception(Marshal.GetLastWin32Error(), $"Failed to associate {filePaths[i]} with the IO completion port.");
+                    }
+                }
+
+                return RunWithIocp(spec, fileHandles, iocpHandle, totalSlots, alignment, placement, progress, warnings, cancellationToken);
             }
             finally
             {
@@ -297,21 +344,52 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
         finally
         {
             // Final flush if configured
-            if (workload.FlushPolicy == FlushPolicy.AtEnd && workload.WritePercent > 0)
+            foreach (var fileHandle in fileHandles)
+            {
+                if (workload.FlushPolicy == FlushPolicy.AtEnd && workload.WritePercent > 0)
+                {
+                    NativeMethods.FlushFileBuffers(fileHandle);
+                }
+
+                NativeMethods.CloseHandle(fileHandle);
+            }
+
+            if (pinned)
             {
-                NativeMethods.FlushFileBuffers(fileHandle);
+                ProcessorTopology.RestoreCurrentThread(previousAffinity);
             }
+        }
+    }
 
-            NativeMethods.CloseHandle(fileHandle);
+    private WorkerPlacement? PlaceIoThread(string filePath, List<string> warnings)
+    {
+        if (_options.PinToCore >= 0)
+        {
+            return new WorkerPlacement { Cpus = [_options.PinToCore], Notes = ["Pinned by PinToCore"] };
         }
+
+        if (!_options.AutoPlacement)
+        {
+            return null;
+        }
+
+        var topology = ProcessorTopology.Read();
+        if (topology == null)
+        {
+            warnings.Add("CPU topology unavailable; IO thread not pinned.");
+            return null;
+        }
+
+        return WorkerPlacementPlanner.Plan(topology, workers: 1, SysfsTopology.ReadDevice(filePath));
     }
 
     private static TrialResult RunWithIocp(
         TrialSpec spec,
-        IntPtr fileHandle,
+        IntPtr[] fileHandles,
         IntPtr iocpHandle,
         int totalSlots,
         int alignment,
+        WorkerPlacement? placement,
         IProgress<TrialProgress>? progress,
         List<string> warnings,
         CancellationToken cancellationToken)
@@ -319,34 +397,32 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
         var workload = spec.Workload;
         var ticksPerMicrosecond = LatencyHistogram.TicksPerMicrosecond;
 
-        using var slotPool = new IoSlotPool(totalSlots, workload.BlockSize, alignment);
+        using var slots = new IoSlotTable(totalSlots, workload.BlockSize, alignment);
 
         // Fill write buffers with data
         if (workload.WritePercent > 0)
         {
-            slotPool.FillWriteBuffersRandom(spec.Seed);
+            slots.FillWriteBuffersRandom(spec.Seed);
         }
 
-        // Create offset generator
-        long regionLength = workload.Region.Length > 0 ? workload.Region.Length : (workload.FileSize - workload.Region.Offset);
-        var offsetGen = new OffsetGenerator(
-            workload.Pattern,
-            workload.FileSize,
-            workload.BlockSize,
-            workload.Region.Offset,
-            regionLength,
-            spec.Seed);
-
-        // Determine read/write threshold (0-255 scale for hot path)
-        int writeThreshold = (int)(workload.WritePercent * 2.55);
-        var writeRandom = new Random(spec.Seed + 1);
-        var writeDecisions = new byte[65536];
-        writeRandom.NextBytes(writeDecisions);
-        int writeDecisionIndex = 0;
+        // Offsets and read/write decisions, precomputed from the seed
+        var stream = new IoStreamGenerator(workload, spec.Seed, alignment);
+        var observer = spec.IoObserver;
 
         // Metrics collector
         var maxSeconds = (int)(spec.WarmupDuration.TotalSeconds + spec.MeasuredDuration.TotalSeconds + 10);
-        var metrics = new TrialMetricsCollector(maxSeconds, spec.CollectTimeSeries);
+        var metrics = new TrialMetricsCollector(maxSeconds, spec.CollectTimeSeries, spec.CollectIntervalLatency);
+        var slowIos = spec.CreateSlowIoTracker();
+
+        // Per-IO trace of the measured window, written a compressed block at a time
+        using var trace = spec.TracePath != null ? new IoTraceWriter(spec.TracePath) : null;
+        int traceThread = Environment.CurrentManagedThreadId;
+
+        // Error handling and fault injection
+        var errorPolicy = spec.ErrorPolicy ?? IoErrorPolicy.Abort;
+        var faults = spec.FaultInjector;
+        var errorStats = errorPolicy.ContinueOnError || faults != null ? new IoErrorStats() : null;
+        long stallUntil = 0;
 
         // Allocation tracking
         long allocsBefore = 0;
@@ -363,6 +439,10 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
 
         bool inMeasuredPhase = spec.WarmupDuration == TimeSpan.Zero;
         bool measuredStarted = inMeasuredPhase;
+        if (inMeasuredPhase)
+        {
+            trace?.Start(measuredStart);
+        }
 
         if (inMeasuredPhase && spec.TrackAllocations)
         {
@@ -373,15 +453,17 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
         var completionEntries = new OverlappedEntry[totalSlots];
 
         // Issue initial IOs
-        for (int i = 0; i < totalSlots; i++)
+        for (int i = 0; i < totalSlots && CanIssue(trialStart); i++)
         {
-            var slot = slotPool[i];
-            IssueIo(slot, fileHandle, offsetGen, writeThreshold, writeDecisions, ref writeDecisionIndex);
+            IssueNext(slots[i]);
         }
 
         // Main completion loop
         var lastProgressTime = trialStart;
         var progressIntervalTicks = Stopwatch.Frequency / 4; // 4Hz progress updates
+        var progressLatencyBaseline = progress != null ? LatencyHistogram.CreateIntervalBaseline() : null;
+        var lastStuckScan = trialStart;
+        var stuckScanIntervalTicks = Stopwatch.Frequency / 10;
 
         while (!cancellationToken.IsCancellationRequested)
         {
@@ -396,6 +478,9 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
                 measuredStart = now;
                 measuredEnd = now + measuredDurationTicks;
                 metrics.Reset();
+                slowIos?.ResetCompletions();
+                errorStats?.Reset();
+                trace?.Start(measuredStart);
 
                 if (spec.TrackAllocations)
                 {
@@ -409,13 +494,25 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
                 break;
             }
 
-            // Wait for completions
+            // A trial with an IO limit ends once the last of its IOs is retired
+            if (spec.IoLimit > 0 && stream.Issued >= spec.IoLimit && slots.DeferredCount == 0 && slots.PendingCount == 0)
+            {
+                break;
+            }
+
+            // Deliver held-back completions and retries that are due
+            if (slots.DeferredCount > 0)
+            {
+                RunDeferred(now);
+            }
+
+            // Wait for completions (poll faster while work is deferred)
             bool gotCompletion = NativeMethods.GetQueuedCompletionStatusEx(
                 iocpHandle,
                 completionEntries,
                 (uint)totalSlots,
                 out uint numCompleted,
-                100, // 100ms timeout
+                slots.DeferredCount > 0 ? 1u : 100u, // 100ms timeout
                 false);
 
             if (!gotCompletion)
@@ -423,6 +520,12 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
                 int error = Marshal.GetLastWin32Error();
                 if (error == 258) // WAIT_TIMEOUT
                 {
+                    if (slowIos is { TracksStuck: true })
+                    {
+                        lastStuckScan = Stopwatch.GetTimestamp();
+                        ScanForStuckIos(slots, slowIos, lastStuckScan);
+                    }
+
                     continue;
                 }
                 if (error == NativeMethods.ERROR_OPERATION_ABORTED)
@@ -440,31 +543,72 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
                 ref var entry = ref completionEntries[i];
                 
                 // Find the slot by OVERLAPPED pointer
-                var slot = slotPool.FindByOverlapped(entry.Overlapped);
-                if (slot == null || !slot.IsPending)
+                if (!slots.TryGetSlot(entry.Overlapped, out var slot) || !slot.IsPending)
                 {
                     continue;
                 }
 
                 slot.IsPending = false;
-                long latencyTicks = now - slot.SubmitTimestamp;
                 int bytesTransferred = (int)entry.NumberOfBytesTransferred;
-                if (bytesTransferred <= 0)
+                int errorCode = slot.CompletionError;
+                long holdUntil = 0;
+
+                if (errorCode == 0 && faults != null)
                 {
+                    var fault = faults.NextFault(slot.Offset, slot.Size, slot.IsWrite);
+                    if (fault.Kind != IoFaultKind.None && inMeasuredPhase)
+                    {
+                        errorStats!.RecordInjectedFault();
+                    }
+
+                    switch (fault.Kind)
+                    {
+                        case IoFaultKind.Error:
+                            errorCode = NativeMethods.ERROR_CRC;
+                            break;
+                        case IoFaultKind.LatencySpike:
+                            holdUntil = now + ToTicks(fault.Delay);
+                            break;
+                        case IoFaultKind.Stall:
+                            stallUntil = Math.Max(stallUntil, now + ToTicks(fault.Delay));
+                            break;
+                        case IoFaultKind.ShortTransfer:
+                            bytesTransferred = Math.Min(bytesTransferred, fault.BytesTransferred);
+                            break;
+                        default:
+                            break;
+                    }
+                }
+
+                if (errorCode != 0 && errorCode != NativeMethods.ERROR_OPERATION_ABORTED)
+                {
+                    HandleFailure(slot, errorCode, now);
                     continue;
                 }
 
-                // Record metrics only during measured phase
-                if (inMeasuredPhase)
+                if (bytesTransferred <= 0)
                 {
-                    metrics.RecordCompletion(now, latencyTicks, bytesTransferred, slot.IsWrite);
+                    observer?.OnAbandoned(slot.Offset, slot.IsWrite);
+                    continue;
                 }
 
-                // Re-issue IO if we're still running
-                if (now < measuredEnd)
+                // Hold the completion back while a latency spike or stall is in effect
+                holdUntil = Math.Max(holdUntil, stallUntil);
+                if (holdUntil > now)
                 {
-                    IssueIo(slot, fileHandle, offsetGen, writeThreshold, writeDecisions, ref writeDecisionIndex);
+                    slot.DeferredBytes = bytesTransferred;
+                    Defer(slot, DeferredIoAction.Complete, holdUntil);
+                    continue;
                 }
+
+                CompleteIo(slot, bytesTransferred, now);
+            }
+
+            // Look for IOs that have been in flight too long
+            if (slowIos is { TracksStuck: true } && now - lastStuckScan >= stuckScanIntervalTicks)
+            {
+                lastStuckScan = now;
+                ScanForStuckIos(slots, slowIos, now);
             }
 
             // Report progress
@@ -483,7 +627,9 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
                     CurrentBytesPerSecond = elapsedSeconds > 0 ? metrics.TotalBytes / elapsedSeconds : 0,
                     CurrentIops = elapsedSeconds > 0 ? metrics.TotalOperations / elapsedSeconds : 0,
                     TotalBytes = metrics.TotalBytes,
-                    TotalOperations = metrics.TotalOperations
+                    TotalOperations = metrics.TotalOperations,
+                    InFlightIos = slots.PendingCount,
+                    IntervalP99Us = metrics.Histogram.GetIntervalPercentileTicks(0.99, progressLatencyBaseline!) / ticksPerMicrosecond
                 });
             }
         }
@@ -504,8 +650,15 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             });
         }
 
+        // Catch IOs that are stuck right now, before cancellation completes them
+        if (slowIos is { TracksStuck: true })
+        {
+            ScanForStuckIos(slots, slowIos, Stopwatch.GetTimestamp());
+        }
+
         // Drain pending IOs
-        DrainPendingIos(fileHandle, iocpHandle, slotPool, completionEntries, cancellationToken);
+        DrainPendingIos(fileHandles, iocpHandle, slots, completionEntries, observer, cancellationToken);
+        AbandonDeferred();
 
         // Track allocations
         if (spec.TrackAllocations)
@@ -526,20 +679,10 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
         var actualDuration = TimeSpan.FromSeconds((double)(actualEnd - measuredStart) / Stopwatch.Frequency);
 
         // Build time series samples
-        List<Core.TimeSeriesSample>? timeSeries = null;
+        IReadOnlyList<Core.TimeSeriesSample>? timeSeries = null;
         if (spec.CollectTimeSeries && metrics.TimeSeries != null)
         {
-            var snapshot = metrics.TimeSeries.CreateSnapshot();
-            timeSeries = new List<Core.TimeSeriesSample>();
-            foreach (var sample in snapshot.Samples)
-            {
-                timeSeries.Add(new Core.TimeSeriesSample
-                {
-                    SecondOffset = sample.SecondOffset,
-                    Bytes = sample.Bytes,
-                    Operations = sample.Operations
-                });
-            }
+            timeSeries = Core.TimeSeriesSample.FromTimeSeries(metrics.TimeSeries, ticksPerMicrosecond);
         }
 
         return new TrialResult
@@ -550,34 +693,217 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             ReadOperations = metrics.ReadOperations,
             WriteOperations = metrics.WriteOperations,
             Duration = actualDuration,
+            MeasuredStartTimestamp = measuredStart,
             Latency = LatencyPercentiles.FromHistogram(metrics.Histogram, ticksPerMicrosecond),
+            Histogram = metrics.Histogram.CreateSnapshot(),
             TimeSeries = timeSeries,
             AllocatedBytes = spec.TrackAllocations ? allocsAfter - allocsBefore : null,
+            SlowIos = slowIos != null ? SlowIoReport.FromTracker(slowIos, measuredStart, ticksPerMicrosecond) : null,
+            TracePath = spec.TracePath,
+            Errors = errorStats != null ? IoErrorSummary.FromStats(errorStats, ticksPerMicrosecond) : null,
+            Placement = placement,
             Warnings = warnings.Count > 0 ? warnings : null
         };
+
+        void CompleteIo(IoSlot slot, int bytesTransferred, long now)
+        {
+            observer?.OnCompleted(slot.Offset, slot.IsWrite, slot.GetData(bytesTransferred));
+
+            // Latency runs from the first attempt, so retries and held-back completions count in full
+            if (inMeasuredPhase)
+            {
+                long latencyTicks = now - slot.FirstSubmitTimestamp;
+                metrics.RecordCompletion(now, latencyTicks, bytesTransferred, slot.IsWrite);
+                slowIos?.RecordCompletion(slot.Offset, bytesTransferred, slot.IsWrite, slot.Index, slot.FirstSubmitTimestamp, now);
+                trace?.Append(slot.Offset, bytesTransferred, slot.IsWrite, slot.FirstSubmitTimestamp, now, traceThread);
+
+                if (errorStats != null)
+                {
+                    if (slot.Attempt > 0)
+                    {
+                        errorStats.RecordRecovered(latencyTicks);
+                    }
+
+                    if (bytesTransferred < slot.Size)
+                    {
+                        errorStats.RecordShortTransfer();
+                    }
+                }
+            }
+
+            // Re-issue IO if we're still running
+            if (CanIssue(now))
+            {
+                IssueNext(slot);
+            }
+        }
+
+        bool CanIssue(long now) => now < measuredEnd && (spec.IoLimit == 0 || stream.Issued < spec.IoLimit);
+
+        void IssueNext(IoSlot slot)
+        {
+            long now = Stopwatch.GetTimestamp();
+            long thinkTimeTicks = ConfigureNextIo(slot, stream, now);
+            if (thinkTimeTicks > 0)
+            {
+                Defer(slot, DeferredIoAction.Submit, now + thinkTimeTicks);
+                return;
+            }
+
+            SubmitNew(slot);
+        }
+
+        void SubmitNew(IoSlot slot)
+        {
+            int error = SubmitIo(slot, fileHandles[slot.FileIndex]);
+            observer?.OnIssued(slot.Offset, slot.Size, slot.IsWrite);
+            if (error != 0)
+            {
+                HandleFailure(slot, error, Stopwatch.GetTimestamp());
+            }
+        }
+
+        void HandleFailure(IoSlot slot, int errorCode, long now)
+        {
+            if (!errorPolicy.ContinueOnError)
+            {
+                // Don't let the slot buffers be freed under IOs that are still in flight
+                observer?.OnAbandoned(slot.Offset, slot.IsWrite);
+                DrainPendingIos(fileHandles, iocpHandle, slots, completionEntries, observer, cancellationToken);
+                AbandonDeferred();
+                throw new Win32Exception(errorCode, slot.IsWrite ? "WriteFile failed" : "ReadFile failed");
+            }
+
+            if (inMeasuredPhase)
+            {
+                errorStats!.RecordError(errorCode);
+            }
+
+            if (slot.Attempt < errorPolicy.MaxRetries)
+            {
+                slot.Attempt++;
+                if (inMeasuredPhase)
+                {
+                    errorStats!.RecordRetry();
+                }
+
+                Defer(slot, DeferredIoAction.Retry, now + ToTicks(errorPolicy.DelayBeforeRetry(slot.Attempt)));
+                return;
+            }
+
+            if (inMeasuredPhase)
+            {
+                errorStats!.RecordFailed();
+            }
+
+            observer?.OnAbandoned(slot.Offset, slot.IsWrite);
+
+            // Replace the IO from the loop rather than recursing, in case every IO fails synchronously
+            Defer(slot, DeferredIoAction.Reissue, now);
+        }
+
+        void Defer(IoSlot slot, DeferredIoAction action, long until)
+        {
+            slot.DeferredAction = action;
+            slot.DeferredUntil = until;
+        }
+
+        void AbandonDeferred()
+        {
+            foreach (var slot in slots.GetDeferredSlots())
+            {
+                if (slot.DeferredAction is DeferredIoAction.Complete or DeferredIoAction.Retry)
+                {
+                    observer?.OnAbandoned(slot.Offset, slot.IsWrite);
+                }
+
+                slot.DeferredAction = DeferredIoAction.None;
+            }
+        }
+
+        void RunDeferred(long now)
+        {
+            foreach (var slot in slots.GetDeferredSlots())
+            {
+                var action = slot.DeferredAction;
+                if (slot.DeferredUntil > now ||
+                    (action == DeferredIoAction.Complete && stallUntil > now))
+                {
+                    continue;
+                }
+
+                slot.DeferredAction = DeferredIoAction.None;
+
+                if (action == DeferredIoAction.Complete)
+                {
+                    CompleteIo(slot, slot.DeferredBytes, now);
+                }
+                else if (action == DeferredIoAction.Retry)
+                {
+                    slot.SubmitTimestamp = now;
+                    slot.StuckReported = false;
+                    int error = SubmitIo(slot, fileHandles[slot.FileIndex]);
+                    if (error != 0)
+                    {
+                        HandleFailure(slot, error, now);
+                    }
+                }
+                else if (action == DeferredIoAction.Submit)
+                {
+                    // Latency runs from submission; the think time before it is not part of the IO
+                    slot.SubmitTimestamp = now;
+                    slot.FirstSubmitTimestamp = now;
+                    SubmitNew(slot);
+                }
+                else if (CanIssue(now))
+                {
+                    IssueNext(slot);
+                }
+            }
+        }
     }
 
-    private static void IssueIo(
-        IoSlot slot,
-        IntPtr fileHandle,
-        OffsetGenerator offsetGen,
-        int writeThreshold,
-        byte[] writeDecisions,
-        ref int writeDecisionIndex)
+    private static long ToTicks(TimeSpan duration) => (long)(duration.TotalSeconds * Stopwatch.Frequency);
+
+    private static void ScanForStuckIos(IoSlotTable slots, SlowIoTracker slowIos, long now)
+    {
+        foreach (var slot in slots.GetPendingSlots())
+        {
+            if (!slot.StuckReported && slowIos.IsStuck(slot.SubmitTimestamp, now))
+            {
+                slot.StuckReported = true;
+                slowIos.RecordStuck(slot.Offset, slot.Size, slot.IsWrite, slot.Index, slot.SubmitTimestamp, now);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Configures the slot for the next IO of the workload.
+    /// Returns the think time to wait before submitting it, in Stopwatch ticks.
+    /// </summary>
+    private static long ConfigureNextIo(IoSlot slot, IoStreamGenerator stream, long now)
     {
-        long offset = offsetGen.GetNextOffset();
-        bool isWrite = writeDecisions[writeDecisionIndex++ & 0xFFFF] < writeThreshold;
+        ref readonly var io = ref stream.NextIo();
 
-        slot.Configure(offset, slot.Size, isWrite, Stopwatch.GetTimestamp());
+        slot.Configure(io.Offset, io.Size, io.IsWrite, now);
+        slot.FileIndex = io.FileIndex;
+        return io.ThinkTimeTicks;
+    }
+
+    /// <summary>
+    /// Submits the slot's configured IO. Returns 0, or the Win32 error if the IO failed synchronously.
+    /// </summary>
+    internal static int SubmitIo(IoSlot slot, IntPtr fileHandle)
+    {
         slot.IsPending = true;
 
         // Update OVERLAPPED with slot index as internal data for fast lookup
         ref var overlapped = ref slot.Overlapped;
-        overlapped.OffsetLow = (int)(offset & 0xFFFFFFFF);
-        overlapped.OffsetHigh = (int)(offset >> 32);
+        overlapped.OffsetLow = (int)(slot.Offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (int)(slot.Offset >> 32);
 
         bool success;
-        if (isWrite)
+        if (slot.IsWrite)
         {
             success = NativeMethods.WriteFile(fileHandle, slot.Buffer, (uint)slot.Size, out _, ref overlapped);
         }
@@ -592,26 +918,32 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             if (error != NativeMethods.ERROR_IO_PENDING)
             {
                 slot.IsPending = false;
-                throw new Win32Exception(error, isWrite ? "WriteFile failed" : "ReadFile failed");
+                return error;
             }
         }
+
+        return 0;
     }
 
-    private static void DrainPendingIos(
-        IntPtr fileHandle,
+    internal static void DrainPendingIos(
+        ReadOnlySpan<IntPtr> fileHandles,
         IntPtr iocpHandle,
-        IoSlotPool slotPool,
+        IoSlotTable slots,
         OverlappedEntry[] completionEntries,
+        IIoObserver? observer,
         CancellationToken cancellationToken)
     {
         // Cancel all pending IOs
-        NativeMethods.CancelIoEx(fileHandle, IntPtr.Zero);
+        foreach (var fileHandle in fileHandles)
+        {
+            NativeMethods.CancelIoEx(fileHandle, IntPtr.Zero);
+        }
 
         // Wait for completions with timeout
         var drainStart = Stopwatch.GetTimestamp();
         var drainTimeout = Stopwatch.Frequency * 5; // 5 second timeout
 
-        while (slotPool.GetPendingCount() > 0 && !cancellationToken.IsCancellationRequested)
+        while (slots.PendingCount > 0 && !cancellationToken.IsCancellationRequested)
         {
             if (Stopwatch.GetTimestamp() - drainStart > drainTimeout)
             {
@@ -621,7 +953,7 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             bool gotCompletion = NativeMethods.GetQueuedCompletionStatusEx(
                 iocpHandle,
                 completionEntries,
-                (uint)slotPool.Count,
+                (uint)slots.Count,
                 out uint numCompleted,
                 100,
                 false);
@@ -630,16 +962,54 @@ public sealed class WindowsIoEngine : IBenchmarkEngine
             {
                 for (int i = 0; i < numCompleted; i++)
                 {
-                    var slot = slotPool.FindByOverlapped(completionEntries[i].Overlapped);
-                    if (slot != null)
+                    ref var entry = ref completionEntries[i];
+                    if (!slots.TryGetSlot(entry.Overlapped, out var slot) || !slot.IsPending)
+                    {
+                        continue;
+                    }
+
+                    slot.IsPending = false;
+                    if (observer != null)
                     {
-                        slot.IsPending = false;
+                        // IOs that beat the cancellation completed normally; their data is valid
+                        if (slot.CompletionError == 0 && entry.NumberOfBytesTransferred > 0)
+                        {
+                            observer.OnCompleted(slot.Offset, slot.IsWrite, slot.GetData((int)entry.NumberOfBytesTransferred));
+                        }
+                        else
+                        {
+                            observer.OnAbandoned(slot.Offset, slot.IsWrite);
+                        }
                     }
                 }
             }
         }
     }
 
+    /// <inheritdoc />
+    public Task<long> CopyFileAsync(CopyCase copyCase, string sourcePath, string destinationPath, CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(copyCase);
+        ArgumentException.ThrowIfNullOrWhiteSpace(sourcePath);
+        ArgumentException.ThrowIfNullOrWhiteSpace(destinationPath);
+
+        return copyCase.Strategy switch
+        {
+            CopyStrategy.Unbuffered => Task.Run(
+                () => WindowsFileCopy.CopyUnbuffered(sourcePath, destinationPath, copyCase.BlockSize, copyCase.QueueDepth, cancellationToken),
+                cancellationToken),
+            CopyStrategy.Clone => Task.Run(() => WindowsFileCopy.Clone(sourcePath, destinationPath, cancellationToken), cancellationToken),
+            _ => throw new NotSupportedException($"{copyCase.Strategy} copies are not implemented by the Windows engine.")
+        };
+    }
+
+    /// <inheritdoc />
+    public Task EvictFromCacheAsync(string path, CancellationToken cancellationToken = default)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(path);
+        return Task.Run(() => WindowsFileCopy.EvictFromCache(path), cancellationToken);
+    }
+
     /// <inheritdoc />
     public int GetSectorSize(string filePath)
     {
@@ -681,10 +1051,17 @@ public sealed class WindowsIoEngineOptions
     public bool RaiseThreadPriority { get; init; }
 
     /// <summary>
-    /// Core to pin the thread to (-1 = no pinning).
+    /// Processor to pin the IO thread to (-1 = no pinning). Processors beyond 64 are numbered
+    /// group * 64 + index within the group.
     /// </summary>
     public int PinToCore { get; init; } = -1;
 
+    /// <summary>
+    /// Whether to pin the IO thread to a processor chosen from the CPU topology
+    /// (see <see cref="WorkerPlacementPlanner"/>). Ignored when <see cref="PinToCore"/> is set.
+    /// </summary>
+    public bool AutoPlacement { get; init; }
+
     /// <summary>
     /// Whether to verify read data integrity.
     /// </summary>